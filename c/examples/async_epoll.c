@@ -0,0 +1,147 @@
+#define _GNU_SOURCE
+// Drives the async API from a plain epoll loop: one thread, many requests.
+// Usage: example_async_epoll DROPLET_ID...
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/timerfd.h>
+#include "digitalocean/client.h"
+#include "digitalocean/async.h"
+
+typedef struct {
+    int epoll_fd;
+    int timer_fd;
+    int completed;
+} loop_t;
+
+// Library -> loop: start, change or stop watching a socket
+static void on_socket(do_async_t *async, int fd, int events, void *userdata) {
+    (void)async;
+    loop_t *loop = userdata;
+    
+    if (events == 0) {
+        epoll_ctl(loop->epoll_fd, EPOLL_CTL_DEL, fd, NULL);
+        return;
+    }
+    
+    struct epoll_event ev = {0};
+    ev.data.fd = fd;
+    if (events & DO_ASYNC_READ) {
+        ev.events |= EPOLLIN;
+    }
+    if (events & DO_ASYNC_WRITE) {
+        ev.events |= EPOLLOUT;
+    }
+    
+    if (epoll_ctl(loop->epoll_fd, EPOLL_CTL_MOD, fd, &ev) != 0 && errno == ENOENT) {
+        epoll_ctl(loop->epoll_fd, EPOLL_CTL_ADD, fd, &ev);
+    }
+}
+
+// Library -> loop: arm or cancel the single timer
+static void on_timer(do_async_t *async, long timeout_ms, void *userdata) {
+    (void)async;
+    loop_t *loop = userdata;
+    
+    struct itimerspec spec = {0};
+    if (timeout_ms == 0) {
+        spec.it_value.tv_nsec = 1; // zero would disarm the timer
+    } else if (timeout_ms > 0) {
+        spec.it_value.tv_sec = timeout_ms / 1000;
+        spec.it_value.tv_nsec = (timeout_ms % 1000) * 1000000;
+    }
+    timerfd_settime(loop->timer_fd, 0, &spec, NULL);
+}
+
+static void on_droplet(do_async_t *async, do_result_t result, do_droplet_t *droplet, void *userdata) {
+    (void)async;
+    loop_t *loop = userdata;
+    loop->completed++;
+    
+    if (result != DO_SUCCESS) {
+        printf("error: %s\n", do_client_get_error_string(result));
+        return;
+    }
+    
+    printf("%u %s %s\n", droplet->id, droplet->name ? droplet->name : "-",
+           droplet->status ? droplet->status : "-");
+    do_droplet_free(droplet);
+    do_free(droplet);
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s DROPLET_ID...\n", argv[0]);
+        return 1;
+    }
+    
+    if (do_library_init() != DO_SUCCESS) {
+        fprintf(stderr, "Failed to initialize HTTP library\n");
+        return 1;
+    }
+    
+    do_client_t *client = do_client_new();
+    if (!client || do_client_init_from_config(client) != DO_SUCCESS) {
+        fprintf(stderr, "Failed to initialize client; is DIGITALOCEAN_TOKEN set?\n");
+        do_client_free(client);
+        do_library_cleanup();
+        return 1;
+    }
+    
+    loop_t loop = {0};
+    loop.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    loop.timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    struct epoll_event timer_ev = {.events = EPOLLIN, .data.fd = loop.timer_fd};
+    epoll_ctl(loop.epoll_fd, EPOLL_CTL_ADD, loop.timer_fd, &timer_ev);
+    
+    do_async_t *async = do_async_new(client, on_socket, on_timer, &loop);
+    if (!async) {
+        fprintf(stderr, "Failed to create async context\n");
+        return 1;
+    }
+    
+    // Every request is in flight at once; nothing below blocks on the network
+    for (int i = 1; i < argc; i++) {
+        do_async_get_droplet(async, (uint32_t)strtoul(argv[i], NULL, 10), on_droplet, &loop);
+    }
+    
+    while (do_async_pending(async) > 0) {
+        struct epoll_event events[64];
+        int n = epoll_wait(loop.epoll_fd, events, 64, -1);
+        if (n < 0 && errno != EINTR) {
+            perror("epoll_wait");
+            break;
+        }
+        
+        for (int i = 0; i < n; i++) {
+            if (events[i].data.fd == loop.timer_fd) {
+                uint64_t expirations;
+                if (read(loop.timer_fd, &expirations, sizeof(expirations)) > 0) {
+                    do_async_timeout(async);
+                }
+                continue;
+            }
+            
+            int ready = 0;
+            if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+                ready |= DO_ASYNC_READ;
+            }
+            if (events[i].events & (EPOLLOUT | EPOLLERR)) {
+                ready |= DO_ASYNC_WRITE;
+            }
+            do_async_socket_ready(async, events[i].data.fd, ready);
+        }
+    }
+    
+    printf("%d requests completed\n", loop.completed);
+    
+    do_async_free(async);
+    close(loop.timer_fd);
+    close(loop.epoll_fd);
+    do_client_free(client);
+    do_library_cleanup();
+    return 0;
+}
\ No newline at end of file
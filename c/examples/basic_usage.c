@@ -100,6 +100,7 @@ int main() {
     if (result == DO_SUCCESS) {
         printf("Created droplet: %s (ID: %u)\n", new_droplet->name, new_droplet->id);
         do_droplet_free(new_droplet);
+        do_free(new_droplet);
     } else {
         printf("Failed to create droplet: %s\n", do_client_get_error_string(result));
     }
@@ -0,0 +1,318 @@
+#define _GNU_SOURCE
+// Decodes droplet list pages with both JSON backends and reports the
+// throughput of each: cJSON parse plus decode against on-demand index plus
+// decode with every indexer this CPU has. Both must decode the same
+// droplets. Pages come from the files given, or are generated like the
+// API's at 200 (one page) and 5000 droplets.
+// Usage: json_bench [FILE...]
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <cjson/cjson.h>
+#include "digitalocean/client.h"
+#include "digitalocean/alloc.h"
+#include "json_internal.h"
+
+#define BENCH_MIN_SECONDS 0.5
+
+typedef struct {
+    char *data;
+    size_t len;
+    size_t capacity;
+} text_t;
+
+static void text_append(text_t *text, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+static void text_append(text_t *text, const char *format, ...) {
+    for (;;) {
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(text->data + text->len, text->capacity - text->len, format, args);
+        va_end(args);
+        if (n >= 0 && (size_t)n < text->capacity - text->len) {
+            text->len += (size_t)n;
+            return;
+        }
+        
+        text->capacity = text->capacity ? text->capacity * 2 : 65536;
+        text->data = realloc(text->data, text->capacity);
+        if (!text->data) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+}
+
+// A page shaped like GET /v2/droplets, escapes and all
+static text_t generate_page(int count) {
+    static const char *regions[] = {"nyc3", "sfo3", "ams3", "fra1"};
+    text_t text = {0};
+    text_append(&text, "{\"droplets\":[");
+    for (int i = 1; i <= count; i++) {
+        const char *region = regions[i % 4];
+        int vcpus = 1 + i % 4;
+        text_append(&text,
+                    "%s{\"id\":%d,\"name\":\"%s-%d\",\"memory\":%d,\"vcpus\":%d,\"disk\":%d,"
+                    "\"locked\":%s,\"status\":\"%s\",\"kernel\":null,"
+                    "\"created_at\":\"2026-%02d-14T09:%02d:11Z\","
+                    "\"features\":[\"monitoring\",\"ipv6\"],\"backup_ids\":[],"
+                    "\"next_backup_window\":null,\"snapshot_ids\":[%d],",
+                    i > 1 ? "," : "", i, i % 2 ? "web" : "db", i, 1024 * vcpus, vcpus, 25 * vcpus,
+                    i % 50 == 0 ? "true" : "false", i % 3 ? "active" : "off", 1 + i % 12, i % 60,
+                    1000 + i);
+        text_append(&text,
+                    "\"image\":{\"id\":15450%d,\"name\":\"24.04 (LTS) x64\","
+                    "\"distribution\":\"Ubuntu\",\"slug\":\"ubuntu-24-04-x64\",\"public\":true,"
+                    "\"regions\":[\"nyc3\",\"sfo3\",\"ams3\"],"
+                    "\"created_at\":\"2026-04-25T16:21:08Z\",\"min_disk_size\":7,"
+                    "\"type\":\"base\",\"size_gigabytes\":2.36,"
+                    "\"description\":\"Ubuntu 24.04 x64 \\\"noble\\\"\",\"tags\":[],"
+                    "\"status\":\"available\"},\"volume_ids\":[],",
+                    i % 10);
+        text_append(&text,
+                    "\"size\":{\"slug\":\"s-%dvcpu-%dgb\",\"memory\":%d,\"vcpus\":%d,"
+                    "\"disk\":%d,\"transfer\":%d.0,\"price_monthly\":%d.0,"
+                    "\"price_hourly\":0.0%d7,\"regions\":[\"ams3\",\"fra1\",\"nyc3\",\"sfo3\"],"
+                    "\"available\":true,\"description\":\"Basic\"},"
+                    "\"size_slug\":\"s-%dvcpu-%dgb\",",
+                    vcpus, vcpus, 1024 * vcpus, vcpus, 25 * vcpus, vcpus, 6 * vcpus, vcpus, vcpus,
+                    vcpus);
+        text_append(&text,
+                    "\"networks\":{\"v4\":[{\"ip_address\":\"10.1%d.%d.%d\","
+                    "\"netmask\":\"255.255.0.0\",\"gateway\":\"10.1%d.0.1\","
+                    "\"type\":\"private\"},{\"ip_address\":\"164.90.%d.%d\","
+                    "\"netmask\":\"255.255.240.0\",\"gateway\":\"164.90.%d.1\","
+                    "\"type\":\"public\"}],\"v6\":[{\"ip_address\":\"2604:a880:4:1d0::%x:%x\","
+                    "\"netmask\":64,\"gateway\":\"2604:a880:4:1d0::1\",\"type\":\"public\"}]},",
+                    i % 8, i / 256 % 256, i % 256, i % 8, i / 256 % 256, i % 256, i / 256 % 256,
+                    (unsigned)i, (unsigned)i * 7);
+        text_append(&text,
+                    "\"region\":{\"name\":\"%s\",\"slug\":\"%s\",\"features\":[\"backups\","
+                    "\"ipv6\",\"metadata\",\"install_agent\",\"storage\",\"image_transfer\"],"
+                    "\"available\":true,\"sizes\":[\"s-1vcpu-1gb\",\"s-1vcpu-2gb\","
+                    "\"s-2vcpu-4gb\",\"s-4vcpu-8gb\"]},"
+                    "\"tags\":[\"%s\",\"team:\\u00e9quipe-%d\"%s],"
+                    "\"vpc_uuid\":\"5a4981aa-%04x-4f4b-9f4b-%012x\"}",
+                    region, region, i % 2 ? "web" : "db", i % 7, i % 5 ? "" : ",\"prod\"",
+                    (unsigned)i % 65536, (unsigned)i);
+    }
+    text_append(&text, "],\"links\":{\"pages\":{}},\"meta\":{\"total\":%d}}", count);
+    return text;
+}
+
+static text_t read_page(const char *path) {
+    text_t text = {0};
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        perror(path);
+        exit(1);
+    }
+    
+    char buffer[65536];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text_append(&text, "%.*s", (int)n, buffer);
+    }
+    fclose(file);
+    return text;
+}
+
+static double now_seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec + (double)now.tv_nsec / 1e9;
+}
+
+static void free_droplets(do_droplet_t *droplets, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        do_droplet_free(&droplets[i]);
+    }
+    free(droplets);
+}
+
+// Decodes every droplet on the page with cJSON; NULL when it does not parse
+static do_droplet_t *decode_cjson(const text_t *text, size_t *count) {
+    cJSON *json = cJSON_Parse(text->data);
+    const cJSON *items = cJSON_GetObjectItemCaseSensitive(json, "droplets");
+    if (!cJSON_IsArray(items)) {
+        cJSON_Delete(json);
+        return NULL;
+    }
+    
+    *count = (size_t)cJSON_GetArraySize(items);
+    do_droplet_t *droplets = calloc(*count ? *count : 1, sizeof(do_droplet_t));
+    size_t i = 0;
+    const cJSON *item;
+    cJSON_ArrayForEach(item, items) {
+        json_parse_droplet(item, &droplets[i++]);
+    }
+    cJSON_Delete(json);
+    return droplets;
+}
+
+static do_droplet_t *decode_ondemand(json_od_doc_t *doc, const text_t *text, size_t *count) {
+    json_od_value_t root, items, item;
+    if (json_od_index(doc, text->data, text->len) != DO_SUCCESS || !json_od_root(doc, &root) ||
+        !json_od_find(&root, "droplets", &items) || !json_od_is_array(&items)) {
+        return NULL;
+    }
+    
+    *count = json_od_count(&items);
+    do_droplet_t *droplets = calloc(*count ? *count : 1, sizeof(do_droplet_t));
+    size_t i = 0;
+    for (bool more = json_od_first(&items, &item); more; more = json_od_next(&item)) {
+        json_od_parse_droplet(&item, &droplets[i++]);
+    }
+    return droplets;
+}
+
+static bool same_string(const char *a, const char *b) {
+    return (!a && !b) || (a && b && strcmp(a, b) == 0);
+}
+
+static bool same_strings(const do_string_array_t *a, const do_string_array_t *b) {
+    if (a->count != b->count) {
+        return false;
+    }
+    for (size_t i = 0; i < a->count; i++) {
+        if (!same_string(a->items[i], b->items[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool same_droplet(const do_droplet_t *a, const do_droplet_t *b) {
+    if (a->id != b->id || a->memory != b->memory || a->vcpus != b->vcpus || a->disk != b->disk ||
+        a->locked != b->locked || a->created_at != b->created_at || !same_string(a->name, b->name) ||
+        !same_string(a->status, b->status) || !same_string(a->size_slug, b->size_slug) ||
+        !same_string(a->vpc_uuid, b->vpc_uuid) || !same_strings(&a->features, &b->features) ||
+        !same_strings(&a->tags, &b->tags) || !same_strings(&a->volume_ids, &b->volume_ids)) {
+        return false;
+    }
+    if (!a->region != !b->region || !a->size != !b->size || !a->networks != !b->networks) {
+        return false;
+    }
+    if (a->region && (!same_string(a->region->slug, b->region->slug) ||
+                      !same_string(a->region->name, b->region->name) ||
+                      a->region->available != b->region->available ||
+                      !same_strings(&a->region->features, &b->region->features) ||
+                      !same_strings(&a->region->sizes, &b->region->sizes))) {
+        return false;
+    }
+    if (a->size && (!same_string(a->size->slug, b->size->slug) ||
+                    a->size->memory != b->size->memory ||
+                    a->size->price_monthly != b->size->price_monthly ||
+                    a->size->price_hourly != b->size->price_hourly ||
+                    !same_strings(&a->size->regions, &b->size->regions))) {
+        return false;
+    }
+    if (a->networks) {
+        if (a->networks->v4_count != b->networks->v4_count ||
+            a->networks->v6_count != b->networks->v6_count) {
+            return false;
+        }
+        for (size_t i = 0; i < a->networks->v4_count; i++) {
+            const do_network_v4_t *x = &a->networks->v4[i], *y = &b->networks->v4[i];
+            if (!same_string(x->ip_address, y->ip_address) || !same_string(x->type, y->type) ||
+                !same_string(x->gateway, y->gateway)) {
+                return false;
+            }
+        }
+        for (size_t i = 0; i < a->networks->v6_count; i++) {
+            const do_network_v6_t *x = &a->networks->v6[i], *y = &b->networks->v6[i];
+            if (!same_string(x->ip_address, y->ip_address) || x->netmask != y->netmask) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static void report(const char *label, const char *backend, size_t bytes, size_t droplets,
+                   long runs, double seconds) {
+    printf("%-16s %-10s %9.1f MB/s %12.0f droplets/s\n", label, backend,
+           (double)bytes * (double)runs / seconds / 1e6, (double)droplets * (double)runs / seconds);
+}
+
+static int bench(const char *label, const text_t *text) {
+    size_t cjson_count = 0, od_count = 0;
+    json_od_doc_t doc = {0};
+    do_droplet_t *expected = decode_cjson(text, &cjson_count);
+    do_droplet_t *actual = decode_ondemand(&doc, text, &od_count);
+    if (!expected || !actual || cjson_count != od_count) {
+        fprintf(stderr, "%s: the backends disagree on the page\n", label);
+        return 1;
+    }
+    for (size_t i = 0; i < cjson_count; i++) {
+        if (!same_droplet(&expected[i], &actual[i])) {
+            fprintf(stderr, "%s: droplet %zu decodes differently\n", label, i);
+            return 1;
+        }
+    }
+    free_droplets(expected, cjson_count);
+    free_droplets(actual, od_count);
+    
+    long runs = 0;
+    double start = now_seconds(), elapsed;
+    do {
+        size_t count = 0;
+        free_droplets(decode_cjson(text, &count), count);
+        runs++;
+    } while ((elapsed = now_seconds() - start) < BENCH_MIN_SECONDS);
+    report(label, "cjson", text->len, cjson_count, runs, elapsed);
+    
+    static const char *indexers[] = {"scalar", "sse4.2", "avx2"};
+    for (size_t i = 0; i < sizeof(indexers) / sizeof(indexers[0]); i++) {
+        if (!json_od_use_backend(indexers[i])) {
+            continue;
+        }
+        
+        runs = 0;
+        start = now_seconds();
+        do {
+            size_t count = 0;
+            free_droplets(decode_ondemand(&doc, text, &count), count);
+            runs++;
+        } while ((elapsed = now_seconds() - start) < BENCH_MIN_SECONDS);
+        report(label, indexers[i], text->len, od_count, runs, elapsed);
+        
+        // The structural pass alone, which is all the SIMD speeds up
+        runs = 0;
+        start = now_seconds();
+        do {
+            json_od_index(&doc, text->data, text->len);
+            runs++;
+        } while ((elapsed = now_seconds() - start) < BENCH_MIN_SECONDS);
+        char index_label[32];
+        snprintf(index_label, sizeof(index_label), "%s idx", indexers[i]);
+        report(label, index_label, text->len, od_count, runs, elapsed);
+    }
+    
+    json_od_doc_free(&doc);
+    return 0;
+}
+
+int main(int argc, char *argv[]) {
+    int failed = 0;
+    if (argc > 1) {
+        for (int i = 1; i < argc; i++) {
+            text_t text = read_page(argv[i]);
+            failed |= bench(argv[i], &text);
+            free(text.data);
+        }
+        return failed;
+    }
+    
+    static const int sizes[] = {200, 5000};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        char label[32];
+        snprintf(label, sizeof(label), "%d droplets", sizes[i]);
+        text_t text = generate_page(sizes[i]);
+        failed |= bench(label, &text);
+        free(text.data);
+    }
+    return failed;
+}
\ No newline at end of file
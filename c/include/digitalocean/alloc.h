@@ -0,0 +1,52 @@
+#ifndef DIGITALOCEAN_ALLOC_H
+#define DIGITALOCEAN_ALLOC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Allocator used for every allocation the library, cJSON and libcurl make.
+// ctx is passed back to each hook unchanged.
+typedef struct {
+    void *(*malloc_fn)(size_t size, void *ctx);
+    void *(*realloc_fn)(void *ptr, size_t size, void *ctx);
+    void (*free_fn)(void *ptr, void *ctx);
+    void *ctx;
+} do_allocator_t;
+
+// Installs the allocator; NULL restores the libc default. Call it before
+// do_library_init() and before any other library call, since memory must
+// be freed by the allocator that allocated it.
+do_result_t do_set_allocator(const do_allocator_t *allocator);
+const do_allocator_t *do_get_allocator(void);
+
+// Allocation entry points used throughout the library. Strings and objects
+// the library hands back are released with do_free() or their _free call.
+void *do_malloc(size_t size);
+void *do_calloc(size_t count, size_t size);
+void *do_realloc(void *ptr, size_t size);
+void do_free(void *ptr);
+char *do_strdup(const char *str);
+
+// Built-in counting allocator for profiling, layered over libc malloc
+typedef struct {
+    uint64_t allocations;
+    uint64_t reallocations;
+    uint64_t frees;
+    uint64_t bytes_allocated; // total requested over the process lifetime
+    int64_t live_bytes;
+    int64_t peak_bytes;
+} do_alloc_stats_t;
+
+const do_allocator_t *do_counting_allocator(void);
+void do_counting_allocator_stats(do_alloc_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DIGITALOCEAN_ALLOC_H
\ No newline at end of file
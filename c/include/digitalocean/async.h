@@ -0,0 +1,72 @@
+#ifndef DIGITALOCEAN_ASYNC_H
+#define DIGITALOCEAN_ASYNC_H
+
+#include "types.h"
+#include "client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Non-blocking requests driven by the host's event loop. The library says
+// which sockets to watch through the socket callback and when it next needs
+// to run through the timer callback; the host calls do_async_socket_ready()
+// when a watched socket is ready and do_async_timeout() when the timer
+// fires. All calls must come from the thread running the loop.
+typedef struct do_async do_async_t;
+
+#define DO_ASYNC_READ 0x1
+#define DO_ASYNC_WRITE 0x2
+
+// events is a mask of DO_ASYNC_READ/DO_ASYNC_WRITE to watch fd for, or 0 to
+// stop watching it
+typedef void (*do_async_socket_callback_t)(do_async_t *async, int fd, int events, void *userdata);
+
+// Arms the timer: fire after timeout_ms (0 means as soon as possible), or
+// cancel it when timeout_ms is -1
+typedef void (*do_async_timer_callback_t)(do_async_t *async, long timeout_ms, void *userdata);
+
+typedef struct {
+    do_result_t result;       // transport failure, or the HTTP status mapped to a result
+    long status_code;
+    const char *body;         // NUL-terminated; valid only during the callback
+    size_t body_size;
+    const do_request_timing_t *timing;
+} do_async_response_t;
+
+typedef void (*do_async_callback_t)(do_async_t *async, const do_async_response_t *response,
+                                    void *userdata);
+
+// droplet is owned by the callback and NULL unless result is DO_SUCCESS
+typedef void (*do_async_droplet_callback_t)(do_async_t *async, do_result_t result,
+                                            do_droplet_t *droplet, void *userdata);
+
+// The client supplies configuration and credentials and must outlive the
+// async context. Connections are shared by every request on the context.
+do_async_t *do_async_new(do_client_t *client, do_async_socket_callback_t socket_fn,
+                         do_async_timer_callback_t timer_fn, void *userdata);
+
+// Abandons requests still in flight without calling their callbacks. The
+// socket callback may be called while their sockets are closed. Do not
+// call from inside a request callback.
+void do_async_free(do_async_t *async);
+
+// Queues a request; the callback runs from do_async_socket_ready() or
+// do_async_timeout() once it completes. body may be NULL and is copied.
+do_result_t do_async_request(do_async_t *async, const char *method, const char *path,
+                             const char *body, do_async_callback_t callback, void *userdata);
+do_result_t do_async_get_droplet(do_async_t *async, uint32_t id,
+                                 do_async_droplet_callback_t callback, void *userdata);
+
+// Event loop entry points; events uses DO_ASYNC_READ/DO_ASYNC_WRITE
+do_result_t do_async_socket_ready(do_async_t *async, int fd, int events);
+do_result_t do_async_timeout(do_async_t *async);
+
+// Requests queued or in flight
+size_t do_async_pending(const do_async_t *async);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DIGITALOCEAN_ASYNC_H
\ No newline at end of file
@@ -0,0 +1,113 @@
+#ifndef DIGITALOCEAN_CATALOG_H
+#define DIGITALOCEAN_CATALOG_H
+
+#include "types.h"
+#include "client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Sizes, regions and distribution images, with where each size and image
+// can be created. They change rarely but are large to list, so answers
+// come from a local catalog. The library carries a snapshot compiled in
+// at build time (scripts/gen_catalog.py). A fresher copy is kept in the
+// config directory and refetched once it is older than a TTL. Lookups by
+// slug are hash probes and availability is a bit test, so no query
+// touches the network.
+typedef struct do_catalog do_catalog_t;
+
+// Records point into the catalog and live as long as it does. slug comes
+// first in each.
+typedef struct {
+    const char *slug;
+    const char *name;
+    bool available;       // accepting new droplets
+} do_catalog_region_t;
+
+typedef struct {
+    const char *slug;
+    uint32_t memory;      // MB
+    uint32_t vcpus;
+    uint32_t disk;        // GB
+    double transfer;      // TB
+    double price_monthly;
+    double price_hourly;
+    bool available;
+} do_catalog_size_t;
+
+typedef struct {
+    const char *slug;
+    const char *name;
+    const char *distribution;
+    uint32_t id;
+    uint32_t min_disk_size; // GB
+} do_catalog_image_t;
+
+#define DO_CATALOG_DEFAULT_TTL (24 * 60 * 60)
+#define DO_CATALOG_OFFLINE (-1) // as a TTL: never fetch
+
+// The snapshot built into the library; never NULL and never freed
+const do_catalog_t *do_catalog_builtin(void);
+
+// "catalog.json" in the config directory, from do_malloc()
+char *do_catalog_default_path(void);
+
+// Fetches /v2/regions, /v2/sizes and /v2/images?type=distribution, all
+// three at once
+do_result_t do_catalog_fetch(do_client_t *client, do_catalog_t **catalog);
+
+// A catalog saved by do_catalog_save(); DO_ERROR_NOT_FOUND when the file
+// does not exist, DO_ERROR_JSON when it is damaged. Saving replaces the
+// file atomically.
+do_result_t do_catalog_load(const char *path, do_catalog_t **catalog);
+do_result_t do_catalog_save(const do_catalog_t *catalog, const char *path);
+
+// Does nothing for the built-in snapshot
+void do_catalog_free(do_catalog_t *catalog);
+
+// The client's catalog: the newer of the saved copy and the built-in
+// snapshot while it is younger than ttl seconds, otherwise a fresh fetch,
+// which is saved. If the fetch fails, the older catalog is still set and
+// the failure is returned. With DO_CATALOG_OFFLINE nothing is fetched.
+// The catalog belongs to the client.
+do_result_t do_client_catalog(do_client_t *client, int64_t ttl, const do_catalog_t **catalog);
+
+// Unix time of the listing the catalog was built from; 0 when it was not
+// fetched, as for a hand-curated built-in snapshot, which is then always
+// past its TTL and loses to any saved copy
+int64_t do_catalog_fetched_at(const do_catalog_t *catalog);
+
+size_t do_catalog_region_count(const do_catalog_t *catalog);
+size_t do_catalog_size_count(const do_catalog_t *catalog);
+size_t do_catalog_image_count(const do_catalog_t *catalog);
+const do_catalog_region_t *do_catalog_region_at(const do_catalog_t *catalog, size_t index);
+const do_catalog_size_t *do_catalog_size_at(const do_catalog_t *catalog, size_t index);
+const do_catalog_image_t *do_catalog_image_at(const do_catalog_t *catalog, size_t index);
+
+// NULL when the catalog has no such slug
+const do_catalog_region_t *do_catalog_find_region(const do_catalog_t *catalog, const char *slug);
+const do_catalog_size_t *do_catalog_find_size(const do_catalog_t *catalog, const char *slug);
+const do_catalog_image_t *do_catalog_find_image(const do_catalog_t *catalog, const char *slug);
+
+// Whether a droplet of the size, or from the image, can be created in the
+// region now. Both the size and the region have to be available.
+bool do_catalog_size_available(const do_catalog_t *catalog, const char *size, const char *region);
+bool do_catalog_image_available(const do_catalog_t *catalog, const char *image, const char *region);
+
+// Checks a create request's region, size and image before it is sent. An
+// image given by ID, or by a slug outside the catalog (an application
+// image, say), is left to the API, and so are a region or size the
+// catalog does not know, since they may be newer than it: the request
+// passes and error holds a note naming the slug, to show as a warning.
+// error is empty when there is nothing to note. Returns
+// DO_ERROR_INVALID_PARAM with the reason in error (which may be NULL).
+do_result_t do_catalog_validate_droplet(const do_catalog_t *catalog,
+                                        const do_create_droplet_request_t *request,
+                                        char *error, size_t error_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DIGITALOCEAN_CATALOG_H
\ No newline at end of file
@@ -4,15 +4,28 @@
 #include "types.h"
 #include "config.h"
 #include "http.h"
+#include "metrics.h"
+#include "alloc.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Called after every API request with its timing breakdown
+typedef void (*do_timing_callback_t)(const do_request_timing_t *timing, void *userdata);
+
 typedef struct {
     do_config_t *config;
     do_http_client_t *http_client;
     char *auth_header;
+    do_timing_callback_t timing_callback;
+    void *timing_userdata;
+    do_string_t request_body; // reused buffer for serialized request bodies
+    do_http_client_t *cursor_http_client; // kept warm for list cursors
+    bool cursor_http_busy;
+    do_rate_budget_t *rate_budget; // see do_client_share_rate_limit()
+    char *tls_session_path; // see do_client_persist_tls_sessions()
+    const struct do_catalog *catalog; // see do_client_catalog()
 } do_client_t;
 
 // Client lifecycle
@@ -22,20 +35,215 @@ void do_client_free(do_client_t *client);
 do_result_t do_client_init(do_client_t *client, do_config_t *config);
 do_result_t do_client_init_from_config(do_client_t *client);
 
+// Timing hook; pass NULL to disable. For list calls decode time includes
+// the time spent in the visitor.
+void do_client_set_timing_callback(do_client_t *client, do_timing_callback_t callback,
+                                   void *userdata);
+
+// Opts in to a rate-limit budget shared with every other process on the
+// host that does the same for this token. It lives in a file mapped from
+// the config directory and is updated lock-free from each response's
+// RateLimit-* headers. Each request then takes its share before it is
+// sent: requests are spaced to stay within DO_RATE_LIMIT_PER_MINUTE across
+// the host, and once the hourly budget is spent they fail with
+// DO_ERROR_RATE_LIMIT until it resets instead of drawing 429s. Async
+// requests never wait; they fail with DO_ERROR_RATE_LIMIT instead.
+do_result_t do_client_share_rate_limit(do_client_t *client);
+
+// Starts connecting to the API in the background: DNS, TCP and TLS for
+// the base URL, on both the client's handle and the one list cursors
+// borrow, since either may carry the first request. Call it as soon as the
+// client is initialized; whatever the caller does before its first request
+// then overlaps the handshake. That request waits for the connection if it
+// is still being set up, and connects as usual if it could not be.
+do_result_t do_client_warm_up(do_client_t *client);
+
+// Keeps TLS sessions in a file (path, or "tls-sessions" in the config
+// directory when NULL) so the next process resumes its handshake with the
+// API instead of doing a full one. Sessions in the file are loaded now and
+// the client's are written back when it is freed. Call it before
+// do_client_warm_up() so the warm-up resumes too. Needs libcurl 8.12 or
+// later built with session export; DO_ERROR_CONFIG otherwise.
+do_result_t do_client_persist_tls_sessions(do_client_t *client, const char *path);
+
 // Account operations
 do_result_t do_client_get_account(do_client_t *client, do_account_t **account);
 
+// Streaming list iteration: the visitor sees each item as its page is
+// decoded and must copy anything it keeps. Returning anything other than
+// DO_SUCCESS stops the walk and is passed back to the caller.
+typedef struct {
+    size_t index;       // position in the whole listing
+    size_t page_index;  // position within the current page
+    size_t page_count;  // items in the current page
+    uint32_t total;     // total reported by the API
+} do_list_position_t;
+
+typedef do_result_t (*do_droplet_visitor_t)(const do_droplet_t *droplet,
+                                            const do_list_position_t *position,
+                                            void *userdata);
+
 // Droplet operations
 do_result_t do_client_list_droplets(do_client_t *client, do_droplet_list_t **droplets);
+do_result_t do_client_list_droplets_each(do_client_t *client, do_droplet_visitor_t visitor,
+                                         void *userdata);
 do_result_t do_client_get_droplet(do_client_t *client, uint32_t id, do_droplet_t **droplet);
+
+// Page-at-a-time cursor over any list endpoint. While the caller works
+// through one page, the next is fetched and decoded on a background
+// thread, so a sequential walk waits about one round trip in total rather
+// than one per page. At most two pages are held: the current and the next.
+// The cursor has its own connection, so the client stays free for other
+// calls in the meantime. The timing callback runs from do_cursor_next().
+typedef struct do_list_cursor do_list_cursor_t;
+
+// Describes a list endpoint: where it lives, which member holds the items
+// and how to decode one into a zeroed item_size block
+struct cJSON;
+typedef struct {
+    const char *endpoint;
+    const char *collection_key;
+    size_t item_size;
+    do_result_t (*decode)(const struct cJSON *json, void *item);
+    void (*free_item)(void *item); // releases what decode filled in
+} do_list_type_t;
+
+extern const do_list_type_t do_list_droplets; // items are do_droplet_t
+
+// Items are do_droplet_view_t: the listing fields with every string a view
+// into the page's response text. Nothing is copied or allocated per field,
+// and escapes are decoded only when a view is copied. Pages are indexed
+// with the on-demand parser whichever JSON backend is selected.
+extern const do_list_type_t do_list_droplet_views;
+
+do_result_t do_cursor_open(do_client_t *client, const do_list_type_t *type,
+                           do_list_cursor_t **cursor);
+
+// Narrows a listing: query ("name=value&...", may be NULL) is added to the
+// endpoint's query string, and only items for which keep returns true are
+// decoded. keep sees the item's JSON, runs on the prefetch thread and may
+// be NULL. Pages with no matches are skipped, so a 0 count still means
+// the end.
+typedef bool (*do_list_predicate_t)(const struct cJSON *json, void *userdata);
+do_result_t do_cursor_open_filtered(do_client_t *client, const do_list_type_t *type,
+                                    const char *query, do_list_predicate_t keep, void *userdata,
+                                    do_list_cursor_t **cursor);
+
+// Points *items at the next page of *count decoded items, valid until the
+// next call or close. *count is 0 once the listing is exhausted. A failed
+// page ends the walk and its result is returned from then on.
+do_result_t do_cursor_next(do_list_cursor_t *cursor, const void **items, size_t *count);
+
+// Total reported by the API; 0 until the first page has been returned
+uint32_t do_cursor_total(const do_list_cursor_t *cursor);
+
+// Stops a prefetch in flight and frees everything, including the last page
+void do_cursor_close(do_list_cursor_t *cursor);
+
+// The response text and views of a do_list_droplet_views page, counted by
+// reference. do_cursor_retain_page() keeps the page do_cursor_next() last
+// returned alive past the next call and the cursor's close, until the
+// reference is released; NULL for other cursors. References may be
+// released from any thread.
+typedef struct do_page_buffer do_page_buffer_t;
+do_page_buffer_t *do_cursor_retain_page(do_list_cursor_t *cursor);
+do_page_buffer_t *do_page_buffer_retain(do_page_buffer_t *page);
+void do_page_buffer_release(do_page_buffer_t *page);
+
+// Incremental refresh for polling: re-lists droplets but decodes only those
+// whose JSON changed since the previous refresh. Unchanged structs are kept
+// as they are, though their position in items can shift. Pass *list as
+// NULL to start from scratch. A list from do_client_list_droplets() has no
+// hashes yet, so its first refresh re-decodes everything and reports only
+// additions and removals. changes may be NULL; otherwise free it with
+// do_droplet_changes_free(). On failure the list is left unchanged.
+do_result_t do_droplet_list_refresh(do_client_t *client, do_droplet_list_t **list,
+                                    do_droplet_changes_t *changes);
 do_result_t do_client_create_droplet(do_client_t *client, 
                                      const do_create_droplet_request_t *request,
                                      do_droplet_t **droplet);
 do_result_t do_client_delete_droplet(do_client_t *client, uint32_t id);
 
+// Droplet actions: the types that can be applied to one droplet or to
+// every droplet with a tag
+typedef enum {
+    DO_DROPLET_ACTION_POWER_CYCLE,
+    DO_DROPLET_ACTION_POWER_ON,
+    DO_DROPLET_ACTION_POWER_OFF,
+    DO_DROPLET_ACTION_SHUTDOWN,
+    DO_DROPLET_ACTION_ENABLE_BACKUPS,
+    DO_DROPLET_ACTION_DISABLE_BACKUPS,
+    DO_DROPLET_ACTION_ENABLE_IPV6,
+    DO_DROPLET_ACTION_ENABLE_PRIVATE_NETWORKING,
+    DO_DROPLET_ACTION_SNAPSHOT,
+    DO_DROPLET_ACTION_TYPE_COUNT
+} do_droplet_action_type_t;
+
+// The API's names: "power_cycle", "snapshot", ...
+const char *do_droplet_action_type_name(do_droplet_action_type_t type);
+bool do_droplet_action_type_parse(const char *name, do_droplet_action_type_t *type);
+
+// snapshot_name is used by DO_DROPLET_ACTION_SNAPSHOT and may be NULL to
+// let the API pick one. Free the result with do_action_free() + do_free().
+do_result_t do_client_droplet_action(do_client_t *client, uint32_t id,
+                                     do_droplet_action_type_t type, const char *snapshot_name,
+                                     do_action_t **action);
+
+// Applies the action to every droplet tagged tag in one request, costing
+// one rate-limit token however many droplets match. The API starts one
+// action per droplet; all of them are returned.
+do_result_t do_client_droplet_action_by_tag(do_client_t *client, const char *tag,
+                                            do_droplet_action_type_t type,
+                                            const char *snapshot_name,
+                                            do_action_list_t **actions);
+
+// Tag operations. Creating a tag that already exists succeeds.
+do_result_t do_client_create_tag(do_client_t *client, const char *name);
+
+// Bulk tagging through /v2/tags/{tag}/resources. resource_type is
+// "droplet", "image", "volume" or "volume_snapshot"; IDs are given as
+// strings since volumes use UUIDs. Any number of IDs may be passed: they
+// are sent DO_TAG_CHUNK_SIZE to a request with up to
+// DO_TAG_MAX_CONCURRENCY requests in flight. Chunks succeed or fail on
+// their own, so after a failure some resources may already be (un)tagged;
+// both calls are idempotent and can simply be repeated. The first failure
+// is returned once every chunk has been sent.
+#define DO_TAG_CHUNK_SIZE 200
+#define DO_TAG_MAX_CONCURRENCY 8
+
+do_result_t do_client_tag_resources(do_client_t *client, const char *tag,
+                                    const char *resource_type, const char *const *resource_ids,
+                                    size_t count);
+do_result_t do_client_untag_resources(do_client_t *client, const char *tag,
+                                      const char *resource_type, const char *const *resource_ids,
+                                      size_t count);
+
+// Raw passthrough: streams the response body for any endpoint to fd as it
+// arrives, without buffering or parsing it. Non-2xx bodies are still
+// written and the status is mapped to a result code. With DO_RAW_PAGINATE
+// a GET follows links.pages.next and writes one page per line (NDJSON).
+#define DO_RAW_PAGINATE 0x1
+
+do_result_t do_client_raw(do_client_t *client, const char *method, const char *path,
+                          const char *body, int fd, unsigned flags);
+
 // Error handling
 const char *do_client_get_error_string(do_result_t result);
 
+// JSON parser for list pages. The on-demand backend indexes each page in
+// one SIMD pass and decodes droplets straight from the response text
+// without building a tree; cJSON builds the tree first. The default is
+// on-demand unless the library was built with
+// DO_JSON_BACKEND_DEFAULT=DO_JSON_BACKEND_CJSON. Process-wide; set it
+// before requests are in flight.
+typedef enum {
+    DO_JSON_BACKEND_CJSON,
+    DO_JSON_BACKEND_ONDEMAND
+} do_json_backend_t;
+
+do_result_t do_set_json_backend(do_json_backend_t backend);
+do_json_backend_t do_get_json_backend(void);
+
 // Library initialization/cleanup
 do_result_t do_library_init(void);
 void do_library_cleanup(void);
@@ -22,6 +22,18 @@ void do_config_free(do_config_t *config);
 do_result_t do_config_load(do_config_t *config);
 do_result_t do_config_save(const do_config_t *config);
 
+// Named token profiles, stored in the config file as
+//
+//   [profile NAME]
+//   token=...
+//   base_url=...   (optional; defaults to the top-level base_url)
+//
+// Listing appends profile names to names in file order. Loading replaces
+// the token in config with the profile's; DIGITALOCEAN_BASE_URL still
+// overrides the base URL. DO_ERROR_NOT_FOUND if the profile has no token.
+do_result_t do_config_list_profiles(do_string_array_t *names);
+do_result_t do_config_load_profile(do_config_t *config, const char *name);
+
 do_result_t do_config_set_token(do_config_t *config, const char *token);
 do_result_t do_config_set_base_url(do_config_t *config, const char *base_url);
 
@@ -34,6 +46,7 @@ do_result_t do_config_validate(const do_config_t *config);
 // Utility functions
 char *do_config_get_config_dir(void);
 char *do_config_get_config_path(void);
+do_result_t do_config_ensure_config_dir(void);
 char *do_config_mask_token(const char *token);
 
 #ifdef __cplusplus
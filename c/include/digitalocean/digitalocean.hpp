@@ -0,0 +1,617 @@
+#ifndef DIGITALOCEAN_HPP
+#define DIGITALOCEAN_HPP
+
+// Header-only C++20 wrapper over the C API. Owning types are move-only and
+// release their C structs on destruction; accessors return views into the
+// C structs and never copy. Failures throw digitalocean::error.
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "client.h"
+#include "async.h"
+
+namespace digitalocean {
+
+class error : public std::runtime_error {
+public:
+    explicit error(do_result_t code)
+        : std::runtime_error(do_client_get_error_string(code)), code_(code) {}
+
+    do_result_t code() const noexcept { return code_; }
+
+private:
+    do_result_t code_;
+};
+
+namespace detail {
+
+inline void check(do_result_t result) {
+    if (result != DO_SUCCESS) {
+        throw error(result);
+    }
+}
+
+inline std::string_view view(const char *str) noexcept {
+    return str ? std::string_view(str) : std::string_view();
+}
+
+struct droplet_deleter {
+    void operator()(do_droplet_t *droplet) const noexcept {
+        do_droplet_free(droplet);
+        do_free(droplet);
+    }
+};
+
+struct droplet_list_deleter {
+    void operator()(do_droplet_list_t *list) const noexcept { do_droplet_list_free(list); }
+};
+
+struct account_deleter {
+    void operator()(do_account_t *account) const noexcept { do_account_free(account); }
+};
+
+struct client_deleter {
+    void operator()(do_client_t *client) const noexcept { do_client_free(client); }
+};
+
+struct async_deleter {
+    void operator()(do_async_t *async) const noexcept { do_async_free(async); }
+};
+
+// Blocks handed to the C library carry their size so they can be returned
+// to a memory_resource, which needs it on deallocation
+union pmr_header {
+    std::size_t size;
+    std::max_align_t align;
+};
+
+inline void *pmr_malloc(std::size_t size, void *ctx) {
+    auto *resource = static_cast<std::pmr::memory_resource *>(ctx);
+    if (size > SIZE_MAX - sizeof(pmr_header)) {
+        return nullptr;
+    }
+
+    try {
+        auto *header = static_cast<pmr_header *>(
+            resource->allocate(sizeof(pmr_header) + size, alignof(pmr_header)));
+        header->size = size;
+        return header + 1;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+inline void pmr_free(void *ptr, void *ctx) {
+    if (!ptr) {
+        return;
+    }
+
+    auto *resource = static_cast<std::pmr::memory_resource *>(ctx);
+    auto *header = static_cast<pmr_header *>(ptr) - 1;
+    resource->deallocate(header, sizeof(pmr_header) + header->size, alignof(pmr_header));
+}
+
+// memory_resource has no resize, so grow by copying
+inline void *pmr_realloc(void *ptr, std::size_t size, void *ctx) {
+    if (!ptr) {
+        return pmr_malloc(size, ctx);
+    }
+
+    void *grown = pmr_malloc(size, ctx);
+    if (grown) {
+        std::size_t old_size = (static_cast<pmr_header *>(ptr) - 1)->size;
+        std::memcpy(grown, ptr, old_size < size ? old_size : size);
+        pmr_free(ptr, ctx);
+    }
+    return grown;
+}
+
+} // namespace detail
+
+// Routes every allocation of the library, cJSON and libcurl through
+// resource, or back to libc for nullptr. Same rules as do_set_allocator():
+// call it before library and keep the resource alive until after it.
+inline void use_memory_resource(std::pmr::memory_resource *resource) {
+    if (!resource) {
+        detail::check(do_set_allocator(nullptr));
+        return;
+    }
+
+    do_allocator_t allocator = {detail::pmr_malloc, detail::pmr_realloc, detail::pmr_free, resource};
+    detail::check(do_set_allocator(&allocator));
+}
+
+// Initializes libcurl for the lifetime of the object
+class library {
+public:
+    library() { detail::check(do_library_init()); }
+    ~library() { do_library_cleanup(); }
+
+    library(const library &) = delete;
+    library &operator=(const library &) = delete;
+};
+
+// Random-access view of a do_string_array_t as string_views
+class string_array_view {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::string_view;
+
+        iterator() = default;
+        explicit iterator(char *const *item) : item_(item) {}
+
+        std::string_view operator*() const noexcept { return detail::view(*item_); }
+        std::string_view operator[](difference_type n) const noexcept { return detail::view(item_[n]); }
+        iterator &operator++() noexcept { ++item_; return *this; }
+        iterator operator++(int) noexcept { return iterator(item_++); }
+        iterator &operator--() noexcept { --item_; return *this; }
+        iterator operator--(int) noexcept { return iterator(item_--); }
+        iterator &operator+=(difference_type n) noexcept { item_ += n; return *this; }
+        iterator &operator-=(difference_type n) noexcept { item_ -= n; return *this; }
+        friend iterator operator+(iterator it, difference_type n) noexcept { return it += n; }
+        friend iterator operator+(difference_type n, iterator it) noexcept { return it += n; }
+        friend iterator operator-(iterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(iterator a, iterator b) noexcept { return a.item_ - b.item_; }
+        friend auto operator<=>(iterator, iterator) = default;
+
+    private:
+        char *const *item_ = nullptr;
+    };
+
+    explicit string_array_view(const do_string_array_t &array) noexcept : array_(&array) {}
+
+    std::size_t size() const noexcept { return array_->count; }
+    bool empty() const noexcept { return array_->count == 0; }
+    std::string_view operator[](std::size_t i) const noexcept { return detail::view(array_->items[i]); }
+    iterator begin() const noexcept { return iterator(array_->items); }
+    iterator end() const noexcept { return iterator(array_->items + array_->count); }
+
+private:
+    const do_string_array_t *array_;
+};
+
+// Non-owning accessors for a droplet; valid while the droplet lives
+class droplet_view {
+public:
+    explicit droplet_view(const do_droplet_t &droplet) noexcept : droplet_(&droplet) {}
+
+    std::uint32_t id() const noexcept { return droplet_->id; }
+    std::string_view name() const noexcept { return detail::view(droplet_->name); }
+    std::string_view status() const noexcept { return detail::view(droplet_->status); }
+    std::uint32_t memory() const noexcept { return droplet_->memory; }
+    std::uint32_t vcpus() const noexcept { return droplet_->vcpus; }
+    std::uint32_t disk() const noexcept { return droplet_->disk; }
+    bool locked() const noexcept { return droplet_->locked; }
+    std::time_t created_at() const noexcept { return droplet_->created_at; }
+    std::string_view size_slug() const noexcept { return detail::view(droplet_->size_slug); }
+    std::string_view vpc_uuid() const noexcept { return detail::view(droplet_->vpc_uuid); }
+
+    std::string_view region_slug() const noexcept {
+        return droplet_->region ? detail::view(droplet_->region->slug) : std::string_view();
+    }
+
+    std::string_view image_slug() const noexcept {
+        return droplet_->image ? detail::view(droplet_->image->slug) : std::string_view();
+    }
+
+    // First address of the given type ("public" or "private"), if any
+    std::string_view ipv4(std::string_view type = "public") const noexcept {
+        if (!droplet_->networks) {
+            return {};
+        }
+        for (std::size_t i = 0; i < droplet_->networks->v4_count; i++) {
+            const do_network_v4_t &network = droplet_->networks->v4[i];
+            if (detail::view(network.type) == type) {
+                return detail::view(network.ip_address);
+            }
+        }
+        return {};
+    }
+
+    string_array_view tags() const noexcept { return string_array_view(droplet_->tags); }
+    string_array_view features() const noexcept { return string_array_view(droplet_->features); }
+    string_array_view volume_ids() const noexcept { return string_array_view(droplet_->volume_ids); }
+
+    std::span<const std::uint32_t> backup_ids() const noexcept {
+        return {droplet_->backup_ids, droplet_->backup_ids ? droplet_->backup_ids_count : 0};
+    }
+
+    std::span<const std::uint32_t> snapshot_ids() const noexcept {
+        return {droplet_->snapshot_ids, droplet_->snapshot_ids ? droplet_->snapshot_ids_count : 0};
+    }
+
+    const do_droplet_t &raw() const noexcept { return *droplet_; }
+
+private:
+    const do_droplet_t *droplet_;
+};
+
+class droplet {
+public:
+    explicit droplet(do_droplet_t *droplet) noexcept : droplet_(droplet) {}
+
+    droplet_view view() const noexcept { return droplet_view(*droplet_); }
+    operator droplet_view() const noexcept { return view(); }
+    const do_droplet_t *get() const noexcept { return droplet_.get(); }
+
+private:
+    std::unique_ptr<do_droplet_t, detail::droplet_deleter> droplet_;
+};
+
+class droplet_list {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = droplet_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = droplet_view;
+
+        iterator() = default;
+        explicit iterator(const do_droplet_t *item) : item_(item) {}
+
+        droplet_view operator*() const noexcept { return droplet_view(*item_); }
+        droplet_view operator[](difference_type n) const noexcept { return droplet_view(item_[n]); }
+        iterator &operator++() noexcept { ++item_; return *this; }
+        iterator operator++(int) noexcept { return iterator(item_++); }
+        iterator &operator--() noexcept { --item_; return *this; }
+        iterator operator--(int) noexcept { return iterator(item_--); }
+        iterator &operator+=(difference_type n) noexcept { item_ += n; return *this; }
+        iterator &operator-=(difference_type n) noexcept { item_ -= n; return *this; }
+        friend iterator operator+(iterator it, difference_type n) noexcept { return it += n; }
+        friend iterator operator+(difference_type n, iterator it) noexcept { return it += n; }
+        friend iterator operator-(iterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(iterator a, iterator b) noexcept { return a.item_ - b.item_; }
+        friend auto operator<=>(iterator, iterator) = default;
+
+    private:
+        const do_droplet_t *item_ = nullptr;
+    };
+
+    explicit droplet_list(do_droplet_list_t *list) noexcept : list_(list) {}
+
+    std::size_t size() const noexcept { return list_->count; }
+    bool empty() const noexcept { return list_->count == 0; }
+    droplet_view operator[](std::size_t i) const noexcept { return droplet_view(list_->items[i]); }
+    iterator begin() const noexcept { return iterator(list_->items); }
+    iterator end() const noexcept { return iterator(list_->items + list_->count); }
+
+    std::span<const do_droplet_t> raw() const noexcept { return {list_->items, list_->count}; }
+    const do_droplet_list_t *get() const noexcept { return list_.get(); }
+
+private:
+    std::unique_ptr<do_droplet_list_t, detail::droplet_list_deleter> list_;
+};
+
+class account {
+public:
+    explicit account(do_account_t *account) noexcept : account_(account) {}
+
+    std::string_view email() const noexcept { return detail::view(account_->email); }
+    std::string_view uuid() const noexcept { return detail::view(account_->uuid); }
+    std::string_view status() const noexcept { return detail::view(account_->status); }
+    std::string_view status_message() const noexcept { return detail::view(account_->status_message); }
+    bool email_verified() const noexcept { return account_->email_verified; }
+    std::uint32_t droplet_limit() const noexcept { return account_->droplet_limit; }
+    std::uint32_t floating_ip_limit() const noexcept { return account_->floating_ip_limit; }
+    std::uint32_t volume_limit() const noexcept { return account_->volume_limit; }
+
+    std::string_view team_name() const noexcept {
+        return account_->team ? detail::view(account_->team->name) : std::string_view();
+    }
+
+    const do_account_t *get() const noexcept { return account_.get(); }
+
+private:
+    std::unique_ptr<do_account_t, detail::account_deleter> account_;
+};
+
+class client {
+public:
+    // Token and base URL from the environment and config file
+    static client from_config() {
+        client result(do_client_new());
+        detail::check(do_client_init_from_config(result.get()));
+        return result;
+    }
+
+    explicit client(std::string_view token, std::string_view base_url = DO_DEFAULT_BASE_URL)
+        : client(do_client_new()) {
+        do_config_t *config = do_config_new();
+        if (!config) {
+            throw error(DO_ERROR_MEMORY);
+        }
+
+        std::string token_str(token);
+        std::string base_url_str(base_url);
+        do_result_t result = do_config_set_token(config, token_str.c_str());
+        if (result == DO_SUCCESS) {
+            result = do_config_set_base_url(config, base_url_str.c_str());
+        }
+        if (result == DO_SUCCESS) {
+            result = do_client_init(get(), config); // the client takes ownership
+        }
+        if (result != DO_SUCCESS) {
+            if (get()->config != config) {
+                do_config_free(config);
+            }
+            throw error(result);
+        }
+    }
+
+    account get_account() {
+        do_account_t *result = nullptr;
+        detail::check(do_client_get_account(get(), &result));
+        return account(result);
+    }
+
+    droplet get_droplet(std::uint32_t id) {
+        do_droplet_t *result = nullptr;
+        detail::check(do_client_get_droplet(get(), id, &result));
+        return droplet(result);
+    }
+
+    droplet_list list_droplets() {
+        do_droplet_list_t *result = nullptr;
+        detail::check(do_client_list_droplets(get(), &result));
+        return droplet_list(result);
+    }
+
+    // Streams every droplet to fn(droplet_view, const do_list_position_t &)
+    // as its page is decoded. fn may return bool; false stops the walk.
+    template <typename Fn>
+    void for_each_droplet(Fn &&fn) {
+        struct state {
+            Fn &fn;
+            bool stopped;
+            std::exception_ptr exception;
+        } walk{fn, false, nullptr};
+
+        auto visitor = [](const do_droplet_t *item, const do_list_position_t *position,
+                          void *userdata) -> do_result_t {
+            auto *walk = static_cast<state *>(userdata);
+            try {
+                if constexpr (std::is_same_v<std::invoke_result_t<Fn &, droplet_view,
+                                                                  const do_list_position_t &>, bool>) {
+                    if (!walk->fn(droplet_view(*item), *position)) {
+                        walk->stopped = true;
+                        return DO_ERROR_INVALID_PARAM; // any error ends the walk
+                    }
+                } else {
+                    walk->fn(droplet_view(*item), *position);
+                }
+                return DO_SUCCESS;
+            } catch (...) {
+                walk->exception = std::current_exception();
+                return DO_ERROR_INVALID_PARAM;
+            }
+        };
+
+        do_result_t result = do_client_list_droplets_each(get(), visitor, &walk);
+        if (walk.exception) {
+            std::rethrow_exception(walk.exception);
+        }
+        if (!walk.stopped) {
+            detail::check(result);
+        }
+    }
+
+    droplet create_droplet(const do_create_droplet_request_t &request) {
+        do_droplet_t *result = nullptr;
+        detail::check(do_client_create_droplet(get(), &request, &result));
+        return droplet(result);
+    }
+
+    void delete_droplet(std::uint32_t id) { detail::check(do_client_delete_droplet(get(), id)); }
+
+    do_client_t *get() const noexcept { return client_.get(); }
+
+private:
+    explicit client(do_client_t *client) : client_(client) {
+        if (!client_) {
+            throw error(DO_ERROR_MEMORY);
+        }
+    }
+
+    std::unique_ptr<do_client_t, detail::client_deleter> client_;
+};
+
+// Result of an async request. The body is copied out of the library's
+// buffer with the context's memory resource.
+struct response {
+    do_result_t result;
+    long status_code;
+    std::pmr::string body;
+
+    bool ok() const noexcept { return result == DO_SUCCESS; }
+};
+
+// Coroutine-friendly wrapper over do_async_t. The host's event loop
+// supplies watch_socket and arm_timer and calls socket_ready() and
+// timeout() back; awaiting coroutines are resumed from inside those calls,
+// on the loop's thread. Destroying the context while coroutines are still
+// suspended on it leaves them suspended forever.
+class async_context {
+public:
+    using socket_handler = std::function<void(int fd, int events)>;
+    using timer_handler = std::function<void(long timeout_ms)>;
+
+    async_context(client &owner, socket_handler watch_socket, timer_handler arm_timer,
+                  std::pmr::memory_resource *resource = std::pmr::get_default_resource())
+        : watch_socket_(std::move(watch_socket)), arm_timer_(std::move(arm_timer)),
+          resource_(resource),
+          async_(do_async_new(owner.get(), &async_context::on_socket, &async_context::on_timer, this)) {
+        if (!async_) {
+            throw error(DO_ERROR_MEMORY);
+        }
+    }
+
+    // Callbacks hold this pointer
+    async_context(const async_context &) = delete;
+    async_context &operator=(const async_context &) = delete;
+
+    // Also rethrow anything watch_socket or arm_timer threw since the last call
+    void socket_ready(int fd, int events) {
+        do_result_t result = do_async_socket_ready(async_.get(), fd, events);
+        rethrow_pending();
+        detail::check(result);
+    }
+
+    void timeout() {
+        do_result_t result = do_async_timeout(async_.get());
+        rethrow_pending();
+        detail::check(result);
+    }
+
+    std::size_t pending() const noexcept { return do_async_pending(async_.get()); }
+
+    // co_await yields a response; HTTP errors are reported in it, not thrown
+    class request_awaitable {
+    public:
+        request_awaitable(async_context &context, std::string method, std::string path,
+                          std::optional<std::string> body)
+            : context_(context), method_(std::move(method)), path_(std::move(path)),
+              body_(std::move(body)), response_{DO_SUCCESS, 0, std::pmr::string(context.resource_)} {}
+
+        bool await_ready() const noexcept { return false; }
+
+        // The request starts only once the coroutine is suspended, so the
+        // completion can never race the suspension
+        bool await_suspend(std::coroutine_handle<> handle) noexcept {
+            handle_ = handle;
+            do_result_t result = do_async_request(context_.async_.get(), method_.c_str(), path_.c_str(),
+                                                  body_ ? body_->c_str() : nullptr,
+                                                  &request_awaitable::on_done, this);
+            if (result != DO_SUCCESS) {
+                response_.result = result;
+                return false;
+            }
+            return true;
+        }
+
+        response await_resume() noexcept { return std::move(response_); }
+
+    private:
+        static void on_done(do_async_t *, const do_async_response_t *done, void *userdata) noexcept {
+            auto *self = static_cast<request_awaitable *>(userdata);
+            self->response_.result = done->result;
+            self->response_.status_code = done->status_code;
+            try {
+                self->response_.body.assign(done->body, done->body_size);
+            } catch (...) {
+                self->response_.result = DO_ERROR_MEMORY;
+            }
+            self->handle_.resume();
+        }
+
+        async_context &context_;
+        std::string method_;
+        std::string path_;
+        std::optional<std::string> body_;
+        response response_;
+        std::coroutine_handle<> handle_;
+    };
+
+    // co_await yields a droplet or throws error
+    class droplet_awaitable {
+    public:
+        droplet_awaitable(async_context &context, std::uint32_t id) : context_(context), id_(id) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> handle) noexcept {
+            handle_ = handle;
+            result_ = do_async_get_droplet(context_.async_.get(), id_, &droplet_awaitable::on_done, this);
+            return result_ == DO_SUCCESS;
+        }
+
+        droplet await_resume() {
+            detail::check(result_);
+            return droplet(droplet_);
+        }
+
+    private:
+        static void on_done(do_async_t *, do_result_t result, do_droplet_t *item, void *userdata) noexcept {
+            auto *self = static_cast<droplet_awaitable *>(userdata);
+            self->result_ = result;
+            self->droplet_ = item;
+            self->handle_.resume();
+        }
+
+        async_context &context_;
+        std::uint32_t id_;
+        do_result_t result_ = DO_SUCCESS;
+        do_droplet_t *droplet_ = nullptr;
+        std::coroutine_handle<> handle_;
+    };
+
+    request_awaitable request(std::string method, std::string path,
+                              std::optional<std::string> body = std::nullopt) {
+        return request_awaitable(*this, std::move(method), std::move(path), std::move(body));
+    }
+
+    droplet_awaitable get_droplet(std::uint32_t id) { return droplet_awaitable(*this, id); }
+
+private:
+    // The handlers run inside C code, which an exception must not cross;
+    // the first one is kept for socket_ready() or timeout() to rethrow
+    static void on_socket(do_async_t *, int fd, int events, void *userdata) noexcept {
+        auto *self = static_cast<async_context *>(userdata);
+        try {
+            self->watch_socket_(fd, events);
+        } catch (...) {
+            if (!self->pending_) {
+                self->pending_ = std::current_exception();
+            }
+        }
+    }
+
+    static void on_timer(do_async_t *, long timeout_ms, void *userdata) noexcept {
+        auto *self = static_cast<async_context *>(userdata);
+        try {
+            self->arm_timer_(timeout_ms);
+        } catch (...) {
+            if (!self->pending_) {
+                self->pending_ = std::current_exception();
+            }
+        }
+    }
+
+    void rethrow_pending() {
+        if (pending_) {
+            std::rethrow_exception(std::exchange(pending_, nullptr));
+        }
+    }
+
+    socket_handler watch_socket_;
+    timer_handler arm_timer_;
+    std::pmr::memory_resource *resource_;
+    std::exception_ptr pending_;
+    std::unique_ptr<do_async_t, detail::async_deleter> async_;
+};
+
+} // namespace digitalocean
+
+#endif // DIGITALOCEAN_HPP
\ No newline at end of file
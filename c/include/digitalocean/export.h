@@ -0,0 +1,83 @@
+#ifndef DIGITALOCEAN_EXPORT_H
+#define DIGITALOCEAN_EXPORT_H
+
+#include "types.h"
+#include "client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Resource types in an inventory export
+typedef enum {
+    DO_EXPORT_DROPLETS,
+    DO_EXPORT_VOLUMES,
+    DO_EXPORT_SNAPSHOTS,
+    DO_EXPORT_IMAGES,          // private images only, not the public catalog
+    DO_EXPORT_DOMAINS,
+    DO_EXPORT_DOMAIN_RECORDS,  // listed per domain as each domain page arrives
+    DO_EXPORT_FIREWALLS,
+    DO_EXPORT_LOAD_BALANCERS,
+    DO_EXPORT_VPCS,
+    DO_EXPORT_TAGS,
+    DO_EXPORT_RESOURCE_COUNT
+} do_export_resource_t;
+
+// Names as used in the archive: "droplets", "domain_records", ...
+const char *do_export_resource_name(do_export_resource_t resource);
+
+typedef enum {
+    DO_EXPORT_PLAIN,
+    DO_EXPORT_GZIP
+} do_export_compression_t;
+
+typedef struct {
+    do_export_compression_t compression;
+    int level;               // gzip level 1-9; 0 means zlib's default
+    size_t max_concurrency;  // requests in flight; 0 means 8
+    uint32_t per_page;       // 0 means 200, the API maximum
+} do_export_options_t;
+
+typedef struct {
+    size_t items;
+    size_t pages;
+    uint64_t bytes;          // response bodies received
+    int64_t elapsed_us;      // first request sent to last page written
+    do_result_t result;      // first failed page, DO_SUCCESS when none
+} do_export_count_t;
+
+typedef struct {
+    time_t started_at;
+    int64_t elapsed_us;
+    uint64_t bytes_in;       // archive text before compression
+    uint64_t bytes_out;      // archive bytes written to the fd
+    bool finished;           // every page was handled and the manifest written
+    do_export_count_t resources[DO_EXPORT_RESOURCE_COUNT];
+} do_export_manifest_t;
+
+// Dumps every resource type in the account to fd as NDJSON, one line per
+// item:
+//
+//   {"resource":"droplets","item":{...}}
+//   {"resource":"domain_records","domain":"example.com","item":{...}}
+//
+// Items are copied from the responses as the API sent them. All types are
+// listed at once on the calling thread. A type's first page gives its
+// total, and its remaining pages are then requested together. Each page is
+// written, through the compressor when there is one, as soon as it
+// arrives, so memory stays at about one response per request in flight.
+// Lines from different types and pages interleave.
+//
+// The last line is {"manifest":{...}} with the counts and timings, which
+// are also returned in manifest when it is not NULL. A failed page does
+// not stop the others. Its type is marked with the error in the manifest,
+// and the first failure is returned once everything else has finished.
+// A failed write to fd stops the export with DO_ERROR_CONFIG.
+do_result_t do_client_export(do_client_t *client, int fd, const do_export_options_t *options,
+                             do_export_manifest_t *manifest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DIGITALOCEAN_EXPORT_H
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef DIGITALOCEAN_FILTER_H
+#define DIGITALOCEAN_FILTER_H
+
+#include "types.h"
+#include "client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Droplet filter expressions: clauses joined by "and", e.g.
+//
+//   tag=web and region=nyc3 and status!=active and memory>=4096
+//
+// Operators are = != < <= > >= and ~ (substring). Values may be quoted.
+// Fields: id, name, status, memory, vcpus, disk, locked, region, size,
+// image, vpc, created (an ISO 8601 prefix, compared as text) and tag (=
+// has the tag, != lacks it).
+//
+// Where the API can evaluate a clause itself it is pushed into the query
+// string instead: one tag= clause becomes tag_name, or failing that one
+// name= clause becomes name (the API matches names case-insensitively).
+// The rest is checked against each droplet's JSON before it is decoded,
+// so droplets that do not match are never materialized; view and
+// on-demand cursors read it from the page's index without building a tree.
+typedef struct do_droplet_filter do_droplet_filter_t;
+
+// DO_ERROR_INVALID_PARAM with a message in error (which may be NULL) when
+// the expression does not parse
+do_result_t do_droplet_filter_compile(const char *expression, do_droplet_filter_t **filter,
+                                      char *error, size_t error_size);
+void do_droplet_filter_free(do_droplet_filter_t *filter);
+
+// The pushed-down query parameters, "" when there are none
+const char *do_droplet_filter_query(const do_droplet_filter_t *filter);
+
+// The remaining clauses against one droplet object from the API
+bool do_droplet_filter_matches(const do_droplet_filter_t *filter, const struct cJSON *droplet);
+
+// A do_list_droplets cursor that returns only matching droplets. The
+// filter must outlive the cursor.
+do_result_t do_cursor_open_droplets_filtered(do_client_t *client,
+                                             const do_droplet_filter_t *filter,
+                                             do_list_cursor_t **cursor);
+
+// The same for a do_list_droplet_views cursor
+do_result_t do_cursor_open_droplet_views_filtered(do_client_t *client,
+                                                  const do_droplet_filter_t *filter,
+                                                  do_list_cursor_t **cursor);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DIGITALOCEAN_FILTER_H
\ No newline at end of file
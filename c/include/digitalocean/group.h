@@ -0,0 +1,75 @@
+#ifndef DIGITALOCEAN_GROUP_H
+#define DIGITALOCEAN_GROUP_H
+
+#include "types.h"
+#include "client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A set of named accounts served from one process. Each member is an
+// ordinary client with its own token, auth header and rate-limit counters;
+// all of them share one DNS cache, TLS session cache and connection pool,
+// so forty tenants cost one handshake rather than forty. Group calls fan
+// out to every member at once on a single thread. A group and its members
+// must be used from one thread at a time.
+typedef struct do_client_group do_client_group_t;
+
+do_client_group_t *do_client_group_new(void);
+void do_client_group_free(do_client_group_t *group);
+
+// Adds a member named name; the group takes ownership of config either way
+do_result_t do_client_group_add(do_client_group_t *group, const char *name, do_config_t *config);
+
+// Adds a member for every [profile NAME] section in the config file
+do_result_t do_client_group_load_profiles(do_client_group_t *group);
+
+size_t do_client_group_count(const do_client_group_t *group);
+const char *do_client_group_name(const do_client_group_t *group, size_t index);
+
+// The member's client, for single-account calls; owned by the group
+do_client_t *do_client_group_client(do_client_group_t *group, size_t index);
+do_client_t *do_client_group_find(do_client_group_t *group, const char *name);
+
+// Budget per token: a fan-out skips a member, failing it with
+// DO_ERROR_RATE_LIMIT, once the API reports that many requests or fewer
+// left in its window. 0 (the default) only stops at an empty budget.
+void do_client_group_set_reserve(do_client_group_t *group, int64_t reserve);
+
+// Outcome of the member's part in the last fan-out
+do_result_t do_client_group_result(const do_client_group_t *group, size_t index);
+
+// Fan-out listing. The visitor sees each droplet tagged with its account
+// as pages arrive, so pages of different accounts interleave; within one
+// account the API's order is kept and position counts per account.
+// Returning anything other than DO_SUCCESS stops the whole fan-out and is
+// passed back. A failing account does not stop the others: the call
+// returns the first member's failure once everyone else has finished.
+typedef do_result_t (*do_group_droplet_visitor_t)(const char *profile, const do_droplet_t *droplet,
+                                                  const do_list_position_t *position,
+                                                  void *userdata);
+
+do_result_t do_client_group_list_droplets_each(do_client_group_t *group,
+                                               do_group_droplet_visitor_t visitor,
+                                               void *userdata);
+
+// Merged listing, in arrival order. *droplets is set whenever the fan-out
+// ran, including when some accounts failed; it holds what the others
+// returned.
+typedef struct {
+    do_droplet_t *items;
+    size_t *members;  // members[i] is the group index items[i] came from
+    size_t count;
+    size_t capacity;
+} do_group_droplet_list_t;
+
+do_result_t do_client_group_list_droplets(do_client_group_t *group,
+                                          do_group_droplet_list_t **droplets);
+void do_group_droplet_list_free(do_group_droplet_list_t *list);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DIGITALOCEAN_GROUP_H
\ No newline at end of file
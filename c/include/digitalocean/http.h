@@ -8,16 +8,75 @@
 extern "C" {
 #endif
 
+// Free response buffers kept per HTTP client, bucketed by power-of-two
+// capacity starting at DO_HTTP_POOL_MIN_BUFFER. Buffers bigger than the
+// last class are freed instead of pooled.
+#define DO_HTTP_POOL_CLASSES 12       // 4 KB .. 8 MB
+#define DO_HTTP_POOL_DEPTH 2          // free buffers kept per class
+#define DO_HTTP_POOL_MIN_BUFFER 4096
+#define DO_HTTP_MAX_PRESIZE (64 * 1024 * 1024) // larger Content-Length grows on demand
+
+typedef struct {
+    char *data;
+    size_t capacity;
+} do_http_pool_buffer_t;
+
+typedef struct {
+    do_http_pool_buffer_t free[DO_HTTP_POOL_CLASSES][DO_HTTP_POOL_DEPTH];
+    size_t count[DO_HTTP_POOL_CLASSES];
+    uint64_t hits;    // buffers served from the pool
+    uint64_t misses;  // buffers that had to be allocated
+} do_http_buffer_pool_t;
+
+// Requests per token per minute the API allows, in addition to the hourly
+// limit it reports in RateLimit-* headers
+#define DO_RATE_LIMIT_PER_MINUTE 250
+
+// A rate-limit budget shared by every process on the host that uses the
+// same token (ratelimit.c); see do_client_share_rate_limit()
+typedef struct do_rate_budget do_rate_budget_t;
+
+// A connection being opened in the background; see do_http_client_warm_up()
+typedef struct do_http_warm_up do_http_warm_up_t;
+
 typedef struct {
     char *data;
     size_t size;
     size_t capacity;
+    do_http_buffer_pool_t *pool; // set when acquired from a client
 } do_http_response_t;
 
+// Timing of a single request. Phase times are microseconds from the start
+// of the request as reported by libcurl; parse and decode are filled in by
+// the client layer and stay 0 when nothing was parsed.
+typedef struct {
+    const char *method;
+    const char *url;          // effective URL; valid until the next request
+    long status_code;
+    int64_t name_lookup_us;
+    int64_t connect_us;
+    int64_t app_connect_us;   // TLS handshake complete; 0 without TLS
+    int64_t first_byte_us;
+    int64_t total_us;
+    int64_t parse_us;
+    int64_t decode_us;
+    int64_t bytes_received;
+    int64_t bytes_sent;
+} do_request_timing_t;
+
 typedef struct {
     CURL *curl;
     char *user_agent;
     long timeout;
+    do_request_timing_t timing; // last completed request
+    // Last RateLimit-* response headers seen; -1 until the API sends them
+    int64_t rate_limit;
+    int64_t rate_limit_remaining;
+    int64_t rate_limit_reset;
+    do_rate_budget_t *rate_budget; // borrowed from the client; NULL when not shared
+    do_http_buffer_pool_t pool;
+    do_http_response_t *pending; // response being received, for Content-Length presizing
+    do_http_warm_up_t *warm_up;  // NULL once the handle is free for requests
 } do_http_client_t;
 
 // HTTP client functions
@@ -28,11 +87,22 @@ do_result_t do_http_client_init(do_http_client_t *client);
 do_result_t do_http_client_set_timeout(do_http_client_t *client, long timeout_seconds);
 do_result_t do_http_client_set_user_agent(do_http_client_t *client, const char *user_agent);
 
+// Opens a connection to url's host on a background thread, so the next
+// request finds DNS, TCP and TLS already done. Only a HEAD of url without
+// credentials is sent. Every other call on the client waits for it first;
+// if it fails, the next request simply connects as usual.
+do_result_t do_http_client_warm_up(do_http_client_t *client, const char *url);
+
 // HTTP response functions
 do_http_response_t *do_http_response_new(void);
 void do_http_response_free(do_http_response_t *response);
 void do_http_response_clear(do_http_response_t *response);
 
+// Pooled responses: the body buffer is drawn from the client's pool, sized
+// from Content-Length when the server sends one, and handed back on release
+do_http_response_t *do_http_client_acquire_response(do_http_client_t *client);
+void do_http_client_release_response(do_http_client_t *client, do_http_response_t *response);
+
 // HTTP request functions
 do_result_t do_http_get(do_http_client_t *client, const char *url, 
                         const char *auth_header, do_http_response_t *response);
@@ -44,6 +114,12 @@ do_result_t do_http_post(do_http_client_t *client, const char *url,
 do_result_t do_http_delete(do_http_client_t *client, const char *url, 
                            const char *auth_header, do_http_response_t *response);
 
+// Streams the response body to write_fn as it arrives instead of buffering
+// it. method is any HTTP verb; body is sent for everything but GET.
+do_result_t do_http_stream(do_http_client_t *client, const char *method, const char *url,
+                           const char *auth_header, const char *body,
+                           curl_write_callback write_fn, void *userdata, long *status_code);
+
 // Utility functions
 size_t do_http_write_callback(void *contents, size_t size, size_t nmemb, do_http_response_t *response);
 char *do_http_build_auth_header(const char *token);
@@ -52,6 +128,7 @@ char *do_http_build_url(const char *base_url, const char *endpoint);
 // Error handling
 const char *do_http_get_error_string(CURLcode code);
 do_result_t do_http_code_to_result(CURLcode code);
+do_result_t do_http_status_to_result(long status_code);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,83 @@
+#ifndef DIGITALOCEAN_INVOKE_H
+#define DIGITALOCEAN_INVOKE_H
+
+#include "types.h"
+#include "client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Every operation in the API spec, compiled at build time into a read-only
+// table (scripts/gen_optable.py) and found by operationId through a
+// perfect hash. Requests are checked against the table before anything is
+// sent, so a missing or malformed parameter is reported locally.
+typedef struct do_operation do_operation_t;
+
+typedef enum {
+    DO_PARAM_PATH,
+    DO_PARAM_QUERY,
+    DO_PARAM_HEADER
+} do_param_location_t;
+
+typedef enum {
+    DO_PARAM_STRING,
+    DO_PARAM_INTEGER,
+    DO_PARAM_NUMBER,
+    DO_PARAM_BOOLEAN,   // "true" or "false"
+    DO_PARAM_ARRAY      // comma-separated; sent as a repeated query parameter
+} do_param_kind_t;
+
+typedef struct {
+    const char *name;
+    do_param_location_t location;
+    do_param_kind_t kind;
+    bool required;
+} do_param_info_t;
+
+// NULL when the spec has no such operation, e.g. do_operation_find("listDroplets")
+const do_operation_t *do_operation_find(const char *operation_id);
+
+// All operations, in table order
+size_t do_operation_count(void);
+const do_operation_t *do_operation_at(size_t index);
+
+const char *do_operation_id(const do_operation_t *op);
+const char *do_operation_method(const do_operation_t *op);
+const char *do_operation_path(const do_operation_t *op);  // "/v2/droplets/{droplet_id}"
+
+size_t do_operation_param_count(const do_operation_t *op);
+do_param_info_t do_operation_param(const do_operation_t *op, size_t index);
+
+// Whether a JSON body is accepted or required, and the top-level fields
+// every valid body must have
+bool do_operation_has_body(const do_operation_t *op);
+bool do_operation_body_required(const do_operation_t *op);
+size_t do_operation_body_field_count(const do_operation_t *op);
+const char *do_operation_body_field(const do_operation_t *op, size_t index);
+
+// A parameter value by name; values are given as text whatever their kind
+typedef struct {
+    const char *name;
+    const char *value;
+} do_param_t;
+
+// Checks parameter names, required parameters, value kinds, that header
+// values hold no line breaks, and that the body is a JSON object with the
+// required fields. Returns
+// DO_ERROR_INVALID_PARAM with a message in error (which may be NULL).
+do_result_t do_operation_validate(const do_operation_t *op, const do_param_t *params,
+                                  size_t param_count, const char *body,
+                                  char *error, size_t error_size);
+
+// Validates, then sends the request and streams the response body to fd
+// as do_client_raw() does. flags takes DO_RAW_PAGINATE.
+do_result_t do_client_invoke(do_client_t *client, const do_operation_t *op,
+                             const do_param_t *params, size_t param_count, const char *body,
+                             int fd, unsigned flags);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DIGITALOCEAN_INVOKE_H
\ No newline at end of file
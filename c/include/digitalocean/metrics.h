@@ -0,0 +1,27 @@
+#ifndef DIGITALOCEAN_METRICS_H
+#define DIGITALOCEAN_METRICS_H
+
+#include <stdio.h>
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Process-wide request metrics, updated by every client on every thread.
+// Series are keyed by method and endpoint; numeric and UUID path segments
+// are collapsed to ":id" so the label set stays bounded.
+#define DO_METRICS_MAX_SERIES 64
+
+// Writes all counters, histograms and rate-limit gauges in the Prometheus
+// text exposition format (version 0.0.4)
+do_result_t do_metrics_dump_prometheus(FILE *out);
+
+// Zeroes every counter; series labels are kept
+void do_metrics_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DIGITALOCEAN_METRICS_H
\ No newline at end of file
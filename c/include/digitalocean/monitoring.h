@@ -0,0 +1,117 @@
+#ifndef DIGITALOCEAN_MONITORING_H
+#define DIGITALOCEAN_MONITORING_H
+
+#include "types.h"
+#include "client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Droplet metrics from /v2/monitoring/metrics/droplet/*
+typedef enum {
+    DO_METRIC_CPU,               // cumulative CPU seconds, one series per mode
+    DO_METRIC_LOAD_1,
+    DO_METRIC_LOAD_5,
+    DO_METRIC_LOAD_15,
+    DO_METRIC_MEMORY_TOTAL,      // bytes
+    DO_METRIC_MEMORY_AVAILABLE,
+    DO_METRIC_MEMORY_FREE,
+    DO_METRIC_MEMORY_CACHED,
+    DO_METRIC_FILESYSTEM_FREE,   // bytes, one series per device and mount point
+    DO_METRIC_FILESYSTEM_SIZE,
+    DO_METRIC_BANDWIDTH_PUBLIC_IN,   // megabits per second
+    DO_METRIC_BANDWIDTH_PUBLIC_OUT,
+    DO_METRIC_BANDWIDTH_PRIVATE_IN,
+    DO_METRIC_BANDWIDTH_PRIVATE_OUT,
+    DO_METRIC_KIND_COUNT
+} do_metric_kind_t;
+
+// Names as used on the command line: "cpu", "load_1", "bandwidth_public_in"
+const char *do_metric_kind_name(do_metric_kind_t kind);
+bool do_metric_kind_parse(const char *name, do_metric_kind_t *kind);
+
+// One time series, stored as columns: timestamps[i] (Unix seconds,
+// ascending) goes with values[i]. The arrays grow in place as scrapes
+// append to them.
+typedef struct {
+    uint32_t droplet_id;
+    do_metric_kind_t kind;
+    char *labels;          // other labels as "key=value,..."; "" when there are none
+    int64_t *timestamps;
+    double *values;
+    size_t count;
+    size_t capacity;
+} do_metric_series_t;
+
+// All series scraped so far, plus the window each droplet and metric was
+// last fetched up to, so the next scrape asks only for what is new
+typedef struct do_metric_store do_metric_store_t;
+
+do_metric_store_t *do_metric_store_new(void);
+void do_metric_store_free(do_metric_store_t *store);
+
+// Series are numbered from 0; pointers stay valid until the next scrape
+size_t do_metric_store_count(const do_metric_store_t *store);
+const do_metric_series_t *do_metric_store_series(const do_metric_store_t *store, size_t index);
+
+// labels NULL matches the first series for the droplet and metric
+const do_metric_series_t *do_metric_store_find(const do_metric_store_t *store, uint32_t droplet_id,
+                                               do_metric_kind_t kind, const char *labels);
+
+// Drops samples older than before from every series; the fetch windows
+// are kept, so trimmed samples are not fetched again
+void do_metric_store_trim(do_metric_store_t *store, int64_t before);
+
+// What to scrape. A droplet and metric seen before is fetched from the end
+// of its last window; one seen for the first time goes back lookback
+// seconds.
+typedef struct {
+    const uint32_t *droplet_ids;
+    size_t droplet_count;
+    const do_metric_kind_t *kinds;
+    size_t kind_count;
+    int64_t lookback;        // 0 means one hour
+    int64_t end;             // Unix seconds; 0 means now
+    size_t max_concurrency;  // requests in flight; 0 means 16
+} do_metric_scrape_t;
+
+// Fetches every droplet and metric pair concurrently on the calling thread
+// and appends new samples to the store. A failed pair does not stop the
+// others; its window is left as it was so the next scrape retries it, and
+// the first failure is returned once everything else has finished.
+do_result_t do_client_scrape_metrics(do_client_t *client, do_metric_store_t *store,
+                                     const do_metric_scrape_t *scrape);
+
+// Rollups over the samples with start <= timestamp < end. NaN samples are
+// skipped; count is 0 and the rest NaN when nothing is left.
+typedef struct {
+    size_t count;
+    double min;
+    double max;
+    double avg;
+    double p95;
+} do_metric_rollup_t;
+
+do_result_t do_metric_rollup(const do_metric_series_t *series, int64_t start, int64_t end,
+                             do_metric_rollup_t *rollup);
+
+typedef enum {
+    DO_METRIC_AGG_MIN,
+    DO_METRIC_AGG_MAX,
+    DO_METRIC_AGG_AVG,
+    DO_METRIC_AGG_P95
+} do_metric_agg_t;
+
+// Downsamples into buckets of step seconds starting at start, writing one
+// point per bucket that has samples. Returns the number of points written,
+// at most max_points.
+size_t do_metric_downsample(const do_metric_series_t *series, int64_t start, int64_t step,
+                            do_metric_agg_t agg, int64_t *timestamps, double *values,
+                            size_t max_points);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // DIGITALOCEAN_MONITORING_H
\ No newline at end of file
@@ -87,7 +87,7 @@ typedef struct {
     char *type;
     char *distribution;
     char *slug;
-    bool public;
+    bool is_public; // "public" in the API; renamed so the header compiles as C++
     do_string_array_t regions;
     uint32_t min_disk_size;
     double size_gigabytes;
@@ -146,14 +146,57 @@ typedef struct {
     char *vpc_uuid;
 } do_droplet_t;
 
+// A string inside a response the library still holds: len bytes at data,
+// not NUL-terminated. escaped is set when the text still has JSON escapes
+// in it; do_str_view_dup() and do_str_view_decode() resolve them. data is
+// NULL when the value was absent or not a string.
+typedef struct {
+    const char *data;
+    size_t len;
+    bool escaped;
+} do_str_view_t;
+
+// A droplet from a do_list_droplet_views cursor: the fields a listing
+// shows, with every string a view into the page's response text
+typedef struct {
+    uint32_t id;
+    do_str_view_t name;
+    uint32_t memory;
+    uint32_t vcpus;
+    uint32_t disk;
+    bool locked;
+    do_str_view_t status;
+    time_t created_at;
+    do_str_view_t size_slug;
+    do_str_view_t region;       // region.slug
+    do_str_view_t image;        // image.slug
+    do_str_view_t public_ipv4;  // first public v4 address
+    do_str_view_t private_ipv4; // first private v4 address
+    do_str_view_t vpc_uuid;
+    const do_str_view_t *tags;
+    size_t tags_count;
+} do_droplet_view_t;
+
 typedef struct {
     do_droplet_t *items;
     size_t count;
     size_t capacity;
     do_links_t links;
     do_meta_t meta;
+    uint64_t *hashes; // per-item hash of the droplet's JSON; set by do_droplet_list_refresh()
 } do_droplet_list_t;
 
+// What a refresh changed. Added and modified droplets are in the list;
+// removed ones are handed over here and freed with the changes.
+typedef struct {
+    uint32_t *added;
+    size_t added_count;
+    uint32_t *modified;
+    size_t modified_count;
+    do_droplet_t *removed;
+    size_t removed_count;
+} do_droplet_changes_t;
+
 // Create droplet request
 typedef struct {
     char *name;
@@ -190,6 +233,24 @@ typedef struct {
     do_team_t *team;
 } do_account_t;
 
+// Action
+typedef struct {
+    uint32_t id;
+    char *status;         // "in-progress", "completed" or "errored"
+    char *type;
+    time_t started_at;
+    time_t completed_at;  // 0 until the action finishes
+    uint32_t resource_id;
+    char *resource_type;
+    char *region_slug;
+} do_action_t;
+
+typedef struct {
+    do_action_t *items;
+    size_t count;
+    size_t capacity;
+} do_action_list_t;
+
 // Function declarations for memory management
 void do_string_init(do_string_t *str);
 void do_string_free(do_string_t *str);
@@ -199,9 +260,21 @@ void do_string_array_init(do_string_array_t *arr);
 void do_string_array_free(do_string_array_t *arr);
 do_result_t do_string_array_add(do_string_array_t *arr, const char *item);
 
+// The view's text with escapes decoded, in memory from do_malloc(); NULL
+// when data is NULL or memory runs out
+char *do_str_view_dup(const do_str_view_t *view);
+// The same into buffer, which needs len + 1 bytes; returns the decoded
+// length, or -1 when an escape is malformed
+long do_str_view_decode(const do_str_view_t *view, char *buffer);
+// Whether the decoded text equals str
+bool do_str_view_equals(const do_str_view_t *view, const char *str);
+
 void do_droplet_free(do_droplet_t *droplet);
 void do_droplet_list_free(do_droplet_list_t *list);
+void do_droplet_changes_free(do_droplet_changes_t *changes);
 void do_account_free(do_account_t *account);
+void do_action_free(do_action_t *action);
+void do_action_list_free(do_action_list_t *list);
 
 #ifdef __cplusplus
 }
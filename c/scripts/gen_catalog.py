@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""Compile a saved catalog into src/catalog_data.c.
+
+The input is a catalog as do_catalog_save() writes it, usually from
+`do-cli catalog refresh --out FILE`. The output is the snapshot behind
+do_catalog_builtin(): the regions, sizes and distribution images, a bitmap
+row per size and image of the regions it can be created in, and the slug
+hash tables, laid out exactly as src/catalog.c builds them at run time.
+
+    python3 scripts/gen_catalog.py build/catalog.json src/catalog_data.c
+
+`make catalog` does both steps. The generated file is committed; rerun
+this before a release so new installs start from a recent catalog. A
+hand-assembled input carries a fetched_at of 0, which the library reads
+as never fetched: any saved or fetched catalog is preferred to it.
+"""
+
+import json
+import sys
+import time
+
+
+def slug_hash(slug):
+    """Must match do_catalog_hash() in src/catalog.c."""
+    h = 2166136261
+    for byte in slug.encode():
+        h ^= byte
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def index(slugs):
+    """Open-addressing table of index + 1, at least twice the count;
+    repeated slugs keep their first record."""
+    size = 1
+    while size < len(slugs) * 2:
+        size <<= 1
+    mask = size - 1
+    slots = [0] * size
+    seen = set()
+    for i, slug in enumerate(slugs):
+        if slug in seen:
+            continue
+        seen.add(slug)
+        slot = slug_hash(slug) & mask
+        while slots[slot]:
+            slot = (slot + 1) & mask
+        slots[slot] = i + 1
+    return slots, mask
+
+
+def c_string(text):
+    if text is None:
+        return "NULL"
+    return json.dumps(text, ensure_ascii=True)
+
+
+def c_double(value):
+    return repr(float(value or 0))
+
+
+def rows(items, regions, region_index, words, usable):
+    """Bit r set when the item lists regions[r] and both are taking new
+    droplets, as catalog_fill_row() does."""
+    out = []
+    for item in items:
+        row = [0] * words
+        if usable(item):
+            for slug in item.get("regions") or []:
+                r = region_index.get(slug)
+                if r is not None and regions[r].get("available"):
+                    row[r // 64] |= 1 << (r % 64)
+        out.append(row)
+    return out
+
+
+def emit_words(out, name, values, ctype, per_line, fmt):
+    out.append("static const %s %s[] = {" % (ctype, name))
+    values = values or [0]
+    for i in range(0, len(values), per_line):
+        out.append("    " + ", ".join(fmt(v) for v in values[i:i + per_line]) + ",")
+    out.append("};")
+    out.append("")
+
+
+def generate(in_path, out_path):
+    with open(in_path) as f:
+        catalog = json.load(f)
+
+    regions = [r for r in catalog["regions"] if r.get("slug")]
+    sizes = [s for s in catalog["sizes"] if s.get("slug")]
+    images = [i for i in catalog["images"] if i.get("slug")]
+    if len(regions) + len(sizes) + len(images) == 0:
+        sys.exit("gen_catalog.py: %s is empty" % in_path)
+
+    words = max(1, (len(regions) + 63) // 64)
+    region_index = {}
+    for i, region in enumerate(regions):
+        region_index.setdefault(region["slug"], i)
+    size_rows = rows(sizes, regions, region_index, words, lambda s: s.get("available"))
+    image_rows = rows(images, regions, region_index, words, lambda i: True)
+
+    fetched_at = int(catalog.get("fetched_at") or 0)
+
+    out = []
+    if fetched_at > 0:
+        stamp = time.strftime("%Y-%m-%d", time.gmtime(fetched_at))
+        out.append("// Generated by scripts/gen_catalog.py from a catalog fetched %s." % stamp)
+        out.append("// Do not edit; run `make catalog` to refresh it.")
+    else:
+        out.append("// Generated by scripts/gen_catalog.py from a hand-curated catalog, not an")
+        out.append("// API listing, so it carries no fetch time and any fetched catalog wins.")
+        out.append("// Do not edit; run `make catalog` to replace it with a fetched one.")
+    out.append("#include <stddef.h>")
+    out.append('#include "catalog_table.h"')
+    out.append("")
+
+    out.append("static const do_catalog_region_t regions[] = {")
+    for r in regions:
+        out.append("    {%s, %s, %s}," % (c_string(r["slug"]), c_string(r.get("name")),
+                                          "true" if r.get("available") else "false"))
+    if not regions:
+        out.append("    {NULL, NULL, false},")
+    out.append("};")
+    out.append("")
+
+    out.append("static const do_catalog_size_t sizes[] = {")
+    for s in sizes:
+        out.append("    {%s, %d, %d, %d, %s, %s, %s, %s}," % (
+            c_string(s["slug"]), s.get("memory", 0), s.get("vcpus", 0), s.get("disk", 0),
+            c_double(s.get("transfer")), c_double(s.get("price_monthly")),
+            c_double(s.get("price_hourly")), "true" if s.get("available") else "false"))
+    if not sizes:
+        out.append("    {NULL, 0, 0, 0, 0.0, 0.0, 0.0, false},")
+    out.append("};")
+    out.append("")
+
+    out.append("static const do_catalog_image_t images[] = {")
+    for i in images:
+        out.append("    {%s, %s, %s, %d, %d}," % (
+            c_string(i["slug"]), c_string(i.get("name")), c_string(i.get("distribution")),
+            i.get("id", 0), i.get("min_disk_size", 0)))
+    if not images:
+        out.append("    {NULL, NULL, NULL, 0, 0},")
+    out.append("};")
+    out.append("")
+
+    out.append("// %d word(s) per row; bit r is regions[r]" % words)
+    hex64 = lambda v: "0x%016xULL" % v
+    emit_words(out, "size_regions", [w for row in size_rows for w in row], "uint64_t", 4, hex64)
+    emit_words(out, "image_regions", [w for row in image_rows for w in row], "uint64_t", 4,
+               hex64)
+
+    region_slots, region_mask = index([r["slug"] for r in regions])
+    size_slots, size_mask = index([s["slug"] for s in sizes])
+    image_slots, image_mask = index([i["slug"] for i in images])
+    emit_words(out, "region_slots", region_slots, "uint16_t", 16, str)
+    emit_words(out, "size_slots", size_slots, "uint16_t", 16, str)
+    emit_words(out, "image_slots", image_slots, "uint16_t", 16, str)
+
+    out.append("const struct do_catalog do_catalog_snapshot = {")
+    out.append("    %dLL," % fetched_at)
+    out.append("    regions, sizes, images,")
+    out.append("    %d, %d, %d, %d," % (len(regions), len(sizes), len(images), words))
+    out.append("    size_regions, image_regions,")
+    out.append("    region_slots, size_slots, image_slots,")
+    out.append("    %d, %d, %d," % (region_mask, size_mask, image_mask))
+    out.append("    true")
+    out.append("};")
+
+    with open(out_path, "w") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit("usage: gen_catalog.py CATALOG.json OUT.c")
+    generate(sys.argv[1], sys.argv[2])
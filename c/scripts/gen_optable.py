@@ -0,0 +1,238 @@
+#!/usr/bin/env python3
+"""Compile the OpenAPI spec into src/optable.c.
+
+The output is a read-only operation table for do_client_invoke(): each
+operation's method, path template, parameters and required body fields,
+found by a minimal perfect hash on operationId. Strings live in one pool
+and are referenced by offset, so the table needs no relocations.
+
+    python3 scripts/gen_optable.py ../DigitalOcean-public.v2.yaml src/optable.c
+
+Needs PyYAML. The generated file is committed; rerun this when the spec
+changes.
+"""
+
+import sys
+
+import yaml
+
+METHODS = ("get", "put", "post", "patch", "delete", "head")
+LOCATIONS = {"path": "DO_PARAM_PATH", "query": "DO_PARAM_QUERY", "header": "DO_PARAM_HEADER"}
+KINDS = {
+    "string": "DO_PARAM_STRING",
+    "integer": "DO_PARAM_INTEGER",
+    "number": "DO_PARAM_NUMBER",
+    "boolean": "DO_PARAM_BOOLEAN",
+    "array": "DO_PARAM_ARRAY",
+}
+
+
+def fnv1a(key, seed):
+    """Must match do_optable_hash() in src/invoke.c."""
+    h = (2166136261 ^ seed) & 0xFFFFFFFF
+    for byte in key.encode():
+        h ^= byte
+        h = (h * 16777619) & 0xFFFFFFFF
+    return h
+
+
+class Spec:
+    def __init__(self, document):
+        self.document = document
+
+    def resolve(self, node):
+        while isinstance(node, dict) and "$ref" in node:
+            target = self.document
+            for part in node["$ref"].lstrip("#/").split("/"):
+                target = target[part]
+            node = target
+        return node
+
+    def required_fields(self, schema, depth=0):
+        """Fields every valid body must have: all of allOf's, and only
+        those common to every branch of oneOf/anyOf."""
+        schema = self.resolve(schema)
+        if not isinstance(schema, dict) or depth > 8:
+            return set()
+        fields = set(schema.get("required", []))
+        for part in schema.get("allOf", []):
+            fields |= self.required_fields(part, depth + 1)
+        for key in ("oneOf", "anyOf"):
+            branches = [self.required_fields(b, depth + 1) for b in schema.get(key, [])]
+            if branches:
+                fields |= set.intersection(*branches)
+        return fields
+
+    def is_object(self, schema, depth=0):
+        schema = self.resolve(schema)
+        if not isinstance(schema, dict) or depth > 8:
+            return False
+        if schema.get("type") == "object" or "properties" in schema:
+            return True
+        parts = schema.get("allOf", []) + schema.get("oneOf", []) + schema.get("anyOf", [])
+        return bool(parts) and all(self.is_object(p, depth + 1) for p in parts)
+
+    def param_kind(self, param):
+        schema = self.resolve(param.get("schema", {}))
+        return KINDS.get(schema.get("type"), "DO_PARAM_STRING")
+
+    def operations(self):
+        ops = []
+        for path, item in self.document["paths"].items():
+            common = item.get("parameters", [])
+            for method in METHODS:
+                if method not in item:
+                    continue
+                op = item[method]
+
+                params = {}
+                for param in common + op.get("parameters", []):
+                    param = self.resolve(param)
+                    if param["in"] not in LOCATIONS:
+                        continue
+                    params[(param["in"], param["name"])] = (
+                        param["name"],
+                        LOCATIONS[param["in"]],
+                        self.param_kind(param),
+                        param["in"] == "path" or bool(param.get("required")),
+                    )
+                order = list(LOCATIONS.values())
+                params = sorted(params.values(), key=lambda p: order.index(p[1]))
+
+                flags = []
+                fields = []
+                body = self.resolve(op.get("requestBody"))
+                if body:
+                    flags.append("DO_OP_HAS_BODY")
+                    if body.get("required"):
+                        flags.append("DO_OP_BODY_REQUIRED")
+                    schema = body.get("content", {}).get("application/json", {}).get("schema")
+                    if schema and self.is_object(schema):
+                        flags.append("DO_OP_BODY_OBJECT")
+                        fields = sorted(self.required_fields(schema))
+
+                ops.append({
+                    "id": op["operationId"],
+                    "method": method.upper(),
+                    "path": path,
+                    "params": params,
+                    "fields": fields,
+                    "flags": flags,
+                })
+        return ops
+
+
+def perfect_hash(keys):
+    """CHD: keys go to buckets by one hash, then each bucket, largest first,
+    searches for a seed that puts all its keys in free slots. Minimal: one
+    slot per key."""
+    count = len(keys)
+    bucket_count = max(1, count // 4)
+    buckets = [[] for _ in range(bucket_count)]
+    for key in keys:
+        buckets[fnv1a(key, 0) % bucket_count].append(key)
+
+    seeds = [0] * bucket_count
+    slots = [None] * count
+    for index in sorted(range(bucket_count), key=lambda i: -len(buckets[i])):
+        bucket = buckets[index]
+        if not bucket:
+            continue
+        for seed in range(1, 1 << 16):
+            chosen = {fnv1a(key, seed) % count for key in bucket}
+            if len(chosen) == len(bucket) and all(slots[s] is None for s in chosen):
+                break
+        else:
+            raise SystemExit("no perfect hash seed found")
+        seeds[index] = seed
+        for key in bucket:
+            slots[fnv1a(key, seed) % count] = key
+    return seeds, slots
+
+
+class StringPool:
+    def __init__(self):
+        self.index = {}
+        self.strings = []
+
+    def add(self, text):
+        if text not in self.index:
+            self.index[text] = len(self.strings)
+            self.strings.append(text)
+        return "DO_OPTABLE_STR(%d)" % self.index[text]
+
+
+def c_string(text):
+    return '"' + text.replace("\\", "\\\\").replace('"', '\\"') + '"'
+
+
+def generate(spec_path, out_path):
+    with open(spec_path) as f:
+        spec = Spec(yaml.load(f, Loader=getattr(yaml, "CSafeLoader", yaml.SafeLoader)))
+
+    ops = {op["id"]: op for op in spec.operations()}
+    seeds, slots = perfect_hash(list(ops))
+
+    pool = StringPool()
+    op_rows, param_rows, field_rows = [], [], []
+    for op_id in slots:
+        op = ops[op_id]
+        op_rows.append("    {%s, %s, %s, %d, %d, %d, %d, %s}," % (
+            pool.add(op["id"]), pool.add(op["method"]), pool.add(op["path"]),
+            len(param_rows), len(op["params"]), len(field_rows), len(op["fields"]),
+            " | ".join(op["flags"]) or "0"))
+        for name, location, kind, required in op["params"]:
+            param_rows.append("    {%s, %s, %s, %s}," % (
+                pool.add(name), location, kind, "true" if required else "false"))
+        for field in op["fields"]:
+            field_rows.append("    %s," % pool.add(field))
+
+    out = []
+    out.append("// Generated by scripts/gen_optable.py from DigitalOcean-public.v2.yaml.")
+    out.append("// Do not edit; rerun the script when the spec changes.")
+    out.append('#include <stddef.h>')
+    out.append('#include "optable.h"')
+    out.append("")
+    out.append("// Every string once, as members of one struct so that offsets into it")
+    out.append("// are compile-time constants")
+    out.append("static const struct do_optable_pool {")
+    for i, text in enumerate(pool.strings):
+        out.append("    char s%d[sizeof(%s)];" % (i, c_string(text)))
+    out.append("} do_optable_pool = {")
+    for text in pool.strings:
+        out.append("    %s," % c_string(text))
+    out.append("};")
+    out.append("")
+    out.append("#define DO_OPTABLE_STR(n) offsetof(struct do_optable_pool, s##n)")
+    out.append("")
+    out.append("const char *const do_optable_strings = (const char *)&do_optable_pool;")
+    out.append("")
+    out.append("const size_t do_optable_op_count = %d;" % len(op_rows))
+    out.append("const size_t do_optable_seed_count = %d;" % len(seeds))
+    out.append("")
+    out.append("// Indexed by perfect-hash slot")
+    out.append("const struct do_operation do_optable_ops[] = {")
+    out.extend(op_rows)
+    out.append("};")
+    out.append("")
+    out.append("const do_optable_param_t do_optable_params[] = {")
+    out.extend(param_rows)
+    out.append("};")
+    out.append("")
+    out.append("const uint32_t do_optable_fields[] = {")
+    out.extend(field_rows or ["    0,"])
+    out.append("};")
+    out.append("")
+    out.append("const uint16_t do_optable_seeds[] = {")
+    for i in range(0, len(seeds), 16):
+        out.append("    " + ", ".join(str(s) for s in seeds[i:i + 16]) + ",")
+    out.append("};")
+
+    with open(out_path, "w") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit("usage: gen_optable.py SPEC.yaml OUT.c")
+    generate(sys.argv[1], sys.argv[2])
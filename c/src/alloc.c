@@ -0,0 +1,198 @@
+#include <stdatomic.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cjson/cjson.h>
+#include "digitalocean/alloc.h"
+
+static void *libc_malloc(size_t size, void *ctx) {
+    (void)ctx;
+    return malloc(size);
+}
+
+static void *libc_realloc(void *ptr, size_t size, void *ctx) {
+    (void)ctx;
+    return realloc(ptr, size);
+}
+
+static void libc_free(void *ptr, void *ctx) {
+    (void)ctx;
+    free(ptr);
+}
+
+static const do_allocator_t libc_allocator = {libc_malloc, libc_realloc, libc_free, NULL};
+static do_allocator_t current_allocator = {libc_malloc, libc_realloc, libc_free, NULL};
+
+// cJSON hooks carry no context, so they go through the global entry points
+static void *cjson_malloc(size_t size) {
+    return do_malloc(size);
+}
+
+static void cjson_free(void *ptr) {
+    do_free(ptr);
+}
+
+do_result_t do_set_allocator(const do_allocator_t *allocator) {
+    if (!allocator) {
+        allocator = &libc_allocator;
+    }
+    
+    if (!allocator->malloc_fn || !allocator->realloc_fn || !allocator->free_fn) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    current_allocator = *allocator;
+    
+    // Default hooks let cJSON use realloc when printing, so keep them for libc
+    if (allocator == &libc_allocator) {
+        cJSON_InitHooks(NULL);
+    } else {
+        cJSON_Hooks hooks = {cjson_malloc, cjson_free};
+        cJSON_InitHooks(&hooks);
+    }
+    
+    return DO_SUCCESS;
+}
+
+const do_allocator_t *do_get_allocator(void) {
+    return &current_allocator;
+}
+
+void *do_malloc(size_t size) {
+    return current_allocator.malloc_fn(size, current_allocator.ctx);
+}
+
+void *do_calloc(size_t count, size_t size) {
+    if (size != 0 && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    
+    void *ptr = current_allocator.malloc_fn(count * size, current_allocator.ctx);
+    if (ptr) {
+        memset(ptr, 0, count * size);
+    }
+    return ptr;
+}
+
+void *do_realloc(void *ptr, size_t size) {
+    return current_allocator.realloc_fn(ptr, size, current_allocator.ctx);
+}
+
+void do_free(void *ptr) {
+    if (ptr) {
+        current_allocator.free_fn(ptr, current_allocator.ctx);
+    }
+}
+
+char *do_strdup(const char *str) {
+    if (!str) {
+        return NULL;
+    }
+    
+    size_t len = strlen(str) + 1;
+    char *copy = do_malloc(len);
+    if (copy) {
+        memcpy(copy, str, len);
+    }
+    return copy;
+}
+
+// Counting allocator: a size header in front of each block lets frees and
+// reallocs keep the live byte count exact
+typedef union {
+    size_t size;
+    max_align_t align;
+} counting_header_t;
+
+static _Atomic uint64_t stat_allocations = 0;
+static _Atomic uint64_t stat_reallocations = 0;
+static _Atomic uint64_t stat_frees = 0;
+static _Atomic uint64_t stat_bytes_allocated = 0;
+static _Atomic int64_t stat_live_bytes = 0;
+static _Atomic int64_t stat_peak_bytes = 0;
+
+static void counting_track(int64_t delta) {
+    int64_t live = atomic_fetch_add_explicit(&stat_live_bytes, delta, memory_order_relaxed) + delta;
+    int64_t peak = atomic_load_explicit(&stat_peak_bytes, memory_order_relaxed);
+    while (live > peak &&
+           !atomic_compare_exchange_weak_explicit(&stat_peak_bytes, &peak, live,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+    }
+}
+
+static void *counting_malloc(size_t size, void *ctx) {
+    (void)ctx;
+    
+    if (size > SIZE_MAX - sizeof(counting_header_t)) {
+        return NULL;
+    }
+    
+    counting_header_t *header = malloc(sizeof(counting_header_t) + size);
+    if (!header) {
+        return NULL;
+    }
+    
+    header->size = size;
+    atomic_fetch_add_explicit(&stat_allocations, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stat_bytes_allocated, size, memory_order_relaxed);
+    counting_track((int64_t)size);
+    return header + 1;
+}
+
+static void *counting_realloc(void *ptr, size_t size, void *ctx) {
+    if (!ptr) {
+        return counting_malloc(size, ctx);
+    }
+    
+    if (size > SIZE_MAX - sizeof(counting_header_t)) {
+        return NULL;
+    }
+    
+    counting_header_t *header = (counting_header_t *)ptr - 1;
+    size_t old_size = header->size;
+    
+    header = realloc(header, sizeof(counting_header_t) + size);
+    if (!header) {
+        return NULL;
+    }
+    
+    header->size = size;
+    atomic_fetch_add_explicit(&stat_reallocations, 1, memory_order_relaxed);
+    if (size > old_size) {
+        atomic_fetch_add_explicit(&stat_bytes_allocated, size - old_size, memory_order_relaxed);
+    }
+    counting_track((int64_t)size - (int64_t)old_size);
+    return header + 1;
+}
+
+static void counting_free(void *ptr, void *ctx) {
+    (void)ctx;
+    
+    if (!ptr) {
+        return;
+    }
+    
+    counting_header_t *header = (counting_header_t *)ptr - 1;
+    atomic_fetch_add_explicit(&stat_frees, 1, memory_order_relaxed);
+    counting_track(-(int64_t)header->size);
+    free(header);
+}
+
+static const do_allocator_t counting_allocator = {counting_malloc, counting_realloc, counting_free, NULL};
+
+const do_allocator_t *do_counting_allocator(void) {
+    return &counting_allocator;
+}
+
+void do_counting_allocator_stats(do_alloc_stats_t *stats) {
+    if (!stats) {
+        return;
+    }
+    
+    stats->allocations = atomic_load_explicit(&stat_allocations, memory_order_relaxed);
+    stats->reallocations = atomic_load_explicit(&stat_reallocations, memory_order_relaxed);
+    stats->frees = atomic_load_explicit(&stat_frees, memory_order_relaxed);
+    stats->bytes_allocated = atomic_load_explicit(&stat_bytes_allocated, memory_order_relaxed);
+    stats->live_bytes = atomic_load_explicit(&stat_live_bytes, memory_order_relaxed);
+    stats->peak_bytes = atomic_load_explicit(&stat_peak_bytes, memory_order_relaxed);
+}
\ No newline at end of file
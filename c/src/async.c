@@ -0,0 +1,316 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cjson/cjson.h>
+#include "digitalocean/async.h"
+#include "digitalocean/alloc.h"
+#include "http_transfer.h"
+#include "json_internal.h"
+#include "ratelimit.h"
+
+typedef struct do_async_transfer {
+    do_async_t *async;
+    CURL *curl;
+    struct curl_slist *headers;
+    char *method;
+    char *body;
+    do_http_response_t *response;
+    do_async_callback_t callback;
+    void *userdata;
+    struct do_async_transfer *prev;
+    struct do_async_transfer *next;
+} do_async_transfer_t;
+
+struct do_async {
+    do_client_t *client;
+    CURLM *multi;
+    do_async_socket_callback_t socket_fn;
+    do_async_timer_callback_t timer_fn;
+    void *userdata;
+    do_async_transfer_t *transfers; // in flight, most recent first
+    size_t pending;
+};
+
+// libcurl -> host: translate socket interest into DO_ASYNC_* events
+static int do_async_socket_cb(CURL *curl, curl_socket_t fd, int what, void *userp, void *socketp) {
+    (void)curl;
+    (void)socketp;
+    do_async_t *async = userp;
+    
+    int events = 0;
+    switch (what) {
+        case CURL_POLL_IN: events = DO_ASYNC_READ; break;
+        case CURL_POLL_OUT: events = DO_ASYNC_WRITE; break;
+        case CURL_POLL_INOUT: events = DO_ASYNC_READ | DO_ASYNC_WRITE; break;
+        default: events = 0; break; // CURL_POLL_REMOVE
+    }
+    
+    async->socket_fn(async, (int)fd, events, async->userdata);
+    return 0;
+}
+
+static int do_async_timer_cb(CURLM *multi, long timeout_ms, void *userp) {
+    (void)multi;
+    do_async_t *async = userp;
+    async->timer_fn(async, timeout_ms, async->userdata);
+    return 0;
+}
+
+static void do_async_transfer_free(do_async_transfer_t *transfer) {
+    do_async_t *async = transfer->async;
+    
+    if (transfer->prev) {
+        transfer->prev->next = transfer->next;
+    } else {
+        async->transfers = transfer->next;
+    }
+    if (transfer->next) {
+        transfer->next->prev = transfer->prev;
+    }
+    async->pending--;
+    
+    if (transfer->curl) {
+        curl_multi_remove_handle(async->multi, transfer->curl);
+        curl_easy_cleanup(transfer->curl);
+    }
+    curl_slist_free_all(transfer->headers);
+    do_http_client_release_response(async->client->http_client, transfer->response);
+    do_free(transfer->method);
+    do_free(transfer->body);
+    do_free(transfer);
+}
+
+do_async_t *do_async_new(do_client_t *client, do_async_socket_callback_t socket_fn,
+                         do_async_timer_callback_t timer_fn, void *userdata) {
+    if (!client || !client->config || !client->http_client || !socket_fn || !timer_fn) {
+        return NULL;
+    }
+    
+    do_async_t *async = do_calloc(1, sizeof(do_async_t));
+    if (!async) {
+        return NULL;
+    }
+    
+    async->multi = curl_multi_init();
+    if (!async->multi) {
+        do_free(async);
+        return NULL;
+    }
+    
+    async->client = client;
+    async->socket_fn = socket_fn;
+    async->timer_fn = timer_fn;
+    async->userdata = userdata;
+    
+    curl_multi_setopt(async->multi, CURLMOPT_SOCKETFUNCTION, do_async_socket_cb);
+    curl_multi_setopt(async->multi, CURLMOPT_SOCKETDATA, async);
+    curl_multi_setopt(async->multi, CURLMOPT_TIMERFUNCTION, do_async_timer_cb);
+    curl_multi_setopt(async->multi, CURLMOPT_TIMERDATA, async);
+    
+    return async;
+}
+
+void do_async_free(do_async_t *async) {
+    if (!async) {
+        return;
+    }
+    
+    while (async->transfers) {
+        do_async_transfer_free(async->transfers);
+    }
+    
+    curl_multi_cleanup(async->multi);
+    do_free(async);
+}
+
+do_result_t do_async_request(do_async_t *async, const char *method, const char *path,
+                             const char *body, do_async_callback_t callback, void *userdata) {
+    if (!async || !method || !path || !callback) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    do_client_t *client = async->client;
+    
+    // The loop must never block, so a request that would have to wait for
+    // the shared budget is refused instead
+    int64_t wait_us;
+    if (client->http_client->rate_budget &&
+        do_rate_budget_reserve(client->http_client->rate_budget, &wait_us) != DO_SUCCESS) {
+        return DO_ERROR_RATE_LIMIT;
+    }
+    
+    do_async_transfer_t *transfer = do_calloc(1, sizeof(do_async_transfer_t));
+    if (!transfer) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    transfer->async = async;
+    transfer->callback = callback;
+    transfer->userdata = userdata;
+    transfer->next = async->transfers;
+    if (async->transfers) {
+        async->transfers->prev = transfer;
+    }
+    async->transfers = transfer;
+    async->pending++;
+    
+    char *url = do_http_build_url(client->config->base_url, path);
+    transfer->method = do_strdup(method);
+    transfer->body = body ? do_strdup(body) : NULL;
+    transfer->response = do_http_client_acquire_response(client->http_client);
+    if (transfer->response) {
+        transfer->headers = curl_slist_append(transfer->headers, "Content-Type: application/json");
+        if (client->auth_header) {
+            transfer->headers = curl_slist_append(transfer->headers, client->auth_header);
+        }
+        transfer->curl = do_http_transfer_new(client->http_client, transfer->headers,
+                                              transfer->response, transfer);
+    }
+    if (!url || !transfer->method || (body && !transfer->body) || !transfer->curl) {
+        do_free(url);
+        do_async_transfer_free(transfer);
+        return DO_ERROR_MEMORY;
+    }
+    
+    CURL *curl = transfer->curl;
+    curl_easy_setopt(curl, CURLOPT_URL, url);
+    
+    if (strcmp(method, "GET") != 0) {
+        curl_easy_setopt(curl, CURLOPT_POST, 1L);
+        curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, strcmp(method, "POST") == 0 ? NULL : method);
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDS, transfer->body ? transfer->body : "");
+        curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, transfer->body ? (long)strlen(transfer->body) : 0L);
+    }
+    
+    // libcurl copies the URL
+    CURLMcode code = curl_multi_add_handle(async->multi, curl);
+    do_free(url);
+    if (code != CURLM_OK) {
+        curl_easy_cleanup(transfer->curl);
+        transfer->curl = NULL;
+        do_async_transfer_free(transfer);
+        return code == CURLM_OUT_OF_MEMORY ? DO_ERROR_MEMORY : DO_ERROR_HTTP;
+    }
+    
+    return DO_SUCCESS;
+}
+
+// Hands a finished transfer to its callback
+static do_result_t do_async_transfer_done(void *owner, CURLcode res, void *userdata) {
+    do_async_transfer_t *transfer = owner;
+    do_async_t *async = userdata;
+    
+    do_request_timing_t timing;
+    do_async_response_t response = {0};
+    response.result = do_http_transfer_finish(async->client->http_client, transfer->curl,
+                                              transfer->method, res, &timing);
+    response.status_code = timing.status_code;
+    response.body = transfer->response->data ? transfer->response->data : "";
+    response.body_size = transfer->response->size;
+    response.timing = &timing;
+    
+    if (async->client->timing_callback) {
+        async->client->timing_callback(&timing, async->client->timing_userdata);
+    }
+    
+    // The body lives in the transfer, so it is freed only afterwards.
+    // The callback may queue further requests.
+    transfer->callback(async, &response, transfer->userdata);
+    do_async_transfer_free(transfer);
+    return DO_SUCCESS;
+}
+
+do_result_t do_async_socket_ready(do_async_t *async, int fd, int events) {
+    if (!async) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    int mask = 0;
+    if (events & DO_ASYNC_READ) {
+        mask |= CURL_CSELECT_IN;
+    }
+    if (events & DO_ASYNC_WRITE) {
+        mask |= CURL_CSELECT_OUT;
+    }
+    
+    int running;
+    CURLMcode code = curl_multi_socket_action(async->multi, (curl_socket_t)fd, mask, &running);
+    do_http_multi_drain(async->multi, do_async_transfer_done, async);
+    
+    return code == CURLM_OK ? DO_SUCCESS : DO_ERROR_HTTP;
+}
+
+do_result_t do_async_timeout(do_async_t *async) {
+    if (!async) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    int running;
+    CURLMcode code = curl_multi_socket_action(async->multi, CURL_SOCKET_TIMEOUT, 0, &running);
+    do_http_multi_drain(async->multi, do_async_transfer_done, async);
+    
+    return code == CURLM_OK ? DO_SUCCESS : DO_ERROR_HTTP;
+}
+
+size_t do_async_pending(const do_async_t *async) {
+    return async ? async->pending : 0;
+}
+
+// Typed requests decode the body before handing it on
+typedef struct {
+    do_async_droplet_callback_t callback;
+    void *userdata;
+} do_async_droplet_ctx_t;
+
+static void do_async_droplet_done(do_async_t *async, const do_async_response_t *response,
+                                  void *userdata) {
+    do_async_droplet_ctx_t ctx = *(do_async_droplet_ctx_t *)userdata;
+    do_free(userdata);
+    
+    if (response->result != DO_SUCCESS) {
+        ctx.callback(async, response->result, NULL, ctx.userdata);
+        return;
+    }
+    
+    cJSON *json = cJSON_Parse(response->body);
+    const cJSON *droplet_json = cJSON_GetObjectItemCaseSensitive(json, "droplet");
+    do_droplet_t *droplet = droplet_json ? do_calloc(1, sizeof(do_droplet_t)) : NULL;
+    
+    do_result_t result = DO_ERROR_JSON;
+    if (droplet) {
+        result = json_parse_droplet(droplet_json, droplet);
+        if (result != DO_SUCCESS) {
+            do_droplet_free(droplet);
+            do_free(droplet);
+            droplet = NULL;
+        }
+    } else if (droplet_json) {
+        result = DO_ERROR_MEMORY;
+    }
+    cJSON_Delete(json);
+    
+    ctx.callback(async, result, droplet, ctx.userdata);
+}
+
+do_result_t do_async_get_droplet(do_async_t *async, uint32_t id,
+                                 do_async_droplet_callback_t callback, void *userdata) {
+    if (!async || !callback) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    do_async_droplet_ctx_t *ctx = do_malloc(sizeof(do_async_droplet_ctx_t));
+    if (!ctx) {
+        return DO_ERROR_MEMORY;
+    }
+    ctx->callback = callback;
+    ctx->userdata = userdata;
+    
+    char path[64];
+    snprintf(path, sizeof(path), "/v2/droplets/%u", id);
+    
+    do_result_t result = do_async_request(async, "GET", path, NULL, do_async_droplet_done, ctx);
+    if (result != DO_SUCCESS) {
+        do_free(ctx);
+    }
+    return result;
+}
\ No newline at end of file
@@ -0,0 +1,836 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <cjson/cjson.h>
+#include "digitalocean/catalog.h"
+#include "digitalocean/alloc.h"
+#include "catalog_table.h"
+#include "json_internal.h"
+
+#define DO_CATALOG_MAX_FILE (4 * 1024 * 1024) // ignore anything bigger
+#define DO_CATALOG_MAX_ITEMS (UINT16_MAX - 1) // slots hold index + 1 in 16 bits
+
+uint32_t do_catalog_hash(const char *slug) {
+    uint32_t hash = 2166136261u;
+    for (const unsigned char *p = (const unsigned char *)slug; *p; p++) {
+        hash ^= *p;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+// Every record starts with its slug, so one probe serves all three tables
+static const void *catalog_lookup(const uint16_t *slots, size_t mask, const char *slug,
+                                  const void *items, size_t item_size) {
+    if (!slots || !slug) {
+        return NULL;
+    }
+    
+    for (size_t i = do_catalog_hash(slug) & mask;; i = (i + 1) & mask) {
+        if (slots[i] == 0) {
+            return NULL;
+        }
+        const void *item = (const char *)items + (size_t)(slots[i] - 1) * item_size;
+        if (strcmp(*(const char *const *)item, slug) == 0) {
+            return item;
+        }
+    }
+}
+
+// Tables are at least twice the count, so a probe always ends on an
+// empty slot. Repeated slugs keep their first record.
+static uint16_t *catalog_index(const void *items, size_t count, size_t item_size, size_t *mask) {
+    size_t size = 1;
+    while (size < count * 2) {
+        size <<= 1;
+    }
+    
+    uint16_t *slots = do_calloc(size, sizeof(uint16_t));
+    if (!slots) {
+        return NULL;
+    }
+    *mask = size - 1;
+    
+    for (size_t i = 0; i < count; i++) {
+        const char *slug = *(const char *const *)((const char *)items + i * item_size);
+        if (catalog_lookup(slots, *mask, slug, items, item_size)) {
+            continue;
+        }
+        size_t slot = do_catalog_hash(slug) & *mask;
+        while (slots[slot] != 0) {
+            slot = (slot + 1) & *mask;
+        }
+        slots[slot] = (uint16_t)(i + 1);
+    }
+    return slots;
+}
+
+static bool catalog_bit(const uint64_t *rows, size_t words, size_t item, size_t region) {
+    return (rows[item * words + region / 64] >> (region % 64)) & 1;
+}
+
+// Catalogs built at run time, from a fetch or a saved file. Regions come
+// first: the size and image rows are laid out once their count is known.
+typedef struct {
+    do_catalog_t *catalog;
+    do_catalog_region_t *regions;
+    do_catalog_size_t *sizes;
+    do_catalog_image_t *images;
+    size_t region_capacity;
+    size_t size_capacity;
+    size_t image_capacity;
+    uint64_t *size_regions;
+    uint64_t *image_regions;
+    uint16_t *region_slots;
+    bool failed;
+} catalog_builder_t;
+
+static void catalog_builder_init(catalog_builder_t *builder, int64_t fetched_at) {
+    memset(builder, 0, sizeof(*builder));
+    builder->catalog = do_calloc(1, sizeof(do_catalog_t));
+    if (!builder->catalog) {
+        builder->failed = true;
+        return;
+    }
+    builder->catalog->fetched_at = fetched_at;
+    builder->catalog->region_words = 1;
+}
+
+// Makes room for one more record, and its availability row when rows is
+// not NULL
+static bool catalog_reserve(catalog_builder_t *builder, void **items, size_t item_size,
+                            size_t *capacity, size_t count, uint64_t **rows) {
+    if (builder->failed) {
+        return false;
+    }
+    if (count >= DO_CATALOG_MAX_ITEMS) {
+        return false;
+    }
+    if (count < *capacity) {
+        return true;
+    }
+    
+    size_t words = builder->catalog->region_words;
+    size_t new_capacity = *capacity ? *capacity * 2 : 16;
+    void *new_items = do_realloc(*items, new_capacity * item_size);
+    if (!new_items) {
+        builder->failed = true;
+        return false;
+    }
+    *items = new_items;
+    
+    if (rows) {
+        uint64_t *new_rows = do_realloc(*rows, new_capacity * words * sizeof(uint64_t));
+        if (!new_rows) {
+            builder->failed = true;
+            return false;
+        }
+        *rows = new_rows;
+    }
+    *capacity = new_capacity;
+    return true;
+}
+
+static char *catalog_strdup(catalog_builder_t *builder, const char *text) {
+    if (!text) {
+        return NULL;
+    }
+    char *copy = do_strdup(text);
+    if (!copy) {
+        builder->failed = true;
+    }
+    return copy;
+}
+
+static void catalog_add_region(catalog_builder_t *builder, const do_region_t *region) {
+    do_catalog_t *catalog = builder->catalog;
+    if (!region->slug || builder->region_slots ||
+        !catalog_reserve(builder, (void **)&builder->regions, sizeof(do_catalog_region_t),
+                         &builder->region_capacity, catalog->region_count, NULL)) {
+        return;
+    }
+    
+    do_catalog_region_t *record = &builder->regions[catalog->region_count++];
+    record->slug = catalog_strdup(builder, region->slug);
+    record->name = catalog_strdup(builder, region->name);
+    record->available = region->available;
+    if (!record->slug) {
+        catalog->region_count--;
+        do_free((char *)record->name);
+    }
+}
+
+// Called once every region is in
+static void catalog_index_regions(catalog_builder_t *builder) {
+    if (builder->failed) {
+        return;
+    }
+    
+    do_catalog_t *catalog = builder->catalog;
+    catalog->region_words = catalog->region_count ? (catalog->region_count + 63) / 64 : 1;
+    builder->region_slots = catalog_index(builder->regions, catalog->region_count,
+                                          sizeof(do_catalog_region_t), &catalog->region_mask);
+    if (!builder->region_slots) {
+        builder->failed = true;
+    }
+}
+
+// Sets the bit of each listed region that is taking new droplets
+static void catalog_fill_row(catalog_builder_t *builder, uint64_t *row,
+                             const do_string_array_t *regions) {
+    do_catalog_t *catalog = builder->catalog;
+    memset(row, 0, catalog->region_words * sizeof(uint64_t));
+    for (size_t i = 0; i < regions->count; i++) {
+        const do_catalog_region_t *region =
+            catalog_lookup(builder->region_slots, catalog->region_mask, regions->items[i],
+                           builder->regions, sizeof(do_catalog_region_t));
+        if (region && region->available) {
+            size_t index = (size_t)(region - builder->regions);
+            row[index / 64] |= (uint64_t)1 << (index % 64);
+        }
+    }
+}
+
+static void catalog_add_size(catalog_builder_t *builder, const do_size_t *size) {
+    do_catalog_t *catalog = builder->catalog;
+    if (!size->slug || !builder->region_slots ||
+        !catalog_reserve(builder, (void **)&builder->sizes, sizeof(do_catalog_size_t),
+                         &builder->size_capacity, catalog->size_count, &builder->size_regions)) {
+        return;
+    }
+    
+    do_catalog_size_t *record = &builder->sizes[catalog->size_count];
+    record->slug = catalog_strdup(builder, size->slug);
+    if (!record->slug) {
+        return;
+    }
+    record->memory = size->memory;
+    record->vcpus = size->vcpus;
+    record->disk = size->disk;
+    record->transfer = size->transfer;
+    record->price_monthly = size->price_monthly;
+    record->price_hourly = size->price_hourly;
+    record->available = size->available;
+    
+    uint64_t *row = builder->size_regions + catalog->size_count * catalog->region_words;
+    static const do_string_array_t none = {NULL, 0, 0};
+    catalog_fill_row(builder, row, size->available ? &size->regions : &none);
+    catalog->size_count++;
+}
+
+static void catalog_add_image(catalog_builder_t *builder, const do_image_t *image) {
+    do_catalog_t *catalog = builder->catalog;
+    if (!image->slug || !builder->region_slots ||
+        !catalog_reserve(builder, (void **)&builder->images, sizeof(do_catalog_image_t),
+                         &builder->image_capacity, catalog->image_count,
+                         &builder->image_regions)) {
+        return;
+    }
+    
+    do_catalog_image_t *record = &builder->images[catalog->image_count++];
+    record->slug = catalog_strdup(builder, image->slug);
+    record->name = catalog_strdup(builder, image->name);
+    record->distribution = catalog_strdup(builder, image->distribution);
+    record->id = image->id;
+    record->min_disk_size = image->min_disk_size;
+    if (!record->slug) {
+        catalog->image_count--;
+        do_free((char *)record->name);
+        do_free((char *)record->distribution);
+        return;
+    }
+    
+    uint64_t *row = builder->image_regions + (catalog->image_count - 1) * catalog->region_words;
+    catalog_fill_row(builder, row, &image->regions);
+}
+
+// Hands the records to the catalog and indexes sizes and images; the
+// builder is spent either way
+static do_result_t catalog_builder_finish(catalog_builder_t *builder, do_catalog_t **catalog) {
+    do_catalog_t *result = builder->catalog;
+    if (!result) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    result->regions = builder->regions;
+    result->sizes = builder->sizes;
+    result->images = builder->images;
+    result->size_regions = builder->size_regions;
+    result->image_regions = builder->image_regions;
+    result->region_slots = builder->region_slots;
+    if (!builder->failed && !builder->region_slots) {
+        catalog_index_regions(builder);
+        result->region_slots = builder->region_slots;
+    }
+    if (!builder->failed) {
+        result->size_slots = catalog_index(result->sizes, result->size_count,
+                                           sizeof(do_catalog_size_t), &result->size_mask);
+        result->image_slots = catalog_index(result->images, result->image_count,
+                                            sizeof(do_catalog_image_t), &result->image_mask);
+        builder->failed = !result->size_slots || !result->image_slots;
+    }
+    
+    if (builder->failed) {
+        do_catalog_free(result);
+        return DO_ERROR_MEMORY;
+    }
+    *catalog = result;
+    return DO_SUCCESS;
+}
+
+static void free_region_fields(do_region_t *region) {
+    do_free(region->name);
+    do_free(region->slug);
+    do_string_array_free(&region->features);
+    do_string_array_free(&region->sizes);
+}
+
+static void free_size_fields(do_size_t *size) {
+    do_free(size->slug);
+    do_string_array_free(&size->regions);
+}
+
+static void free_image_fields(do_image_t *image) {
+    do_free(image->name);
+    do_free(image->type);
+    do_free(image->distribution);
+    do_free(image->slug);
+    do_free(image->description);
+    do_free(image->status);
+    do_free(image->error_message);
+    do_string_array_free(&image->regions);
+    do_string_array_free(&image->tags);
+}
+
+const do_catalog_t *do_catalog_builtin(void) {
+    return &do_catalog_snapshot;
+}
+
+char *do_catalog_default_path(void) {
+    char *config_dir = do_config_get_config_dir();
+    if (!config_dir) {
+        return NULL;
+    }
+    
+    size_t len = strlen(config_dir) + strlen("/catalog.json") + 1;
+    char *path = do_malloc(len);
+    if (path) {
+        snprintf(path, len, "%s/catalog.json", config_dir);
+    }
+    do_free(config_dir);
+    return path;
+}
+
+static do_result_t decode_region_item(const cJSON *json, void *item) {
+    return json_parse_region(json, item);
+}
+
+static void free_region_item(void *item) {
+    free_region_fields(item);
+}
+
+static do_result_t decode_size_item(const cJSON *json, void *item) {
+    return json_parse_size(json, item);
+}
+
+static void free_size_item(void *item) {
+    free_size_fields(item);
+}
+
+static do_result_t decode_image_item(const cJSON *json, void *item) {
+    return json_parse_image(json, item);
+}
+
+static void free_image_item(void *item) {
+    free_image_fields(item);
+}
+
+static const do_list_type_t catalog_list_regions = {
+    "/v2/regions", "regions", sizeof(do_region_t), decode_region_item, free_region_item
+};
+
+static const do_list_type_t catalog_list_sizes = {
+    "/v2/sizes", "sizes", sizeof(do_size_t), decode_size_item, free_size_item
+};
+
+static const do_list_type_t catalog_list_images = {
+    "/v2/images?type=distribution", "images", sizeof(do_image_t), decode_image_item,
+    free_image_item
+};
+
+do_result_t do_catalog_fetch(do_client_t *client, do_catalog_t **catalog) {
+    if (!client || !catalog) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    *catalog = NULL;
+    
+    // Each cursor prefetches on its own connection, so the three first
+    // pages are in flight together while regions are walked
+    const do_list_type_t *types[] = {&catalog_list_regions, &catalog_list_sizes,
+                                     &catalog_list_images};
+    do_list_cursor_t *cursors[3] = {NULL, NULL, NULL};
+    do_result_t result = DO_SUCCESS;
+    for (size_t i = 0; i < 3 && result == DO_SUCCESS; i++) {
+        result = do_cursor_open(client, types[i], &cursors[i]);
+    }
+    
+    catalog_builder_t builder;
+    catalog_builder_init(&builder, (int64_t)time(NULL));
+    for (size_t i = 0; i < 3 && result == DO_SUCCESS; i++) {
+        const void *items;
+        size_t count;
+        while ((result = do_cursor_next(cursors[i], &items, &count)) == DO_SUCCESS && count > 0) {
+            for (size_t j = 0; j < count; j++) {
+                if (i == 0) {
+                    catalog_add_region(&builder, (const do_region_t *)items + j);
+                } else if (i == 1) {
+                    catalog_add_size(&builder, (const do_size_t *)items + j);
+                } else {
+                    catalog_add_image(&builder, (const do_image_t *)items + j);
+                }
+            }
+        }
+        if (i == 0) {
+            catalog_index_regions(&builder);
+        }
+    }
+    
+    for (size_t i = 0; i < 3; i++) {
+        do_cursor_close(cursors[i]);
+    }
+    
+    if (result != DO_SUCCESS) {
+        builder.failed = true;
+        catalog_builder_finish(&builder, catalog);
+        return result;
+    }
+    return catalog_builder_finish(&builder, catalog);
+}
+
+static char *catalog_read_file(const char *path, size_t *length, do_result_t *result) {
+    FILE *file = fopen(path, "rb");
+    if (!file) {
+        *result = DO_ERROR_NOT_FOUND;
+        return NULL;
+    }
+    
+    char *data = do_malloc(DO_CATALOG_MAX_FILE + 1);
+    *length = data ? fread(data, 1, DO_CATALOG_MAX_FILE + 1, file) : 0;
+    fclose(file);
+    if (!data) {
+        *result = DO_ERROR_MEMORY;
+        return NULL;
+    }
+    if (*length > DO_CATALOG_MAX_FILE) {
+        do_free(data);
+        *result = DO_ERROR_JSON;
+        return NULL;
+    }
+    return data;
+}
+
+do_result_t do_catalog_load(const char *path, do_catalog_t **catalog) {
+    if (!path || !catalog) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    *catalog = NULL;
+    
+    size_t length = 0;
+    do_result_t result = DO_SUCCESS;
+    char *data = catalog_read_file(path, &length, &result);
+    if (!data) {
+        return result;
+    }
+    
+    cJSON *json = cJSON_ParseWithLength(data, length);
+    do_free(data);
+    const cJSON *fetched_at = cJSON_GetObjectItemCaseSensitive(json, "fetched_at");
+    const cJSON *regions = cJSON_GetObjectItemCaseSensitive(json, "regions");
+    const cJSON *sizes = cJSON_GetObjectItemCaseSensitive(json, "sizes");
+    const cJSON *images = cJSON_GetObjectItemCaseSensitive(json, "images");
+    if (!cJSON_IsNumber(fetched_at) || !cJSON_IsArray(regions) || !cJSON_IsArray(sizes) ||
+        !cJSON_IsArray(images)) {
+        cJSON_Delete(json);
+        return DO_ERROR_JSON;
+    }
+    
+    catalog_builder_t builder;
+    catalog_builder_init(&builder, (int64_t)fetched_at->valuedouble);
+    
+    const cJSON *item;
+    cJSON_ArrayForEach(item, regions) {
+        do_region_t region = {0};
+        json_parse_region(item, &region);
+        catalog_add_region(&builder, &region);
+        free_region_fields(&region);
+    }
+    catalog_index_regions(&builder);
+    
+    cJSON_ArrayForEach(item, sizes) {
+        do_size_t size = {0};
+        json_parse_size(item, &size);
+        catalog_add_size(&builder, &size);
+        free_size_fields(&size);
+    }
+    
+    cJSON_ArrayForEach(item, images) {
+        do_image_t image = {0};
+        json_parse_image(item, &image);
+        catalog_add_image(&builder, &image);
+        free_image_fields(&image);
+    }
+    
+    cJSON_Delete(json);
+    return catalog_builder_finish(&builder, catalog);
+}
+
+// The regions whose bit is set in row, by slug
+static void catalog_write_row(json_writer_t *writer, const do_catalog_t *catalog,
+                              const uint64_t *rows, size_t item) {
+    json_writer_key(writer, "regions");
+    json_writer_begin_array(writer);
+    for (size_t r = 0; r < catalog->region_count; r++) {
+        if (catalog_bit(rows, catalog->region_words, item, r)) {
+            json_writer_string(writer, catalog->regions[r].slug);
+        }
+    }
+    json_writer_end_array(writer);
+}
+
+// The file has the API's field names, so loading it goes through the same
+// decoders as a fetch. A size or image lists only the regions it can be
+// created in.
+do_result_t do_catalog_save(const do_catalog_t *catalog, const char *path) {
+    if (!catalog || !path) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    do_string_t text;
+    do_string_init(&text);
+    json_writer_t writer;
+    json_writer_init(&writer, &text);
+    json_writer_begin_object(&writer);
+    json_writer_key(&writer, "fetched_at");
+    json_writer_int(&writer, catalog->fetched_at);
+    
+    json_writer_key(&writer, "regions");
+    json_writer_begin_array(&writer);
+    for (size_t i = 0; i < catalog->region_count; i++) {
+        const do_catalog_region_t *region = &catalog->regions[i];
+        json_writer_begin_object(&writer);
+        json_writer_member_string(&writer, "slug", region->slug);
+        json_writer_member_string(&writer, "name", region->name);
+        json_writer_member_bool(&writer, "available", region->available);
+        json_writer_end_object(&writer);
+    }
+    json_writer_end_array(&writer);
+    
+    json_writer_key(&writer, "sizes");
+    json_writer_begin_array(&writer);
+    for (size_t i = 0; i < catalog->size_count; i++) {
+        const do_catalog_size_t *size = &catalog->sizes[i];
+        json_writer_begin_object(&writer);
+        json_writer_member_string(&writer, "slug", size->slug);
+        json_writer_key(&writer, "memory");
+        json_writer_int(&writer, size->memory);
+        json_writer_key(&writer, "vcpus");
+        json_writer_int(&writer, size->vcpus);
+        json_writer_key(&writer, "disk");
+        json_writer_int(&writer, size->disk);
+        json_writer_key(&writer, "transfer");
+        json_writer_number(&writer, size->transfer);
+        json_writer_key(&writer, "price_monthly");
+        json_writer_number(&writer, size->price_monthly);
+        json_writer_key(&writer, "price_hourly");
+        json_writer_number(&writer, size->price_hourly);
+        json_writer_member_bool(&writer, "available", size->available);
+        catalog_write_row(&writer, catalog, catalog->size_regions, i);
+        json_writer_end_object(&writer);
+    }
+    json_writer_end_array(&writer);
+    
+    json_writer_key(&writer, "images");
+    json_writer_begin_array(&writer);
+    for (size_t i = 0; i < catalog->image_count; i++) {
+        const do_catalog_image_t *image = &catalog->images[i];
+        json_writer_begin_object(&writer);
+        json_writer_key(&writer, "id");
+        json_writer_int(&writer, image->id);
+        json_writer_member_string(&writer, "slug", image->slug);
+        json_writer_member_string(&writer, "name", image->name);
+        json_writer_member_string(&writer, "distribution", image->distribution);
+        json_writer_key(&writer, "min_disk_size");
+        json_writer_int(&writer, image->min_disk_size);
+        catalog_write_row(&writer, catalog, catalog->image_regions, i);
+        json_writer_end_object(&writer);
+    }
+    json_writer_end_array(&writer);
+    json_writer_end_object(&writer);
+    json_writer_newline(&writer);
+    
+    do_result_t result = json_writer_finish(&writer);
+    if (result != DO_SUCCESS) {
+        do_string_free(&text);
+        return result;
+    }
+    
+    size_t tmp_len = strlen(path) + 32;
+    char *tmp_path = do_malloc(tmp_len);
+    if (!tmp_path) {
+        do_string_free(&text);
+        return DO_ERROR_MEMORY;
+    }
+    snprintf(tmp_path, tmp_len, "%s.%ld", path, (long)getpid());
+    
+    result = DO_ERROR_CONFIG;
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd >= 0) {
+        ssize_t written = write(fd, text.data, text.length);
+        if (close(fd) == 0 && written == (ssize_t)text.length && rename(tmp_path, path) == 0) {
+            result = DO_SUCCESS;
+        } else {
+            unlink(tmp_path);
+        }
+    }
+    
+    do_free(tmp_path);
+    do_string_free(&text);
+    return result;
+}
+
+void do_catalog_free(do_catalog_t *catalog) {
+    if (!catalog || catalog->builtin) {
+        return;
+    }
+    
+    for (size_t i = 0; i < catalog->region_count; i++) {
+        do_free((char *)catalog->regions[i].slug);
+        do_free((char *)catalog->regions[i].name);
+    }
+    for (size_t i = 0; i < catalog->size_count; i++) {
+        do_free((char *)catalog->sizes[i].slug);
+    }
+    for (size_t i = 0; i < catalog->image_count; i++) {
+        do_free((char *)catalog->images[i].slug);
+        do_free((char *)catalog->images[i].name);
+        do_free((char *)catalog->images[i].distribution);
+    }
+    do_free((void *)catalog->regions);
+    do_free((void *)catalog->sizes);
+    do_free((void *)catalog->images);
+    do_free((void *)catalog->size_regions);
+    do_free((void *)catalog->image_regions);
+    do_free((void *)catalog->region_slots);
+    do_free((void *)catalog->size_slots);
+    do_free((void *)catalog->image_slots);
+    do_free(catalog);
+}
+
+do_result_t do_client_catalog(do_client_t *client, int64_t ttl, const do_catalog_t **catalog) {
+    if (!client || !catalog) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    char *path = do_catalog_default_path();
+    if (!client->catalog) {
+        do_catalog_t *saved = NULL;
+        if (path && do_catalog_load(path, &saved) == DO_SUCCESS &&
+            saved->fetched_at > do_catalog_snapshot.fetched_at) {
+            client->catalog = saved;
+        } else {
+            do_catalog_free(saved);
+            client->catalog = &do_catalog_snapshot;
+        }
+    }
+    *catalog = client->catalog;
+    
+    if (ttl == DO_CATALOG_OFFLINE || (int64_t)time(NULL) - client->catalog->fetched_at < ttl) {
+        do_free(path);
+        return DO_SUCCESS;
+    }
+    
+    do_catalog_t *fresh = NULL;
+    do_result_t result = do_catalog_fetch(client, &fresh);
+    if (result != DO_SUCCESS) {
+        do_free(path);
+        return result;
+    }
+    
+    // A cache that cannot be written only costs the next process a fetch
+    if (path && do_config_ensure_config_dir() == DO_SUCCESS) {
+        do_catalog_save(fresh, path);
+    }
+    do_free(path);
+    
+    do_catalog_free((do_catalog_t *)client->catalog);
+    client->catalog = fresh;
+    *catalog = fresh;
+    return DO_SUCCESS;
+}
+
+int64_t do_catalog_fetched_at(const do_catalog_t *catalog) {
+    return catalog ? catalog->fetched_at : 0;
+}
+
+size_t do_catalog_region_count(const do_catalog_t *catalog) {
+    return catalog ? catalog->region_count : 0;
+}
+
+size_t do_catalog_size_count(const do_catalog_t *catalog) {
+    return catalog ? catalog->size_count : 0;
+}
+
+size_t do_catalog_image_count(const do_catalog_t *catalog) {
+    return catalog ? catalog->image_count : 0;
+}
+
+const do_catalog_region_t *do_catalog_region_at(const do_catalog_t *catalog, size_t index) {
+    return catalog && index < catalog->region_count ? &catalog->regions[index] : NULL;
+}
+
+const do_catalog_size_t *do_catalog_size_at(const do_catalog_t *catalog, size_t index) {
+    return catalog && index < catalog->size_count ? &catalog->sizes[index] : NULL;
+}
+
+const do_catalog_image_t *do_catalog_image_at(const do_catalog_t *catalog, size_t index) {
+    return catalog && index < catalog->image_count ? &catalog->images[index] : NULL;
+}
+
+const do_catalog_region_t *do_catalog_find_region(const do_catalog_t *catalog, const char *slug) {
+    return catalog ? catalog_lookup(catalog->region_slots, catalog->region_mask, slug,
+                                    catalog->regions, sizeof(do_catalog_region_t))
+                   : NULL;
+}
+
+const do_catalog_size_t *do_catalog_find_size(const do_catalog_t *catalog, const char *slug) {
+    return catalog ? catalog_lookup(catalog->size_slots, catalog->size_mask, slug,
+                                    catalog->sizes, sizeof(do_catalog_size_t))
+                   : NULL;
+}
+
+const do_catalog_image_t *do_catalog_find_image(const do_catalog_t *catalog, const char *slug) {
+    return catalog ? catalog_lookup(catalog->image_slots, catalog->image_mask, slug,
+                                    catalog->images, sizeof(do_catalog_image_t))
+                   : NULL;
+}
+
+bool do_catalog_size_available(const do_catalog_t *catalog, const char *size, const char *region) {
+    const do_catalog_size_t *s = do_catalog_find_size(catalog, size);
+    const do_catalog_region_t *r = do_catalog_find_region(catalog, region);
+    return s && r &&
+           catalog_bit(catalog->size_regions, catalog->region_words,
+                       (size_t)(s - catalog->sizes), (size_t)(r - catalog->regions));
+}
+
+bool do_catalog_image_available(const do_catalog_t *catalog, const char *image,
+                                const char *region) {
+    const do_catalog_image_t *i = do_catalog_find_image(catalog, image);
+    const do_catalog_region_t *r = do_catalog_find_region(catalog, region);
+    return i && r &&
+           catalog_bit(catalog->image_regions, catalog->region_words,
+                       (size_t)(i - catalog->images), (size_t)(r - catalog->regions));
+}
+
+static do_result_t invalid(char *error, size_t error_size, const char *format, ...) {
+    if (error && error_size > 0) {
+        va_list args;
+        va_start(args, format);
+        vsnprintf(error, error_size, format, args);
+        va_end(args);
+    }
+    return DO_ERROR_INVALID_PARAM;
+}
+
+// A slug the catalog does not know may be newer than the catalog, so it
+// is noted rather than refused; the first note is kept
+static void unknown(char *error, size_t error_size, const char *what, const char *slug) {
+    if (error && error_size > 0 && error[0] == '\0') {
+        snprintf(error, error_size, "%s '%s' is not in the catalog; left to the API", what, slug);
+    }
+}
+
+static bool all_digits(const char *text) {
+    if (!*text) {
+        return false;
+    }
+    for (; *text; text++) {
+        if (!isdigit((unsigned char)*text)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// "nyc1, sfo3, ..." for the regions set in row, cut short to fit
+static void catalog_list_row(const do_catalog_t *catalog, const uint64_t *rows, size_t item,
+                             char *out, size_t out_size) {
+    size_t len = 0;
+    out[0] = '\0';
+    for (size_t r = 0; r < catalog->region_count && len < out_size; r++) {
+        if (catalog_bit(rows, catalog->region_words, item, r)) {
+            int n = snprintf(out + len, out_size - len, "%s%s", len ? ", " : "",
+                             catalog->regions[r].slug);
+            len += n > 0 ? (size_t)n : 0;
+        }
+    }
+}
+
+do_result_t do_catalog_validate_droplet(const do_catalog_t *catalog,
+                                        const do_create_droplet_request_t *request,
+                                        char *error, size_t error_size) {
+    if (!catalog || !request) {
+        return invalid(error, error_size, "no catalog or request given");
+    }
+    if (error && error_size > 0) {
+        error[0] = '\0';
+    }
+    
+    const do_catalog_region_t *region = NULL;
+    if (request->region) {
+        region = do_catalog_find_region(catalog, request->region);
+        if (!region) {
+            unknown(error, error_size, "region", request->region);
+        } else if (!region->available) {
+            return invalid(error, error_size, "region '%s' is not accepting new droplets",
+                           request->region);
+        }
+    }
+    
+    const do_catalog_size_t *size = NULL;
+    if (request->size) {
+        size = do_catalog_find_size(catalog, request->size);
+        if (!size) {
+            unknown(error, error_size, "size", request->size);
+        } else if (region && !do_catalog_size_available(catalog, request->size, request->region)) {
+            char where[256];
+            catalog_list_row(catalog, catalog->size_regions, (size_t)(size - catalog->sizes),
+                             where, sizeof(where));
+            return invalid(error, error_size, "size '%s' is not available in '%s'%s%s%s",
+                           request->size, request->region, where[0] ? " (try " : "", where,
+                           where[0] ? ")" : "");
+        }
+    }
+    
+    if (!request->image || all_digits(request->image)) {
+        return DO_SUCCESS;
+    }
+    const do_catalog_image_t *image = do_catalog_find_image(catalog, request->image);
+    if (!image) {
+        return DO_SUCCESS;
+    }
+    if (region && !do_catalog_image_available(catalog, request->image, request->region)) {
+        return invalid(error, error_size, "image '%s' is not available in '%s'",
+                       request->image, request->region);
+    }
+    if (size && size->disk < image->min_disk_size) {
+        return invalid(error, error_size, "image '%s' needs a %u GB disk; size '%s' has %u GB",
+                       request->image, image->min_disk_size, request->size, size->disk);
+    }
+    return DO_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+// Generated by scripts/gen_catalog.py from a hand-curated catalog, not an
+// API listing, so it carries no fetch time and any fetched catalog wins.
+// Do not edit; run `make catalog` to replace it with a fetched one.
+#include <stddef.h>
+#include "catalog_table.h"
+
+static const do_catalog_region_t regions[] = {
+    {"nyc1", "New York 1", true},
+    {"nyc2", "New York 2", false},
+    {"nyc3", "New York 3", true},
+    {"ams2", "Amsterdam 2", false},
+    {"ams3", "Amsterdam 3", true},
+    {"sfo1", "San Francisco 1", false},
+    {"sfo2", "San Francisco 2", true},
+    {"sfo3", "San Francisco 3", true},
+    {"sgp1", "Singapore 1", true},
+    {"lon1", "London 1", true},
+    {"fra1", "Frankfurt 1", true},
+    {"tor1", "Toronto 1", true},
+    {"blr1", "Bangalore 1", true},
+    {"syd1", "Sydney 1", true},
+    {"atl1", "Atlanta 1", true},
+};
+
+static const do_catalog_size_t sizes[] = {
+    {"s-1vcpu-512mb-10gb", 512, 1, 10, 0.5, 4.0, 0.00595, true},
+    {"s-1vcpu-1gb", 1024, 1, 25, 1.0, 6.0, 0.00893, true},
+    {"s-1vcpu-1gb-amd", 1024, 1, 25, 1.0, 7.0, 0.01042, true},
+    {"s-1vcpu-1gb-intel", 1024, 1, 35, 1.0, 8.0, 0.0119, true},
+    {"s-1vcpu-2gb", 2048, 1, 50, 2.0, 12.0, 0.01786, true},
+    {"s-1vcpu-2gb-amd", 2048, 1, 50, 2.0, 14.0, 0.02083, true},
+    {"s-1vcpu-2gb-intel", 2048, 1, 70, 2.0, 16.0, 0.02381, true},
+    {"s-2vcpu-2gb", 2048, 2, 60, 3.0, 18.0, 0.02679, true},
+    {"s-2vcpu-2gb-amd", 2048, 2, 60, 3.0, 21.0, 0.03125, true},
+    {"s-2vcpu-2gb-intel", 2048, 2, 90, 3.0, 24.0, 0.03571, true},
+    {"s-2vcpu-4gb", 4096, 2, 80, 4.0, 24.0, 0.03571, true},
+    {"s-2vcpu-4gb-amd", 4096, 2, 80, 4.0, 28.0, 0.04167, true},
+    {"s-2vcpu-4gb-intel", 4096, 2, 120, 4.0, 32.0, 0.04762, true},
+    {"s-4vcpu-8gb", 8192, 4, 160, 5.0, 48.0, 0.07143, true},
+    {"s-4vcpu-8gb-amd", 8192, 4, 160, 5.0, 56.0, 0.08333, true},
+    {"s-4vcpu-8gb-intel", 8192, 4, 240, 5.0, 64.0, 0.09524, true},
+    {"s-8vcpu-16gb", 16384, 8, 320, 6.0, 96.0, 0.14286, true},
+    {"s-8vcpu-16gb-amd", 16384, 8, 320, 6.0, 112.0, 0.16667, true},
+    {"s-8vcpu-16gb-intel", 16384, 8, 480, 6.0, 128.0, 0.19048, true},
+    {"c-2", 4096, 2, 25, 4.0, 42.0, 0.0625, true},
+    {"c-4", 8192, 4, 50, 5.0, 84.0, 0.125, true},
+    {"c-8", 16384, 8, 100, 6.0, 168.0, 0.25, true},
+    {"c-16", 32768, 16, 200, 7.0, 336.0, 0.5, true},
+    {"g-2vcpu-8gb", 8192, 2, 25, 4.0, 63.0, 0.09375, true},
+    {"g-4vcpu-16gb", 16384, 4, 50, 5.0, 126.0, 0.1875, true},
+    {"g-8vcpu-32gb", 32768, 8, 100, 6.0, 252.0, 0.375, true},
+    {"m-2vcpu-16gb", 16384, 2, 50, 4.0, 84.0, 0.125, true},
+    {"m-4vcpu-32gb", 32768, 4, 100, 5.0, 168.0, 0.25, true},
+    {"m-8vcpu-64gb", 65536, 8, 200, 6.0, 336.0, 0.5, true},
+    {"so-2vcpu-16gb", 16384, 2, 300, 4.0, 131.0, 0.19494, true},
+    {"s-4vcpu-16gb-320gb-intel", 16384, 4, 320, 6.0, 112.0, 0.16667, false},
+};
+
+static const do_catalog_image_t images[] = {
+    {"ubuntu-24-04-x64", "24.04 (LTS) x64", "Ubuntu", 168262734, 7},
+    {"ubuntu-22-04-x64", "22.04 (LTS) x64", "Ubuntu", 168260957, 7},
+    {"ubuntu-24-10-x64", "24.10 x64", "Ubuntu", 168263310, 7},
+    {"debian-12-x64", "12 x64", "Debian", 168259862, 7},
+    {"debian-11-x64", "11 x64", "Debian", 168259451, 7},
+    {"fedora-41-x64", "41 x64", "Fedora", 168264021, 7},
+    {"fedora-40-x64", "40 x64", "Fedora", 168263874, 7},
+    {"centos-stream-9-x64", "Stream 9 x64", "CentOS", 168261122, 10},
+    {"rockylinux-9-x64", "9 x64", "Rocky Linux", 168262015, 10},
+    {"rockylinux-8-x64", "8 x64", "Rocky Linux", 168261788, 10},
+    {"almalinux-9-x64", "9 x64", "AlmaLinux", 168262502, 10},
+    {"almalinux-8-x64", "8 x64", "AlmaLinux", 168262377, 10},
+};
+
+// 1 word(s) per row; bit r is regions[r]
+static const uint64_t size_regions[] = {
+    0x0000000000002f95ULL, 0x0000000000007fd5ULL, 0x0000000000003fd5ULL, 0x0000000000003fd5ULL,
+    0x0000000000007fd5ULL, 0x0000000000003fd5ULL, 0x0000000000003fd5ULL, 0x0000000000007fd5ULL,
+    0x0000000000003fd5ULL, 0x0000000000003fd5ULL, 0x0000000000007fd5ULL, 0x0000000000003fd5ULL,
+    0x0000000000003fd5ULL, 0x0000000000007fd5ULL, 0x0000000000003fd5ULL, 0x0000000000003fd5ULL,
+    0x0000000000007fd5ULL, 0x0000000000003fd5ULL, 0x0000000000003fd5ULL, 0x0000000000003f95ULL,
+    0x0000000000003f95ULL, 0x0000000000003f95ULL, 0x0000000000003f95ULL, 0x0000000000003f95ULL,
+    0x0000000000003f95ULL, 0x0000000000003f95ULL, 0x0000000000001f95ULL, 0x0000000000001f95ULL,
+    0x0000000000001f95ULL, 0x0000000000000695ULL, 0x0000000000000000ULL,
+};
+
+static const uint64_t image_regions[] = {
+    0x0000000000007fd5ULL, 0x0000000000007fd5ULL, 0x0000000000007fd5ULL, 0x0000000000007fd5ULL,
+    0x0000000000007fd5ULL, 0x0000000000007fd5ULL, 0x0000000000007fd5ULL, 0x0000000000007fd5ULL,
+    0x0000000000007fd5ULL, 0x0000000000007fd5ULL, 0x0000000000007fd5ULL, 0x0000000000007fd5ULL,
+};
+
+static const uint16_t region_slots[] = {
+    0, 0, 0, 0, 9, 0, 0, 15, 0, 2, 5, 12, 14, 0, 0, 0,
+    1, 7, 0, 11, 0, 10, 3, 4, 6, 0, 0, 0, 0, 0, 8, 13,
+};
+
+static const uint16_t size_slots[] = {
+    0, 19, 26, 14, 28, 30, 23, 31, 0, 0, 0, 7, 0, 20, 0, 2,
+    17, 22, 25, 0, 0, 0, 12, 29, 0, 0, 0, 8, 21, 0, 0, 0,
+    0, 11, 10, 24, 0, 1, 0, 0, 9, 6, 16, 18, 13, 0, 0, 0,
+    15, 0, 0, 0, 3, 0, 5, 0, 27, 0, 0, 0, 0, 0, 4, 0,
+};
+
+static const uint16_t image_slots[] = {
+    0, 0, 12, 2, 0, 0, 0, 0, 7, 1, 8, 6, 0, 10, 0, 4,
+    0, 0, 9, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 11, 5, 0,
+};
+
+const struct do_catalog do_catalog_snapshot = {
+    0LL,
+    regions, sizes, images,
+    15, 31, 12, 1,
+    size_regions, image_regions,
+    region_slots, size_slots, image_slots,
+    31, 63, 31,
+    true
+};
\ No newline at end of file
@@ -0,0 +1,39 @@
+#ifndef DO_CATALOG_TABLE_H
+#define DO_CATALOG_TABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "digitalocean/catalog.h"
+
+// Layout shared by the generated snapshot (catalog_data.c) and catalogs
+// built at run time. Slugs are found through open-addressing tables that
+// hold index + 1 (0 is empty), probed linearly from
+// do_catalog_hash(slug) & mask. Each size and image has a row of
+// region_words words with bit r set when it can be created in region r.
+struct do_catalog {
+    int64_t fetched_at;
+    const do_catalog_region_t *regions;
+    const do_catalog_size_t *sizes;
+    const do_catalog_image_t *images;
+    size_t region_count;
+    size_t size_count;
+    size_t image_count;
+    size_t region_words;
+    const uint64_t *size_regions;
+    const uint64_t *image_regions;
+    const uint16_t *region_slots;
+    const uint16_t *size_slots;
+    const uint16_t *image_slots;
+    size_t region_mask;
+    size_t size_mask;
+    size_t image_mask;
+    bool builtin;
+};
+
+extern const struct do_catalog do_catalog_snapshot;
+
+// FNV-1a; must match slug_hash() in scripts/gen_catalog.py
+uint32_t do_catalog_hash(const char *slug);
+
+#endif // DO_CATALOG_TABLE_H
\ No newline at end of file
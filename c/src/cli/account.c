@@ -1,29 +1,21 @@
 #include <stdio.h>
 #include <stdlib.h>
-#include "digitalocean/client.h"
+#include "cli.h"
 
 int cmd_account_info(int argc, char **argv) {
     (void)argc; // Unused parameter
     (void)argv; // Unused parameter
     
-    do_client_t *client = do_client_new();
+    do_client_t *client = cli_client_open();
     if (!client) {
-        fprintf(stderr, "Failed to create client\n");
-        return 1;
-    }
-    
-    do_result_t result = do_client_init_from_config(client);
-    if (result != DO_SUCCESS) {
-        fprintf(stderr, "Failed to initialize client: %s\n", do_client_get_error_string(result));
-        do_client_free(client);
         return 1;
     }
     
     do_account_t *account;
-    result = do_client_get_account(client, &account);
+    do_result_t result = do_client_get_account(client, &account);
     if (result != DO_SUCCESS) {
         fprintf(stderr, "Failed to get account: %s\n", do_client_get_error_string(result));
-        do_client_free(client);
+        cli_client_close(client);
         return 1;
     }
     
@@ -44,6 +36,6 @@ int cmd_account_info(int argc, char **argv) {
     }
     
     do_account_free(account);
-    do_client_free(client);
+    cli_client_close(client);
     return 0;
 }
\ No newline at end of file
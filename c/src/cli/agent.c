@@ -0,0 +1,674 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include "cli.h"
+
+#define AGENT_SOCKET_NAME "agent.sock"
+#define AGENT_MAGIC 0x444f4147u // "DOAG"
+#define AGENT_MAX_ARGS 256
+#define AGENT_MAX_PAYLOAD 65536
+#define AGENT_FD_COUNT 4 // stdin, stdout, stderr, working directory
+#define AGENT_READ_TIMEOUT 5
+
+typedef enum {
+    AGENT_OP_RUN = 1,
+    AGENT_OP_PING = 2,
+    AGENT_OP_STOP = 3
+} agent_op_t;
+
+typedef enum {
+    AGENT_REPLY_DONE = 0,
+    AGENT_REPLY_REFUSED = 1
+} agent_reply_status_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t op;
+    uint32_t argc;
+    uint32_t payload_len;
+    uint64_t fingerprint;
+} agent_request_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t status;
+    int32_t exit_code;
+    int32_t pid;
+} agent_reply_t;
+
+static volatile sig_atomic_t agent_stop_requested = 0;
+
+static void agent_signal_handler(int signum) {
+    (void)signum;
+    agent_stop_requested = 1;
+}
+
+// FNV-1a over token, base URL and the environment options that change
+// how the client behaves; lets the agent refuse commands that were meant
+// for a different account, or a differently configured client, without
+// the token crossing the socket
+static uint64_t config_fingerprint(const do_config_t *config) {
+    static const char *const options[] = {
+        "DO_CLI_JSON_BACKEND", "DO_CLI_SHARED_RATE_LIMIT", "DO_CLI_TLS_SESSIONS"
+    };
+    const char *parts[2 + sizeof(options) / sizeof(options[0])] = {
+        config->token ? config->token : "",
+        config->base_url ? config->base_url : ""
+    };
+    for (size_t i = 0; i < sizeof(options) / sizeof(options[0]); i++) {
+        const char *value = getenv(options[i]);
+        // Unset and set-to-empty differ for the flag-style options
+        parts[2 + i] = value ? value : "\x01";
+    }
+    
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < sizeof(parts) / sizeof(parts[0]); i++) {
+        for (const unsigned char *p = (const unsigned char *)parts[i]; *p; p++) {
+            hash ^= *p;
+            hash *= 1099511628211ULL;
+        }
+        hash ^= 0xff;
+        hash *= 1099511628211ULL;
+    }
+    
+    return hash;
+}
+
+static char *agent_socket_path(void) {
+    char *config_dir = do_config_get_config_dir();
+    if (!config_dir) {
+        return NULL;
+    }
+    
+    size_t len = strlen(config_dir) + strlen("/") + strlen(AGENT_SOCKET_NAME) + 1;
+    char *path = malloc(len);
+    if (path) {
+        snprintf(path, len, "%s/%s", config_dir, AGENT_SOCKET_NAME);
+    }
+    
+    do_free(config_dir);
+    return path;
+}
+
+static int agent_connect(const char *path) {
+    struct sockaddr_un addr;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        return -1;
+    }
+    
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    
+    if (connect(fd, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        close(fd);
+        return -1;
+    }
+    
+    return fd;
+}
+
+// Sends the request header and arguments, passing fds via SCM_RIGHTS
+static int agent_send_request(int fd, agent_op_t op, int argc, char **argv,
+                              uint64_t fingerprint, const int *fds, int nfds) {
+    size_t payload_len = 0;
+    for (int i = 0; i < argc; i++) {
+        payload_len += strlen(argv[i]) + 1;
+    }
+    
+    if (argc > AGENT_MAX_ARGS || payload_len > AGENT_MAX_PAYLOAD) {
+        return -1;
+    }
+    
+    size_t total = sizeof(agent_request_t) + payload_len;
+    char *buffer = malloc(total);
+    if (!buffer) {
+        return -1;
+    }
+    
+    agent_request_t request = {AGENT_MAGIC, (uint32_t)op, (uint32_t)argc,
+                               (uint32_t)payload_len, fingerprint};
+    memcpy(buffer, &request, sizeof(request));
+    
+    char *p = buffer + sizeof(request);
+    for (int i = 0; i < argc; i++) {
+        size_t len = strlen(argv[i]) + 1;
+        memcpy(p, argv[i], len);
+        p += len;
+    }
+    
+    struct iovec iov = {buffer, total};
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    
+    union {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE(sizeof(int) * AGENT_FD_COUNT)];
+    } control;
+    
+    if (nfds > 0) {
+        memset(&control, 0, sizeof(control));
+        msg.msg_control = control.buf;
+        msg.msg_controllen = CMSG_SPACE(sizeof(int) * nfds);
+        
+        struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(sizeof(int) * nfds);
+        memcpy(CMSG_DATA(cmsg), fds, sizeof(int) * nfds);
+    }
+    
+    ssize_t sent;
+    do {
+        sent = sendmsg(fd, &msg, 0);
+    } while (sent < 0 && errno == EINTR);
+    
+    int result = -1;
+    if (sent >= 0) {
+        result = cli_write_all(fd, buffer + sent, total - (size_t)sent);
+    }
+    
+    free(buffer);
+    return result;
+}
+
+// Runs a control request against the agent; returns -1 if none is listening
+static int agent_request(agent_op_t op, int argc, char **argv, uint64_t fingerprint,
+                         const int *fds, int nfds, agent_reply_t *reply) {
+    char *path = agent_socket_path();
+    if (!path) {
+        return -1;
+    }
+    
+    int fd = agent_connect(path);
+    free(path);
+    if (fd < 0) {
+        return -1;
+    }
+    
+    if (agent_send_request(fd, op, argc, argv, fingerprint, fds, nfds) != 0) {
+        close(fd);
+        return -1;
+    }
+    
+    int result = cli_read_all(fd, reply, sizeof(*reply));
+    close(fd);
+    
+    if (result != 0 || reply->magic != AGENT_MAGIC) {
+        return -2;
+    }
+    
+    return 0;
+}
+
+bool cli_agent_forward(int argc, char **argv, int *exit_code) {
+    const char *disabled = getenv("DO_CLI_NO_AGENT");
+    if (disabled && *disabled && strcmp(disabled, "0") != 0) {
+        return false;
+    }
+    
+    // Loading the config is cheap compared to a TLS handshake, and the
+    // fingerprint keeps us from running against the wrong account
+    do_config_t *config = do_config_new();
+    if (!config) {
+        return false;
+    }
+    
+    if (do_config_load(config) != DO_SUCCESS) {
+        do_config_free(config);
+        return false;
+    }
+    
+    uint64_t fingerprint = config_fingerprint(config);
+    do_config_free(config);
+    
+    int cwd = open(".", O_RDONLY | O_DIRECTORY);
+    int fds[AGENT_FD_COUNT] = {STDIN_FILENO, STDOUT_FILENO, STDERR_FILENO, cwd};
+    int nfds = cwd >= 0 ? AGENT_FD_COUNT : AGENT_FD_COUNT - 1;
+    
+    fflush(stdout);
+    fflush(stderr);
+    
+    agent_reply_t reply;
+    int result = agent_request(AGENT_OP_RUN, argc, argv, fingerprint, fds, nfds, &reply);
+    
+    if (cwd >= 0) {
+        close(cwd);
+    }
+    
+    if (result == -1) {
+        return false;
+    }
+    
+    if (result == -2) {
+        // The command may already have run, so don't retry it locally
+        fprintf(stderr, "Lost connection to agent\n");
+        *exit_code = 1;
+        return true;
+    }
+    
+    if (reply.status == AGENT_REPLY_REFUSED) {
+        return false;
+    }
+    
+    *exit_code = reply.exit_code;
+    return true;
+}
+
+static bool agent_peer_allowed(int fd) {
+#if defined(SO_PEERCRED)
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+    if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0) {
+        return false;
+    }
+    return cred.uid == geteuid();
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__)
+    uid_t uid;
+    gid_t gid;
+    if (getpeereid(fd, &uid, &gid) != 0) {
+        return false;
+    }
+    return uid == geteuid();
+#else
+    (void)fd;
+    return true; // socket file permissions are the only guard
+#endif
+}
+
+static void close_fds(int *fds, int nfds) {
+    for (int i = 0; i < nfds; i++) {
+        close(fds[i]);
+    }
+}
+
+static int agent_read_request(int fd, agent_request_t *request, char **payload,
+                              int *fds, int *nfds) {
+    union {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE(sizeof(int) * AGENT_FD_COUNT)];
+    } control;
+    
+    struct iovec iov = {request, sizeof(*request)};
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control.buf;
+    msg.msg_controllen = sizeof(control.buf);
+    
+    *nfds = 0;
+    ssize_t received;
+    do {
+        received = recvmsg(fd, &msg, 0);
+    } while (received < 0 && errno == EINTR);
+    
+    if (received <= 0) {
+        return -1;
+    }
+    
+    // Every fd that arrived is ours to close: keep the first
+    // AGENT_FD_COUNT and close anything beyond them
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+            int count = (int)((cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int));
+            const unsigned char *data = CMSG_DATA(cmsg);
+            for (int i = 0; i < count; i++) {
+                int received_fd;
+                memcpy(&received_fd, data + sizeof(int) * i, sizeof(int));
+                if (*nfds < AGENT_FD_COUNT) {
+                    fds[(*nfds)++] = received_fd;
+                } else {
+                    close(received_fd);
+                }
+            }
+        }
+    }
+    
+    // Truncated control data means fds were dropped by the kernel, so the
+    // caller's stdio cannot be trusted to be what it sent
+    if (msg.msg_flags & MSG_CTRUNC) {
+        close_fds(fds, *nfds);
+        *nfds = 0;
+        return -1;
+    }
+    
+    if ((size_t)received < sizeof(*request) &&
+        cli_read_all(fd, (char *)request + received, sizeof(*request) - (size_t)received) != 0) {
+        close_fds(fds, *nfds);
+        return -1;
+    }
+    
+    if (request->magic != AGENT_MAGIC || request->argc > AGENT_MAX_ARGS ||
+        request->payload_len > AGENT_MAX_PAYLOAD) {
+        close_fds(fds, *nfds);
+        return -1;
+    }
+    
+    *payload = malloc(request->payload_len + 1);
+    if (!*payload || cli_read_all(fd, *payload, request->payload_len) != 0) {
+        free(*payload);
+        close_fds(fds, *nfds);
+        return -1;
+    }
+    (*payload)[request->payload_len] = '\0';
+    
+    return 0;
+}
+
+// Runs one command with the caller's stdio and working directory
+static int agent_run_command(int argc, char **argv, const int *fds, int nfds) {
+    fflush(stdout);
+    fflush(stderr);
+    
+    int saved[3];
+    for (int i = 0; i < 3; i++) {
+        saved[i] = dup(i);
+    }
+    int saved_cwd = open(".", O_RDONLY | O_DIRECTORY);
+    
+    for (int i = 0; i < 3 && i < nfds; i++) {
+        dup2(fds[i], i);
+    }
+    if (nfds > 3 && fchdir(fds[3]) != 0) {
+        fprintf(stderr, "Warning: agent could not enter working directory\n");
+    }
+    
+    clearerr(stdin);
+    clearerr(stdout);
+    clearerr(stderr);
+    
+    int exit_code = cli_dispatch(argc, argv);
+    
+    fflush(stdout);
+    fflush(stderr);
+    
+    for (int i = 0; i < 3; i++) {
+        if (saved[i] >= 0) {
+            dup2(saved[i], i);
+            close(saved[i]);
+        }
+    }
+    if (saved_cwd >= 0) {
+        if (fchdir(saved_cwd) != 0) {
+            // Nothing useful to do; the next command sends its own cwd
+        }
+        close(saved_cwd);
+    }
+    
+    return exit_code;
+}
+
+static void agent_handle_connection(int fd, uint64_t fingerprint) {
+    agent_request_t request;
+    char *payload = NULL;
+    int fds[AGENT_FD_COUNT];
+    int nfds = 0;
+    
+    struct timeval timeout = {AGENT_READ_TIMEOUT, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    
+    if (!agent_peer_allowed(fd) || agent_read_request(fd, &request, &payload, fds, &nfds) != 0) {
+        return;
+    }
+    
+    agent_reply_t reply = {AGENT_MAGIC, AGENT_REPLY_DONE, 0, (int32_t)getpid()};
+    
+    if (request.op == AGENT_OP_STOP) {
+        agent_stop_requested = 1;
+    } else if (request.op == AGENT_OP_RUN) {
+        char *argv[AGENT_MAX_ARGS + 1];
+        int argc = 0;
+        char *p = payload;
+        char *end = payload + request.payload_len;
+        
+        while (p < end && argc < (int)request.argc) {
+            argv[argc++] = p;
+            p += strlen(p) + 1;
+        }
+        argv[argc] = NULL;
+        
+        if (request.fingerprint != fingerprint || argc == 0 || argc != (int)request.argc) {
+            reply.status = AGENT_REPLY_REFUSED;
+        } else {
+            reply.exit_code = agent_run_command(argc, argv, fds, nfds);
+        }
+    }
+    
+    close_fds(fds, nfds);
+    free(payload);
+    cli_write_all(fd, &reply, sizeof(reply));
+}
+
+static int agent_listen(const char *path) {
+    struct sockaddr_un addr;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Agent socket path too long: %s\n", path);
+        return -1;
+    }
+    
+    int probe = agent_connect(path);
+    if (probe >= 0) {
+        close(probe);
+        fprintf(stderr, "Agent already running at %s\n", path);
+        return -1;
+    }
+    
+    if (do_config_ensure_config_dir() != DO_SUCCESS) {
+        fprintf(stderr, "Failed to create config directory\n");
+        return -1;
+    }
+    
+    // Nobody is listening, so whatever is at the path is stale
+    unlink(path);
+    
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        perror("socket");
+        return -1;
+    }
+    
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+    
+    mode_t old_mask = umask(0077);
+    int bound = bind(fd, (struct sockaddr *)&addr, sizeof(addr));
+    umask(old_mask);
+    
+    if (bound != 0 || listen(fd, 16) != 0) {
+        fprintf(stderr, "Failed to listen on %s: %s\n", path, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+    return fd;
+}
+
+static int agent_serve(int listen_fd, do_client_t *client) {
+    uint64_t fingerprint = config_fingerprint(client->config);
+    
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = agent_signal_handler;
+    sigemptyset(&sa.sa_mask);
+    sigaction(SIGTERM, &sa, NULL);
+    sigaction(SIGINT, &sa, NULL);
+    signal(SIGPIPE, SIG_IGN);
+    
+    // Unbuffered stdin so no input leaks from one caller to the next
+    setvbuf(stdin, NULL, _IONBF, 0);
+    cli_set_shared_client(client);
+    
+    while (!agent_stop_requested) {
+        int fd = accept(listen_fd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            perror("accept");
+            break;
+        }
+        
+        agent_handle_connection(fd, fingerprint);
+        close(fd);
+    }
+    
+    cli_set_shared_client(NULL);
+    return 0;
+}
+
+static int agent_run(bool daemonize) {
+    char *path = agent_socket_path();
+    if (!path) {
+        fprintf(stderr, "Failed to determine agent socket path\n");
+        return 1;
+    }
+    
+    do_client_t *client = cli_client_open();
+    if (!client) {
+        free(path);
+        return 1;
+    }
+    
+    int listen_fd = agent_listen(path);
+    if (listen_fd < 0) {
+        cli_client_close(client);
+        free(path);
+        return 1;
+    }
+    
+    if (daemonize) {
+        int ready[2];
+        if (pipe(ready) != 0) {
+            perror("pipe");
+            close(listen_fd);
+            unlink(path);
+            cli_client_close(client);
+            free(path);
+            return 1;
+        }
+        
+        pid_t pid = fork();
+        if (pid < 0) {
+            perror("fork");
+            close(ready[0]);
+            close(ready[1]);
+            close(listen_fd);
+            unlink(path);
+            cli_client_close(client);
+            free(path);
+            return 1;
+        }
+        
+        if (pid > 0) {
+            // Parent: the socket is already bound, so the agent is usable
+            close(ready[1]);
+            char byte;
+            bool started = read(ready[0], &byte, 1) == 1;
+            close(ready[0]);
+            close(listen_fd);
+            free(path);
+            cli_client_close(client);
+            
+            if (!started) {
+                fprintf(stderr, "Failed to start agent\n");
+                return 1;
+            }
+            printf("Agent started (pid %d)\n", (int)pid);
+            return 0;
+        }
+        
+        close(ready[0]);
+        setsid();
+        
+        int null_fd = open("/dev/null", O_RDWR);
+        if (null_fd >= 0) {
+            dup2(null_fd, STDIN_FILENO);
+            dup2(null_fd, STDOUT_FILENO);
+            dup2(null_fd, STDERR_FILENO);
+            if (null_fd > STDERR_FILENO) {
+                close(null_fd);
+            }
+        }
+        
+        if (write(ready[1], "1", 1) != 1) {
+            // Parent went away; keep serving anyway
+        }
+        close(ready[1]);
+    } else {
+        printf("Agent listening on %s\n", path);
+        fflush(stdout);
+    }
+    
+    agent_serve(listen_fd, client);
+    
+    close(listen_fd);
+    unlink(path);
+    free(path);
+    cli_client_close(client);
+    return 0;
+}
+
+int cmd_agent(int argc, char **argv) {
+    const char *action = argc >= 2 ? argv[1] : NULL;
+    
+    if (!action || strcmp(action, "--help") == 0) {
+        printf("Usage: agent <start|run|stop|status>\n");
+        printf("  start   Start the agent in the background\n");
+        printf("  run     Run the agent in the foreground\n");
+        printf("  stop    Stop a running agent\n");
+        printf("  status  Show whether an agent is running\n");
+        return action ? 0 : 1;
+    }
+    
+    if (strcmp(action, "start") == 0) {
+        return agent_run(true);
+    }
+    
+    if (strcmp(action, "run") == 0) {
+        return agent_run(false);
+    }
+    
+    if (strcmp(action, "stop") == 0 || strcmp(action, "status") == 0) {
+        bool stop = strcmp(action, "stop") == 0;
+        agent_reply_t reply;
+        int result = agent_request(stop ? AGENT_OP_STOP : AGENT_OP_PING,
+                                   0, NULL, 0, NULL, 0, &reply);
+        if (result != 0) {
+            printf("Agent is not running\n");
+            return 1;
+        }
+        
+        if (stop) {
+            printf("Agent stopped (pid %d)\n", reply.pid);
+        } else {
+            char *path = agent_socket_path();
+            printf("Agent running (pid %d) on %s\n", reply.pid, path ? path : "<unknown>");
+            free(path);
+        }
+        return 0;
+    }
+    
+    fprintf(stderr, "Unknown agent action: %s\n", action);
+    return 1;
+}
\ No newline at end of file
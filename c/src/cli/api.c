@@ -0,0 +1,196 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <unistd.h>
+#include "digitalocean/invoke.h"
+#include "cli.h"
+
+static int compare_operation_ids(const void *a, const void *b) {
+    return strcmp(do_operation_id(*(const do_operation_t *const *)a),
+                  do_operation_id(*(const do_operation_t *const *)b));
+}
+
+// Operations whose ID contains filter, sorted by ID
+static int list_operations(const char *filter) {
+    size_t count = do_operation_count();
+    const do_operation_t **ops = calloc(count, sizeof(*ops));
+    if (!ops) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+    
+    size_t matched = 0;
+    for (size_t i = 0; i < count; i++) {
+        const do_operation_t *op = do_operation_at(i);
+        if (!filter || strcasestr(do_operation_id(op), filter)) {
+            ops[matched++] = op;
+        }
+    }
+    qsort(ops, matched, sizeof(*ops), compare_operation_ids);
+    
+    for (size_t i = 0; i < matched; i++) {
+        printf("%-48s %-6s %s\n", do_operation_id(ops[i]), do_operation_method(ops[i]),
+               do_operation_path(ops[i]));
+    }
+    
+    free(ops);
+    return 0;
+}
+
+static void describe_operation(const do_operation_t *op) {
+    static const char *const locations[] = {"path", "query", "header"};
+    static const char *const kinds[] = {"string", "integer", "number", "boolean", "array"};
+    
+    printf("%s %s\n", do_operation_method(op), do_operation_path(op));
+    for (size_t i = 0; i < do_operation_param_count(op); i++) {
+        do_param_info_t param = do_operation_param(op, i);
+        printf("  %-32s %-7s %-8s%s\n", param.name, kinds[param.kind], locations[param.location],
+               param.required ? " required" : "");
+    }
+    
+    if (do_operation_has_body(op)) {
+        printf("  body%s", do_operation_body_required(op) ? " (required)" : "");
+        for (size_t i = 0; i < do_operation_body_field_count(op); i++) {
+            printf("%s%s", i == 0 ? ", needs: " : ", ", do_operation_body_field(op, i));
+        }
+        printf("\n");
+    }
+}
+
+int cmd_api(int argc, char **argv) {
+    const char *data_arg = NULL;
+    bool list = false;
+    bool describe = false;
+    unsigned flags = 0;
+    
+    static struct option long_options[] = {
+        {"data", required_argument, 0, 'd'},
+        {"list", no_argument, 0, 'l'},
+        {"describe", no_argument, 0, 'D'},
+        {"paginate", no_argument, 0, 'p'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    
+    int c;
+    while ((c = getopt_long(argc, argv, "d:lph", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'd':
+                data_arg = optarg;
+                break;
+            case 'l':
+                list = true;
+                break;
+            case 'D':
+                describe = true;
+                break;
+            case 'p':
+                flags |= DO_RAW_PAGINATE;
+                break;
+            case 'h':
+                printf("Usage: api <operationId> [name=value ...] [--data JSON|@FILE|-] [--paginate]\n");
+                printf("       api --list [FILTER]\n");
+                printf("       api --describe <operationId>\n");
+                printf("Calls any operation in the API spec by its operationId, e.g.\n");
+                printf("  api droplets_get droplet_id=3164444\n");
+                printf("Parameters and the body are checked before anything is sent. The\n");
+                printf("response body goes to stdout unparsed; --paginate follows every page\n");
+                printf("of a GET and prints one page per line.\n");
+                return 0;
+            default:
+                fprintf(stderr, "Use --help for usage information\n");
+                return 1;
+        }
+    }
+    
+    if (list) {
+        return list_operations(optind < argc ? argv[optind] : NULL);
+    }
+    
+    if (optind >= argc) {
+        fprintf(stderr, "Usage: api <operationId> [name=value ...] (--list to see them)\n");
+        return 1;
+    }
+    
+    const do_operation_t *op = do_operation_find(argv[optind]);
+    if (!op) {
+        fprintf(stderr, "Unknown operation: %s (try api --list %s)\n", argv[optind], argv[optind]);
+        return 1;
+    }
+    if (describe) {
+        describe_operation(op);
+        return 0;
+    }
+    
+    // name=value pairs point into argv
+    size_t param_count = (size_t)(argc - optind - 1);
+    do_param_t *params = calloc(param_count ? param_count : 1, sizeof(do_param_t));
+    char **names = calloc(param_count ? param_count : 1, sizeof(char *));
+    if (!params || !names) {
+        fprintf(stderr, "Out of memory\n");
+        free(params);
+        free(names);
+        return 1;
+    }
+    
+    int status = 0;
+    for (size_t i = 0; i < param_count && status == 0; i++) {
+        const char *arg = argv[optind + 1 + (int)i];
+        const char *equals = strchr(arg, '=');
+        if (!equals || equals == arg) {
+            fprintf(stderr, "Expected name=value, got: %s\n", arg);
+            status = 1;
+            break;
+        }
+        names[i] = strndup(arg, (size_t)(equals - arg));
+        if (!names[i]) {
+            fprintf(stderr, "Out of memory\n");
+            status = 1;
+            break;
+        }
+        params[i].name = names[i];
+        params[i].value = equals + 1;
+    }
+    
+    char *body = NULL;
+    if (status == 0 && data_arg) {
+        body = cli_load_text(data_arg);
+        if (!body) {
+            fprintf(stderr, "Failed to read request body\n");
+            status = 1;
+        }
+    }
+    
+    // Rejected here, before a client is even set up
+    char error[256];
+    if (status == 0 &&
+        do_operation_validate(op, params, param_count, body, error, sizeof(error)) != DO_SUCCESS) {
+        fprintf(stderr, "%s\n", error);
+        status = 1;
+    }
+    
+    do_client_t *client = status == 0 ? cli_client_open() : NULL;
+    if (client) {
+        // The body bypasses stdio, so anything already buffered goes first
+        fflush(stdout);
+        do_result_t result = do_client_invoke(client, op, params, param_count, body,
+                                              STDOUT_FILENO, flags);
+        if (result != DO_SUCCESS) {
+            fprintf(stderr, "Request failed: %s\n", do_client_get_error_string(result));
+            status = 1;
+        }
+        cli_client_close(client);
+    } else if (status == 0) {
+        status = 1;
+    }
+    
+    for (size_t i = 0; i < param_count; i++) {
+        free(names[i]);
+    }
+    free(names);
+    free(params);
+    free(body);
+    return status;
+}
\ No newline at end of file
@@ -0,0 +1,639 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <poll.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "cli.h"
+
+#define BATCH_MAX_ARGS 128
+#define BATCH_MAX_PARALLEL 64
+#define BATCH_WINDOW_PER_WORKER 16 // results buffered ahead of the output cursor
+
+typedef struct {
+    char *line;       // owns the storage argv points into
+    int argc;
+    char **argv;
+    size_t line_number;
+} batch_command_t;
+
+typedef struct {
+    batch_command_t *items;
+    size_t count;
+    size_t capacity;
+} batch_command_list_t;
+
+typedef struct {
+    bool done;
+    int exit_code;
+    char *out;
+    size_t out_len;
+    char *err;
+    size_t err_len;
+} batch_result_t;
+
+typedef struct {
+    pid_t pid;
+    int task_fd;      // parent -> worker: command index
+    int result_fd;    // worker -> parent: result header + captured output
+    bool busy;
+    size_t current_index; // command it is running while busy
+} batch_worker_t;
+
+typedef struct {
+    uint32_t index;
+    int32_t exit_code;
+    uint32_t out_len;
+    uint32_t err_len;
+} batch_result_header_t;
+
+// Splits a line into words with shell-like quoting: 'single', "double"
+// (backslash escapes allowed) and backslash outside quotes
+static int batch_tokenize(char *line, char **argv, int max_args) {
+    int argc = 0;
+    char *src = line;
+    char *dst = line;
+    
+    while (*src) {
+        while (*src == ' ' || *src == '\t') src++;
+        if (!*src || *src == '#') {
+            break;
+        }
+        
+        if (argc >= max_args) {
+            return -1;
+        }
+        argv[argc++] = dst;
+        
+        while (*src && *src != ' ' && *src != '\t') {
+            if (*src == '\'') {
+                src++;
+                while (*src && *src != '\'') *dst++ = *src++;
+                if (!*src) return -1;
+                src++;
+            } else if (*src == '"') {
+                src++;
+                while (*src && *src != '"') {
+                    if (*src == '\\' && (src[1] == '"' || src[1] == '\\')) src++;
+                    *dst++ = *src++;
+                }
+                if (!*src) return -1;
+                src++;
+            } else if (*src == '\\' && src[1]) {
+                src++;
+                *dst++ = *src++;
+            } else {
+                *dst++ = *src++;
+            }
+        }
+        
+        // dst never overtakes src, so terminating here is safe
+        bool at_end = *src == '\0';
+        *dst++ = '\0';
+        if (at_end) {
+            break;
+        }
+        src++;
+    }
+    
+    argv[argc] = NULL;
+    return argc;
+}
+
+static void batch_command_list_free(batch_command_list_t *list) {
+    for (size_t i = 0; i < list->count; i++) {
+        free(list->items[i].line);
+        free(list->items[i].argv);
+    }
+    free(list->items);
+}
+
+static int batch_read_commands(FILE *input, batch_command_list_t *list) {
+    char *line = NULL;
+    size_t line_capacity = 0;
+    size_t line_number = 0;
+    ssize_t len;
+    
+    while ((len = getline(&line, &line_capacity, input)) >= 0) {
+        line_number++;
+        line[strcspn(line, "\r\n")] = '\0';
+        
+        char *argv[BATCH_MAX_ARGS + 1];
+        char *copy = strdup(line);
+        if (!copy) {
+            free(line);
+            return -1;
+        }
+        
+        int argc = batch_tokenize(copy, argv, BATCH_MAX_ARGS);
+        if (argc < 0) {
+            fprintf(stderr, "batch: line %zu: unterminated quote or too many arguments\n", line_number);
+            free(copy);
+            free(line);
+            return -1;
+        }
+        
+        if (argc == 0) {
+            free(copy);
+            continue;
+        }
+        
+        const char *name = argv[0];
+        for (int i = 0; i < argc - 1 && strcmp(name, "--timing") == 0; i++) {
+            name = argv[i + 1];
+        }
+        if (strcmp(name, "batch") == 0 || strcmp(name, "agent") == 0) {
+            fprintf(stderr, "batch: line %zu: '%s' cannot run inside a batch\n", line_number, name);
+            free(copy);
+            free(line);
+            return -1;
+        }
+        
+        if (list->count >= list->capacity) {
+            size_t new_capacity = list->capacity ? list->capacity * 2 : 64;
+            batch_command_t *items = realloc(list->items, new_capacity * sizeof(batch_command_t));
+            if (!items) {
+                free(copy);
+                free(line);
+                return -1;
+            }
+            list->items = items;
+            list->capacity = new_capacity;
+        }
+        
+        batch_command_t *command = &list->items[list->count];
+        command->argv = malloc((argc + 1) * sizeof(char *));
+        if (!command->argv) {
+            free(copy);
+            free(line);
+            return -1;
+        }
+        memcpy(command->argv, argv, (argc + 1) * sizeof(char *));
+        command->line = copy;
+        command->argc = argc;
+        command->line_number = line_number;
+        list->count++;
+    }
+    
+    free(line);
+    return ferror(input) ? -1 : 0;
+}
+
+// Runs commands first..count in this process
+static size_t batch_run_serial(batch_command_list_t *list, size_t first, bool stop_on_error) {
+    size_t failures = 0;
+    
+    for (size_t i = first; i < list->count; i++) {
+        int exit_code = cli_dispatch(list->items[i].argc, list->items[i].argv);
+        fflush(stdout);
+        fflush(stderr);
+        
+        if (exit_code != 0) {
+            failures++;
+            if (stop_on_error) {
+                break;
+            }
+        }
+    }
+    
+    return failures;
+}
+
+// Reads back and resets one capture fd; returns a malloc'd copy
+static char *batch_drain_capture(int fd, size_t *len) {
+    off_t size = lseek(fd, 0, SEEK_CUR);
+    *len = size > 0 ? (size_t)size : 0;
+    
+    char *data = malloc(*len + 1);
+    if (data && *len > 0 && pread(fd, data, *len, 0) != (ssize_t)*len) {
+        *len = 0;
+    }
+    
+    if (ftruncate(fd, 0) != 0) {
+        // A stale tail would only duplicate output; keep going
+    }
+    lseek(fd, 0, SEEK_SET);
+    return data;
+}
+
+// Worker process: owns its own warm client and runs whatever it is handed
+static void batch_worker_main(batch_command_list_t *list, int task_fd, int result_fd) {
+    FILE *out_capture = tmpfile();
+    FILE *err_capture = tmpfile();
+    int null_fd = open("/dev/null", O_RDONLY);
+    if (!out_capture || !err_capture) {
+        _exit(1);
+    }
+    
+    // Commands never prompt: confirmations read EOF and cancel
+    if (null_fd >= 0) {
+        dup2(null_fd, STDIN_FILENO);
+        close(null_fd);
+    }
+    dup2(fileno(out_capture), STDOUT_FILENO);
+    dup2(fileno(err_capture), STDERR_FILENO);
+    
+    // Never touch the parent's connection; build our own on first use
+    cli_set_shared_client(NULL);
+    do_client_t *client = NULL;
+    
+    uint32_t index;
+    while (cli_read_all(task_fd, &index, sizeof(index)) == 0) {
+        if (!client) {
+            client = cli_client_open();
+            cli_set_shared_client(client);
+        }
+        
+        int exit_code = 1;
+        if (client) {
+            exit_code = cli_dispatch(list->items[index].argc, list->items[index].argv);
+        }
+        fflush(stdout);
+        fflush(stderr);
+        
+        batch_result_header_t header = {index, exit_code, 0, 0};
+        size_t out_len;
+        size_t err_len;
+        char *out = batch_drain_capture(STDOUT_FILENO, &out_len);
+        char *err = batch_drain_capture(STDERR_FILENO, &err_len);
+        header.out_len = (uint32_t)out_len;
+        header.err_len = (uint32_t)err_len;
+        
+        int written = cli_write_all(result_fd, &header, sizeof(header));
+        if (written == 0 && out_len > 0) written = cli_write_all(result_fd, out, out_len);
+        if (written == 0 && err_len > 0) written = cli_write_all(result_fd, err, err_len);
+        free(out);
+        free(err);
+        
+        if (written != 0) {
+            break;
+        }
+    }
+    
+    _exit(0);
+}
+
+static void batch_emit(batch_result_t *result) {
+    if (result->out_len > 0) {
+        fwrite(result->out, 1, result->out_len, stdout);
+    }
+    if (result->err_len > 0) {
+        fflush(stdout);
+        fwrite(result->err, 1, result->err_len, stderr);
+    }
+    free(result->out);
+    free(result->err);
+    result->out = NULL;
+    result->err = NULL;
+}
+
+// A command whose worker died before reporting back fails with a note in
+// place of its output
+static void batch_result_lost(batch_result_t *result, const batch_command_t *command) {
+    char message[96];
+    int len = snprintf(message, sizeof(message), "batch: line %zu: worker exited before finishing\n",
+                       command->line_number);
+    free(result->out);
+    free(result->err);
+    result->out = NULL;
+    result->out_len = 0;
+    result->err = strdup(message);
+    result->err_len = result->err ? (size_t)len : 0;
+    result->exit_code = 1;
+    result->done = true;
+}
+
+static void batch_worker_retire(batch_worker_t *worker) {
+    if (worker->task_fd >= 0) {
+        close(worker->task_fd);
+    }
+    if (worker->result_fd >= 0) {
+        close(worker->result_fd);
+    }
+    worker->task_fd = -1;
+    worker->result_fd = -1;
+    worker->busy = false;
+}
+
+static size_t batch_run_parallel(batch_command_list_t *list, int parallel, bool stop_on_error) {
+    if ((size_t)parallel > list->count) {
+        parallel = (int)list->count;
+    }
+    
+    batch_result_t *results = calloc(list->count, sizeof(batch_result_t));
+    batch_worker_t workers[BATCH_MAX_PARALLEL];
+    struct pollfd pollfds[BATCH_MAX_PARALLEL];
+    int worker_count = 0;
+    size_t failures = 0;
+    
+    if (!results) {
+        fprintf(stderr, "batch: out of memory\n");
+        return list->count;
+    }
+    
+    // A client warming up has a thread and a socket of its own that a
+    // forked worker cannot use; the workers connect for themselves
+    cli_client_discard_prewarmed();
+    
+    fflush(stdout);
+    fflush(stderr);
+    
+    // A worker that dies must not take us down with it
+    void (*previous_sigpipe)(int) = signal(SIGPIPE, SIG_IGN);
+    
+    for (int i = 0; i < parallel; i++) {
+        int task_pipe[2];
+        int result_pipe[2];
+        if (pipe(task_pipe) != 0) {
+            break;
+        }
+        if (pipe(result_pipe) != 0) {
+            close(task_pipe[0]);
+            close(task_pipe[1]);
+            break;
+        }
+        
+        pid_t pid = fork();
+        if (pid < 0) {
+            close(task_pipe[0]);
+            close(task_pipe[1]);
+            close(result_pipe[0]);
+            close(result_pipe[1]);
+            break;
+        }
+        
+        if (pid == 0) {
+            close(task_pipe[1]);
+            close(result_pipe[0]);
+            for (int j = 0; j < worker_count; j++) {
+                close(workers[j].task_fd);
+                close(workers[j].result_fd);
+            }
+            batch_worker_main(list, task_pipe[0], result_pipe[1]);
+        }
+        
+        close(task_pipe[0]);
+        close(result_pipe[1]);
+        workers[worker_count].pid = pid;
+        workers[worker_count].task_fd = task_pipe[1];
+        workers[worker_count].result_fd = result_pipe[0];
+        workers[worker_count].busy = false;
+        workers[worker_count].current_index = 0;
+        worker_count++;
+    }
+    
+    if (worker_count == 0) {
+        signal(SIGPIPE, previous_sigpipe);
+        free(results);
+        fprintf(stderr, "batch: failed to start workers, running serially\n");
+        return batch_run_serial(list, 0, stop_on_error);
+    }
+    
+    size_t next_task = 0;   // next command to hand out
+    size_t next_emit = 0;   // next command whose output may be written
+    size_t window = (size_t)worker_count * BATCH_WINDOW_PER_WORKER;
+    size_t in_flight = 0;
+    bool stopping = false;
+    
+    while (next_emit < list->count) {
+        // Keep every idle worker fed, but don't run too far ahead of the
+        // output cursor or a slow command makes us buffer everything
+        for (int i = 0; i < worker_count && !stopping; i++) {
+            if (workers[i].busy || workers[i].task_fd < 0 ||
+                next_task >= list->count || next_task >= next_emit + window) {
+                continue;
+            }
+            
+            uint32_t index = (uint32_t)next_task;
+            if (cli_write_all(workers[i].task_fd, &index, sizeof(index)) != 0) {
+                batch_worker_retire(&workers[i]);
+                continue;
+            }
+            workers[i].busy = true;
+            workers[i].current_index = next_task;
+            next_task++;
+            in_flight++;
+        }
+        
+        if (in_flight == 0) {
+            // Every worker is gone: everything sent has been accounted
+            // for and written, so the rest runs here
+            bool alive = false;
+            for (int i = 0; i < worker_count; i++) {
+                alive = alive || workers[i].task_fd >= 0;
+            }
+            if (!alive && !stopping && next_task < list->count) {
+                fprintf(stderr, "batch: all workers exited, running the rest serially\n");
+                fflush(stderr);
+                failures += batch_run_serial(list, next_task, stop_on_error);
+                next_task = list->count;
+                next_emit = list->count;
+            }
+            break;
+        }
+        
+        int npoll = 0;
+        int poll_worker[BATCH_MAX_PARALLEL];
+        for (int i = 0; i < worker_count; i++) {
+            if (workers[i].busy) {
+                pollfds[npoll].fd = workers[i].result_fd;
+                pollfds[npoll].events = POLLIN;
+                poll_worker[npoll] = i;
+                npoll++;
+            }
+        }
+        
+        if (poll(pollfds, npoll, -1) < 0) {
+            if (errno == EINTR) continue;
+            for (int i = 0; i < worker_count; i++) {
+                if (workers[i].busy) {
+                    batch_result_lost(&results[workers[i].current_index],
+                                      &list->items[workers[i].current_index]);
+                }
+            }
+            break;
+        }
+        
+        for (int p = 0; p < npoll; p++) {
+            if (!(pollfds[p].revents & (POLLIN | POLLHUP | POLLERR))) {
+                continue;
+            }
+            
+            batch_worker_t *worker = &workers[poll_worker[p]];
+            batch_result_t *result = &results[worker->current_index];
+            batch_result_header_t header;
+            worker->busy = false;
+            in_flight--;
+            
+            // A worker that dies mid-command loses that command; retire it
+            if (cli_read_all(worker->result_fd, &header, sizeof(header)) != 0 ||
+                header.index != worker->current_index) {
+                batch_result_lost(result, &list->items[worker->current_index]);
+                batch_worker_retire(worker);
+                continue;
+            }
+            
+            result->out = malloc(header.out_len + 1);
+            result->err = malloc(header.err_len + 1);
+            result->out_len = header.out_len;
+            result->err_len = header.err_len;
+            if (!result->out || !result->err) {
+                result->out_len = 0;
+                result->err_len = 0;
+            }
+            int fd = worker->result_fd;
+            if ((result->out_len && cli_read_all(fd, result->out, result->out_len) != 0) ||
+                (result->err_len && cli_read_all(fd, result->err, result->err_len) != 0)) {
+                batch_result_lost(result, &list->items[worker->current_index]);
+                batch_worker_retire(worker);
+                continue;
+            }
+            result->exit_code = header.exit_code;
+            result->done = true;
+        }
+        
+        while (next_emit < list->count && results[next_emit].done) {
+            batch_emit(&results[next_emit]);
+            if (results[next_emit].exit_code != 0) {
+                failures++;
+                if (stop_on_error) {
+                    stopping = true;
+                }
+            }
+            next_emit++;
+        }
+        
+        if (stopping && in_flight == 0) {
+            break;
+        }
+    }
+    
+    // Whatever finished behind a gap is still written in order. Commands
+    // never sent fail, unless --stop-on-error skipped them on purpose.
+    for (size_t i = next_emit; i < list->count; i++) {
+        if (results[i].done) {
+            batch_emit(&results[i]);
+            if (results[i].exit_code != 0) {
+                failures++;
+            }
+        } else if (!stopping) {
+            fprintf(stderr, "batch: line %zu: not run\n", list->items[i].line_number);
+            failures++;
+        }
+    }
+    
+    for (int i = 0; i < worker_count; i++) {
+        batch_worker_retire(&workers[i]);
+    }
+    for (int i = 0; i < worker_count; i++) {
+        waitpid(workers[i].pid, NULL, 0);
+    }
+    signal(SIGPIPE, previous_sigpipe);
+    
+    for (size_t i = 0; i < list->count; i++) {
+        free(results[i].out);
+        free(results[i].err);
+    }
+    free(results);
+    fflush(stdout);
+    return failures;
+}
+
+int cmd_batch(int argc, char **argv) {
+    const char *file = NULL;
+    int parallel = 1;
+    bool stop_on_error = false;
+    
+    static struct option long_options[] = {
+        {"file", required_argument, 0, 'f'},
+        {"parallel", required_argument, 0, 'p'},
+        {"stop-on-error", no_argument, 0, 'e'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    
+    int c;
+    while ((c = getopt_long(argc, argv, "f:p:eh", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'f':
+                file = optarg;
+                break;
+            case 'p':
+                parallel = atoi(optarg);
+                if (parallel < 1 || parallel > BATCH_MAX_PARALLEL) {
+                    fprintf(stderr, "--parallel must be between 1 and %d\n", BATCH_MAX_PARALLEL);
+                    return 1;
+                }
+                break;
+            case 'e':
+                stop_on_error = true;
+                break;
+            case 'h':
+                printf("Usage: batch [--file FILE] [--parallel N] [--stop-on-error]\n");
+                printf("Runs one command per line from FILE (default: stdin) on a shared client.\n");
+                printf("With --parallel, N worker processes each open their own client.\n");
+                printf("Output is written in input order. Lines starting with # are ignored.\n");
+                return 0;
+            default:
+                fprintf(stderr, "Use --help for usage information\n");
+                return 1;
+        }
+    }
+    
+    FILE *input = stdin;
+    if (file && strcmp(file, "-") != 0) {
+        input = fopen(file, "r");
+        if (!input) {
+            fprintf(stderr, "Failed to open %s: %s\n", file, strerror(errno));
+            return 1;
+        }
+    }
+    
+    // Read everything first so commands that prompt see EOF rather than
+    // swallowing the lines that follow them
+    batch_command_list_t list = {0};
+    int read_result = batch_read_commands(input, &list);
+    if (input != stdin) {
+        fclose(input);
+    }
+    
+    if (read_result != 0) {
+        batch_command_list_free(&list);
+        return 1;
+    }
+    
+    if (list.count == 0) {
+        batch_command_list_free(&list);
+        return 0;
+    }
+    
+    size_t failures;
+    if (parallel > 1 && list.count > 1) {
+        failures = batch_run_parallel(&list, parallel, stop_on_error);
+    } else {
+        do_client_t *client = cli_client_open();
+        if (!client) {
+            batch_command_list_free(&list);
+            return 1;
+        }
+        
+        do_client_t *previous = cli_set_shared_client(client);
+        failures = batch_run_serial(&list, 0, stop_on_error);
+        cli_set_shared_client(previous);
+        cli_client_close(client);
+    }
+    
+    if (failures > 0) {
+        fprintf(stderr, "batch: %zu of %zu commands failed\n", failures, list.count);
+    }
+    
+    batch_command_list_free(&list);
+    return failures > 0 ? 1 : 0;
+}
\ No newline at end of file
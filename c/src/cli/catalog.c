@@ -0,0 +1,291 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <time.h>
+#include "digitalocean/catalog.h"
+#include "digitalocean/alloc.h"
+#include "cli.h"
+
+// "the catalog from <date>", or what the catalog is when it was never
+// fetched (the hand-curated built-in one)
+static void describe(const do_catalog_t *catalog, char *out, size_t out_size) {
+    time_t when = (time_t)do_catalog_fetched_at(catalog);
+    struct tm tm;
+    char date[32];
+    if (when <= 0) {
+        snprintf(out, out_size, "the built-in catalog (hand-curated, never fetched)");
+    } else if (!gmtime_r(&when, &tm) || strftime(date, sizeof(date), "%Y-%m-%d %H:%M UTC",
+                                                  &tm) == 0) {
+        snprintf(out, out_size, "the catalog from an unknown date");
+    } else {
+        snprintf(out, out_size, "the catalog from %s%s", date,
+                 catalog == do_catalog_builtin() ? " (built in)" : "");
+    }
+}
+
+const struct do_catalog *cli_catalog_load(void) {
+    char *path = do_catalog_default_path();
+    do_catalog_t *saved = NULL;
+    if (path && do_catalog_load(path, &saved) == DO_SUCCESS &&
+        do_catalog_fetched_at(saved) > do_catalog_fetched_at(do_catalog_builtin())) {
+        do_free(path);
+        return saved;
+    }
+    do_free(path);
+    do_catalog_free(saved);
+    return do_catalog_builtin();
+}
+
+void cli_catalog_release(const struct do_catalog *catalog) {
+    do_catalog_free((do_catalog_t *)catalog);
+}
+
+bool cli_catalog_check_droplet(do_client_t *client, const do_create_droplet_request_t *request) {
+    // A stale catalog is refetched first; if that fails the older one
+    // still answers
+    const do_catalog_t *catalog = NULL;
+    do_result_t result = do_client_catalog(client, DO_CATALOG_DEFAULT_TTL, &catalog);
+    char source[96];
+    describe(catalog, source, sizeof(source));
+    if (result != DO_SUCCESS) {
+        fprintf(stderr, "Warning: failed to refresh the catalog: %s; checking against %s\n",
+                do_client_get_error_string(result), source);
+    }
+    
+    char error[512];
+    bool valid = do_catalog_validate_droplet(catalog, request, error, sizeof(error)) == DO_SUCCESS;
+    if (!valid) {
+        fprintf(stderr, "Invalid droplet: %s\n", error);
+        fprintf(stderr, "Checked against %s; run 'catalog refresh' if it is\n", source);
+        fprintf(stderr, "out of date, or pass --no-validate to let the API decide.\n");
+    } else if (error[0]) {
+        fprintf(stderr, "Warning: %s (checked against %s)\n", error, source);
+    }
+    return valid;
+}
+
+static void print_regions(const do_catalog_t *catalog, const char *size) {
+    printf("%-8s %-20s %s\n", "SLUG", "NAME", "AVAILABLE");
+    for (size_t i = 0; i < do_catalog_region_count(catalog); i++) {
+        const do_catalog_region_t *region = do_catalog_region_at(catalog, i);
+        if (size && !do_catalog_size_available(catalog, size, region->slug)) {
+            continue;
+        }
+        printf("%-8s %-20s %s\n", region->slug, region->name ? region->name : "N/A",
+               region->available ? "yes" : "no");
+    }
+}
+
+static void print_sizes(const do_catalog_t *catalog, const char *region) {
+    printf("%-26s %5s %8s %7s %8s %9s\n", "SLUG", "VCPUS", "MEMORY", "DISK", "TRANSFER",
+           "$/MONTH");
+    for (size_t i = 0; i < do_catalog_size_count(catalog); i++) {
+        const do_catalog_size_t *size = do_catalog_size_at(catalog, i);
+        if (region ? !do_catalog_size_available(catalog, size->slug, region) : !size->available) {
+            continue;
+        }
+        printf("%-26s %5u %6uMB %5uGB %6.1fTB %9.2f\n", size->slug, size->vcpus, size->memory,
+               size->disk, size->transfer, size->price_monthly);
+    }
+}
+
+static void print_images(const do_catalog_t *catalog, const char *region) {
+    printf("%-22s %-10s %-14s %-18s %s\n", "SLUG", "ID", "DISTRIBUTION", "NAME", "MIN DISK");
+    for (size_t i = 0; i < do_catalog_image_count(catalog); i++) {
+        const do_catalog_image_t *image = do_catalog_image_at(catalog, i);
+        if (region && !do_catalog_image_available(catalog, image->slug, region)) {
+            continue;
+        }
+        printf("%-22s %-10u %-14s %-18s %uGB\n", image->slug, image->id,
+               image->distribution ? image->distribution : "N/A",
+               image->name ? image->name : "N/A", image->min_disk_size);
+    }
+}
+
+static void print_summary(const do_catalog_t *catalog) {
+    size_t open = 0;
+    for (size_t i = 0; i < do_catalog_region_count(catalog); i++) {
+        open += do_catalog_region_at(catalog, i)->available;
+    }
+    char source[96];
+    describe(catalog, source, sizeof(source));
+    printf("Using %s\n", source);
+    printf("  %zu regions (%zu available), %zu sizes, %zu images\n",
+           do_catalog_region_count(catalog), open, do_catalog_size_count(catalog),
+           do_catalog_image_count(catalog));
+}
+
+// catalog refresh --out FILE: a fetch written where the caller says,
+// leaving the cache alone; this is what `make catalog` compiles in
+static int refresh_to(const char *out) {
+    do_client_t *client = cli_client_open();
+    if (!client) {
+        return 1;
+    }
+    
+    do_catalog_t *catalog = NULL;
+    do_result_t result = do_catalog_fetch(client, &catalog);
+    cli_client_close(client);
+    if (result == DO_SUCCESS) {
+        result = do_catalog_save(catalog, out);
+    }
+    if (result != DO_SUCCESS) {
+        fprintf(stderr, "Failed to refresh the catalog: %s\n", do_client_get_error_string(result));
+        do_catalog_free(catalog);
+        return 1;
+    }
+    
+    printf("Saved %zu regions, %zu sizes and %zu images to %s\n",
+           do_catalog_region_count(catalog), do_catalog_size_count(catalog),
+           do_catalog_image_count(catalog), out);
+    do_catalog_free(catalog);
+    return 0;
+}
+
+int cmd_catalog(int argc, char **argv) {
+    const char *region = NULL;
+    const char *size = NULL;
+    const char *image = NULL;
+    const char *out = NULL;
+    int64_t ttl = DO_CATALOG_DEFAULT_TTL;
+    
+    enum {
+        OPT_OFFLINE = 256,
+        OPT_TTL
+    };
+    
+    static struct option long_options[] = {
+        {"region", required_argument, 0, 'r'},
+        {"size", required_argument, 0, 's'},
+        {"image", required_argument, 0, 'i'},
+        {"out", required_argument, 0, 'o'},
+        {"ttl", required_argument, 0, OPT_TTL},
+        {"offline", no_argument, 0, OPT_OFFLINE},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    
+    int c;
+    while ((c = getopt_long(argc, argv, "r:s:i:o:h", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'r':
+                region = optarg;
+                break;
+            case 's':
+                size = optarg;
+                break;
+            case 'i':
+                image = optarg;
+                break;
+            case 'o':
+                out = optarg;
+                break;
+            case OPT_TTL: {
+                char *end;
+                long long seconds = strtoll(optarg, &end, 10);
+                if (*end != '\0' || end == optarg || seconds < 0) {
+                    fprintf(stderr, "Invalid --ttl: %s (seconds, 0 or more)\n", optarg);
+                    return 1;
+                }
+                ttl = seconds;
+                break;
+            }
+            case OPT_OFFLINE:
+                ttl = DO_CATALOG_OFFLINE;
+                break;
+            case 'h':
+                printf("Usage: catalog [regions [--size SIZE] | sizes [--region REGION] |\n");
+                printf("                images [--region REGION] | check SIZE REGION [--image IMAGE] |\n");
+                printf("                refresh [--out FILE]] [--ttl SECONDS] [--offline]\n");
+                printf("Answers from the local catalog of regions, sizes and distribution\n");
+                printf("images: the copy saved in the config directory, or the one built in.\n");
+                printf("It is refetched once older than --ttl (default %d), never with\n",
+                       DO_CATALOG_DEFAULT_TTL);
+                printf("--offline. refresh fetches now; with --out the result goes to FILE\n");
+                printf("instead of the config directory.\n");
+                return 0;
+            default:
+                fprintf(stderr, "Use --help for usage information\n");
+                return 1;
+        }
+    }
+    
+    const char *action = optind < argc ? argv[optind] : NULL;
+    bool check = action && strcmp(action, "check") == 0;
+    if ((check && argc - optind != 3) || (!check && action && argc - optind != 1)) {
+        fprintf(stderr, "Usage: catalog [regions|sizes|images|check SIZE REGION|refresh]\n");
+        return 1;
+    }
+    if (action && strcmp(action, "regions") != 0 && strcmp(action, "sizes") != 0 &&
+        strcmp(action, "images") != 0 && !check && strcmp(action, "refresh") != 0) {
+        fprintf(stderr, "Unknown catalog action: %s\n", action);
+        return 1;
+    }
+    
+    bool refresh = action && strcmp(action, "refresh") == 0;
+    if (refresh && out) {
+        return refresh_to(out);
+    }
+    if (refresh) {
+        ttl = 0;
+    }
+    
+    // Only a stale catalog needs a client; a fresh one answers offline
+    const do_catalog_t *catalog = cli_catalog_load();
+    do_client_t *client = NULL;
+    if (ttl != DO_CATALOG_OFFLINE && (int64_t)time(NULL) - do_catalog_fetched_at(catalog) >= ttl) {
+        client = cli_client_open();
+        if (!client) {
+            cli_catalog_release(catalog);
+            return 1;
+        }
+        cli_catalog_release(catalog);
+        do_result_t result = do_client_catalog(client, ttl, &catalog);
+        if (result != DO_SUCCESS) {
+            char source[96];
+            describe(catalog, source, sizeof(source));
+            fprintf(stderr, "Failed to refresh the catalog: %s; using %s\n",
+                    do_client_get_error_string(result), source);
+            if (refresh) {
+                cli_client_close(client);
+                return 1;
+            }
+        }
+    }
+    
+    int exit_code = 0;
+    if (refresh) {
+        print_summary(catalog);
+    } else if (!action) {
+        print_summary(catalog);
+    } else if (strcmp(action, "regions") == 0) {
+        print_regions(catalog, size);
+    } else if (strcmp(action, "sizes") == 0) {
+        print_sizes(catalog, region);
+    } else if (strcmp(action, "images") == 0) {
+        print_images(catalog, region);
+    } else {
+        do_create_droplet_request_t request = {0};
+        request.size = argv[optind + 1];
+        request.region = argv[optind + 2];
+        request.image = (char *)image;
+        char error[512];
+        if (do_catalog_validate_droplet(catalog, &request, error, sizeof(error)) == DO_SUCCESS &&
+            error[0] == '\0') {
+            printf("%s is available in %s\n", request.size, request.region);
+        } else {
+            printf("%s\n", error);
+            exit_code = 1;
+        }
+    }
+    
+    // A catalog from do_client_catalog() belongs to the client
+    if (client) {
+        cli_client_close(client);
+    } else {
+        cli_catalog_release(catalog);
+    }
+    return exit_code;
+}
\ No newline at end of file
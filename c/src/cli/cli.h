@@ -0,0 +1,109 @@
+#ifndef DO_CLI_H
+#define DO_CLI_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "digitalocean/client.h"
+
+// Command function declarations
+int cmd_account_info(int argc, char **argv);
+int cmd_droplets_list(int argc, char **argv);
+int cmd_droplets_get(int argc, char **argv);
+int cmd_droplets_watch(int argc, char **argv);
+int cmd_droplets_monitor(int argc, char **argv);
+int cmd_droplets_create(int argc, char **argv);
+int cmd_droplets_delete(int argc, char **argv);
+int cmd_droplets_action(int argc, char **argv);
+int cmd_tags_apply(int argc, char **argv);
+int cmd_export(int argc, char **argv);
+int cmd_catalog(int argc, char **argv);
+int cmd_config_set(int argc, char **argv);
+int cmd_config_get(int argc, char **argv);
+int cmd_agent(int argc, char **argv);
+int cmd_batch(int argc, char **argv);
+int cmd_raw(int argc, char **argv);
+int cmd_api(int argc, char **argv);
+int cmd_metrics(int argc, char **argv);
+
+// The saved catalog when it is newer than the built-in one, otherwise the
+// built-in one; never NULL and never fetched. Release it when done.
+struct do_catalog;
+const struct do_catalog *cli_catalog_load(void);
+void cli_catalog_release(const struct do_catalog *catalog);
+
+// Checks a create request against the client's catalog, refetched once
+// past the default TTL, before the request is sent. Prints why and returns
+// false when the API would turn it down; slugs the catalog does not know
+// only warn.
+bool cli_catalog_check_droplet(do_client_t *client, const do_create_droplet_request_t *request);
+
+// Run a single command; argv[0] is the command name
+int cli_dispatch(int argc, char **argv);
+
+// Client access for command handlers. Inside a long-lived process (the
+// agent, a batch run) this hands out the shared warm client instead of
+// building one. Setting the shared client returns the previous one.
+do_client_t *cli_client_open(void);
+void cli_client_close(do_client_t *client);
+do_client_t *cli_set_shared_client(do_client_t *client);
+
+// Builds the client before the command runs and starts connecting, so
+// argument parsing and request building overlap the handshake. The next
+// cli_client_open() takes it; an unused one is freed by the discard call.
+// Skipped when DO_CLI_NO_WARM_UP is set or the config is unusable.
+void cli_client_prewarm(void);
+void cli_client_discard_prewarmed(void);
+
+// --timing: print a per-request breakdown to stderr. Returns the previous
+// setting so nested dispatches can restore it.
+bool cli_set_timing(bool enabled);
+
+// Blocking fd I/O that retries on EINTR and short transfers; 0 on success
+int cli_write_all(int fd, const void *data, size_t len);
+int cli_read_all(int fd, void *data, size_t len);
+
+// Option values that take TEXT, @FILE or - for stdin; free() the result
+char *cli_load_text(const char *arg);
+
+// Output formats for list commands
+typedef enum {
+    CLI_OUTPUT_TABLE,
+    CLI_OUTPUT_NDJSON,
+    CLI_OUTPUT_CSV,
+    CLI_OUTPUT_TSV
+} cli_output_format_t;
+
+bool cli_output_parse_format(const char *name, cli_output_format_t *format);
+
+// Large append buffer in front of a FILE; rows are formatted straight into
+// it and written with one fwrite per flush
+#define CLI_WRITER_BUFFER_SIZE (256 * 1024)
+
+typedef struct {
+    FILE *stream;
+    char *buffer;
+    size_t length;
+    size_t capacity;
+    bool failed;
+} cli_writer_t;
+
+bool cli_writer_init(cli_writer_t *writer, FILE *stream);
+void cli_writer_flush(cli_writer_t *writer);
+void cli_writer_free(cli_writer_t *writer);
+void cli_writer_put(cli_writer_t *writer, const char *data, size_t len);
+void cli_writer_puts(cli_writer_t *writer, const char *str);
+void cli_writer_uint(cli_writer_t *writer, unsigned long value);
+void cli_writer_json_string(cli_writer_t *writer, const char *str);
+void cli_writer_json_text(cli_writer_t *writer, const char *str, size_t len);
+void cli_writer_json_view(cli_writer_t *writer, const do_str_view_t *view);
+void cli_writer_field(cli_writer_t *writer, cli_output_format_t format, const char *str);
+void cli_writer_field_text(cli_writer_t *writer, cli_output_format_t format, const char *str,
+                           size_t len);
+void cli_writer_field_view(cli_writer_t *writer, cli_output_format_t format,
+                           const do_str_view_t *view);
+
+// Agent forwarding: returns true if a running agent executed the command
+bool cli_agent_forward(int argc, char **argv, int *exit_code);
+
+#endif // DO_CLI_H
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "digitalocean/config.h"
+#include "digitalocean/alloc.h"
 
 int cmd_config_set(int argc, char **argv) {
     if (argc < 3) {
@@ -71,7 +72,7 @@ int cmd_config_get(int argc, char **argv) {
         if (strcmp(key, "token") == 0) {
             char *masked = do_config_mask_token(do_config_get_token(config));
             printf("token: %s\n", masked ? masked : "<error>");
-            free(masked);
+            do_free(masked);
         } else if (strcmp(key, "base-url") == 0) {
             printf("base-url: %s\n", do_config_get_base_url(config));
         } else {
@@ -84,7 +85,7 @@ int cmd_config_get(int argc, char **argv) {
         char *masked = do_config_mask_token(do_config_get_token(config));
         printf("  token: %s\n", masked ? masked : "<error>");
         printf("  base-url: %s\n", do_config_get_base_url(config));
-        free(masked);
+        do_free(masked);
     }
     
     do_config_free(config);
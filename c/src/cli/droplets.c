@@ -1,12 +1,16 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <getopt.h>
 #include <time.h>
-#include "digitalocean/client.h"
+#include "digitalocean/filter.h"
+#include "digitalocean/group.h"
+#include "digitalocean/alloc.h"
+#include "cli.h"
 
 static const char *get_public_ip(const do_droplet_t *droplet) {
-    if (!droplet->networks) return "N/A";
+    if (!droplet->networks) return NULL;
     
     for (size_t i = 0; i < droplet->networks->v4_count; i++) {
         if (droplet->networks->v4[i].type && 
@@ -14,7 +18,7 @@ static const char *get_public_ip(const do_droplet_t *droplet) {
             return droplet->networks->v4[i].ip_address;
         }
     }
-    return "N/A";
+    return NULL;
 }
 
 static void format_time(time_t timestamp, char *buffer, size_t size) {
@@ -22,57 +26,508 @@ static void format_time(time_t timestamp, char *buffer, size_t size) {
     strftime(buffer, size, "%Y-%m-%d", tm_info);
 }
 
+static do_str_view_t text_view(const char *text) {
+    return (do_str_view_t){text, text ? strlen(text) : 0, false};
+}
+
+// A decoded droplet seen as a view, so one row writer serves both
+// listings. tags has room for the droplet's tags.
+static void droplet_view_of(const do_droplet_t *droplet, do_droplet_view_t *view,
+                            do_str_view_t *tags) {
+    memset(view, 0, sizeof(*view));
+    view->id = droplet->id;
+    view->name = text_view(droplet->name);
+    view->memory = droplet->memory;
+    view->vcpus = droplet->vcpus;
+    view->disk = droplet->disk;
+    view->locked = droplet->locked;
+    view->status = text_view(droplet->status);
+    view->created_at = droplet->created_at;
+    view->size_slug = text_view(droplet->size_slug);
+    view->region = text_view(droplet->region ? droplet->region->slug : NULL);
+    view->image = text_view(droplet->image ? droplet->image->slug : NULL);
+    view->public_ipv4 = text_view(get_public_ip(droplet));
+    view->vpc_uuid = text_view(droplet->vpc_uuid);
+    for (size_t i = 0; i < droplet->tags.count; i++) {
+        tags[i] = text_view(droplet->tags.items[i]);
+    }
+    view->tags = tags;
+    view->tags_count = droplet->tags.count;
+}
+
+// A table column, "N/A" when the value is missing
+static void print_view_column(const do_str_view_t *view, int width) {
+    if (!view->data) {
+        printf("%-*s ", width, "N/A");
+    } else if (!view->escaped) {
+        printf("%-*.*s ", width, (int)view->len, view->data);
+    } else {
+        char *text = do_str_view_dup(view);
+        printf("%-*s ", width, text ? text : "N/A");
+        do_free(text);
+    }
+}
+
+typedef struct {
+    cli_output_format_t format;
+    cli_writer_t writer;
+    size_t rows;
+    bool all_profiles;   // adds a profile column
+    const char *profile; // account of the row being printed
+} droplet_list_output_t;
+
+static void write_droplet_row(cli_writer_t *writer, cli_output_format_t format,
+                              const char *profile, const do_droplet_view_t *droplet) {
+    char created_str[32];
+    strftime(created_str, sizeof(created_str), "%Y-%m-%dT%H:%M:%SZ", gmtime(&droplet->created_at));
+    
+    if (format == CLI_OUTPUT_NDJSON) {
+        cli_writer_puts(writer, "{");
+        if (profile) {
+            cli_writer_puts(writer, "\"profile\":");
+            cli_writer_json_string(writer, profile);
+            cli_writer_puts(writer, ",");
+        }
+        cli_writer_puts(writer, "\"id\":");
+        cli_writer_uint(writer, droplet->id);
+        cli_writer_puts(writer, ",\"name\":");
+        cli_writer_json_view(writer, &droplet->name);
+        cli_writer_puts(writer, ",\"status\":");
+        cli_writer_json_view(writer, &droplet->status);
+        cli_writer_puts(writer, ",\"size\":");
+        cli_writer_json_view(writer, &droplet->size_slug);
+        cli_writer_puts(writer, ",\"region\":");
+        cli_writer_json_view(writer, &droplet->region);
+        cli_writer_puts(writer, ",\"memory\":");
+        cli_writer_uint(writer, droplet->memory);
+        cli_writer_puts(writer, ",\"vcpus\":");
+        cli_writer_uint(writer, droplet->vcpus);
+        cli_writer_puts(writer, ",\"disk\":");
+        cli_writer_uint(writer, droplet->disk);
+        cli_writer_puts(writer, ",\"public_ip\":");
+        cli_writer_json_view(writer, &droplet->public_ipv4);
+        cli_writer_puts(writer, ",\"tags\":[");
+        for (size_t i = 0; i < droplet->tags_count; i++) {
+            if (i > 0) cli_writer_put(writer, ",", 1);
+            cli_writer_json_view(writer, &droplet->tags[i]);
+        }
+        cli_writer_puts(writer, "],\"created_at\":");
+        cli_writer_json_string(writer, created_str);
+        cli_writer_puts(writer, "}\n");
+        return;
+    }
+    
+    const char *sep = format == CLI_OUTPUT_TSV ? "\t" : ",";
+    
+    if (profile) {
+        cli_writer_field(writer, format, profile);
+        cli_writer_puts(writer, sep);
+    }
+    cli_writer_uint(writer, droplet->id);
+    cli_writer_puts(writer, sep);
+    cli_writer_field_view(writer, format, &droplet->name);
+    cli_writer_puts(writer, sep);
+    cli_writer_field_view(writer, format, &droplet->status);
+    cli_writer_puts(writer, sep);
+    cli_writer_field_view(writer, format, &droplet->size_slug);
+    cli_writer_puts(writer, sep);
+    cli_writer_field_view(writer, format, &droplet->region);
+    cli_writer_puts(writer, sep);
+    cli_writer_uint(writer, droplet->memory);
+    cli_writer_puts(writer, sep);
+    cli_writer_uint(writer, droplet->vcpus);
+    cli_writer_puts(writer, sep);
+    cli_writer_uint(writer, droplet->disk);
+    cli_writer_puts(writer, sep);
+    cli_writer_field_view(writer, format, &droplet->public_ipv4);
+    cli_writer_puts(writer, sep);
+    
+    // Tags are space-joined so the column count stays fixed; decoding
+    // never makes a tag longer, so the raw lengths bound the join
+    size_t tags_len = 0;
+    for (size_t i = 0; i < droplet->tags_count; i++) {
+        tags_len += droplet->tags[i].len + 1;
+    }
+    char joined[512];
+    char *tags = tags_len <= sizeof(joined) ? joined : malloc(tags_len);
+    if (tags && tags_len) {
+        size_t length = 0;
+        for (size_t i = 0; i < droplet->tags_count; i++) {
+            if (i > 0) tags[length++] = ' ';
+            long decoded = do_str_view_decode(&droplet->tags[i], tags + length);
+            length += decoded > 0 ? (size_t)decoded : 0;
+        }
+        cli_writer_field_text(writer, format, tags, length);
+    }
+    if (tags != joined) {
+        free(tags);
+    }
+    cli_writer_puts(writer, sep);
+    cli_writer_puts(writer, created_str);
+    cli_writer_puts(writer, "\n");
+}
+
+static do_result_t print_droplet_view_row(const do_droplet_view_t *droplet,
+                                          const do_list_position_t *position,
+                                          droplet_list_output_t *output) {
+    cli_writer_t *writer = &output->writer;
+    
+    if (output->rows == 0) {
+        if (output->format == CLI_OUTPUT_TABLE) {
+            if (output->all_profiles) {
+                printf("%-12s ", "PROFILE");
+            }
+            printf("%-8s %-20s %-10s %-12s %-10s %-15s %s\n", 
+                   "ID", "NAME", "STATUS", "SIZE", "REGION", "IP", "CREATED");
+            if (output->all_profiles) {
+                printf("%-12s ", "-------");
+            }
+            printf("%-8s %-20s %-10s %-12s %-10s %-15s %s\n", 
+                   "--", "----", "------", "----", "------", "--", "-------");
+        } else if (output->format == CLI_OUTPUT_CSV || output->format == CLI_OUTPUT_TSV) {
+            if (output->all_profiles) {
+                cli_writer_puts(writer, output->format == CLI_OUTPUT_CSV ? "profile," : "profile\t");
+            }
+            const char *header = output->format == CLI_OUTPUT_CSV
+                ? "id,name,status,size,region,memory,vcpus,disk,public_ip,tags,created_at\n"
+                : "id\tname\tstatus\tsize\tregion\tmemory\tvcpus\tdisk\tpublic_ip\ttags\tcreated_at\n";
+            cli_writer_puts(writer, header);
+        }
+    }
+    
+    if (output->format == CLI_OUTPUT_TABLE) {
+        char created_str[32];
+        format_time(droplet->created_at, created_str, sizeof(created_str));
+        
+        if (output->all_profiles) {
+            printf("%-12s ", output->profile);
+        }
+        printf("%-8u ", droplet->id);
+        print_view_column(&droplet->name, 20);
+        print_view_column(&droplet->status, 10);
+        print_view_column(&droplet->size_slug, 12);
+        print_view_column(&droplet->region, 10);
+        print_view_column(&droplet->public_ipv4, 15);
+        printf("%s\n", created_str);
+    } else {
+        write_droplet_row(writer, output->format, output->profile, droplet);
+    }
+    output->rows++;
+    
+    // Hand each finished page to the terminal instead of waiting for the end
+    if (position->page_index + 1 == position->page_count) {
+        cli_writer_flush(writer);
+    }
+    
+    return writer->failed ? DO_ERROR_INVALID_PARAM : DO_SUCCESS;
+}
+
+static do_result_t print_droplet_row(const do_droplet_t *droplet,
+                                     const do_list_position_t *position, void *userdata) {
+    do_str_view_t few_tags[16];
+    do_str_view_t *tags = droplet->tags.count <= 16
+        ? few_tags : malloc(droplet->tags.count * sizeof(do_str_view_t));
+    if (!tags) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_droplet_view_t view;
+    droplet_view_of(droplet, &view, tags);
+    do_result_t result = print_droplet_view_row(&view, position, userdata);
+    if (tags != few_tags) {
+        free(tags);
+    }
+    return result;
+}
+
+static do_result_t print_profile_droplet_row(const char *profile, const do_droplet_t *droplet,
+                                             const do_list_position_t *position, void *userdata) {
+    droplet_list_output_t *output = userdata;
+    output->profile = profile;
+    return print_droplet_row(droplet, position, output);
+}
+
+// --all-profiles: every [profile NAME] account listed concurrently
+static int droplets_list_all_profiles(droplet_list_output_t *output) {
+    do_client_group_t *group = do_client_group_new();
+    if (!group) {
+        fprintf(stderr, "Failed to create client group\n");
+        return 1;
+    }
+    
+    do_result_t result = do_client_group_load_profiles(group);
+    if (result != DO_SUCCESS) {
+        fprintf(stderr, "Failed to load profiles: %s\n", do_client_get_error_string(result));
+        do_client_group_free(group);
+        return 1;
+    }
+    if (do_client_group_count(group) == 0) {
+        fprintf(stderr, "No profiles configured; add [profile NAME] sections with a token to the config file\n");
+        do_client_group_free(group);
+        return 1;
+    }
+    
+    if (!cli_writer_init(&output->writer, stdout)) {
+        fprintf(stderr, "Failed to allocate output buffer\n");
+        do_client_group_free(group);
+        return 1;
+    }
+    
+    result = do_client_group_list_droplets_each(group, print_profile_droplet_row, output);
+    cli_writer_free(&output->writer);
+    
+    // One account failing does not hide the others' droplets
+    for (size_t i = 0; i < do_client_group_count(group); i++) {
+        do_result_t member_result = do_client_group_result(group, i);
+        if (member_result != DO_SUCCESS) {
+            fprintf(stderr, "Failed to list droplets for profile %s: %s\n",
+                    do_client_group_name(group, i), do_client_get_error_string(member_result));
+        }
+    }
+    
+    if (output->rows == 0 && output->format == CLI_OUTPUT_TABLE && result == DO_SUCCESS) {
+        printf("No droplets found\n");
+    }
+    
+    do_client_group_free(group);
+    return result == DO_SUCCESS ? 0 : 1;
+}
+
 int cmd_droplets_list(int argc, char **argv) {
-    (void)argc; // Unused parameter
-    (void)argv; // Unused parameter
+    droplet_list_output_t output;
+    output.format = CLI_OUTPUT_TABLE;
+    output.rows = 0;
+    output.all_profiles = false;
+    output.profile = NULL;
+    const char *filter_arg = NULL;
+    
+    static struct option long_options[] = {
+        {"output", required_argument, 0, 'o'},
+        {"all-profiles", no_argument, 0, 'A'},
+        {"filter", required_argument, 0, 'f'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    
+    int c;
+    while ((c = getopt_long(argc, argv, "o:Af:h", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'o':
+                if (!cli_output_parse_format(optarg, &output.format)) {
+                    fprintf(stderr, "Unknown output format: %s (use table, ndjson, csv or tsv)\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'A':
+                output.all_profiles = true;
+                break;
+            case 'f':
+                filter_arg = optarg;
+                break;
+            case 'h':
+                printf("Usage: droplets-list [--output table|ndjson|csv|tsv] [--all-profiles]\n");
+                printf("                     [--filter EXPR]\n");
+                printf("EXPR is clauses joined by \"and\", e.g.\n");
+                printf("  'tag=web and region=nyc3 and status!=active and memory>=4096'\n");
+                printf("Operators: = != < <= > >= ~ (substring). Fields: id name status memory\n");
+                printf("vcpus disk locked region size image vpc created tag\n");
+                return 0;
+            default:
+                fprintf(stderr, "Use --help for usage information\n");
+                return 1;
+        }
+    }
+    
+    if (output.all_profiles) {
+        if (filter_arg) {
+            fprintf(stderr, "--filter cannot be combined with --all-profiles\n");
+            return 1;
+        }
+        return droplets_list_all_profiles(&output);
+    }
+    
+    // Compiled before anything is fetched so a typo costs no requests
+    do_droplet_filter_t *filter = NULL;
+    if (filter_arg) {
+        char error[256];
+        do_result_t result = do_droplet_filter_compile(filter_arg, &filter, error, sizeof(error));
+        if (result != DO_SUCCESS) {
+            fprintf(stderr, "Invalid filter: %s\n", error);
+            return 1;
+        }
+    }
     
-    do_client_t *client = do_client_new();
+    do_client_t *client = cli_client_open();
     if (!client) {
-        fprintf(stderr, "Failed to create client\n");
+        do_droplet_filter_free(filter);
         return 1;
     }
     
-    do_result_t result = do_client_init_from_config(client);
-    if (result != DO_SUCCESS) {
-        fprintf(stderr, "Failed to initialize client: %s\n", do_client_get_error_string(result));
-        do_client_free(client);
+    if (!cli_writer_init(&output.writer, stdout)) {
+        fprintf(stderr, "Failed to allocate output buffer\n");
+        do_droplet_filter_free(filter);
+        cli_client_close(client);
         return 1;
     }
     
-    do_droplet_list_t *droplets;
-    result = do_client_list_droplets(client, &droplets);
+    // Rows are printed page by page while the next page is fetched in the
+    // background; the fleet is never held in memory as a whole
+    do_list_cursor_t *cursor = NULL;
+    do_list_position_t position = {0};
+    do_result_t result = do_cursor_open_droplet_views_filtered(client, filter, &cursor);
+    while (result == DO_SUCCESS) {
+        const void *items;
+        size_t count;
+        result = do_cursor_next(cursor, &items, &count);
+        if (result != DO_SUCCESS || count == 0) {
+            break;
+        }
+        
+        // Rows are written straight from the page text
+        const do_droplet_view_t *droplets = items;
+        position.total = do_cursor_total(cursor);
+        position.page_count = count;
+        for (position.page_index = 0; position.page_index < count && result == DO_SUCCESS;
+             position.page_index++, position.index++) {
+            result = print_droplet_view_row(&droplets[position.page_index], &position, &output);
+        }
+    }
+    do_cursor_close(cursor);
+    do_droplet_filter_free(filter);
+    cli_writer_free(&output.writer);
+    
     if (result != DO_SUCCESS) {
         fprintf(stderr, "Failed to list droplets: %s\n", do_client_get_error_string(result));
-        do_client_free(client);
+        cli_client_close(client);
         return 1;
     }
     
-    if (droplets->count == 0) {
-        printf("No droplets found\n");
+    if (output.rows == 0 && output.format == CLI_OUTPUT_TABLE) {
+        printf("%s\n", filter_arg ? "No droplets match the filter" : "No droplets found");
+    }
+    
+    cli_client_close(client);
+    return 0;
+}
+
+// --interval accepts 500ms, 5s, 2m or plain seconds
+static bool parse_interval(const char *text, long *interval_ms) {
+    char *end;
+    double value = strtod(text, &end);
+    if (end == text || value <= 0) {
+        return false;
+    }
+    
+    if (strcmp(end, "ms") == 0) {
+        *interval_ms = (long)value;
+    } else if (*end == '\0' || strcmp(end, "s") == 0) {
+        *interval_ms = (long)(value * 1000);
+    } else if (strcmp(end, "m") == 0) {
+        *interval_ms = (long)(value * 60000);
     } else {
-        printf("%-8s %-20s %-10s %-12s %-10s %-15s %s\n", 
-               "ID", "NAME", "STATUS", "SIZE", "REGION", "IP", "CREATED");
-        printf("%-8s %-20s %-10s %-12s %-10s %-15s %s\n", 
-               "--", "----", "------", "----", "------", "--", "-------");
+        return false;
+    }
+    
+    return *interval_ms > 0;
+}
+
+static const do_droplet_t *find_droplet(const do_droplet_list_t *list, uint32_t id) {
+    for (size_t i = 0; i < list->count; i++) {
+        if (list->items[i].id == id) {
+            return &list->items[i];
+        }
+    }
+    return NULL;
+}
+
+static void print_change(char mark, const do_droplet_t *droplet) {
+    char stamp[32];
+    time_t now = time(NULL);
+    strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+    
+    printf("%s %c %u %s %s %s\n", stamp, mark, droplet->id,
+           droplet->name ? droplet->name : "N/A",
+           droplet->status ? droplet->status : "N/A",
+           droplet->region && droplet->region->slug ? droplet->region->slug : "N/A");
+}
+
+int cmd_droplets_watch(int argc, char **argv) {
+    long interval_ms = 5000;
+    long count = 0; // refreshes before exiting; 0 runs until interrupted
+    
+    static struct option long_options[] = {
+        {"interval", required_argument, 0, 'i'},
+        {"count", required_argument, 0, 'c'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    
+    int c;
+    while ((c = getopt_long(argc, argv, "i:c:h", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'i':
+                if (!parse_interval(optarg, &interval_ms)) {
+                    fprintf(stderr, "Invalid interval: %s (e.g. 500ms, 5s, 2m)\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'c':
+                count = atol(optarg);
+                break;
+            case 'h':
+                printf("Usage: droplets-watch [--interval 5s] [--count N]\n");
+                printf("Prints droplets as they are added (+), modified (~) or removed (-)\n");
+                return 0;
+            default:
+                fprintf(stderr, "Use --help for usage information\n");
+                return 1;
+        }
+    }
+    
+    do_client_t *client = cli_client_open();
+    if (!client) {
+        return 1;
+    }
+    
+    do_droplet_list_t *list = NULL;
+    do_result_t result = do_droplet_list_refresh(client, &list, NULL);
+    if (result != DO_SUCCESS) {
+        fprintf(stderr, "Failed to list droplets: %s\n", do_client_get_error_string(result));
+        cli_client_close(client);
+        return 1;
+    }
+    
+    printf("Watching %zu droplets\n", list->count);
+    fflush(stdout);
+    
+    // Only droplets whose JSON changed are decoded on each pass
+    for (long refreshes = 1; count == 0 || refreshes < count; refreshes++) {
+        struct timespec delay = {interval_ms / 1000, (interval_ms % 1000) * 1000000};
+        nanosleep(&delay, NULL);
         
-        for (size_t i = 0; i < droplets->count; i++) {
-            const do_droplet_t *droplet = &droplets->items[i];
-            char created_str[32];
-            format_time(droplet->created_at, created_str, sizeof(created_str));
-            
-            printf("%-8u %-20s %-10s %-12s %-10s %-15s %s\n",
-                   droplet->id,
-                   droplet->name ? droplet->name : "N/A",
-                   droplet->status ? droplet->status : "N/A",
-                   droplet->size_slug ? droplet->size_slug : "N/A",
-                   droplet->region && droplet->region->slug ? droplet->region->slug : "N/A",
-                   get_public_ip(droplet),
-                   created_str);
+        do_droplet_changes_t changes;
+        result = do_droplet_list_refresh(client, &list, &changes);
+        if (result != DO_SUCCESS) {
+            fprintf(stderr, "Refresh failed: %s\n", do_client_get_error_string(result));
+            continue;
+        }
+        
+        for (size_t i = 0; i < changes.added_count; i++) {
+            print_change('+', find_droplet(list, changes.added[i]));
+        }
+        for (size_t i = 0; i < changes.modified_count; i++) {
+            print_change('~', find_droplet(list, changes.modified[i]));
+        }
+        for (size_t i = 0; i < changes.removed_count; i++) {
+            print_change('-', &changes.removed[i]);
         }
+        fflush(stdout);
+        
+        do_droplet_changes_free(&changes);
     }
     
-    do_droplet_list_free(droplets);
-    do_client_free(client);
+    do_droplet_list_free(list);
+    cli_client_close(client);
     return 0;
 }
 
@@ -88,24 +543,16 @@ int cmd_droplets_get(int argc, char **argv) {
         return 1;
     }
     
-    do_client_t *client = do_client_new();
+    do_client_t *client = cli_client_open();
     if (!client) {
-        fprintf(stderr, "Failed to create client\n");
-        return 1;
-    }
-    
-    do_result_t result = do_client_init_from_config(client);
-    if (result != DO_SUCCESS) {
-        fprintf(stderr, "Failed to initialize client: %s\n", do_client_get_error_string(result));
-        do_client_free(client);
         return 1;
     }
     
     do_droplet_t *droplet;
-    result = do_client_get_droplet(client, id, &droplet);
+    do_result_t result = do_client_get_droplet(client, id, &droplet);
     if (result != DO_SUCCESS) {
         fprintf(stderr, "Failed to get droplet: %s\n", do_client_get_error_string(result));
-        do_client_free(client);
+        cli_client_close(client);
         return 1;
     }
     
@@ -166,42 +613,102 @@ int cmd_droplets_get(int argc, char **argv) {
     }
     
     do_droplet_free(droplet);
-    do_client_free(client);
+    do_free(droplet);
+    cli_client_close(client);
     return 0;
 }
 
-int cmd_droplets_create(int argc, char **argv) {
-    char *name = NULL;
-    char *region = NULL;
-    char *size = NULL;
-    char *image = NULL;
+// Fills request from the command line and submits it. The request's
+// arrays and user data are owned by the caller.
+static int droplets_create_with(int argc, char **argv, do_create_droplet_request_t *request) {
+    const char *user_data_arg = NULL;
+    bool validate = true;
+    
+    enum {
+        OPT_SSH_KEY = 256,
+        OPT_VOLUME,
+        OPT_USER_DATA,
+        OPT_VPC_UUID,
+        OPT_BACKUPS,
+        OPT_IPV6,
+        OPT_MONITORING,
+        OPT_PRIVATE_NETWORKING,
+        OPT_NO_VALIDATE
+    };
     
     static struct option long_options[] = {
         {"name", required_argument, 0, 'n'},
         {"region", required_argument, 0, 'r'},
         {"size", required_argument, 0, 's'},
         {"image", required_argument, 0, 'i'},
+        {"tag", required_argument, 0, 't'},
+        {"ssh-key", required_argument, 0, OPT_SSH_KEY},
+        {"volume", required_argument, 0, OPT_VOLUME},
+        {"user-data", required_argument, 0, OPT_USER_DATA},
+        {"vpc-uuid", required_argument, 0, OPT_VPC_UUID},
+        {"backups", no_argument, 0, OPT_BACKUPS},
+        {"ipv6", no_argument, 0, OPT_IPV6},
+        {"monitoring", no_argument, 0, OPT_MONITORING},
+        {"private-networking", no_argument, 0, OPT_PRIVATE_NETWORKING},
+        {"no-validate", no_argument, 0, OPT_NO_VALIDATE},
         {"help", no_argument, 0, 'h'},
         {0, 0, 0, 0}
     };
     
     int c;
-    while ((c = getopt_long(argc, argv, "n:r:s:i:h", long_options, NULL)) != -1) {
+    while ((c = getopt_long(argc, argv, "n:r:s:i:t:h", long_options, NULL)) != -1) {
         switch (c) {
             case 'n':
-                name = optarg;
+                request->name = optarg;
                 break;
             case 'r':
-                region = optarg;
+                request->region = optarg;
                 break;
             case 's':
-                size = optarg;
+                request->size = optarg;
                 break;
             case 'i':
-                image = optarg;
+                request->image = optarg;
+                break;
+            case 't':
+                do_string_array_add(&request->tags, optarg);
+                break;
+            case OPT_SSH_KEY:
+                do_string_array_add(&request->ssh_keys, optarg);
+                break;
+            case OPT_VOLUME:
+                do_string_array_add(&request->volumes, optarg);
+                break;
+            case OPT_USER_DATA:
+                user_data_arg = optarg;
+                break;
+            case OPT_VPC_UUID:
+                request->vpc_uuid = optarg;
+                break;
+            case OPT_BACKUPS:
+                request->backups = true;
+                break;
+            case OPT_IPV6:
+                request->ipv6 = true;
+                break;
+            case OPT_MONITORING:
+                request->monitoring = true;
+                break;
+            case OPT_PRIVATE_NETWORKING:
+                request->private_networking = true;
+                break;
+            case OPT_NO_VALIDATE:
+                validate = false;
                 break;
             case 'h':
                 printf("Usage: droplets-create --name NAME --region REGION --size SIZE --image IMAGE\n");
+                printf("                       [--ssh-key ID|FINGERPRINT]... [--tag TAG]... [--volume ID]...\n");
+                printf("                       [--user-data TEXT|@FILE|-] [--vpc-uuid UUID]\n");
+                printf("                       [--backups] [--ipv6] [--monitoring] [--private-networking]\n");
+                printf("                       [--no-validate]\n");
+                printf("The region, size and image are checked against the local catalog first,\n");
+                printf("refetched once it is a day old (see catalog --help). Slugs it does not\n");
+                printf("know only warn; --no-validate leaves the whole check to the API.\n");
                 return 0;
             default:
                 fprintf(stderr, "Use --help for usage information\n");
@@ -209,38 +716,34 @@ int cmd_droplets_create(int argc, char **argv) {
         }
     }
     
-    if (!name || !region || !size || !image) {
+    if (!request->name || !request->region || !request->size || !request->image) {
         fprintf(stderr, "Required options: --name, --region, --size, --image\n");
         return 1;
     }
     
-    do_client_t *client = do_client_new();
+    if (user_data_arg) {
+        request->user_data = cli_load_text(user_data_arg);
+        if (!request->user_data) {
+            fprintf(stderr, "Failed to read user data\n");
+            return 1;
+        }
+    }
+    
+    do_client_t *client = cli_client_open();
     if (!client) {
-        fprintf(stderr, "Failed to create client\n");
         return 1;
     }
     
-    do_result_t result = do_client_init_from_config(client);
-    if (result != DO_SUCCESS) {
-        fprintf(stderr, "Failed to initialize client: %s\n", do_client_get_error_string(result));
-        do_client_free(client);
+    if (validate && !cli_catalog_check_droplet(client, request)) {
+        cli_client_close(client);
         return 1;
     }
     
-    do_create_droplet_request_t request = {0};
-    request.name = name;
-    request.region = region;
-    request.size = size;
-    request.image = image;
-    do_string_array_init(&request.tags);
-    do_string_array_init(&request.ssh_keys);
-    do_string_array_init(&request.volumes);
-    
     do_droplet_t *droplet;
-    result = do_client_create_droplet(client, &request, &droplet);
+    do_result_t result = do_client_create_droplet(client, request, &droplet);
     if (result != DO_SUCCESS) {
         fprintf(stderr, "Failed to create droplet: %s\n", do_client_get_error_string(result));
-        do_client_free(client);
+        cli_client_close(client);
         return 1;
     }
     
@@ -248,14 +751,30 @@ int cmd_droplets_create(int argc, char **argv) {
     printf("  ID: %u\n", droplet->id);
     printf("  Name: %s\n", droplet->name ? droplet->name : "N/A");
     printf("  Status: %s\n", droplet->status ? droplet->status : "N/A");
-    printf("  Region: %s\n", region);
-    printf("  Size: %s\n", size);
+    printf("  Region: %s\n", request->region);
+    printf("  Size: %s\n", request->size);
     
     do_droplet_free(droplet);
-    do_client_free(client);
+    do_free(droplet);
+    cli_client_close(client);
     return 0;
 }
 
+int cmd_droplets_create(int argc, char **argv) {
+    do_create_droplet_request_t request = {0};
+    do_string_array_init(&request.tags);
+    do_string_array_init(&request.ssh_keys);
+    do_string_array_init(&request.volumes);
+    
+    int exit_code = droplets_create_with(argc, argv, &request);
+    
+    free(request.user_data);
+    do_string_array_free(&request.tags);
+    do_string_array_free(&request.ssh_keys);
+    do_string_array_free(&request.volumes);
+    return exit_code;
+}
+
 int cmd_droplets_delete(int argc, char **argv) {
     if (argc < 2) {
         fprintf(stderr, "Usage: droplets-delete <id>\n");
@@ -269,6 +788,7 @@ int cmd_droplets_delete(int argc, char **argv) {
     }
     
     printf("Are you sure you want to delete droplet %u? (y/N): ", id);
+    fflush(stdout);
     char response[10];
     if (!fgets(response, sizeof(response), stdin)) {
         printf("Cancelled\n");
@@ -280,27 +800,117 @@ int cmd_droplets_delete(int argc, char **argv) {
         return 0;
     }
     
-    do_client_t *client = do_client_new();
+    do_client_t *client = cli_client_open();
     if (!client) {
-        fprintf(stderr, "Failed to create client\n");
         return 1;
     }
     
-    do_result_t result = do_client_init_from_config(client);
+    do_result_t result = do_client_delete_droplet(client, id);
     if (result != DO_SUCCESS) {
-        fprintf(stderr, "Failed to initialize client: %s\n", do_client_get_error_string(result));
-        do_client_free(client);
+        fprintf(stderr, "Failed to delete droplet: %s\n", do_client_get_error_string(result));
+        cli_client_close(client);
+        return 1;
+    }
+    
+    printf("Droplet %u deleted successfully\n", id);
+    cli_client_close(client);
+    return 0;
+}
+
+static void print_action(const do_action_t *action) {
+    printf("%-12u %-14s %-26s %-12u %s\n", action->id,
+           action->status ? action->status : "N/A",
+           action->type ? action->type : "N/A",
+           action->resource_id,
+           action->region_slug ? action->region_slug : "N/A");
+}
+
+int cmd_droplets_action(int argc, char **argv) {
+    const char *tag = NULL;
+    const char *snapshot_name = NULL;
+    
+    static struct option long_options[] = {
+        {"tag", required_argument, 0, 't'},
+        {"name", required_argument, 0, 'n'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    
+    int c;
+    while ((c = getopt_long(argc, argv, "t:n:h", long_options, NULL)) != -1) {
+        switch (c) {
+            case 't':
+                tag = optarg;
+                break;
+            case 'n':
+                snapshot_name = optarg;
+                break;
+            case 'h':
+                printf("Usage: droplets-action <type> (<id> | --tag TAG) [--name SNAPSHOT]\n");
+                printf("With --tag the action is applied to every droplet with the tag in one\n");
+                printf("request. --name names the snapshot taken by the snapshot action.\n");
+                printf("Types:");
+                for (int i = 0; i < DO_DROPLET_ACTION_TYPE_COUNT; i++) {
+                    printf(" %s", do_droplet_action_type_name((do_droplet_action_type_t)i));
+                }
+                printf("\n");
+                return 0;
+            default:
+                fprintf(stderr, "Use --help for usage information\n");
+                return 1;
+        }
+    }
+    
+    if (optind >= argc || (tag == NULL) == (optind + 1 >= argc)) {
+        fprintf(stderr, "Usage: droplets-action <type> (<id> | --tag TAG)\n");
+        return 1;
+    }
+    
+    do_droplet_action_type_t type;
+    if (!do_droplet_action_type_parse(argv[optind], &type)) {
+        fprintf(stderr, "Unknown action type: %s\n", argv[optind]);
+        return 1;
+    }
+    
+    uint32_t id = tag ? 0 : (uint32_t)atoi(argv[optind + 1]);
+    if (!tag && id == 0) {
+        fprintf(stderr, "Invalid droplet ID: %s\n", argv[optind + 1]);
         return 1;
     }
     
-    result = do_client_delete_droplet(client, id);
+    do_client_t *client = cli_client_open();
+    if (!client) {
+        return 1;
+    }
+    
+    do_action_list_t *actions = NULL;
+    do_action_t *action = NULL;
+    do_result_t result = tag
+        ? do_client_droplet_action_by_tag(client, tag, type, snapshot_name, &actions)
+        : do_client_droplet_action(client, id, type, snapshot_name, &action);
     if (result != DO_SUCCESS) {
-        fprintf(stderr, "Failed to delete droplet: %s\n", do_client_get_error_string(result));
-        do_client_free(client);
+        fprintf(stderr, "Failed to start action: %s\n", do_client_get_error_string(result));
+        cli_client_close(client);
         return 1;
     }
     
-    printf("Droplet %u deleted successfully\n", id);
-    do_client_free(client);
+    if (actions && actions->count == 0) {
+        printf("No droplets tagged %s\n", tag);
+    } else {
+        printf("%-12s %-14s %-26s %-12s %s\n", "ACTION", "STATUS", "TYPE", "DROPLET", "REGION");
+    }
+    
+    if (action) {
+        print_action(action);
+        do_action_free(action);
+        do_free(action);
+    } else {
+        for (size_t i = 0; i < actions->count; i++) {
+            print_action(&actions->items[i]);
+        }
+        do_action_list_free(actions);
+    }
+    
+    cli_client_close(client);
     return 0;
 }
\ No newline at end of file
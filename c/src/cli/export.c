@@ -0,0 +1,155 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "digitalocean/export.h"
+#include "cli.h"
+
+static bool has_suffix(const char *text, const char *suffix) {
+    size_t len = strlen(text);
+    size_t suffix_len = strlen(suffix);
+    return len >= suffix_len && strcmp(text + len - suffix_len, suffix) == 0;
+}
+
+static void print_manifest(const do_export_manifest_t *manifest, const char *out) {
+    size_t total = 0;
+    fprintf(stderr, "%-16s %8s %6s %9s\n", "RESOURCE", "ITEMS", "PAGES", "TIME");
+    for (int i = 0; i < DO_EXPORT_RESOURCE_COUNT; i++) {
+        const do_export_count_t *count = &manifest->resources[i];
+        fprintf(stderr, "%-16s %8zu %6zu %8.2fs", do_export_resource_name((do_export_resource_t)i),
+                count->items, count->pages, count->elapsed_us / 1e6);
+        if (count->result != DO_SUCCESS) {
+            fprintf(stderr, "  %s", do_client_get_error_string(count->result));
+        }
+        fprintf(stderr, "\n");
+        total += count->items;
+    }
+    fprintf(stderr, "Exported %zu items to %s (%.1f KB, %.1f KB written) in %.2fs\n", total,
+            out, manifest->bytes_in / 1024.0, manifest->bytes_out / 1024.0,
+            manifest->elapsed_us / 1e6);
+}
+
+int cmd_export(int argc, char **argv) {
+    const char *out = NULL;
+    const char *compress = NULL;
+    do_export_options_t options = {DO_EXPORT_PLAIN, 0, 0, 0};
+    
+    static struct option long_options[] = {
+        {"out", required_argument, 0, 'o'},
+        {"compress", required_argument, 0, 'z'},
+        {"level", required_argument, 0, 'l'},
+        {"concurrency", required_argument, 0, 'c'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    
+    int c;
+    while ((c = getopt_long(argc, argv, "o:h", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'o':
+                out = optarg;
+                break;
+            case 'z':
+                compress = optarg;
+                break;
+            case 'l':
+                options.level = atoi(optarg);
+                break;
+            case 'c':
+                options.max_concurrency = (size_t)strtoul(optarg, NULL, 10);
+                break;
+            case 'h':
+                printf("Usage: export --out FILE [--compress gzip|none] [--level 1-9] [--concurrency N]\n");
+                printf("Dumps droplets, volumes, snapshots, private images, domains and their\n");
+                printf("records, firewalls, load balancers, VPCs and tags to FILE as NDJSON,\n");
+                printf("one item per line, ending with a manifest of counts and timings.\n");
+                printf("Every type is listed at once. FILE is gzip-compressed when it ends in\n");
+                printf(".gz, unless --compress says otherwise; - writes to stdout.\n");
+                return 0;
+            default:
+                fprintf(stderr, "Use --help for usage information\n");
+                return 1;
+        }
+    }
+    
+    if (!out || optind != argc) {
+        fprintf(stderr, "Usage: export --out FILE\n");
+        return 1;
+    }
+    
+    if (!compress) {
+        compress = has_suffix(out, ".gz") ? "gzip" : "none";
+    }
+    if (strcmp(compress, "gzip") == 0) {
+        options.compression = DO_EXPORT_GZIP;
+    } else if (strcmp(compress, "none") != 0) {
+        fprintf(stderr, "Unsupported compression: %s (use gzip or none)\n", compress);
+        return 1;
+    }
+    if (has_suffix(out, ".zst") || has_suffix(out, ".zstd")) {
+        fprintf(stderr, "zstd is not supported; use a .gz file\n");
+        return 1;
+    }
+    
+    // The archive is written beside its destination and renamed into
+    // place once the manifest is in, so FILE is never half an export. It
+    // holds the whole account, so only the owner may read it.
+    bool to_stdout = strcmp(out, "-") == 0;
+    char *tmp_path = NULL;
+    int fd = STDOUT_FILENO;
+    if (!to_stdout) {
+        if (asprintf(&tmp_path, "%s.%ld", out, (long)getpid()) < 0) {
+            fprintf(stderr, "Out of memory\n");
+            return 1;
+        }
+        fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+        if (fd < 0) {
+            perror(out);
+            free(tmp_path);
+            return 1;
+        }
+    }
+    
+    do_client_t *client = cli_client_open();
+    if (!client) {
+        if (!to_stdout) {
+            close(fd);
+            unlink(tmp_path);
+            free(tmp_path);
+        }
+        return 1;
+    }
+    
+    fflush(stdout);
+    do_export_manifest_t manifest;
+    do_result_t result = do_client_export(client, fd, &options, &manifest);
+    cli_client_close(client);
+    
+    if (!to_stdout) {
+        if (close(fd) != 0 && manifest.finished) {
+            perror(out);
+            manifest.finished = false;
+        }
+        if (manifest.finished && rename(tmp_path, out) != 0) {
+            perror(out);
+            manifest.finished = false;
+        }
+        if (!manifest.finished) {
+            unlink(tmp_path);
+        }
+        free(tmp_path);
+    }
+    
+    if (manifest.finished) {
+        print_manifest(&manifest, out);
+    }
+    if (result != DO_SUCCESS) {
+        fprintf(stderr, "Export %s: %s\n", manifest.finished ? "incomplete" : "failed",
+                do_client_get_error_string(result));
+        return 1;
+    }
+    return manifest.finished ? 0 : 1;
+}
\ No newline at end of file
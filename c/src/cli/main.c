@@ -2,45 +2,101 @@
 #include <stdlib.h>
 #include <string.h>
 #include <getopt.h>
-#include "digitalocean/client.h"
-
-// Command function declarations
-int cmd_account_info(int argc, char **argv);
-int cmd_droplets_list(int argc, char **argv);
-int cmd_droplets_get(int argc, char **argv);
-int cmd_droplets_create(int argc, char **argv);
-int cmd_droplets_delete(int argc, char **argv);
-int cmd_config_set(int argc, char **argv);
-int cmd_config_get(int argc, char **argv);
+#include "cli.h"
 
 typedef struct {
     const char *name;
     int (*handler)(int argc, char **argv);
     const char *description;
+    bool local_only; // never forwarded to the agent
 } command_t;
 
 static const command_t commands[] = {
-    {"account-info", cmd_account_info, "Show account information"},
-    {"droplets-list", cmd_droplets_list, "List all droplets"},
-    {"droplets-get", cmd_droplets_get, "Get droplet details"},
-    {"droplets-create", cmd_droplets_create, "Create a new droplet"},
-    {"droplets-delete", cmd_droplets_delete, "Delete a droplet"},
-    {"config-set", cmd_config_set, "Set configuration value"},
-    {"config-get", cmd_config_get, "Get configuration value"},
-    {NULL, NULL, NULL}
+    {"account-info", cmd_account_info, "Show account information", false},
+    {"droplets-list", cmd_droplets_list, "List all droplets", false},
+    {"droplets-get", cmd_droplets_get, "Get droplet details", false},
+    {"droplets-watch", cmd_droplets_watch, "Print droplet changes as they happen", true},
+    {"droplets-monitor", cmd_droplets_monitor, "Summarize droplet monitoring metrics", false},
+    {"droplets-create", cmd_droplets_create, "Create a new droplet", false},
+    {"droplets-delete", cmd_droplets_delete, "Delete a droplet", false},
+    {"droplets-action", cmd_droplets_action, "Power, snapshot or reconfigure droplets", false},
+    {"tags-apply", cmd_tags_apply, "Tag or untag many resources at once", false},
+    {"export", cmd_export, "Dump the whole account to an NDJSON archive", true},
+    {"catalog", cmd_catalog, "Look up regions, sizes and images offline", true},
+    {"raw", cmd_raw, "Stream an API response to stdout unparsed", false},
+    {"api", cmd_api, "Call any API operation by its operationId", false},
+    {"metrics", cmd_metrics, "Print request metrics (Prometheus format)", false},
+    {"config-set", cmd_config_set, "Set configuration value", true},
+    {"config-get", cmd_config_get, "Get configuration value", true},
+    {"batch", cmd_batch, "Run commands from stdin or a file on one client", false},
+    {"agent", cmd_agent, "Run or control the background agent", true},
+    {NULL, NULL, NULL, false}
 };
 
+static const command_t *find_command(const char *name) {
+    for (int i = 0; commands[i].name; i++) {
+        if (strcmp(name, commands[i].name) == 0) {
+            return &commands[i];
+        }
+    }
+    return NULL;
+}
+
+// Counts the global options in front of the command name
+static int parse_global_options(int argc, char **argv, bool *timing) {
+    int count = 0;
+    while (count < argc && strcmp(argv[count], "--timing") == 0) {
+        *timing = true;
+        count++;
+    }
+    return count;
+}
+
 static void print_usage(const char *program_name) {
-    printf("Usage: %s <command> [options]\n\n", program_name);
+    printf("Usage: %s [--timing] <command> [options]\n\n", program_name);
     printf("Commands:\n");
     
     for (int i = 0; commands[i].name; i++) {
         printf("  %-20s %s\n", commands[i].name, commands[i].description);
     }
     
+    printf("\nGlobal Options:\n");
+    printf("  --timing             Print a per-request timing breakdown to stderr\n");
+    
     printf("\nEnvironment Variables:\n");
     printf("  DIGITALOCEAN_TOKEN    API authentication token\n");
     printf("  DIGITALOCEAN_BASE_URL Base URL for API (default: %s)\n", DO_DEFAULT_BASE_URL);
+    printf("  DO_CLI_NO_AGENT       Run commands locally even if an agent is running\n");
+    printf("  DO_CLI_ALLOC_STATS    Count library allocations and report them at exit\n");
+    printf("  DO_CLI_JSON_BACKEND   Parser for list pages: ondemand or cjson\n");
+}
+
+int cli_dispatch(int argc, char **argv) {
+    bool timing = false;
+    int skip = parse_global_options(argc, argv, &timing);
+    argc -= skip;
+    argv += skip;
+    
+    if (argc < 1) {
+        fprintf(stderr, "Missing command\n");
+        return 1;
+    }
+    
+    const command_t *command = find_command(argv[0]);
+    if (!command) {
+        fprintf(stderr, "Unknown command: %s\n", argv[0]);
+        return 1;
+    }
+    
+    // Global options apply to this command and anything it runs
+    bool previous_timing = cli_set_timing(false);
+    cli_set_timing(previous_timing || timing);
+    
+    // Reset getopt so handlers can run more than once per process
+    optind = 0;
+    int result = command->handler(argc, argv);
+    cli_set_timing(previous_timing);
+    return result;
 }
 
 int main(int argc, char **argv) {
@@ -49,26 +105,64 @@ int main(int argc, char **argv) {
         return 1;
     }
     
+    bool timing = false; // applied by cli_dispatch, which also runs in the agent
+    int skip = parse_global_options(argc - 1, argv + 1, &timing);
+    if (1 + skip >= argc) {
+        print_usage(argv[0]);
+        return 1;
+    }
+    
+    const command_t *command = find_command(argv[1 + skip]);
+    if (!command) {
+        fprintf(stderr, "Unknown command: %s\n", argv[1 + skip]);
+        print_usage(argv[0]);
+        return 1;
+    }
+    
+    // Profiling: count every library allocation and report at exit. The
+    // command runs locally so the numbers describe this process.
+    bool alloc_stats = getenv("DO_CLI_ALLOC_STATS") != NULL;
+    if (alloc_stats) {
+        do_set_allocator(do_counting_allocator());
+    }
+    
+    // The build picks the JSON backend for list pages; this overrides it
+    const char *json_backend = getenv("DO_CLI_JSON_BACKEND");
+    if (json_backend && strcmp(json_backend, "cjson") == 0) {
+        do_set_json_backend(DO_JSON_BACKEND_CJSON);
+    } else if (json_backend && strcmp(json_backend, "ondemand") == 0) {
+        do_set_json_backend(DO_JSON_BACKEND_ONDEMAND);
+    }
+    
+    // Hand the command to a running agent before paying for any setup
+    int exit_code;
+    if (!command->local_only && !alloc_stats && cli_agent_forward(argc - 1, argv + 1, &exit_code)) {
+        return exit_code;
+    }
+    
     // Initialize libcurl
     if (do_library_init() != DO_SUCCESS) {
         fprintf(stderr, "Failed to initialize HTTP library\n");
         return 1;
     }
     
-    const char *command = argv[1];
-    
-    // Find and execute command
-    for (int i = 0; commands[i].name; i++) {
-        if (strcmp(command, commands[i].name) == 0) {
-            int result = commands[i].handler(argc - 1, argv + 1);
-            do_library_cleanup();
-            return result;
-        }
+    // Connect while the command parses its arguments
+    if (!command->local_only) {
+        cli_client_prewarm();
     }
     
-    // Command not found
-    fprintf(stderr, "Unknown command: %s\n", command);
-    print_usage(argv[0]);
+    int result = cli_dispatch(argc - 1, argv + 1);
+    cli_client_discard_prewarmed();
     do_library_cleanup();
-    return 1;
+    
+    if (alloc_stats) {
+        do_alloc_stats_t stats;
+        do_counting_allocator_stats(&stats);
+        fprintf(stderr, "alloc: %llu allocations, %llu reallocations, %llu frees, %llu bytes, "
+                "peak %lld bytes, %lld bytes live at exit\n",
+                (unsigned long long)stats.allocations, (unsigned long long)stats.reallocations,
+                (unsigned long long)stats.frees, (unsigned long long)stats.bytes_allocated,
+                (long long)stats.peak_bytes, (long long)stats.live_bytes);
+    }
+    return result;
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include "cli.h"
+
+int cmd_metrics(int argc, char **argv) {
+    bool reset = false;
+    
+    static struct option long_options[] = {
+        {"reset", no_argument, 0, 'r'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    
+    int c;
+    while ((c = getopt_long(argc, argv, "rh", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'r':
+                reset = true;
+                break;
+            case 'h':
+                printf("Usage: metrics [--reset]\n");
+                printf("Prints request metrics in Prometheus text format. Counters cover the\n");
+                printf("current process: the agent when one is running, or a batch run.\n");
+                return 0;
+            default:
+                fprintf(stderr, "Use --help for usage information\n");
+                return 1;
+        }
+    }
+    
+    do_metrics_dump_prometheus(stdout);
+    if (reset) {
+        do_metrics_reset();
+    }
+    
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include <time.h>
+#include "digitalocean/monitoring.h"
+#include "cli.h"
+
+#define MONITOR_MAX_POINTS 4096
+
+// Durations such as 90s, 15m, 6h, 1d or plain seconds
+static bool parse_duration(const char *text, int64_t *seconds) {
+    char *end;
+    double value = strtod(text, &end);
+    if (end == text || value <= 0) {
+        return false;
+    }
+    
+    if (*end == '\0' || strcmp(end, "s") == 0) {
+        *seconds = (int64_t)value;
+    } else if (strcmp(end, "m") == 0) {
+        *seconds = (int64_t)(value * 60);
+    } else if (strcmp(end, "h") == 0) {
+        *seconds = (int64_t)(value * 3600);
+    } else if (strcmp(end, "d") == 0) {
+        *seconds = (int64_t)(value * 86400);
+    } else {
+        return false;
+    }
+    
+    return *seconds > 0;
+}
+
+// Comma-separated metric names
+static size_t parse_metrics(const char *text, do_metric_kind_t *kinds) {
+    char *copy = strdup(text);
+    if (!copy) {
+        return 0;
+    }
+    
+    size_t count = 0;
+    char *save;
+    for (char *name = strtok_r(copy, ",", &save); name; name = strtok_r(NULL, ",", &save)) {
+        if (count == DO_METRIC_KIND_COUNT || !do_metric_kind_parse(name, &kinds[count])) {
+            fprintf(stderr, "Unknown metric: %s\n", name);
+            count = 0;
+            break;
+        }
+        count++;
+    }
+    
+    free(copy);
+    return count;
+}
+
+static void print_series(const do_metric_series_t *series, int64_t start, int64_t end,
+                         int64_t step) {
+    do_metric_rollup_t rollup;
+    if (do_metric_rollup(series, start, end, &rollup) != DO_SUCCESS) {
+        return;
+    }
+    
+    printf("%-12u %-22s %-30s %8zu %12.4g %12.4g %12.4g %12.4g\n", series->droplet_id,
+           do_metric_kind_name(series->kind), series->labels[0] ? series->labels : "-",
+           rollup.count, rollup.min, rollup.avg, rollup.max, rollup.p95);
+    
+    if (step == 0) {
+        return;
+    }
+    
+    static int64_t timestamps[MONITOR_MAX_POINTS];
+    static double values[MONITOR_MAX_POINTS];
+    size_t points = do_metric_downsample(series, start, step, DO_METRIC_AGG_AVG, timestamps,
+                                         values, MONITOR_MAX_POINTS);
+    for (size_t i = 0; i < points; i++) {
+        char stamp[32];
+        time_t t = (time_t)timestamps[i];
+        strftime(stamp, sizeof(stamp), "%Y-%m-%dT%H:%M:%SZ", gmtime(&t));
+        printf("    %s %.6g\n", stamp, values[i]);
+    }
+}
+
+int cmd_droplets_monitor(int argc, char **argv) {
+    do_metric_kind_t kinds[DO_METRIC_KIND_COUNT] = {DO_METRIC_CPU};
+    size_t kind_count = 1;
+    int64_t since = 3600;
+    int64_t step = 0;
+    
+    static struct option long_options[] = {
+        {"metric", required_argument, 0, 'm'},
+        {"since", required_argument, 0, 's'},
+        {"step", required_argument, 0, 'S'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    
+    int c;
+    while ((c = getopt_long(argc, argv, "m:s:S:h", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'm':
+                kind_count = parse_metrics(optarg, kinds);
+                if (kind_count == 0) {
+                    return 1;
+                }
+                break;
+            case 's':
+                if (!parse_duration(optarg, &since)) {
+                    fprintf(stderr, "Invalid duration: %s (e.g. 90s, 15m, 6h, 1d)\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'S':
+                if (!parse_duration(optarg, &step)) {
+                    fprintf(stderr, "Invalid duration: %s (e.g. 90s, 15m, 6h, 1d)\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'h':
+                printf("Usage: droplets-monitor [--metric cpu,load_1,...] [--since 1h] [--step 5m] <id>...\n");
+                printf("Prints min, average, max and 95th percentile per series; --step also\n");
+                printf("prints the series averaged over buckets of that size.\n");
+                printf("Metrics:");
+                for (int i = 0; i < DO_METRIC_KIND_COUNT; i++) {
+                    printf(" %s", do_metric_kind_name((do_metric_kind_t)i));
+                }
+                printf("\n");
+                return 0;
+            default:
+                fprintf(stderr, "Use --help for usage information\n");
+                return 1;
+        }
+    }
+    
+    if (optind >= argc) {
+        fprintf(stderr, "Usage: droplets-monitor [options] <id>...\n");
+        return 1;
+    }
+    
+    size_t droplet_count = (size_t)(argc - optind);
+    uint32_t *droplet_ids = calloc(droplet_count, sizeof(uint32_t));
+    if (!droplet_ids) {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < droplet_count; i++) {
+        droplet_ids[i] = (uint32_t)atoi(argv[optind + (int)i]);
+        if (droplet_ids[i] == 0) {
+            fprintf(stderr, "Invalid droplet ID: %s\n", argv[optind + (int)i]);
+            free(droplet_ids);
+            return 1;
+        }
+    }
+    
+    do_client_t *client = cli_client_open();
+    do_metric_store_t *store = client ? do_metric_store_new() : NULL;
+    if (!store) {
+        cli_client_close(client);
+        free(droplet_ids);
+        return 1;
+    }
+    
+    int64_t end = (int64_t)time(NULL);
+    do_metric_scrape_t scrape = {
+        .droplet_ids = droplet_ids,
+        .droplet_count = droplet_count,
+        .kinds = kinds,
+        .kind_count = kind_count,
+        .lookback = since,
+        .end = end,
+    };
+    
+    // Whatever did arrive is still printed when some pairs failed
+    do_result_t result = do_client_scrape_metrics(client, store, &scrape);
+    if (result != DO_SUCCESS) {
+        fprintf(stderr, "Failed to fetch some metrics: %s\n", do_client_get_error_string(result));
+    }
+    
+    printf("%-12s %-22s %-30s %8s %12s %12s %12s %12s\n",
+           "DROPLET", "METRIC", "LABELS", "POINTS", "MIN", "AVG", "MAX", "P95");
+    for (size_t i = 0; i < do_metric_store_count(store); i++) {
+        print_series(do_metric_store_series(store, i), end - since, end + 1, step);
+    }
+    
+    do_metric_store_free(store);
+    cli_client_close(client);
+    free(droplet_ids);
+    return result == DO_SUCCESS ? 0 : 1;
+}
\ No newline at end of file
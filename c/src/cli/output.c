@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "digitalocean/alloc.h"
+#include "cli.h"
+
+bool cli_output_parse_format(const char *name, cli_output_format_t *format) {
+    static const struct {
+        const char *name;
+        cli_output_format_t format;
+    } formats[] = {
+        {"table", CLI_OUTPUT_TABLE},
+        {"ndjson", CLI_OUTPUT_NDJSON},
+        {"csv", CLI_OUTPUT_CSV},
+        {"tsv", CLI_OUTPUT_TSV},
+    };
+    
+    for (size_t i = 0; i < sizeof(formats) / sizeof(formats[0]); i++) {
+        if (strcmp(name, formats[i].name) == 0) {
+            *format = formats[i].format;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool cli_writer_init(cli_writer_t *writer, FILE *stream) {
+    writer->stream = stream;
+    writer->length = 0;
+    writer->capacity = CLI_WRITER_BUFFER_SIZE;
+    writer->failed = false;
+    writer->buffer = malloc(writer->capacity);
+    return writer->buffer != NULL;
+}
+
+void cli_writer_flush(cli_writer_t *writer) {
+    if (writer->length > 0 && !writer->failed) {
+        // One large fwrite bypasses stdio's own buffer
+        if (fwrite(writer->buffer, 1, writer->length, writer->stream) != writer->length) {
+            writer->failed = true;
+        }
+    }
+    writer->length = 0;
+    fflush(writer->stream);
+}
+
+void cli_writer_free(cli_writer_t *writer) {
+    cli_writer_flush(writer);
+    free(writer->buffer);
+    writer->buffer = NULL;
+}
+
+void cli_writer_put(cli_writer_t *writer, const char *data, size_t len) {
+    if (writer->length + len > writer->capacity) {
+        cli_writer_flush(writer);
+        if (len > writer->capacity) {
+            if (!writer->failed && fwrite(data, 1, len, writer->stream) != len) {
+                writer->failed = true;
+            }
+            return;
+        }
+    }
+    memcpy(writer->buffer + writer->length, data, len);
+    writer->length += len;
+}
+
+void cli_writer_puts(cli_writer_t *writer, const char *str) {
+    cli_writer_put(writer, str, strlen(str));
+}
+
+void cli_writer_uint(cli_writer_t *writer, unsigned long value) {
+    char digits[24];
+    size_t pos = sizeof(digits);
+    do {
+        digits[--pos] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    cli_writer_put(writer, digits + pos, sizeof(digits) - pos);
+}
+
+void cli_writer_json_text(cli_writer_t *writer, const char *str, size_t len) {
+    static const char hex[] = "0123456789abcdef";
+    cli_writer_put(writer, "\"", 1);
+    
+    const char *run = str;
+    const char *end = str + len;
+    for (const char *p = str; p < end; p++) {
+        unsigned char c = (unsigned char)*p;
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        
+        cli_writer_put(writer, run, (size_t)(p - run));
+        run = p + 1;
+        
+        char escape[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf]};
+        switch (c) {
+            case '"': cli_writer_put(writer, "\\\"", 2); break;
+            case '\\': cli_writer_put(writer, "\\\\", 2); break;
+            case '\n': cli_writer_put(writer, "\\n", 2); break;
+            case '\r': cli_writer_put(writer, "\\r", 2); break;
+            case '\t': cli_writer_put(writer, "\\t", 2); break;
+            default: cli_writer_put(writer, escape, sizeof(escape)); break;
+        }
+    }
+    
+    cli_writer_put(writer, run, (size_t)(end - run));
+    cli_writer_put(writer, "\"", 1);
+}
+
+void cli_writer_json_string(cli_writer_t *writer, const char *str) {
+    if (!str) {
+        cli_writer_put(writer, "null", 4);
+        return;
+    }
+    cli_writer_json_text(writer, str, strlen(str));
+}
+
+void cli_writer_field_text(cli_writer_t *writer, cli_output_format_t format, const char *str,
+                           size_t len) {
+    const char *end = str + len;
+    
+    if (format == CLI_OUTPUT_TSV) {
+        // TSV has no quoting; fold separators into spaces
+        const char *run = str;
+        for (const char *p = str; p < end; p++) {
+            if (*p == '\t' || *p == '\n' || *p == '\r') {
+                cli_writer_put(writer, run, (size_t)(p - run));
+                cli_writer_put(writer, " ", 1);
+                run = p + 1;
+            }
+        }
+        cli_writer_put(writer, run, (size_t)(end - run));
+        return;
+    }
+    
+    // RFC 4180: quote only when needed, doubling embedded quotes
+    bool quote = false;
+    for (const char *p = str; p < end && !quote; p++) {
+        quote = *p == ',' || *p == '"' || *p == '\r' || *p == '\n';
+    }
+    if (!quote) {
+        cli_writer_put(writer, str, len);
+        return;
+    }
+    
+    cli_writer_put(writer, "\"", 1);
+    const char *run = str;
+    for (const char *p = str; p < end; p++) {
+        if (*p == '"') {
+            cli_writer_put(writer, run, (size_t)(p - run + 1));
+            cli_writer_put(writer, "\"", 1);
+            run = p + 1;
+        }
+    }
+    cli_writer_put(writer, run, (size_t)(end - run));
+    cli_writer_put(writer, "\"", 1);
+}
+
+void cli_writer_field(cli_writer_t *writer, cli_output_format_t format, const char *str) {
+    if (str) {
+        cli_writer_field_text(writer, format, str, strlen(str));
+    }
+}
+
+// Views are written straight from the response; only the rare one with
+// escapes in it is decoded first
+void cli_writer_json_view(cli_writer_t *writer, const do_str_view_t *view) {
+    if (!view->escaped) {
+        if (view->data) {
+            cli_writer_json_text(writer, view->data, view->len);
+        } else {
+            cli_writer_put(writer, "null", 4);
+        }
+        return;
+    }
+    
+    char *text = do_str_view_dup(view);
+    cli_writer_json_string(writer, text);
+    do_free(text);
+}
+
+void cli_writer_field_view(cli_writer_t *writer, cli_output_format_t format,
+                           const do_str_view_t *view) {
+    if (!view->escaped) {
+        if (view->data) {
+            cli_writer_field_text(writer, format, view->data, view->len);
+        }
+        return;
+    }
+    
+    char *text = do_str_view_dup(view);
+    cli_writer_field(writer, format, text);
+    do_free(text);
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <getopt.h>
+#include <unistd.h>
+#include "cli.h"
+
+static const char *const raw_methods[] = {"GET", "POST", "PUT", "PATCH", "DELETE", NULL};
+
+// Reads all of a stream into a NUL-terminated string
+static char *read_stream(FILE *stream) {
+    size_t length = 0;
+    size_t capacity = 4096;
+    char *data = malloc(capacity);
+    if (!data) {
+        return NULL;
+    }
+    
+    size_t n;
+    while ((n = fread(data + length, 1, capacity - length - 1, stream)) > 0) {
+        length += n;
+        if (capacity - length - 1 == 0) {
+            char *grown = realloc(data, capacity * 2);
+            if (!grown) {
+                free(data);
+                return NULL;
+            }
+            data = grown;
+            capacity *= 2;
+        }
+    }
+    
+    data[length] = '\0';
+    return data;
+}
+
+char *cli_load_text(const char *arg) {
+    if (strcmp(arg, "-") == 0) {
+        return read_stream(stdin);
+    }
+    
+    if (arg[0] == '@') {
+        FILE *file = fopen(arg + 1, "r");
+        if (!file) {
+            perror(arg + 1);
+            return NULL;
+        }
+        char *data = read_stream(file);
+        fclose(file);
+        return data;
+    }
+    
+    return strdup(arg);
+}
+
+int cmd_raw(int argc, char **argv) {
+    const char *data_arg = NULL;
+    unsigned flags = DO_RAW_PAGINATE;
+    
+    static struct option long_options[] = {
+        {"data", required_argument, 0, 'd'},
+        {"no-paginate", no_argument, 0, 'P'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    
+    int c;
+    while ((c = getopt_long(argc, argv, "d:h", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'd':
+                data_arg = optarg;
+                break;
+            case 'P':
+                flags &= ~DO_RAW_PAGINATE;
+                break;
+            case 'h':
+                printf("Usage: raw [--data JSON|@FILE|-] [--no-paginate] GET|POST|PUT|PATCH|DELETE PATH\n");
+                printf("Streams the response body to stdout unparsed. GET requests follow every\n");
+                printf("page and print one page per line.\n");
+                return 0;
+            default:
+                fprintf(stderr, "Use --help for usage information\n");
+                return 1;
+        }
+    }
+    
+    if (optind + 2 != argc) {
+        fprintf(stderr, "Usage: raw [--data JSON|@FILE|-] [--no-paginate] METHOD PATH\n");
+        return 1;
+    }
+    
+    const char *method = NULL;
+    for (int i = 0; raw_methods[i]; i++) {
+        if (strcasecmp(argv[optind], raw_methods[i]) == 0) {
+            method = raw_methods[i];
+            break;
+        }
+    }
+    if (!method) {
+        fprintf(stderr, "Unsupported method: %s\n", argv[optind]);
+        return 1;
+    }
+    
+    const char *path = argv[optind + 1];
+    if (path[0] != '/') {
+        fprintf(stderr, "Path must start with '/', e.g. /v2/droplets\n");
+        return 1;
+    }
+    
+    char *body = NULL;
+    if (data_arg) {
+        body = cli_load_text(data_arg);
+        if (!body) {
+            fprintf(stderr, "Failed to read request body\n");
+            return 1;
+        }
+    }
+    
+    do_client_t *client = cli_client_open();
+    if (!client) {
+        free(body);
+        return 1;
+    }
+    
+    // The body bypasses stdio, so anything already buffered goes first
+    fflush(stdout);
+    do_result_t result = do_client_raw(client, method, path, body, STDOUT_FILENO, flags);
+    free(body);
+    
+    if (result != DO_SUCCESS) {
+        fprintf(stderr, "Request failed: %s\n", do_client_get_error_string(result));
+        cli_client_close(client);
+        return 1;
+    }
+    
+    cli_client_close(client);
+    return 0;
+}
\ No newline at end of file
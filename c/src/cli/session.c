@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <unistd.h>
+#include "cli.h"
+
+// Client shared by every command run in this process (agent mode)
+static do_client_t *shared_client = NULL;
+
+// Client set up and connecting before the command ran; see cli_client_prewarm()
+static do_client_t *prewarmed_client = NULL;
+
+static bool timing_enabled = false;
+
+bool cli_set_timing(bool enabled) {
+    bool previous = timing_enabled;
+    timing_enabled = enabled;
+    return previous;
+}
+
+static double ms(int64_t us) {
+    return (double)us / 1000.0;
+}
+
+// Turns libcurl's cumulative timestamps into per-phase durations
+static void print_timing(const do_request_timing_t *timing, void *userdata) {
+    (void)userdata;
+    
+    if (!timing_enabled) {
+        return;
+    }
+    
+    // A reused connection reports 0 for connect and TLS
+    int64_t connect = timing->connect_us > timing->name_lookup_us
+        ? timing->connect_us - timing->name_lookup_us : 0;
+    int64_t tls = timing->app_connect_us > timing->connect_us
+        ? timing->app_connect_us - timing->connect_us : 0;
+    int64_t connected = timing->name_lookup_us + connect + tls;
+    int64_t server = timing->first_byte_us > connected ? timing->first_byte_us - connected : 0;
+    int64_t transfer = timing->first_byte_us > 0 ? timing->total_us - timing->first_byte_us : 0;
+    
+    fprintf(stderr, "timing: %s %s -> %ld\n", timing->method ? timing->method : "?",
+            timing->url ? timing->url : "?", timing->status_code);
+    fprintf(stderr, "  dns %.1fms  connect %.1fms  tls %.1fms  server %.1fms  transfer %.1fms"
+            "  total %.1fms\n",
+            ms(timing->name_lookup_us), ms(connect), ms(tls), ms(server), ms(transfer), ms(timing->total_us));
+    fprintf(stderr, "  parse %.1fms  decode %.1fms  received %lld bytes  sent %lld bytes\n",
+            ms(timing->parse_us), ms(timing->decode_us),
+            (long long)timing->bytes_received, (long long)timing->bytes_sent);
+}
+
+do_client_t *cli_set_shared_client(do_client_t *client) {
+    do_client_t *previous = shared_client;
+    shared_client = client;
+    return previous;
+}
+
+// Builds a client from the config and applies the DO_CLI_* options. Quiet
+// about configuration problems, which the command itself reports later.
+static do_client_t *client_create(bool quiet) {
+    do_client_t *client = do_client_new();
+    if (!client) {
+        if (!quiet) {
+            fprintf(stderr, "Failed to create client\n");
+        }
+        return NULL;
+    }
+    
+    do_result_t result = do_client_init_from_config(client);
+    if (result != DO_SUCCESS) {
+        if (!quiet) {
+            fprintf(stderr, "Failed to initialize client: %s\n", do_client_get_error_string(result));
+        }
+        do_client_free(client);
+        return NULL;
+    }
+    
+    // Opt-in pacing across every do-cli on the host using this token
+    if (getenv("DO_CLI_SHARED_RATE_LIMIT")) {
+        result = do_client_share_rate_limit(client);
+        if (result != DO_SUCCESS) {
+            fprintf(stderr, "Warning: not sharing the rate limit: %s\n",
+                    do_client_get_error_string(result));
+        }
+    }
+    
+    // Opt-in TLS resumption across runs; loaded before anything connects
+    if (getenv("DO_CLI_TLS_SESSIONS")) {
+        result = do_client_persist_tls_sessions(client, NULL);
+        if (result != DO_SUCCESS) {
+            fprintf(stderr, "Warning: not keeping TLS sessions (needs libcurl 8.12+ with "
+                    "SSLS-EXPORT): %s\n", do_client_get_error_string(result));
+        }
+    }
+    
+    do_client_set_timing_callback(client, print_timing, NULL);
+    return client;
+}
+
+void cli_client_prewarm(void) {
+    if (shared_client || prewarmed_client || getenv("DO_CLI_NO_WARM_UP")) {
+        return;
+    }
+    
+    prewarmed_client = client_create(true);
+    if (prewarmed_client) {
+        do_client_warm_up(prewarmed_client);
+    }
+}
+
+void cli_client_discard_prewarmed(void) {
+    do_client_free(prewarmed_client);
+    prewarmed_client = NULL;
+}
+
+do_client_t *cli_client_open(void) {
+    if (shared_client) {
+        do_client_set_timing_callback(shared_client, print_timing, NULL);
+        return shared_client;
+    }
+    
+    if (prewarmed_client) {
+        do_client_t *client = prewarmed_client;
+        prewarmed_client = NULL;
+        return client;
+    }
+    
+    return client_create(false);
+}
+
+void cli_client_close(do_client_t *client) {
+    if (!client || client == shared_client) {
+        return;
+    }
+    
+    do_client_free(client);
+}
+
+int cli_write_all(int fd, const void *data, size_t len) {
+    const char *p = data;
+    while (len > 0) {
+        ssize_t n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+int cli_read_all(int fd, void *data, size_t len) {
+    char *p = data;
+    while (len > 0) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        if (n == 0) {
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+#include "cli.h"
+
+// Splits text in place into IDs separated by whitespace or commas
+static const char **split_ids(char *text, size_t *count) {
+    const char **ids = NULL;
+    size_t capacity = 0;
+    *count = 0;
+    
+    char *save;
+    for (char *id = strtok_r(text, " \t\r\n,", &save); id; id = strtok_r(NULL, " \t\r\n,", &save)) {
+        if (*count == capacity) {
+            capacity = capacity ? capacity * 2 : 256;
+            const char **grown = realloc(ids, capacity * sizeof(*ids));
+            if (!grown) {
+                free(ids);
+                return NULL;
+            }
+            ids = grown;
+        }
+        ids[(*count)++] = id;
+    }
+    
+    return ids;
+}
+
+int cmd_tags_apply(int argc, char **argv) {
+    const char *ids_from = NULL;
+    const char *resource_type = "droplet";
+    bool remove = false;
+    
+    static struct option long_options[] = {
+        {"ids-from", required_argument, 0, 'f'},
+        {"type", required_argument, 0, 't'},
+        {"remove", no_argument, 0, 'r'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0}
+    };
+    
+    int c;
+    while ((c = getopt_long(argc, argv, "f:t:rh", long_options, NULL)) != -1) {
+        switch (c) {
+            case 'f':
+                ids_from = optarg;
+                break;
+            case 't':
+                resource_type = optarg;
+                break;
+            case 'r':
+                remove = true;
+                break;
+            case 'h':
+                printf("Usage: tags-apply <tag> --ids-from FILE [--type droplet] [--remove]\n");
+                printf("Tags (or with --remove, untags) every resource listed in FILE, one ID\n");
+                printf("per line or separated by commas; - reads stdin. The tag is created if\n");
+                printf("it does not exist. --type is droplet, image, volume or volume_snapshot.\n");
+                return 0;
+            default:
+                fprintf(stderr, "Use --help for usage information\n");
+                return 1;
+        }
+    }
+    
+    if (optind >= argc || !ids_from) {
+        fprintf(stderr, "Usage: tags-apply <tag> --ids-from FILE\n");
+        return 1;
+    }
+    const char *tag = argv[optind];
+    
+    // cli_load_text takes @FILE for a file and - for stdin
+    char *text;
+    if (strcmp(ids_from, "-") == 0) {
+        text = cli_load_text("-");
+    } else {
+        char *arg = NULL;
+        text = asprintf(&arg, "@%s", ids_from) < 0 ? NULL : cli_load_text(arg);
+        free(arg);
+    }
+    if (!text) {
+        fprintf(stderr, "Failed to read IDs from %s\n", ids_from);
+        return 1;
+    }
+    
+    size_t count;
+    const char **ids = split_ids(text, &count);
+    if (!ids && count > 0) {
+        fprintf(stderr, "Out of memory\n");
+        free(text);
+        return 1;
+    }
+    
+    do_client_t *client = cli_client_open();
+    if (!client) {
+        free(ids);
+        free(text);
+        return 1;
+    }
+    
+    do_result_t result = remove ? DO_SUCCESS : do_client_create_tag(client, tag);
+    if (result != DO_SUCCESS) {
+        fprintf(stderr, "Failed to create tag %s: %s\n", tag, do_client_get_error_string(result));
+    } else {
+        result = remove ? do_client_untag_resources(client, tag, resource_type, ids, count)
+                        : do_client_tag_resources(client, tag, resource_type, ids, count);
+        if (result == DO_SUCCESS) {
+            size_t requests = (count + DO_TAG_CHUNK_SIZE - 1) / DO_TAG_CHUNK_SIZE;
+            printf("%s %zu %s%s %s %s (%zu request%s)\n", remove ? "Untagged" : "Tagged", count,
+                   resource_type, count == 1 ? "" : "s", remove ? "from" : "with", tag, requests,
+                   requests == 1 ? "" : "s");
+        } else {
+            fprintf(stderr, "Failed to %s some resources: %s\n", remove ? "untag" : "tag",
+                    do_client_get_error_string(result));
+        }
+    }
+    
+    cli_client_close(client);
+    free(ids);
+    free(text);
+    return result == DO_SUCCESS ? 0 : 1;
+}
\ No newline at end of file
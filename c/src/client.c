@@ -1,15 +1,25 @@
+#define _GNU_SOURCE
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
 #include <cjson/cjson.h>
 #include "digitalocean/client.h"
+#include "digitalocean/alloc.h"
+#include "digitalocean/catalog.h"
+#include "client_internal.h"
+#include "http_internal.h"
+#include "json_internal.h"
+#include "metrics_internal.h"
+#include "ratelimit.h"
+#include "tls_sessions.h"
 
-// Forward declarations for JSON parsing
-extern do_result_t json_parse_droplet(const cJSON *json, do_droplet_t *droplet);
-extern do_result_t json_parse_account(const cJSON *json, do_account_t *account);
+#define DO_LIST_PAGE_SIZE 200 // API maximum; fewer round trips for big fleets
 
 do_client_t *do_client_new(void) {
-    do_client_t *client = calloc(1, sizeof(do_client_t));
+    do_client_t *client = do_calloc(1, sizeof(do_client_t));
     return client;
 }
 
@@ -18,10 +28,20 @@ void do_client_free(do_client_t *client) {
         return;
     }
     
+    if (client->tls_session_path) {
+        do_http_client_t *handles[] = {client->http_client, client->cursor_http_client};
+        do_tls_sessions_save(handles, 2, client->tls_session_path);
+        do_free(client->tls_session_path);
+    }
+    
     do_config_free(client->config);
     do_http_client_free(client->http_client);
-    free(client->auth_header);
-    free(client);
+    do_free(client->auth_header);
+    do_string_free(&client->request_body);
+    do_http_client_free(client->cursor_http_client);
+    do_rate_budget_close(client->rate_budget);
+    do_catalog_free((struct do_catalog *)client->catalog);
+    do_free(client);
 }
 
 do_result_t do_client_init(do_client_t *client, do_config_t *config) {
@@ -56,6 +76,108 @@ do_result_t do_client_init(do_client_t *client, do_config_t *config) {
     return DO_SUCCESS;
 }
 
+do_result_t do_client_share_rate_limit(do_client_t *client) {
+    if (!client || !client->config || !client->http_client) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    if (client->rate_budget) {
+        return DO_SUCCESS;
+    }
+    
+    do_result_t result = do_rate_budget_open(client->config->token, &client->rate_budget);
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    
+    client->http_client->rate_budget = client->rate_budget;
+    if (client->cursor_http_client) {
+        client->cursor_http_client->rate_budget = client->rate_budget;
+    }
+    return DO_SUCCESS;
+}
+
+do_result_t do_client_warm_up(do_client_t *client) {
+    if (!client || !client->config || !client->http_client) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    char *url = do_http_build_url(client->config->base_url, "/");
+    if (!url) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_result_t result = do_http_client_warm_up(client->http_client, url);
+    if (result == DO_SUCCESS) {
+        result = do_cursor_warm_up(client, url);
+    }
+    do_free(url);
+    return result;
+}
+
+do_result_t do_client_persist_tls_sessions(do_client_t *client, const char *path) {
+    if (!client || !client->http_client) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    if (client->tls_session_path) {
+        return DO_SUCCESS;
+    }
+    
+    char *session_path = path ? do_strdup(path) : do_tls_sessions_default_path();
+    if (!session_path) {
+        return DO_ERROR_MEMORY;
+    }
+    if (!path && do_config_ensure_config_dir() != DO_SUCCESS) {
+        do_free(session_path);
+        return DO_ERROR_CONFIG;
+    }
+    
+    do_result_t result = do_tls_sessions_load(client->http_client, session_path);
+    if (result == DO_SUCCESS && client->cursor_http_client) {
+        result = do_tls_sessions_load(client->cursor_http_client, session_path);
+    }
+    if (result != DO_SUCCESS) {
+        do_free(session_path);
+        return result;
+    }
+    
+    client->tls_session_path = session_path;
+    return DO_SUCCESS;
+}
+
+void do_client_set_timing_callback(do_client_t *client, do_timing_callback_t callback,
+                                   void *userdata) {
+    if (!client) {
+        return;
+    }
+    
+    client->timing_callback = callback;
+    client->timing_userdata = userdata;
+}
+
+static int64_t do_client_clock_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+// Finishes the bookkeeping for the last request: adds our parse/decode
+// time to its timing record, updates the metrics and calls the hook.
+// Shared with the group fan-out (group.c).
+void do_client_request_done(do_client_t *client, do_result_t result,
+                            int64_t parse_us, int64_t decode_us) {
+    const do_request_timing_t *last = &client->http_client->timing;
+    do_metrics_record_decode(last->method, last->url, parse_us, decode_us, result == DO_ERROR_JSON);
+    
+    if (!client->timing_callback) {
+        return;
+    }
+    
+    do_request_timing_t timing = *last;
+    timing.parse_us = parse_us;
+    timing.decode_us = decode_us;
+    client->timing_callback(&timing, client->timing_userdata);
+}
+
 do_result_t do_client_init_from_config(do_client_t *client) {
     if (!client) {
         return DO_ERROR_INVALID_PARAM;
@@ -85,42 +207,50 @@ do_result_t do_client_get_account(do_client_t *client, do_account_t **account) {
         return DO_ERROR_MEMORY;
     }
     
-    do_http_response_t *response = do_http_response_new();
+    do_http_response_t *response = do_http_client_acquire_response(client->http_client);
     if (!response) {
-        free(url);
+        do_free(url);
         return DO_ERROR_MEMORY;
     }
     
     do_result_t result = do_http_get(client->http_client, url, client->auth_header, response);
-    free(url);
+    do_free(url);
     
     if (result != DO_SUCCESS) {
-        do_http_response_free(response);
+        do_http_client_release_response(client->http_client, response);
+        do_client_request_done(client, result, 0, 0);
         return result;
     }
     
     // Parse JSON response
+    int64_t parse_start = do_client_clock_us();
     cJSON *json = cJSON_Parse(response->data);
-    do_http_response_free(response);
+    do_http_client_release_response(client->http_client, response);
+    int64_t parse_us = do_client_clock_us() - parse_start;
     
     if (!json) {
+        do_client_request_done(client, DO_ERROR_JSON, parse_us, 0);
         return DO_ERROR_JSON;
     }
     
     cJSON *account_json = cJSON_GetObjectItemCaseSensitive(json, "account");
     if (!account_json) {
         cJSON_Delete(json);
+        do_client_request_done(client, DO_ERROR_JSON, parse_us, 0);
         return DO_ERROR_JSON;
     }
     
-    *account = calloc(1, sizeof(do_account_t));
+    *account = do_calloc(1, sizeof(do_account_t));
     if (!*account) {
         cJSON_Delete(json);
+        do_client_request_done(client, DO_ERROR_MEMORY, parse_us, 0);
         return DO_ERROR_MEMORY;
     }
     
+    int64_t decode_start = do_client_clock_us();
     result = json_parse_account(account_json, *account);
     cJSON_Delete(json);
+    do_client_request_done(client, result, parse_us, do_client_clock_us() - decode_start);
     
     if (result != DO_SUCCESS) {
         do_account_free(*account);
@@ -130,79 +260,681 @@ do_result_t do_client_get_account(do_client_t *client, do_account_t **account) {
     return result;
 }
 
+// Fetches a URL and parses the body as JSON
+static do_result_t do_client_fetch_json(do_client_t *client, const char *url, cJSON **json,
+                                        int64_t *parse_us) {
+    *parse_us = 0;
+    
+    do_http_response_t *response = do_http_client_acquire_response(client->http_client);
+    if (!response) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_result_t result = do_http_get(client->http_client, url, client->auth_header, response);
+    if (result == DO_SUCCESS) {
+        result = do_http_status_to_result(client->http_client->timing.status_code);
+    }
+    if (result != DO_SUCCESS) {
+        do_http_client_release_response(client->http_client, response);
+        return result;
+    }
+    
+    int64_t parse_start = do_client_clock_us();
+    *json = response->data ? cJSON_Parse(response->data) : NULL;
+    do_http_client_release_response(client->http_client, response);
+    *parse_us = do_client_clock_us() - parse_start;
+    
+    return *json ? DO_SUCCESS : DO_ERROR_JSON;
+}
+
+// Called once per page with the collection array and the whole page
+typedef do_result_t (*do_page_handler_t)(const cJSON *items, const cJSON *page, void *userdata);
+
+// The same over the on-demand index of the page (json_ondemand.c)
+typedef do_result_t (*do_page_handler_od_t)(const json_od_value_t *items,
+                                            const json_od_value_t *page, void *userdata);
+
+// Fetches one page, parses it with cJSON and hands it to the handler;
+// sets *next_url when there is a following page
+static do_result_t do_client_page_parsed(do_client_t *client, const char *url,
+                                         const char *collection_key, do_page_handler_t handler,
+                                         void *userdata, char **next_url) {
+    cJSON *json = NULL;
+    int64_t parse_us;
+    do_result_t result = do_client_fetch_json(client, url, &json, &parse_us);
+    if (result != DO_SUCCESS) {
+        do_client_request_done(client, result, parse_us, 0);
+        return result;
+    }
+    
+    const cJSON *items = cJSON_GetObjectItemCaseSensitive(json, collection_key);
+    if (!cJSON_IsArray(items)) {
+        cJSON_Delete(json);
+        do_client_request_done(client, DO_ERROR_JSON, parse_us, 0);
+        return DO_ERROR_JSON;
+    }
+    
+    int64_t decode_start = do_client_clock_us();
+    result = handler(items, json, userdata);
+    do_client_request_done(client, result, parse_us, do_client_clock_us() - decode_start);
+    
+    // The API hands back absolute URLs for the following page
+    const cJSON *links = cJSON_GetObjectItemCaseSensitive(json, "links");
+    const cJSON *pages = cJSON_GetObjectItemCaseSensitive(links, "pages");
+    const cJSON *next = cJSON_GetObjectItemCaseSensitive(pages, "next");
+    if (result == DO_SUCCESS && cJSON_IsString(next) && next->valuestring[0] != '\0' &&
+        cJSON_GetArraySize(items) > 0) {
+        *next_url = do_strdup(next->valuestring);
+        if (!*next_url) {
+            result = DO_ERROR_MEMORY;
+        }
+    }
+    
+    cJSON_Delete(json);
+    return result;
+}
+
+// The same without a tree: the page is indexed into doc and decoded
+// straight from the response buffer, which is held until the handler and
+// the next-link lookup are done with it
+static do_result_t do_client_page_ondemand(do_client_t *client, const char *url,
+                                           const char *collection_key,
+                                           do_page_handler_od_t handler, void *userdata,
+                                           json_od_doc_t *doc, char **next_url) {
+    do_http_response_t *response = do_http_client_acquire_response(client->http_client);
+    if (!response) {
+        do_client_request_done(client, DO_ERROR_MEMORY, 0, 0);
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_result_t result = do_http_get(client->http_client, url, client->auth_header, response);
+    if (result == DO_SUCCESS) {
+        result = do_http_status_to_result(client->http_client->timing.status_code);
+    }
+    if (result != DO_SUCCESS) {
+        do_http_client_release_response(client->http_client, response);
+        do_client_request_done(client, result, 0, 0);
+        return result;
+    }
+    
+    int64_t parse_start = do_client_clock_us();
+    json_od_value_t page, items;
+    result = response->data ? json_od_index(doc, response->data, response->size) : DO_ERROR_JSON;
+    if (result == DO_SUCCESS && (!json_od_root(doc, &page) ||
+                                 !json_od_find(&page, collection_key, &items) ||
+                                 !json_od_is_array(&items))) {
+        result = DO_ERROR_JSON;
+    }
+    int64_t parse_us = do_client_clock_us() - parse_start;
+    if (result != DO_SUCCESS) {
+        do_http_client_release_response(client->http_client, response);
+        do_client_request_done(client, result, parse_us, 0);
+        return result;
+    }
+    
+    int64_t decode_start = do_client_clock_us();
+    result = handler(&items, &page, userdata);
+    do_client_request_done(client, result, parse_us, do_client_clock_us() - decode_start);
+    
+    json_od_value_t links, pages, next;
+    if (result == DO_SUCCESS && json_od_find(&page, "links", &links) &&
+        json_od_find(&links, "pages", &pages) && json_od_find(&pages, "next", &next) &&
+        json_od_is_string(&next) && json_od_count(&items) > 0) {
+        char *next_link = json_od_strdup(&next);
+        if (!next_link) {
+            result = DO_ERROR_MEMORY;
+        } else if (next_link[0] == '\0') {
+            do_free(next_link);
+        } else {
+            *next_url = next_link;
+        }
+    }
+    
+    do_http_client_release_response(client->http_client, response);
+    return result;
+}
+
+// Walks every page of a list endpoint, following links.pages.next. Only
+// one page is held in memory at a time. Endpoints with an on-demand
+// handler use it while that backend is selected, and always when they
+// have no cJSON handler.
+static do_result_t do_client_paginate(do_client_t *client, const char *endpoint,
+                                      const char *collection_key, do_page_handler_t handler,
+                                      do_page_handler_od_t od_handler, void *userdata) {
+    char first_page[256];
+    snprintf(first_page, sizeof(first_page), "%s%sper_page=%d",
+             endpoint, strchr(endpoint, '?') ? "&" : "?", DO_LIST_PAGE_SIZE);
+    
+    char *url = do_http_build_url(client->config->base_url, first_page);
+    if (!url) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    bool ondemand = od_handler && (!handler || do_get_json_backend() == DO_JSON_BACKEND_ONDEMAND);
+    json_od_doc_t doc = {0};
+    
+    do_result_t result = DO_SUCCESS;
+    while (url) {
+        char *next_url = NULL;
+        if (ondemand) {
+            result = do_client_page_ondemand(client, url, collection_key, od_handler, userdata,
+                                             &doc, &next_url);
+        } else {
+            result = do_client_page_parsed(client, url, collection_key, handler, userdata,
+                                           &next_url);
+        }
+        do_free(url);
+        url = next_url;
+        
+        if (result != DO_SUCCESS) {
+            break;
+        }
+    }
+    
+    do_free(url);
+    json_od_doc_free(&doc);
+    return result;
+}
+
+uint32_t json_page_total(const cJSON *page) {
+    const cJSON *meta = cJSON_GetObjectItemCaseSensitive(page, "meta");
+    const cJSON *total = cJSON_GetObjectItemCaseSensitive(meta, "total");
+    return cJSON_IsNumber(total) ? (uint32_t)total->valuedouble : 0;
+}
+
+static uint32_t json_od_page_total(const json_od_value_t *page) {
+    json_od_value_t meta, total;
+    double number;
+    if (json_od_find(page, "meta", &meta) && json_od_find(&meta, "total", &total) &&
+        json_od_number(&total, &number)) {
+        return (uint32_t)number;
+    }
+    return 0;
+}
+
+// Makes room for count more droplets in the list
+static do_result_t droplet_list_reserve(do_droplet_list_t *list, size_t count) {
+    if (list->count + count <= list->capacity) {
+        return DO_SUCCESS;
+    }
+    
+    size_t new_capacity = list->capacity ? list->capacity : count;
+    while (new_capacity < list->count + count) {
+        new_capacity *= 2;
+    }
+    
+    do_droplet_t *new_items = do_realloc(list->items, new_capacity * sizeof(do_droplet_t));
+    if (!new_items) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    list->items = new_items;
+    list->capacity = new_capacity;
+    return DO_SUCCESS;
+}
+
+static do_result_t collect_droplet_page(const cJSON *items, const cJSON *page, void *userdata) {
+    do_droplet_list_t *list = userdata;
+    size_t count = cJSON_GetArraySize(items);
+    
+    list->meta.total = json_page_total(page);
+    if (count == 0) {
+        return DO_SUCCESS;
+    }
+    
+    if (droplet_list_reserve(list, count) != DO_SUCCESS) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    const cJSON *droplet_json;
+    cJSON_ArrayForEach(droplet_json, items) {
+        do_droplet_t *droplet = &list->items[list->count];
+        memset(droplet, 0, sizeof(*droplet));
+        
+        // Count it first so a partial parse is released with the list
+        list->count++;
+        do_result_t result = json_parse_droplet(droplet_json, droplet);
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+    }
+    
+    return DO_SUCCESS;
+}
+
+static do_result_t collect_droplet_page_od(const json_od_value_t *items,
+                                           const json_od_value_t *page, void *userdata) {
+    do_droplet_list_t *list = userdata;
+    size_t count = json_od_count(items);
+    
+    list->meta.total = json_od_page_total(page);
+    if (count == 0) {
+        return DO_SUCCESS;
+    }
+    
+    if (droplet_list_reserve(list, count) != DO_SUCCESS) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    json_od_value_t droplet_json;
+    for (bool more = json_od_first(items, &droplet_json); more; more = json_od_next(&droplet_json)) {
+        do_droplet_t *droplet = &list->items[list->count];
+        memset(droplet, 0, sizeof(*droplet));
+        
+        list->count++;
+        do_result_t result = json_od_parse_droplet(&droplet_json, droplet);
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+    }
+    
+    return DO_SUCCESS;
+}
+
 do_result_t do_client_list_droplets(do_client_t *client, do_droplet_list_t **droplets) {
     if (!client || !droplets) {
         return DO_ERROR_INVALID_PARAM;
     }
     
-    char *url = do_http_build_url(client->config->base_url, "/v2/droplets");
-    if (!url) {
+    *droplets = do_calloc(1, sizeof(do_droplet_list_t));
+    if (!*droplets) {
         return DO_ERROR_MEMORY;
     }
     
-    do_http_response_t *response = do_http_response_new();
-    if (!response) {
-        free(url);
+    do_result_t result = do_client_paginate(client, "/v2/droplets", "droplets",
+                                            collect_droplet_page, collect_droplet_page_od,
+                                            *droplets);
+    if (result != DO_SUCCESS) {
+        do_droplet_list_free(*droplets);
+        *droplets = NULL;
+    }
+    
+    return result;
+}
+
+typedef struct {
+    do_droplet_visitor_t visitor;
+    void *userdata;
+    do_list_position_t position;
+} droplet_visit_t;
+
+static do_result_t visit_droplet_page(const cJSON *items, const cJSON *page, void *userdata) {
+    droplet_visit_t *visit = userdata;
+    
+    visit->position.total = json_page_total(page);
+    visit->position.page_count = cJSON_GetArraySize(items);
+    visit->position.page_index = 0;
+    
+    const cJSON *droplet_json;
+    cJSON_ArrayForEach(droplet_json, items) {
+        do_droplet_t droplet;
+        memset(&droplet, 0, sizeof(droplet));
+        
+        do_result_t result = json_parse_droplet(droplet_json, &droplet);
+        if (result == DO_SUCCESS) {
+            result = visit->visitor(&droplet, &visit->position, visit->userdata);
+        }
+        do_droplet_free(&droplet);
+        
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+        
+        visit->position.index++;
+        visit->position.page_index++;
+    }
+    
+    return DO_SUCCESS;
+}
+
+static do_result_t visit_droplet_page_od(const json_od_value_t *items,
+                                         const json_od_value_t *page, void *userdata) {
+    droplet_visit_t *visit = userdata;
+    
+    visit->position.total = json_od_page_total(page);
+    visit->position.page_count = json_od_count(items);
+    visit->position.page_index = 0;
+    
+    json_od_value_t droplet_json;
+    for (bool more = json_od_first(items, &droplet_json); more; more = json_od_next(&droplet_json)) {
+        do_droplet_t droplet;
+        memset(&droplet, 0, sizeof(droplet));
+        
+        do_result_t result = json_od_parse_droplet(&droplet_json, &droplet);
+        if (result == DO_SUCCESS) {
+            result = visit->visitor(&droplet, &visit->position, visit->userdata);
+        }
+        do_droplet_free(&droplet);
+        
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+        
+        visit->position.index++;
+        visit->position.page_index++;
+    }
+    
+    return DO_SUCCESS;
+}
+
+do_result_t do_client_list_droplets_each(do_client_t *client, do_droplet_visitor_t visitor,
+                                         void *userdata) {
+    if (!client || !visitor) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    droplet_visit_t visit;
+    memset(&visit, 0, sizeof(visit));
+    visit.visitor = visitor;
+    visit.userdata = userdata;
+    
+    return do_client_paginate(client, "/v2/droplets", "droplets", visit_droplet_page,
+                              visit_droplet_page_od, &visit);
+}
+
+// Incremental refresh. Each droplet's JSON span is hashed straight from the
+// page text, found through the page's on-demand index; only spans whose
+// hash differs from the last refresh are parsed and decoded, and unchanged
+// structs are carried over as they are.
+enum {
+    REFRESH_OLD_GONE = 0,   // not seen in the new listing
+    REFRESH_OLD_KEPT,       // struct moved into the new listing unchanged
+    REFRESH_OLD_REPLACED    // re-decoded; the old struct is freed on commit
+};
+
+typedef struct {
+    do_droplet_list_t *old;
+    size_t *slots;            // open-addressed id -> old index + 1
+    size_t mask;
+    unsigned char *old_state;
+    do_droplet_t *items;      // the new listing
+    uint64_t *hashes;
+    size_t *origin;           // old index + 1 for carried-over structs, 0 for fresh decodes
+    size_t count;
+    size_t capacity;
+    do_droplet_changes_t changes;
+} droplet_refresh_t;
+
+// FNV-1a; the spans only need to be compared with their own previous value
+static uint64_t do_client_hash_span(const char *data, size_t len) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+static size_t refresh_slot(const droplet_refresh_t *refresh, uint32_t id) {
+    return (size_t)(id * 2654435761u) & refresh->mask;
+}
+
+static size_t refresh_find_old(const droplet_refresh_t *refresh, uint32_t id) {
+    for (size_t slot = refresh_slot(refresh, id); refresh->slots[slot]; slot = (slot + 1) & refresh->mask) {
+        size_t index = refresh->slots[slot] - 1;
+        if (refresh->old->items[index].id == id) {
+            return index;
+        }
+    }
+    return SIZE_MAX;
+}
+
+static do_result_t refresh_index_old(droplet_refresh_t *refresh) {
+    const do_droplet_list_t *old = refresh->old;
+    
+    size_t size = 16;
+    while (size < old->count * 2) {
+        size *= 2;
+    }
+    
+    refresh->mask = size - 1;
+    refresh->slots = do_calloc(size, sizeof(size_t));
+    refresh->old_state = do_calloc(old->count ? old->count : 1, 1);
+    if (!refresh->slots || !refresh->old_state) {
         return DO_ERROR_MEMORY;
     }
     
-    do_result_t result = do_http_get(client->http_client, url, client->auth_header, response);
-    free(url);
+    for (size_t i = 0; i < old->count; i++) {
+        if (refresh_find_old(refresh, old->items[i].id) != SIZE_MAX) {
+            continue;
+        }
+        
+        size_t slot = refresh_slot(refresh, old->items[i].id);
+        while (refresh->slots[slot]) {
+            slot = (slot + 1) & refresh->mask;
+        }
+        refresh->slots[slot] = i + 1;
+    }
     
+    return DO_SUCCESS;
+}
+
+static do_result_t refresh_push_id(uint32_t **ids, size_t *count, uint32_t id) {
+    // Capacity doubles whenever the count reaches a power of two
+    if (*count >= 8 && (*count & (*count - 1)) == 0) {
+        uint32_t *grown = do_realloc(*ids, *count * 2 * sizeof(uint32_t));
+        if (!grown) {
+            return DO_ERROR_MEMORY;
+        }
+        *ids = grown;
+    } else if (*count == 0) {
+        *ids = do_malloc(8 * sizeof(uint32_t));
+        if (!*ids) {
+            return DO_ERROR_MEMORY;
+        }
+    }
+    
+    (*ids)[(*count)++] = id;
+    return DO_SUCCESS;
+}
+
+static do_result_t refresh_reserve(droplet_refresh_t *refresh) {
+    if (refresh->count < refresh->capacity) {
+        return DO_SUCCESS;
+    }
+    
+    size_t new_capacity = refresh->capacity ? refresh->capacity * 2 : DO_LIST_PAGE_SIZE;
+    do_droplet_t *items = do_realloc(refresh->items, new_capacity * sizeof(do_droplet_t));
+    if (items) {
+        refresh->items = items;
+    }
+    uint64_t *hashes = do_realloc(refresh->hashes, new_capacity * sizeof(uint64_t));
+    if (hashes) {
+        refresh->hashes = hashes;
+    }
+    size_t *origin = do_realloc(refresh->origin, new_capacity * sizeof(size_t));
+    if (origin) {
+        refresh->origin = origin;
+    }
+    
+    if (!items || !hashes || !origin) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    refresh->capacity = new_capacity;
+    return DO_SUCCESS;
+}
+
+static do_result_t refresh_visit_span(droplet_refresh_t *refresh, const char *json, size_t len,
+                                      int64_t id) {
+    uint64_t hash = do_client_hash_span(json, len);
+    
+    size_t old_index = id >= 0 && id <= UINT32_MAX ? refresh_find_old(refresh, (uint32_t)id) : SIZE_MAX;
+    if (old_index != SIZE_MAX && refresh->old_state[old_index] != REFRESH_OLD_GONE) {
+        return DO_SUCCESS; // listed twice because the fleet shifted while paging
+    }
+    
+    do_result_t result = refresh_reserve(refresh);
     if (result != DO_SUCCESS) {
-        do_http_response_free(response);
         return result;
     }
     
-    // Parse JSON response
-    cJSON *json = cJSON_Parse(response->data);
-    do_http_response_free(response);
+    size_t slot = refresh->count;
+    refresh->hashes[slot] = hash;
     
-    if (!json) {
-        return DO_ERROR_JSON;
+    if (old_index != SIZE_MAX && refresh->old->hashes && refresh->old->hashes[old_index] == hash) {
+        refresh->items[slot] = refresh->old->items[old_index];
+        refresh->origin[slot] = old_index + 1;
+        refresh->old_state[old_index] = REFRESH_OLD_KEPT;
+        refresh->count++;
+        return DO_SUCCESS;
     }
     
-    cJSON *droplets_array = cJSON_GetObjectItemCaseSensitive(json, "droplets");
-    if (!cJSON_IsArray(droplets_array)) {
-        cJSON_Delete(json);
+    cJSON *droplet_json = cJSON_ParseWithLength(json, len);
+    if (!droplet_json) {
         return DO_ERROR_JSON;
     }
     
-    *droplets = calloc(1, sizeof(do_droplet_list_t));
-    if (!*droplets) {
-        cJSON_Delete(json);
+    // Count it first so a partial parse is released on rollback
+    memset(&refresh->items[slot], 0, sizeof(do_droplet_t));
+    refresh->origin[slot] = 0;
+    refresh->count++;
+    result = json_parse_droplet(droplet_json, &refresh->items[slot]);
+    cJSON_Delete(droplet_json);
+    
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    
+    if (old_index == SIZE_MAX) {
+        return refresh_push_id(&refresh->changes.added, &refresh->changes.added_count,
+                               refresh->items[slot].id);
+    }
+    
+    refresh->old_state[old_index] = REFRESH_OLD_REPLACED;
+    if (!refresh->old->hashes) {
+        return DO_SUCCESS; // no baseline to compare against
+    }
+    return refresh_push_id(&refresh->changes.modified, &refresh->changes.modified_count,
+                           refresh->items[slot].id);
+}
+
+// Visits the span of every droplet object on a page, with its id (-1 when
+// it has none that fits)
+static do_result_t refresh_visit_page_od(const json_od_value_t *items,
+                                         const json_od_value_t *page, void *userdata) {
+    (void)page;
+    droplet_refresh_t *refresh = userdata;
+    
+    json_od_value_t item;
+    for (bool more = json_od_first(items, &item); more; more = json_od_next(&item)) {
+        if (!json_od_is_object(&item)) {
+            continue;
+        }
+        
+        json_od_value_t id_value;
+        double number;
+        int64_t id = -1;
+        if (json_od_find(&item, "id", &id_value) && json_od_number(&id_value, &number) &&
+            number >= 0 && number <= UINT32_MAX) {
+            id = (int64_t)number;
+        }
+        
+        do_result_t result = refresh_visit_span(refresh, item.doc->data + item.offset,
+                                                json_od_end(&item) - item.offset, id);
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+    }
+    return DO_SUCCESS;
+}
+
+// Hands droplets that disappeared over to the change set
+static do_result_t refresh_collect_removed(droplet_refresh_t *refresh) {
+    const do_droplet_list_t *old = refresh->old;
+    size_t removed = 0;
+    for (size_t i = 0; i < old->count; i++) {
+        removed += refresh->old_state[i] == REFRESH_OLD_GONE;
+    }
+    
+    if (removed == 0) {
+        return DO_SUCCESS;
+    }
+    
+    refresh->changes.removed = do_malloc(removed * sizeof(do_droplet_t));
+    if (!refresh->changes.removed) {
         return DO_ERROR_MEMORY;
     }
     
-    size_t count = cJSON_GetArraySize(droplets_array);
-    if (count > 0) {
-        (*droplets)->items = calloc(count, sizeof(do_droplet_t));
-        if (!(*droplets)->items) {
-            free(*droplets);
-            *droplets = NULL;
-            cJSON_Delete(json);
-            return DO_ERROR_MEMORY;
+    for (size_t i = 0; i < old->count; i++) {
+        if (refresh->old_state[i] == REFRESH_OLD_GONE) {
+            refresh->changes.removed[refresh->changes.removed_count++] = old->items[i];
+        }
+    }
+    
+    return DO_SUCCESS;
+}
+
+do_result_t do_droplet_list_refresh(do_client_t *client, do_droplet_list_t **list,
+                                    do_droplet_changes_t *changes) {
+    if (!client || !list) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    do_droplet_list_t *old = *list ? *list : do_calloc(1, sizeof(do_droplet_list_t));
+    if (!old) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    droplet_refresh_t refresh;
+    memset(&refresh, 0, sizeof(refresh));
+    refresh.old = old;
+    
+    do_result_t result = refresh_index_old(&refresh);
+    if (result == DO_SUCCESS) {
+        // Spans only; no cJSON handler, so pages are always indexed on demand
+        result = do_client_paginate(client, "/v2/droplets", "droplets", NULL,
+                                    refresh_visit_page_od, &refresh);
+    }
+    if (result == DO_SUCCESS) {
+        result = refresh_collect_removed(&refresh);
+    }
+    
+    if (result == DO_SUCCESS) {
+        // Commit: the old list adopts the new items; structs that were
+        // re-decoded are released, carried-over and removed ones moved
+        for (size_t i = 0; i < old->count; i++) {
+            if (refresh.old_state[i] == REFRESH_OLD_REPLACED) {
+                do_droplet_free(&old->items[i]);
+            }
         }
         
-        (*droplets)->count = count;
-        (*droplets)->capacity = count;
+        do_free(old->items);
+        do_free(old->hashes);
+        old->items = refresh.items;
+        old->hashes = refresh.hashes;
+        old->count = refresh.count;
+        old->capacity = refresh.capacity;
+        old->meta.total = (uint32_t)refresh.count;
+        *list = old;
         
-        size_t i = 0;
-        const cJSON *droplet_json;
-        cJSON_ArrayForEach(droplet_json, droplets_array) {
-            result = json_parse_droplet(droplet_json, &(*droplets)->items[i]);
-            if (result != DO_SUCCESS) {
-                do_droplet_list_free(*droplets);
-                *droplets = NULL;
-                cJSON_Delete(json);
-                return result;
+        if (changes) {
+            *changes = refresh.changes;
+        } else {
+            do_droplet_changes_free(&refresh.changes);
+        }
+    } else {
+        // Rollback: only fresh decodes are ours to free; the old list is untouched
+        for (size_t i = 0; i < refresh.count; i++) {
+            if (!refresh.origin[i]) {
+                do_droplet_free(&refresh.items[i]);
             }
-            i++;
+        }
+        
+        do_free(refresh.items);
+        do_free(refresh.hashes);
+        do_free(refresh.changes.added);
+        do_free(refresh.changes.modified);
+        do_free(refresh.changes.removed);
+        if (!*list) {
+            do_droplet_list_free(old);
         }
     }
     
-    cJSON_Delete(json);
-    return DO_SUCCESS;
+    do_free(refresh.origin);
+    do_free(refresh.slots);
+    do_free(refresh.old_state);
+    return result;
 }
 
 do_result_t do_client_get_droplet(do_client_t *client, uint32_t id, do_droplet_t **droplet) {
@@ -218,42 +950,50 @@ do_result_t do_client_get_droplet(do_client_t *client, uint32_t id, do_droplet_t
         return DO_ERROR_MEMORY;
     }
     
-    do_http_response_t *response = do_http_response_new();
+    do_http_response_t *response = do_http_client_acquire_response(client->http_client);
     if (!response) {
-        free(url);
+        do_free(url);
         return DO_ERROR_MEMORY;
     }
     
     do_result_t result = do_http_get(client->http_client, url, client->auth_header, response);
-    free(url);
+    do_free(url);
     
     if (result != DO_SUCCESS) {
-        do_http_response_free(response);
+        do_http_client_release_response(client->http_client, response);
+        do_client_request_done(client, result, 0, 0);
         return result;
     }
     
     // Parse JSON response
+    int64_t parse_start = do_client_clock_us();
     cJSON *json = cJSON_Parse(response->data);
-    do_http_response_free(response);
+    do_http_client_release_response(client->http_client, response);
+    int64_t parse_us = do_client_clock_us() - parse_start;
     
     if (!json) {
+        do_client_request_done(client, DO_ERROR_JSON, parse_us, 0);
         return DO_ERROR_JSON;
     }
     
     cJSON *droplet_json = cJSON_GetObjectItemCaseSensitive(json, "droplet");
     if (!droplet_json) {
         cJSON_Delete(json);
+        do_client_request_done(client, DO_ERROR_JSON, parse_us, 0);
         return DO_ERROR_JSON;
     }
     
-    *droplet = calloc(1, sizeof(do_droplet_t));
+    *droplet = do_calloc(1, sizeof(do_droplet_t));
     if (!*droplet) {
         cJSON_Delete(json);
+        do_client_request_done(client, DO_ERROR_MEMORY, parse_us, 0);
         return DO_ERROR_MEMORY;
     }
     
+    int64_t decode_start = do_client_clock_us();
     result = json_parse_droplet(droplet_json, *droplet);
     cJSON_Delete(json);
+    do_client_request_done(client, result, parse_us, do_client_clock_us() - decode_start);
     
     if (result != DO_SUCCESS) {
         do_droplet_free(*droplet);
@@ -270,77 +1010,66 @@ do_result_t do_client_create_droplet(do_client_t *client,
         return DO_ERROR_INVALID_PARAM;
     }
     
-    // Build JSON request
-    cJSON *json = cJSON_CreateObject();
-    if (!json) {
-        return DO_ERROR_MEMORY;
-    }
-    
-    cJSON_AddStringToObject(json, "name", request->name);
-    cJSON_AddStringToObject(json, "region", request->region);
-    cJSON_AddStringToObject(json, "size", request->size);
-    cJSON_AddStringToObject(json, "image", request->image);
-    
-    if (request->tags.count > 0) {
-        cJSON *tags_array = cJSON_CreateArray();
-        for (size_t i = 0; i < request->tags.count; i++) {
-            cJSON_AddItemToArray(tags_array, cJSON_CreateString(request->tags.items[i]));
-        }
-        cJSON_AddItemToObject(json, "tags", tags_array);
-    }
+    // Serialize straight into the client's body buffer, which keeps its
+    // capacity between requests
+    json_writer_t writer;
+    json_writer_init(&writer, &client->request_body);
     
-    char *json_string = cJSON_Print(json);
-    cJSON_Delete(json);
-    
-    if (!json_string) {
-        return DO_ERROR_MEMORY;
+    do_result_t result = json_write_create_droplet_request(&writer, request);
+    if (result != DO_SUCCESS) {
+        return result;
     }
     
     char *url = do_http_build_url(client->config->base_url, "/v2/droplets");
     if (!url) {
-        free(json_string);
         return DO_ERROR_MEMORY;
     }
     
-    do_http_response_t *response = do_http_response_new();
+    do_http_response_t *response = do_http_client_acquire_response(client->http_client);
     if (!response) {
-        free(url);
-        free(json_string);
+        do_free(url);
         return DO_ERROR_MEMORY;
     }
     
-    do_result_t result = do_http_post(client->http_client, url, client->auth_header, 
-                                      json_string, response);
-    free(url);
-    free(json_string);
+    result = do_http_post(client->http_client, url, client->auth_header, 
+                          client->request_body.data, response);
+    do_free(url);
     
     if (result != DO_SUCCESS) {
-        do_http_response_free(response);
+        do_http_client_release_response(client->http_client, response);
+        do_client_request_done(client, result, 0, 0);
         return result;
     }
     
     // Parse JSON response
+    int64_t parse_start = do_client_clock_us();
     cJSON *response_json = cJSON_Parse(response->data);
-    do_http_response_free(response);
+    do_http_client_release_response(client->http_client, response);
+    int64_t parse_us = do_client_clock_us() - parse_start;
     
     if (!response_json) {
+        do_client_request_done(client, DO_ERROR_JSON, parse_us, 0);
         return DO_ERROR_JSON;
     }
     
     cJSON *droplet_json = cJSON_GetObjectItemCaseSensitive(response_json, "droplet");
     if (!droplet_json) {
         cJSON_Delete(response_json);
+        do_client_request_done(client, DO_ERROR_JSON, parse_us, 0);
         return DO_ERROR_JSON;
     }
     
-    *droplet = calloc(1, sizeof(do_droplet_t));
+    *droplet = do_calloc(1, sizeof(do_droplet_t));
     if (!*droplet) {
         cJSON_Delete(response_json);
+        do_client_request_done(client, DO_ERROR_MEMORY, parse_us, 0);
         return DO_ERROR_MEMORY;
     }
     
+    int64_t decode_start = do_client_clock_us();
     result = json_parse_droplet(droplet_json, *droplet);
     cJSON_Delete(response_json);
+    do_client_request_done(client, result, parse_us, do_client_clock_us() - decode_start);
     
     if (result != DO_SUCCESS) {
         do_droplet_free(*droplet);
@@ -363,19 +1092,335 @@ do_result_t do_client_delete_droplet(do_client_t *client, uint32_t id) {
         return DO_ERROR_MEMORY;
     }
     
-    do_http_response_t *response = do_http_response_new();
+    do_http_response_t *response = do_http_client_acquire_response(client->http_client);
     if (!response) {
-        free(url);
+        do_free(url);
         return DO_ERROR_MEMORY;
     }
     
     do_result_t result = do_http_delete(client->http_client, url, client->auth_header, response);
-    free(url);
-    do_http_response_free(response);
+    do_free(url);
+    do_http_client_release_response(client->http_client, response);
+    do_client_request_done(client, result, 0, 0);
     
     return result;
 }
 
+static const char *const droplet_action_names[DO_DROPLET_ACTION_TYPE_COUNT] = {
+    [DO_DROPLET_ACTION_POWER_CYCLE] = "power_cycle",
+    [DO_DROPLET_ACTION_POWER_ON] = "power_on",
+    [DO_DROPLET_ACTION_POWER_OFF] = "power_off",
+    [DO_DROPLET_ACTION_SHUTDOWN] = "shutdown",
+    [DO_DROPLET_ACTION_ENABLE_BACKUPS] = "enable_backups",
+    [DO_DROPLET_ACTION_DISABLE_BACKUPS] = "disable_backups",
+    [DO_DROPLET_ACTION_ENABLE_IPV6] = "enable_ipv6",
+    [DO_DROPLET_ACTION_ENABLE_PRIVATE_NETWORKING] = "enable_private_networking",
+    [DO_DROPLET_ACTION_SNAPSHOT] = "snapshot",
+};
+
+const char *do_droplet_action_type_name(do_droplet_action_type_t type) {
+    return (unsigned)type < DO_DROPLET_ACTION_TYPE_COUNT ? droplet_action_names[type] : NULL;
+}
+
+bool do_droplet_action_type_parse(const char *name, do_droplet_action_type_t *type) {
+    if (!name || !type) {
+        return false;
+    }
+    
+    for (int i = 0; i < DO_DROPLET_ACTION_TYPE_COUNT; i++) {
+        if (strcmp(droplet_action_names[i], name) == 0) {
+            *type = (do_droplet_action_type_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Posts an action request to endpoint and parses the reply. Unlike the
+// older calls this checks the status, since an error body would otherwise
+// surface as a missing "action" member.
+static do_result_t do_client_post_action(do_client_t *client, const char *endpoint,
+                                         do_droplet_action_type_t type,
+                                         const char *snapshot_name, cJSON **json,
+                                         int64_t *parse_us) {
+    *json = NULL;
+    *parse_us = 0;
+    
+    json_writer_t writer;
+    json_writer_init(&writer, &client->request_body);
+    json_writer_begin_object(&writer);
+    json_writer_member_string(&writer, "type", droplet_action_names[type]);
+    if (type == DO_DROPLET_ACTION_SNAPSHOT) {
+        json_writer_member_string(&writer, "name", snapshot_name);
+    }
+    json_writer_end_object(&writer);
+    
+    do_result_t result = json_writer_finish(&writer);
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    
+    char *url = do_http_build_url(client->config->base_url, endpoint);
+    if (!url) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_http_response_t *response = do_http_client_acquire_response(client->http_client);
+    if (!response) {
+        do_free(url);
+        return DO_ERROR_MEMORY;
+    }
+    
+    result = do_http_post(client->http_client, url, client->auth_header,
+                          client->request_body.data, response);
+    do_free(url);
+    if (result == DO_SUCCESS) {
+        result = do_http_status_to_result(client->http_client->timing.status_code);
+    }
+    if (result != DO_SUCCESS) {
+        do_http_client_release_response(client->http_client, response);
+        return result;
+    }
+    
+    int64_t parse_start = do_client_clock_us();
+    *json = response->data ? cJSON_Parse(response->data) : NULL;
+    do_http_client_release_response(client->http_client, response);
+    *parse_us = do_client_clock_us() - parse_start;
+    
+    return *json ? DO_SUCCESS : DO_ERROR_JSON;
+}
+
+do_result_t do_client_droplet_action(do_client_t *client, uint32_t id,
+                                     do_droplet_action_type_t type, const char *snapshot_name,
+                                     do_action_t **action) {
+    if (!client || (unsigned)type >= DO_DROPLET_ACTION_TYPE_COUNT || !action) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    *action = NULL;
+    
+    char endpoint[64];
+    snprintf(endpoint, sizeof(endpoint), "/v2/droplets/%u/actions", id);
+    
+    cJSON *json;
+    int64_t parse_us;
+    do_result_t result = do_client_post_action(client, endpoint, type, snapshot_name,
+                                               &json, &parse_us);
+    if (result != DO_SUCCESS) {
+        do_client_request_done(client, result, parse_us, 0);
+        return result;
+    }
+    
+    int64_t decode_start = do_client_clock_us();
+    const cJSON *action_json = cJSON_GetObjectItemCaseSensitive(json, "action");
+    if (!cJSON_IsObject(action_json)) {
+        result = DO_ERROR_JSON;
+    } else {
+        *action = do_calloc(1, sizeof(do_action_t));
+        result = *action ? json_parse_action(action_json, *action) : DO_ERROR_MEMORY;
+    }
+    cJSON_Delete(json);
+    do_client_request_done(client, result, parse_us, do_client_clock_us() - decode_start);
+    
+    if (result != DO_SUCCESS && *action) {
+        do_action_free(*action);
+        do_free(*action);
+        *action = NULL;
+    }
+    
+    return result;
+}
+
+do_result_t do_client_droplet_action_by_tag(do_client_t *client, const char *tag,
+                                            do_droplet_action_type_t type,
+                                            const char *snapshot_name,
+                                            do_action_list_t **actions) {
+    if (!client || !tag || tag[0] == '\0' || (unsigned)type >= DO_DROPLET_ACTION_TYPE_COUNT ||
+        !actions) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    *actions = NULL;
+    
+    char *escaped = curl_easy_escape(NULL, tag, 0);
+    if (!escaped) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    char endpoint[512];
+    int written = snprintf(endpoint, sizeof(endpoint), "/v2/droplets/actions?tag_name=%s", escaped);
+    curl_free(escaped);
+    if (written < 0 || (size_t)written >= sizeof(endpoint)) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    cJSON *json;
+    int64_t parse_us;
+    do_result_t result = do_client_post_action(client, endpoint, type, snapshot_name,
+                                               &json, &parse_us);
+    if (result != DO_SUCCESS) {
+        do_client_request_done(client, result, parse_us, 0);
+        return result;
+    }
+    
+    int64_t decode_start = do_client_clock_us();
+    const cJSON *items = cJSON_GetObjectItemCaseSensitive(json, "actions");
+    size_t count = cJSON_IsArray(items) ? (size_t)cJSON_GetArraySize(items) : 0;
+    *actions = cJSON_IsArray(items) ? do_calloc(1, sizeof(do_action_list_t)) : NULL;
+    if (*actions && count > 0) {
+        (*actions)->items = do_calloc(count, sizeof(do_action_t));
+        (*actions)->capacity = count;
+    }
+    
+    if (!cJSON_IsArray(items)) {
+        result = DO_ERROR_JSON;
+    } else if (!*actions || (count > 0 && !(*actions)->items)) {
+        result = DO_ERROR_MEMORY;
+    } else {
+        const cJSON *action_json;
+        cJSON_ArrayForEach(action_json, items) {
+            result = json_parse_action(action_json, &(*actions)->items[(*actions)->count++]);
+            if (result != DO_SUCCESS) {
+                break;
+            }
+        }
+    }
+    cJSON_Delete(json);
+    do_client_request_done(client, result, parse_us, do_client_clock_us() - decode_start);
+    
+    if (result != DO_SUCCESS) {
+        do_action_list_free(*actions);
+        *actions = NULL;
+    }
+    
+    return result;
+}
+
+typedef struct {
+    int fd;
+    json_next_scanner_t *scanner; // NULL unless paginating
+    char last_byte;
+    bool write_failed;
+} raw_stream_t;
+
+static int raw_write_all(int fd, const char *data, size_t len) {
+    while (len > 0) {
+        ssize_t n = write(fd, data, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        data += n;
+        len -= (size_t)n;
+    }
+    return 0;
+}
+
+// curl write callback: bytes go from curl's buffer straight to the fd
+static size_t raw_stream_write(char *data, size_t size, size_t nmemb, void *userdata) {
+    raw_stream_t *stream = userdata;
+    size_t len = size * nmemb;
+    
+    if (len == 0) {
+        return 0;
+    }
+    
+    if (stream->scanner) {
+        json_next_scanner_feed(stream->scanner, data, len);
+    }
+    
+    if (raw_write_all(stream->fd, data, len) != 0) {
+        stream->write_failed = true;
+        return 0; // aborts the transfer
+    }
+    
+    stream->last_byte = data[len - 1];
+    return len;
+}
+
+// do_client_raw() with extra header lines on every request (invoke.c)
+do_result_t do_client_raw_with_headers(do_client_t *client, const char *method, const char *path,
+                                       const struct curl_slist *headers, const char *body,
+                                       int fd, unsigned flags) {
+    if (!client || !method || !path || path[0] != '/' || fd < 0) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    bool paginate = (flags & DO_RAW_PAGINATE) && strcmp(method, "GET") == 0;
+    
+    char *url;
+    if (paginate && !strstr(path, "per_page=")) {
+        size_t len = strlen(path) + 32;
+        char *endpoint = do_malloc(len);
+        if (!endpoint) {
+            return DO_ERROR_MEMORY;
+        }
+        snprintf(endpoint, len, "%s%sper_page=%d", path, strchr(path, '?') ? "&" : "?", DO_LIST_PAGE_SIZE);
+        url = do_http_build_url(client->config->base_url, endpoint);
+        do_free(endpoint);
+    } else {
+        url = do_http_build_url(client->config->base_url, path);
+    }
+    if (!url) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    raw_stream_t stream;
+    memset(&stream, 0, sizeof(stream));
+    stream.fd = fd;
+    if (paginate) {
+        stream.scanner = json_next_scanner_new();
+        if (!stream.scanner) {
+            do_free(url);
+            return DO_ERROR_MEMORY;
+        }
+    }
+    
+    do_result_t result = DO_SUCCESS;
+    while (url) {
+        long status_code = 0;
+        stream.last_byte = '\n';
+        
+        result = do_http_stream_with_headers(client->http_client, method, url,
+                                             client->auth_header, headers, body,
+                                             raw_stream_write, &stream, &status_code);
+        do_client_request_done(client, result, 0, 0);
+        do_free(url);
+        url = NULL;
+        
+        // Terminate every body with a newline so pages form NDJSON
+        if (stream.last_byte != '\n' && !stream.write_failed &&
+            raw_write_all(fd, "\n", 1) != 0) {
+            stream.write_failed = true;
+        }
+        
+        if (result == DO_SUCCESS && stream.write_failed) {
+            result = DO_ERROR_HTTP;
+        }
+        if (result == DO_SUCCESS) {
+            result = do_http_status_to_result(status_code);
+        }
+        if (result != DO_SUCCESS || !stream.scanner) {
+            break;
+        }
+        
+        const char *next = json_next_scanner_next(stream.scanner);
+        if (next) {
+            url = do_strdup(next);
+            if (!url) {
+                result = DO_ERROR_MEMORY;
+            }
+        }
+        json_next_scanner_reset(stream.scanner);
+    }
+    
+    json_next_scanner_free(stream.scanner);
+    return result;
+}
+
+do_result_t do_client_raw(do_client_t *client, const char *method, const char *path,
+                          const char *body, int fd, unsigned flags) {
+    return do_client_raw_with_headers(client, method, path, NULL, body, fd, flags);
+}
+
 const char *do_client_get_error_string(do_result_t result) {
     switch (result) {
         case DO_SUCCESS:
@@ -401,8 +1446,29 @@ const char *do_client_get_error_string(do_result_t result) {
     }
 }
 
+#ifndef DO_JSON_BACKEND_DEFAULT
+#define DO_JSON_BACKEND_DEFAULT DO_JSON_BACKEND_ONDEMAND
+#endif
+
+static do_json_backend_t json_backend = DO_JSON_BACKEND_DEFAULT;
+
+do_result_t do_set_json_backend(do_json_backend_t backend) {
+    if (backend != DO_JSON_BACKEND_CJSON && backend != DO_JSON_BACKEND_ONDEMAND) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    json_backend = backend;
+    return DO_SUCCESS;
+}
+
+do_json_backend_t do_get_json_backend(void) {
+    return json_backend;
+}
+
 do_result_t do_library_init(void) {
-    CURLcode res = curl_global_init(CURL_GLOBAL_DEFAULT);
+    // libcurl's own allocations follow the installed allocator as well
+    CURLcode res = curl_global_init_mem(CURL_GLOBAL_DEFAULT, do_malloc, do_free, do_realloc,
+                                        do_strdup, do_calloc);
     return (res == CURLE_OK) ? DO_SUCCESS : DO_ERROR_HTTP;
 }
 
@@ -0,0 +1,45 @@
+#ifndef DO_CLIENT_INTERNAL_H
+#define DO_CLIENT_INTERNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <cjson/cjson.h>
+#include "digitalocean/client.h"
+#include "digitalocean/filter.h"
+#include "json_ondemand.h"
+
+// Client, cursor and filter functions shared between their files
+
+// Finishes the bookkeeping for the last request: adds our parse/decode
+// time to its timing record, updates the metrics and calls the hook
+// (client.c; used by group.c, tags.c)
+void do_client_request_done(do_client_t *client, do_result_t result,
+                            int64_t parse_us, int64_t decode_us);
+
+// do_client_raw() with extra header lines on every request (invoke.c)
+do_result_t do_client_raw_with_headers(do_client_t *client, const char *method, const char *path,
+                                       const struct curl_slist *headers, const char *body,
+                                       int fd, unsigned flags);
+
+// meta.total of a list page, 0 when absent (client.c)
+uint32_t json_page_total(const cJSON *page);
+
+// Creates the client's spare handle ahead of the first cursor and starts
+// its connection (cursor.c)
+do_result_t do_cursor_warm_up(do_client_t *client, const char *url);
+
+// A keep predicate that reads the item from the page's index instead
+typedef bool (*do_list_indexed_predicate_t)(const json_od_value_t *json, void *userdata);
+
+// do_cursor_open_filtered() with keep_indexed, which must agree with keep,
+// for filters that can also read an item from the page's index (cursor.c)
+do_result_t do_cursor_open_indexed(do_client_t *client, const do_list_type_t *type,
+                                   const char *query, do_list_predicate_t keep,
+                                   do_list_indexed_predicate_t keep_indexed, void *userdata,
+                                   do_list_cursor_t **cursor);
+
+// do_droplet_filter_matches() against one droplet in a page's index (filter.c)
+bool do_droplet_filter_matches_indexed(const do_droplet_filter_t *filter,
+                                       const json_od_value_t *droplet);
+
+#endif // DO_CLIENT_INTERNAL_H
\ No newline at end of file
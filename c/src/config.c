@@ -6,17 +6,18 @@
 #include <sys/types.h>
 #include <pwd.h>
 #include "digitalocean/config.h"
+#include "digitalocean/alloc.h"
 
 do_config_t *do_config_new(void) {
-    do_config_t *config = calloc(1, sizeof(do_config_t));
+    do_config_t *config = do_calloc(1, sizeof(do_config_t));
     if (!config) {
         return NULL;
     }
     
     // Set default base URL
-    config->base_url = strdup(DO_DEFAULT_BASE_URL);
+    config->base_url = do_strdup(DO_DEFAULT_BASE_URL);
     if (!config->base_url) {
-        free(config);
+        do_free(config);
         return NULL;
     }
     
@@ -28,9 +29,98 @@ void do_config_free(do_config_t *config) {
         return;
     }
     
-    free(config->token);
-    free(config->base_url);
-    free(config);
+    do_free(config->token);
+    do_free(config->base_url);
+    do_free(config);
+}
+
+// Called for each key=value line; profile is the name from the enclosing
+// [profile NAME] section, or NULL at the top of the file
+typedef do_result_t (*do_config_entry_t)(const char *profile, const char *key, const char *value,
+                                         void *userdata);
+
+static do_result_t do_config_read_file(do_config_entry_t entry, void *userdata) {
+    char *config_path = do_config_get_config_path();
+    if (!config_path) {
+        return DO_ERROR_CONFIG;
+    }
+    
+    FILE *file = fopen(config_path, "r");
+    do_free(config_path);
+    
+    if (!file) {
+        // Config file doesn't exist, that's OK
+        return DO_SUCCESS;
+    }
+    
+    char line[512];
+    char profile[128] = "";
+    bool in_section = false;
+    do_result_t result = DO_SUCCESS;
+    while (result == DO_SUCCESS && fgets(line, sizeof(line), file)) {
+        // Remove newline
+        line[strcspn(line, "\r\n")] = 0;
+        
+        // Skip comments and empty lines
+        if (line[0] == '#' || line[0] == '\0') {
+            continue;
+        }
+        
+        // Section headers; only [profile NAME] sections are ours, keys in
+        // any other section are skipped
+        if (line[0] == '[') {
+            char *end = strchr(line, ']');
+            in_section = true;
+            profile[0] = '\0';
+            if (end && strncmp(line, "[profile ", 9) == 0) {
+                *end = '\0';
+                const char *name = line + 9;
+                while (*name == ' ') name++;
+                snprintf(profile, sizeof(profile), "%.127s", name);
+            }
+            continue;
+        }
+        if (in_section && profile[0] == '\0') {
+            continue;
+        }
+        
+        // Parse key=value pairs
+        char *equals = strchr(line, '=');
+        if (!equals) {
+            continue;
+        }
+        
+        *equals = '\0';
+        char *key = line;
+        char *value = equals + 1;
+        
+        // Trim whitespace
+        while (*key == ' ' || *key == '\t') key++;
+        while (*value == ' ' || *value == '\t') value++;
+        char *key_end = equals;
+        while (key_end > key && (key_end[-1] == ' ' || key_end[-1] == '\t')) *--key_end = '\0';
+        
+        result = entry(in_section ? profile : NULL, key, value, userdata);
+    }
+    
+    fclose(file);
+    return result;
+}
+
+static do_result_t apply_default_entry(const char *profile, const char *key, const char *value,
+                                       void *userdata) {
+    do_config_t *config = userdata;
+    if (profile) {
+        return DO_SUCCESS;
+    }
+    
+    if (strcmp(key, "token") == 0 && !config->token) {
+        config->token = do_strdup(value);
+    } else if (strcmp(key, "base_url") == 0) {
+        do_free(config->base_url);
+        config->base_url = do_strdup(value);
+    }
+    return DO_SUCCESS;
 }
 
 do_result_t do_config_load(do_config_t *config) {
@@ -41,8 +131,8 @@ do_result_t do_config_load(do_config_t *config) {
     // First try environment variables
     const char *env_token = getenv("DIGITALOCEAN_TOKEN");
     if (env_token) {
-        free(config->token);
-        config->token = strdup(env_token);
+        do_free(config->token);
+        config->token = do_strdup(env_token);
         if (!config->token) {
             return DO_ERROR_MEMORY;
         }
@@ -50,8 +140,8 @@ do_result_t do_config_load(do_config_t *config) {
     
     const char *env_base_url = getenv("DIGITALOCEAN_BASE_URL");
     if (env_base_url) {
-        free(config->base_url);
-        config->base_url = strdup(env_base_url);
+        do_free(config->base_url);
+        config->base_url = do_strdup(env_base_url);
         if (!config->base_url) {
             return DO_ERROR_MEMORY;
         }
@@ -63,53 +153,117 @@ do_result_t do_config_load(do_config_t *config) {
     }
     
     // Try to load from config file
-    char *config_path = do_config_get_config_path();
-    if (!config_path) {
-        return DO_ERROR_CONFIG;
+    return do_config_read_file(apply_default_entry, config);
+}
+
+static do_result_t collect_profile_name(const char *profile, const char *key, const char *value,
+                                        void *userdata) {
+    (void)value;
+    do_string_array_t *names = userdata;
+    if (!profile || strcmp(key, "token") != 0) {
+        return DO_SUCCESS;
     }
     
-    FILE *file = fopen(config_path, "r");
-    free(config_path);
+    for (size_t i = 0; i < names->count; i++) {
+        if (strcmp(names->items[i], profile) == 0) {
+            return DO_SUCCESS;
+        }
+    }
+    return do_string_array_add(names, profile);
+}
+
+do_result_t do_config_list_profiles(do_string_array_t *names) {
+    if (!names) {
+        return DO_ERROR_INVALID_PARAM;
+    }
     
-    if (!file) {
-        // Config file doesn't exist, that's OK
+    return do_config_read_file(collect_profile_name, names);
+}
+
+typedef struct {
+    do_config_t *config;
+    const char *name;
+} profile_load_t;
+
+static do_result_t apply_profile_entry(const char *profile, const char *key, const char *value,
+                                       void *userdata) {
+    profile_load_t *load = userdata;
+    do_config_t *config = load->config;
+    
+    // Top-level base_url is the default for every profile
+    if (profile && strcmp(profile, load->name) != 0) {
         return DO_SUCCESS;
     }
     
+    char **field = NULL;
+    if (strcmp(key, "token") == 0 && profile) {
+        field = &config->token;
+    } else if (strcmp(key, "base_url") == 0) {
+        field = &config->base_url;
+    }
+    if (!field) {
+        return DO_SUCCESS;
+    }
+    
+    do_free(*field);
+    *field = do_strdup(value);
+    return *field ? DO_SUCCESS : DO_ERROR_MEMORY;
+}
+
+do_result_t do_config_load_profile(do_config_t *config, const char *name) {
+    if (!config || !name) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    do_free(config->token);
+    config->token = NULL;
+    
+    profile_load_t load = {config, name};
+    do_result_t result = do_config_read_file(apply_profile_entry, &load);
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    if (!config->token) {
+        return DO_ERROR_NOT_FOUND;
+    }
+    
+    const char *env_base_url = getenv("DIGITALOCEAN_BASE_URL");
+    if (env_base_url) {
+        return do_config_set_base_url(config, env_base_url);
+    }
+    
+    return DO_SUCCESS;
+}
+
+// Returns the text from the first section header to the end of the file,
+// or NULL when there is none
+static char *do_config_read_sections(const char *config_path) {
+    FILE *file = fopen(config_path, "r");
+    if (!file) {
+        return NULL;
+    }
+    
+    char *sections = NULL;
+    size_t length = 0;
     char line[512];
     while (fgets(line, sizeof(line), file)) {
-        // Remove newline
-        line[strcspn(line, "\n")] = 0;
-        
-        // Skip comments and empty lines
-        if (line[0] == '#' || line[0] == '\0') {
+        if (!sections && line[0] != '[') {
             continue;
         }
         
-        // Parse key=value pairs
-        char *equals = strchr(line, '=');
-        if (!equals) {
-            continue;
+        size_t line_len = strlen(line);
+        char *grown = do_realloc(sections, length + line_len + 1);
+        if (!grown) {
+            break;
         }
         
-        *equals = '\0';
-        char *key = line;
-        char *value = equals + 1;
-        
-        // Trim whitespace
-        while (*key == ' ' || *key == '\t') key++;
-        while (*value == ' ' || *value == '\t') value++;
-        
-        if (strcmp(key, "token") == 0 && !config->token) {
-            config->token = strdup(value);
-        } else if (strcmp(key, "base_url") == 0) {
-            free(config->base_url);
-            config->base_url = strdup(value);
-        }
+        sections = grown;
+        memcpy(sections + length, line, line_len + 1);
+        length += line_len;
     }
     
     fclose(file);
-    return DO_SUCCESS;
+    return sections;
 }
 
 do_result_t do_config_save(const do_config_t *config) {
@@ -117,31 +271,26 @@ do_result_t do_config_save(const do_config_t *config) {
         return DO_ERROR_INVALID_PARAM;
     }
     
-    char *config_dir = do_config_get_config_dir();
-    if (!config_dir) {
-        return DO_ERROR_CONFIG;
-    }
-    
     // Create config directory if it doesn't exist
-    struct stat st;
-    if (stat(config_dir, &st) != 0) {
-        if (mkdir(config_dir, 0755) != 0) {
-            free(config_dir);
-            return DO_ERROR_CONFIG;
-        }
+    do_result_t result = do_config_ensure_config_dir();
+    if (result != DO_SUCCESS) {
+        return result;
     }
     
     char *config_path = do_config_get_config_path();
-    free(config_dir);
-    
     if (!config_path) {
         return DO_ERROR_CONFIG;
     }
     
+    // Only the top-level keys are rewritten; [profile NAME] sections and
+    // everything after them are carried over as they are
+    char *sections = do_config_read_sections(config_path);
+    
     FILE *file = fopen(config_path, "w");
-    free(config_path);
+    do_free(config_path);
     
     if (!file) {
+        do_free(sections);
         return DO_ERROR_CONFIG;
     }
     
@@ -152,6 +301,10 @@ do_result_t do_config_save(const do_config_t *config) {
     if (config->base_url) {
         fprintf(file, "base_url=%s\n", config->base_url);
     }
+    if (sections) {
+        fprintf(file, "\n%s", sections);
+        do_free(sections);
+    }
     
     fclose(file);
     return DO_SUCCESS;
@@ -162,8 +315,8 @@ do_result_t do_config_set_token(do_config_t *config, const char *token) {
         return DO_ERROR_INVALID_PARAM;
     }
     
-    free(config->token);
-    config->token = strdup(token);
+    do_free(config->token);
+    config->token = do_strdup(token);
     return config->token ? DO_SUCCESS : DO_ERROR_MEMORY;
 }
 
@@ -172,8 +325,8 @@ do_result_t do_config_set_base_url(do_config_t *config, const char *base_url) {
         return DO_ERROR_INVALID_PARAM;
     }
     
-    free(config->base_url);
-    config->base_url = strdup(base_url);
+    do_free(config->base_url);
+    config->base_url = do_strdup(base_url);
     return config->base_url ? DO_SUCCESS : DO_ERROR_MEMORY;
 }
 
@@ -216,7 +369,7 @@ char *do_config_get_config_dir(void) {
     }
     
     size_t len = strlen(home) + strlen("/.config/do-cli") + 1;
-    char *config_dir = malloc(len);
+    char *config_dir = do_malloc(len);
     if (!config_dir) {
         return NULL;
     }
@@ -225,6 +378,37 @@ char *do_config_get_config_dir(void) {
     return config_dir;
 }
 
+do_result_t do_config_ensure_config_dir(void) {
+    char *config_dir = do_config_get_config_dir();
+    if (!config_dir) {
+        return DO_ERROR_CONFIG;
+    }
+    
+    // Create each missing component, e.g. ~/.config on a fresh account
+    for (char *p = config_dir + 1; ; p++) {
+        if (*p != '/' && *p != '\0') {
+            continue;
+        }
+        
+        char saved = *p;
+        *p = '\0';
+        
+        struct stat st;
+        if (stat(config_dir, &st) != 0 && mkdir(config_dir, 0755) != 0) {
+            do_free(config_dir);
+            return DO_ERROR_CONFIG;
+        }
+        
+        *p = saved;
+        if (saved == '\0') {
+            break;
+        }
+    }
+    
+    do_free(config_dir);
+    return DO_SUCCESS;
+}
+
 char *do_config_get_config_path(void) {
     char *config_dir = do_config_get_config_dir();
     if (!config_dir) {
@@ -232,28 +416,28 @@ char *do_config_get_config_path(void) {
     }
     
     size_t len = strlen(config_dir) + strlen("/") + strlen(DO_CONFIG_FILE_NAME) + 1;
-    char *config_path = malloc(len);
+    char *config_path = do_malloc(len);
     if (!config_path) {
-        free(config_dir);
+        do_free(config_dir);
         return NULL;
     }
     
     snprintf(config_path, len, "%s/%s", config_dir, DO_CONFIG_FILE_NAME);
-    free(config_dir);
+    do_free(config_dir);
     return config_path;
 }
 
 char *do_config_mask_token(const char *token) {
     if (!token || strlen(token) == 0) {
-        return strdup("<not set>");
+        return do_strdup("<not set>");
     }
     
     size_t len = strlen(token);
     if (len <= 8) {
-        return strdup("***");
+        return do_strdup("***");
     }
     
-    char *masked = malloc(16); // "xxxx...xxxx\0"
+    char *masked = do_malloc(16); // "xxxx...xxxx\0"
     if (!masked) {
         return NULL;
     }
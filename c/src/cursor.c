@@ -0,0 +1,644 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <cjson/cjson.h>
+#include "digitalocean/client.h"
+#include "digitalocean/alloc.h"
+#include "client_internal.h"
+#include "http_internal.h"
+#include "json_internal.h"
+#include "metrics_internal.h"
+#include "tls_sessions.h"
+
+#define DO_CURSOR_PAGE_SIZE 200
+
+
+static do_result_t decode_droplet_item(const cJSON *json, void *item) {
+    return json_parse_droplet(json, item);
+}
+
+static void free_droplet_item(void *item) {
+    do_droplet_free(item);
+}
+
+const do_list_type_t do_list_droplets = {
+    "/v2/droplets", "droplets", sizeof(do_droplet_t), decode_droplet_item, free_droplet_item
+};
+
+// Views come from the page text, never from a tree; the cursor decodes
+// them itself and the page buffer owns them
+static do_result_t decode_droplet_view_item(const cJSON *json, void *item) {
+    (void)json;
+    (void)item;
+    return DO_ERROR_INVALID_PARAM;
+}
+
+static void free_droplet_view_item(void *item) {
+    (void)item;
+}
+
+const do_list_type_t do_list_droplet_views = {
+    "/v2/droplets", "droplets", sizeof(do_droplet_view_t), decode_droplet_view_item,
+    free_droplet_view_item
+};
+
+// One view page in a single block: this header, the views, then every
+// droplet's tags. text is the response body they point into, taken over
+// from the HTTP client's pool.
+struct do_page_buffer {
+    _Atomic size_t refs;
+    char *text;
+    do_droplet_view_t *items;
+    do_str_view_t *tags;
+};
+
+typedef struct {
+    char *url;       // page to fetch
+    void *items;     // count decoded items of the type's item_size
+    size_t count;
+    char *next_url;  // links.pages.next, NULL on the last page
+    uint32_t total;
+    do_result_t result;
+    do_request_timing_t timing;
+    int64_t parse_us;
+    int64_t decode_us;
+    do_page_buffer_t *buffer; // view pages: owns items
+} cursor_page_t;
+
+struct do_list_cursor {
+    do_client_t *client;
+    const do_list_type_t *type;
+    do_list_predicate_t keep;      // NULL keeps every item
+    do_list_indexed_predicate_t keep_indexed; // the same test, when it has one; spares a tree
+    void *keep_userdata;
+    do_http_client_t *http_client; // the client's spare handle, or one of our own
+    bool owns_http_client;
+    pthread_t thread;
+    bool fetching;                 // thread is filling next
+    bool done;
+    do_result_t result;            // returned once done
+    _Atomic bool closing;
+    cursor_page_t current;
+    cursor_page_t next;
+    uint32_t total;
+    bool ondemand;                 // droplets decoded from an index of the page, not a tree
+    bool views;                    // do_list_droplet_views
+    json_od_doc_t doc;             // that index, reused page to page by the fetch
+};
+
+static int64_t do_cursor_clock_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+// Aborts a transfer in flight once the cursor is being closed
+static int do_cursor_progress(void *userdata, curl_off_t dltotal, curl_off_t dlnow,
+                              curl_off_t ultotal, curl_off_t ulnow) {
+    (void)dltotal;
+    (void)dlnow;
+    (void)ultotal;
+    (void)ulnow;
+    do_list_cursor_t *cursor = userdata;
+    return atomic_load_explicit(&cursor->closing, memory_order_relaxed) ? 1 : 0;
+}
+
+static void do_cursor_page_clear(const do_list_type_t *type, cursor_page_t *page) {
+    if (page->buffer) {
+        do_page_buffer_release(page->buffer);
+    } else {
+        for (size_t i = 0; i < page->count; i++) {
+            type->free_item((char *)page->items + i * type->item_size);
+        }
+        do_free(page->items);
+    }
+    do_free(page->url);
+    do_free(page->next_url);
+    memset(page, 0, sizeof(*page));
+}
+
+// A handle for cursors with the client's settings
+static do_result_t do_cursor_new_http_client(do_client_t *client, do_http_client_t **out) {
+    do_http_client_t *http_client = do_http_client_new();
+    if (!http_client) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_result_t result = do_http_client_init(http_client);
+    if (result == DO_SUCCESS) {
+        result = do_http_client_set_timeout(http_client, client->http_client->timeout);
+    }
+    if (result == DO_SUCCESS) {
+        result = do_http_client_set_user_agent(http_client, client->http_client->user_agent);
+    }
+    if (result != DO_SUCCESS) {
+        do_http_client_free(http_client);
+        return result;
+    }
+    http_client->rate_budget = client->rate_budget;
+    if (client->tls_session_path) {
+        do_tls_sessions_load(http_client, client->tls_session_path);
+    }
+    
+    *out = http_client;
+    return DO_SUCCESS;
+}
+
+// Creates the client's spare handle ahead of the first cursor and starts
+// its connection (client.c)
+do_result_t do_cursor_warm_up(do_client_t *client, const char *url) {
+    if (!client->cursor_http_client) {
+        do_result_t result = do_cursor_new_http_client(client, &client->cursor_http_client);
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+    }
+    return client->cursor_http_busy ? DO_SUCCESS
+                                    : do_http_client_warm_up(client->cursor_http_client, url);
+}
+
+// One cursor at a time borrows the client's spare handle, so repeated
+// walks reuse its connection; concurrent cursors get handles of their own
+static do_result_t do_cursor_take_http_client(do_list_cursor_t *cursor) {
+    do_client_t *client = cursor->client;
+    do_http_client_t *http_client = client->cursor_http_busy ? NULL : client->cursor_http_client;
+    
+    if (!http_client) {
+        do_result_t result = do_cursor_new_http_client(client, &http_client);
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+        
+        if (!client->cursor_http_busy) {
+            client->cursor_http_client = http_client;
+        }
+    }
+    
+    cursor->owns_http_client = client->cursor_http_busy;
+    if (!cursor->owns_http_client) {
+        client->cursor_http_busy = true;
+    }
+    cursor->http_client = http_client;
+    do_http_client_settle(http_client);
+    
+    // Signals cannot be used for timeouts off the main thread
+    curl_easy_setopt(http_client->curl, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(http_client->curl, CURLOPT_XFERINFOFUNCTION, do_cursor_progress);
+    curl_easy_setopt(http_client->curl, CURLOPT_XFERINFODATA, cursor);
+    curl_easy_setopt(http_client->curl, CURLOPT_NOPROGRESS, 0L);
+    return DO_SUCCESS;
+}
+
+static void do_cursor_give_back_http_client(do_list_cursor_t *cursor) {
+    do_http_client_t *http_client = cursor->http_client;
+    if (!http_client) {
+        return;
+    }
+    
+    if (cursor->owns_http_client) {
+        do_http_client_free(http_client);
+        return;
+    }
+    
+    curl_easy_setopt(http_client->curl, CURLOPT_NOPROGRESS, 1L);
+    curl_easy_setopt(http_client->curl, CURLOPT_XFERINFOFUNCTION, NULL);
+    curl_easy_setopt(http_client->curl, CURLOPT_XFERINFODATA, NULL);
+    cursor->client->cursor_http_busy = false;
+}
+
+// Parses the response with cJSON and decodes cursor->next from the tree
+static void do_cursor_decode_parsed(do_list_cursor_t *cursor, const do_http_response_t *response) {
+    cursor_page_t *page = &cursor->next;
+    const do_list_type_t *type = cursor->type;
+    
+    int64_t parse_start = do_cursor_clock_us();
+    cJSON *json = response->data ? cJSON_Parse(response->data) : NULL;
+    page->parse_us = do_cursor_clock_us() - parse_start;
+    
+    const cJSON *items = cJSON_GetObjectItemCaseSensitive(json, type->collection_key);
+    if (!cJSON_IsArray(items)) {
+        cJSON_Delete(json);
+        page->result = DO_ERROR_JSON;
+        return;
+    }
+    
+    int64_t decode_start = do_cursor_clock_us();
+    size_t count = cJSON_GetArraySize(items);
+    page->total = json_page_total(json);
+    page->items = count ? do_calloc(count, type->item_size) : NULL;
+    if (count && !page->items) {
+        cJSON_Delete(json);
+        page->result = DO_ERROR_MEMORY;
+        return;
+    }
+    
+    const cJSON *item_json;
+    cJSON_ArrayForEach(item_json, items) {
+        if (cursor->keep && !cursor->keep(item_json, cursor->keep_userdata)) {
+            continue;
+        }
+        
+        // Count it first so a partial decode is released with the page
+        void *item = (char *)page->items + page->count * type->item_size;
+        page->count++;
+        page->result = type->decode(item_json, item);
+        if (page->result != DO_SUCCESS) {
+            break;
+        }
+    }
+    
+    // The API hands back absolute URLs for the following page
+    const cJSON *links = cJSON_GetObjectItemCaseSensitive(json, "links");
+    const cJSON *pages = cJSON_GetObjectItemCaseSensitive(links, "pages");
+    const cJSON *next = cJSON_GetObjectItemCaseSensitive(pages, "next");
+    if (page->result == DO_SUCCESS && cJSON_IsString(next) && next->valuestring[0] != '\0' &&
+        count > 0) {
+        page->next_url = do_strdup(next->valuestring);
+        if (!page->next_url) {
+            page->result = DO_ERROR_MEMORY;
+        }
+    }
+    
+    cJSON_Delete(json);
+    page->decode_us = do_cursor_clock_us() - decode_start;
+}
+
+// The same for droplets straight from the response text
+static void do_cursor_decode_ondemand(do_list_cursor_t *cursor,
+                                      const do_http_response_t *response) {
+    cursor_page_t *page = &cursor->next;
+    json_od_doc_t *doc = &cursor->doc;
+    
+    int64_t parse_start = do_cursor_clock_us();
+    json_od_value_t root, items;
+    page->result = response->data ? json_od_index(doc, response->data, response->size)
+                                  : DO_ERROR_JSON;
+    if (page->result == DO_SUCCESS &&
+        (!json_od_root(doc, &root) || !json_od_find(&root, cursor->type->collection_key, &items) ||
+         !json_od_is_array(&items))) {
+        page->result = DO_ERROR_JSON;
+    }
+    page->parse_us = do_cursor_clock_us() - parse_start;
+    if (page->result != DO_SUCCESS) {
+        return;
+    }
+    
+    int64_t decode_start = do_cursor_clock_us();
+    size_t count = json_od_count(&items);
+    json_od_value_t meta, total;
+    double number;
+    if (json_od_find(&root, "meta", &meta) && json_od_find(&meta, "total", &total) &&
+        json_od_number(&total, &number)) {
+        page->total = (uint32_t)number;
+    }
+    page->items = count ? do_calloc(count, sizeof(do_droplet_t)) : NULL;
+    if (count && !page->items) {
+        page->result = DO_ERROR_MEMORY;
+        return;
+    }
+    
+    json_od_value_t item_json;
+    for (bool more = json_od_first(&items, &item_json); more; more = json_od_next(&item_json)) {
+        if (cursor->keep_indexed && !cursor->keep_indexed(&item_json, cursor->keep_userdata)) {
+            continue;
+        }
+        
+        do_droplet_t *droplet = (do_droplet_t *)page->items + page->count;
+        page->count++;
+        page->result = json_od_parse_droplet(&item_json, droplet);
+        if (page->result != DO_SUCCESS) {
+            break;
+        }
+    }
+    
+    json_od_value_t links, pages, next;
+    if (page->result == DO_SUCCESS && count > 0 && json_od_find(&root, "links", &links) &&
+        json_od_find(&links, "pages", &pages) && json_od_find(&pages, "next", &next) &&
+        json_od_is_string(&next)) {
+        page->next_url = json_od_strdup(&next);
+        if (!page->next_url) {
+            page->result = DO_ERROR_MEMORY;
+        } else if (page->next_url[0] == '\0') {
+            do_free(page->next_url);
+            page->next_url = NULL;
+        }
+    }
+    
+    page->decode_us = do_cursor_clock_us() - decode_start;
+}
+
+// Decodes cursor->next as views and takes the response text over for
+// them. A keep predicate with no indexed form still needs a tree, so for
+// one the page is also parsed by cJSON and walked in step with the index.
+static void do_cursor_decode_views(do_list_cursor_t *cursor, do_http_response_t *response) {
+    cursor_page_t *page = &cursor->next;
+    json_od_doc_t *doc = &cursor->doc;
+    
+    int64_t parse_start = do_cursor_clock_us();
+    json_od_value_t root, items, item_json;
+    page->result = response->data ? json_od_index(doc, response->data, response->size)
+                                  : DO_ERROR_JSON;
+    if (page->result == DO_SUCCESS &&
+        (!json_od_root(doc, &root) || !json_od_find(&root, cursor->type->collection_key, &items) ||
+         !json_od_is_array(&items))) {
+        page->result = DO_ERROR_JSON;
+    }
+    
+    cJSON *json = NULL;
+    const cJSON *keep_json = NULL;
+    if (page->result == DO_SUCCESS && cursor->keep && !cursor->keep_indexed) {
+        json = cJSON_Parse(response->data);
+        const cJSON *keep_items = cJSON_GetObjectItemCaseSensitive(json, cursor->type->collection_key);
+        if (!cJSON_IsArray(keep_items)) {
+            page->result = DO_ERROR_JSON;
+        }
+        keep_json = keep_items ? keep_items->child : NULL;
+    }
+    page->parse_us = do_cursor_clock_us() - parse_start;
+    if (page->result != DO_SUCCESS) {
+        cJSON_Delete(json);
+        return;
+    }
+    
+    int64_t decode_start = do_cursor_clock_us();
+    size_t count = 0, tags = 0;
+    for (bool more = json_od_first(&items, &item_json); more; more = json_od_next(&item_json)) {
+        count++;
+        tags += json_od_droplet_view_tags(&item_json);
+    }
+    
+    do_page_buffer_t *buffer = do_calloc(1, sizeof(do_page_buffer_t) +
+                                            count * sizeof(do_droplet_view_t) +
+                                            tags * sizeof(do_str_view_t));
+    if (!buffer) {
+        cJSON_Delete(json);
+        page->result = DO_ERROR_MEMORY;
+        return;
+    }
+    atomic_init(&buffer->refs, 1);
+    buffer->items = (do_droplet_view_t *)(buffer + 1);
+    buffer->tags = (do_str_view_t *)(buffer->items + count);
+    page->buffer = buffer;
+    page->items = buffer->items;
+    
+    do_str_view_t *next_tags = buffer->tags;
+    for (bool more = json_od_first(&items, &item_json); more; more = json_od_next(&item_json)) {
+        bool keep = !cursor->keep ||
+                    (cursor->keep_indexed ? cursor->keep_indexed(&item_json, cursor->keep_userdata)
+                                          : keep_json && cursor->keep(keep_json,
+                                                                      cursor->keep_userdata));
+        keep_json = keep_json ? keep_json->next : NULL;
+        if (!keep) {
+            continue;
+        }
+        
+        do_droplet_view_t *view = &buffer->items[page->count];
+        page->result = json_od_parse_droplet_view(&item_json, view, next_tags);
+        if (page->result != DO_SUCCESS) {
+            break;
+        }
+        next_tags += view->tags_count;
+        page->count++;
+    }
+    cJSON_Delete(json);
+    
+    json_od_value_t meta, total, links, pages, next;
+    double number;
+    if (json_od_find(&root, "meta", &meta) && json_od_find(&meta, "total", &total) &&
+        json_od_number(&total, &number)) {
+        page->total = (uint32_t)number;
+    }
+    if (page->result == DO_SUCCESS && count > 0 && json_od_find(&root, "links", &links) &&
+        json_od_find(&links, "pages", &pages) && json_od_find(&pages, "next", &next) &&
+        json_od_is_string(&next)) {
+        page->next_url = json_od_strdup(&next);
+        if (!page->next_url) {
+            page->result = DO_ERROR_MEMORY;
+        } else if (page->next_url[0] == '\0') {
+            do_free(page->next_url);
+            page->next_url = NULL;
+        }
+    }
+    
+    // The views point into the body, so it leaves the pool with them
+    buffer->text = response->data;
+    response->data = NULL;
+    response->size = 0;
+    response->capacity = 0;
+    page->decode_us = do_cursor_clock_us() - decode_start;
+}
+
+// Fetches and decodes cursor->next. Runs on the prefetch thread, or on
+// the caller's when no thread could be started. Touches nothing but the
+// next page and the cursor's own handle.
+static void do_cursor_fetch(do_list_cursor_t *cursor) {
+    cursor_page_t *page = &cursor->next;
+    do_http_client_t *http_client = cursor->http_client;
+    
+    do_http_response_t *response = do_http_client_acquire_response(http_client);
+    if (!response) {
+        page->result = DO_ERROR_MEMORY;
+        return;
+    }
+    
+    page->result = do_http_get(http_client, page->url, cursor->client->auth_header, response);
+    page->timing = http_client->timing;
+    if (page->result == DO_SUCCESS) {
+        page->result = do_http_status_to_result(page->timing.status_code);
+    }
+    if (page->result != DO_SUCCESS) {
+        do_http_client_release_response(http_client, response);
+        return;
+    }
+    
+    if (cursor->views) {
+        do_cursor_decode_views(cursor, response);
+    } else if (cursor->ondemand) {
+        do_cursor_decode_ondemand(cursor, response);
+    } else {
+        do_cursor_decode_parsed(cursor, response);
+    }
+    do_http_client_release_response(http_client, response);
+}
+
+static void *do_cursor_thread(void *userdata) {
+    do_cursor_fetch(userdata);
+    return NULL;
+}
+
+// Queues url (taken over) as the next page
+static void do_cursor_prefetch(do_list_cursor_t *cursor, char *url) {
+    memset(&cursor->next, 0, sizeof(cursor->next));
+    cursor->next.url = url;
+    
+    if (pthread_create(&cursor->thread, NULL, do_cursor_thread, cursor) == 0) {
+        cursor->fetching = true;
+    } else {
+        do_cursor_fetch(cursor);
+    }
+}
+
+do_result_t do_cursor_open(do_client_t *client, const do_list_type_t *type,
+                           do_list_cursor_t **cursor) {
+    return do_cursor_open_filtered(client, type, NULL, NULL, NULL, cursor);
+}
+
+// do_cursor_open_filtered() with keep_indexed, which must agree with keep,
+// for filters that can also read an item from the page's index (filter.c)
+do_result_t do_cursor_open_indexed(do_client_t *client, const do_list_type_t *type,
+                                   const char *query, do_list_predicate_t keep,
+                                   do_list_indexed_predicate_t keep_indexed, void *userdata,
+                                   do_list_cursor_t **cursor) {
+    if (!client || !client->config || !client->http_client || !type || !type->decode ||
+        !type->free_item || type->item_size == 0 || !cursor) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    *cursor = do_calloc(1, sizeof(do_list_cursor_t));
+    if (!*cursor) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_list_cursor_t *c = *cursor;
+    c->client = client;
+    c->type = type;
+    c->keep = keep;
+    c->keep_indexed = keep ? keep_indexed : NULL;
+    c->keep_userdata = userdata;
+    c->ondemand = type == &do_list_droplets && (!keep || keep_indexed) &&
+                  do_get_json_backend() == DO_JSON_BACKEND_ONDEMAND;
+    c->views = type == &do_list_droplet_views;
+    atomic_init(&c->closing, false);
+    
+    bool has_query = query && query[0] != '\0';
+    size_t len = strlen(type->endpoint) + (has_query ? strlen(query) + 1 : 0) + 32;
+    char *first_page = do_malloc(len);
+    char *url = NULL;
+    if (first_page) {
+        snprintf(first_page, len, "%s%s%s%sper_page=%d", type->endpoint,
+                 strchr(type->endpoint, '?') ? "&" : "?", has_query ? query : "",
+                 has_query ? "&" : "", DO_CURSOR_PAGE_SIZE);
+        url = do_http_build_url(client->config->base_url, first_page);
+        do_free(first_page);
+    }
+    
+    do_result_t result = url ? do_cursor_take_http_client(c) : DO_ERROR_MEMORY;
+    if (result != DO_SUCCESS) {
+        do_free(url);
+        do_cursor_close(c);
+        *cursor = NULL;
+        return result;
+    }
+    
+    // The first page is on its way before the caller asks for it
+    do_cursor_prefetch(c, url);
+    return DO_SUCCESS;
+}
+
+do_result_t do_cursor_open_filtered(do_client_t *client, const do_list_type_t *type,
+                                    const char *query, do_list_predicate_t keep, void *userdata,
+                                    do_list_cursor_t **cursor) {
+    return do_cursor_open_indexed(client, type, query, keep, NULL, userdata, cursor);
+}
+
+do_result_t do_cursor_next(do_list_cursor_t *cursor, const void **items, size_t *count) {
+    if (!cursor || !items || !count) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    *items = NULL;
+    *count = 0;
+    
+    // A filtered page can come back empty; only the last one ends the walk
+    cursor_page_t *page = &cursor->current;
+    do {
+        do_cursor_page_clear(cursor->type, page);
+        if (cursor->done) {
+            return cursor->result;
+        }
+        
+        if (cursor->fetching) {
+            pthread_join(cursor->thread, NULL);
+            cursor->fetching = false;
+        }
+        
+        cursor->current = cursor->next;
+        memset(&cursor->next, 0, sizeof(cursor->next));
+        
+        // Reported here, on the caller's thread, before the handle is reused
+        do_metrics_record_decode(page->timing.method, page->timing.url, page->parse_us,
+                                 page->decode_us, page->result == DO_ERROR_JSON);
+        if (cursor->client->timing_callback) {
+            do_request_timing_t timing = page->timing;
+            timing.parse_us = page->parse_us;
+            timing.decode_us = page->decode_us;
+            cursor->client->timing_callback(&timing, cursor->client->timing_userdata);
+        }
+        
+        if (page->result != DO_SUCCESS) {
+            cursor->done = true;
+            cursor->result = page->result;
+            do_cursor_page_clear(cursor->type, page);
+            return cursor->result;
+        }
+        
+        cursor->total = page->total;
+        if (page->next_url) {
+            do_cursor_prefetch(cursor, page->next_url);
+            page->next_url = NULL;
+        } else {
+            cursor->done = true;
+            cursor->result = DO_SUCCESS;
+        }
+    } while (page->count == 0 && !cursor->done);
+    
+    *items = page->items;
+    *count = page->count;
+    return DO_SUCCESS;
+}
+
+uint32_t do_cursor_total(const do_list_cursor_t *cursor) {
+    return cursor ? cursor->total : 0;
+}
+
+void do_cursor_close(do_list_cursor_t *cursor) {
+    if (!cursor) {
+        return;
+    }
+    
+    if (cursor->fetching) {
+        atomic_store_explicit(&cursor->closing, true, memory_order_relaxed);
+        pthread_join(cursor->thread, NULL);
+        cursor->fetching = false;
+    }
+    
+    do_cursor_page_clear(cursor->type, &cursor->current);
+    do_cursor_page_clear(cursor->type, &cursor->next);
+    do_cursor_give_back_http_client(cursor);
+    json_od_doc_free(&cursor->doc);
+    do_free(cursor);
+}
+
+do_page_buffer_t *do_cursor_retain_page(do_list_cursor_t *cursor) {
+    return cursor ? do_page_buffer_retain(cursor->current.buffer) : NULL;
+}
+
+do_page_buffer_t *do_page_buffer_retain(do_page_buffer_t *page) {
+    if (page) {
+        atomic_fetch_add_explicit(&page->refs, 1, memory_order_relaxed);
+    }
+    return page;
+}
+
+void do_page_buffer_release(do_page_buffer_t *page) {
+    if (!page || atomic_fetch_sub_explicit(&page->refs, 1, memory_order_acq_rel) != 1) {
+        return;
+    }
+    
+    do_free(page->text);
+    do_free(page);
+}
\ No newline at end of file
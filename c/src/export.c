@@ -0,0 +1,598 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <zlib.h>
+#include "digitalocean/export.h"
+#include "digitalocean/alloc.h"
+#include "http_transfer.h"
+#include "json_ondemand.h"
+#include "json_writer.h"
+#include "metrics_internal.h"
+
+#define DO_EXPORT_DEFAULT_CONCURRENCY 8
+#define DO_EXPORT_DEFAULT_PER_PAGE 200
+#define DO_EXPORT_CHUNK (64 * 1024) // compressed output handed to write() at a time
+
+static const struct {
+    const char *name;
+    const char *path; // NULL for records, which are listed per domain
+    const char *collection_key;
+} export_resources[DO_EXPORT_RESOURCE_COUNT] = {
+    [DO_EXPORT_DROPLETS] = {"droplets", "/v2/droplets", "droplets"},
+    [DO_EXPORT_VOLUMES] = {"volumes", "/v2/volumes", "volumes"},
+    [DO_EXPORT_SNAPSHOTS] = {"snapshots", "/v2/snapshots", "snapshots"},
+    [DO_EXPORT_IMAGES] = {"images", "/v2/images?private=true", "images"},
+    [DO_EXPORT_DOMAINS] = {"domains", "/v2/domains", "domains"},
+    [DO_EXPORT_DOMAIN_RECORDS] = {"domain_records", NULL, "domain_records"},
+    [DO_EXPORT_FIREWALLS] = {"firewalls", "/v2/firewalls", "firewalls"},
+    [DO_EXPORT_LOAD_BALANCERS] = {"load_balancers", "/v2/load_balancers", "load_balancers"},
+    [DO_EXPORT_VPCS] = {"vpcs", "/v2/vpcs", "vpcs"},
+    [DO_EXPORT_TAGS] = {"tags", "/v2/tags", "tags"},
+};
+
+const char *do_export_resource_name(do_export_resource_t resource) {
+    return (unsigned)resource < DO_EXPORT_RESOURCE_COUNT ? export_resources[resource].name : NULL;
+}
+
+// One page to fetch. Pages after the first are numbered once the first
+// has given the total; without a total the next link is followed instead.
+typedef struct {
+    do_export_resource_t resource;
+    uint32_t page;
+    char *domain;    // records only
+    char *next_url;  // set when following links.pages.next
+} export_job_t;
+
+typedef struct {
+    CURL *curl;
+    do_http_response_t *response;
+    export_job_t job;
+    bool busy;
+} export_transfer_t;
+
+// The archive: plain writes to the fd, or a gzip stream in front of it
+typedef struct {
+    int fd;
+    bool gzip;
+    z_stream zstream;
+    unsigned char *chunk;
+    uint64_t bytes_in;
+    uint64_t bytes_out;
+} export_sink_t;
+
+typedef struct {
+    do_client_t *client;
+    uint32_t per_page;
+    struct curl_slist *headers;
+    CURLM *multi;
+    export_transfer_t *transfers;
+    size_t transfer_count;
+    export_job_t *jobs;      // FIFO: jobs[job_head..job_count)
+    size_t job_head;
+    size_t job_count;
+    size_t job_capacity;
+    size_t running;
+    export_sink_t sink;
+    json_od_doc_t doc;       // index of the page being written, reused page to page
+    do_string_t lines;       // that page as archive lines
+    do_export_manifest_t *manifest;
+    int64_t first_sent_us[DO_EXPORT_RESOURCE_COUNT];
+    do_result_t failure;
+} export_state_t;
+
+static int64_t export_clock_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+static void export_job_free(export_job_t *job) {
+    do_free(job->domain);
+    do_free(job->next_url);
+    memset(job, 0, sizeof(*job));
+}
+
+// Takes over domain and next_url, freeing them if the job cannot be queued
+static do_result_t export_queue(export_state_t *state, do_export_resource_t resource,
+                                uint32_t page, char *domain, char *next_url) {
+    if (state->job_head > 0 && state->job_count == state->job_capacity) {
+        memmove(state->jobs, state->jobs + state->job_head,
+                (state->job_count - state->job_head) * sizeof(export_job_t));
+        state->job_count -= state->job_head;
+        state->job_head = 0;
+    }
+    if (state->job_count == state->job_capacity) {
+        size_t capacity = state->job_capacity ? state->job_capacity * 2 : 32;
+        export_job_t *jobs = do_realloc(state->jobs, capacity * sizeof(export_job_t));
+        if (!jobs) {
+            do_free(domain);
+            do_free(next_url);
+            return DO_ERROR_MEMORY;
+        }
+        state->jobs = jobs;
+        state->job_capacity = capacity;
+    }
+    
+    state->jobs[state->job_count++] = (export_job_t){resource, page, domain, next_url};
+    return DO_SUCCESS;
+}
+
+static char *export_page_url(export_state_t *state, const export_job_t *job) {
+    if (job->next_url) {
+        return do_strdup(job->next_url);
+    }
+    
+    char path[1024];
+    int written;
+    if (job->resource == DO_EXPORT_DOMAIN_RECORDS) {
+        char *escaped = curl_easy_escape(NULL, job->domain, 0);
+        if (!escaped) {
+            return NULL;
+        }
+        written = snprintf(path, sizeof(path), "/v2/domains/%s/records?page=%u&per_page=%u",
+                           escaped, job->page, state->per_page);
+        curl_free(escaped);
+    } else {
+        const char *base = export_resources[job->resource].path;
+        written = snprintf(path, sizeof(path), "%s%spage=%u&per_page=%u", base,
+                           strchr(base, '?') ? "&" : "?", job->page, state->per_page);
+    }
+    if (written < 0 || (size_t)written >= sizeof(path)) {
+        return NULL;
+    }
+    return do_http_build_url(state->client->config->base_url, path);
+}
+
+static do_result_t export_start_next(export_state_t *state, export_transfer_t *transfer) {
+    if (state->job_head == state->job_count) {
+        return DO_SUCCESS;
+    }
+    
+    transfer->job = state->jobs[state->job_head++];
+    char *url = export_page_url(state, &transfer->job);
+    if (!url) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_http_response_clear(transfer->response);
+    curl_easy_setopt(transfer->curl, CURLOPT_URL, url);
+    do_free(url);
+    
+    do_result_t result = do_http_transfer_start(state->client->http_client, state->multi,
+                                                transfer->curl);
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    
+    if (state->first_sent_us[transfer->job.resource] == 0) {
+        state->first_sent_us[transfer->job.resource] = export_clock_us();
+    }
+    transfer->busy = true;
+    state->running++;
+    return DO_SUCCESS;
+}
+
+static do_result_t export_write_all(int fd, const void *data, size_t len) {
+    const char *bytes = data;
+    while (len > 0) {
+        ssize_t n = write(fd, bytes, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return DO_ERROR_CONFIG;
+        }
+        bytes += n;
+        len -= (size_t)n;
+    }
+    return DO_SUCCESS;
+}
+
+static voidpf export_zalloc(voidpf opaque, uInt items, uInt size) {
+    (void)opaque;
+    return do_calloc(items, size);
+}
+
+static void export_zfree(voidpf opaque, voidpf address) {
+    (void)opaque;
+    do_free(address);
+}
+
+static do_result_t export_sink_open(export_sink_t *sink, int fd, const do_export_options_t *options) {
+    memset(sink, 0, sizeof(*sink));
+    sink->fd = fd;
+    if (options->compression != DO_EXPORT_GZIP) {
+        return DO_SUCCESS;
+    }
+    
+    sink->chunk = do_malloc(DO_EXPORT_CHUNK);
+    if (!sink->chunk) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    // windowBits 15 + 16 asks zlib for a gzip header and trailer
+    sink->zstream.zalloc = export_zalloc;
+    sink->zstream.zfree = export_zfree;
+    int level = options->level >= 1 && options->level <= 9 ? options->level : Z_DEFAULT_COMPRESSION;
+    if (deflateInit2(&sink->zstream, level, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        do_free(sink->chunk);
+        sink->chunk = NULL;
+        return DO_ERROR_MEMORY;
+    }
+    sink->gzip = true;
+    return DO_SUCCESS;
+}
+
+// finish ends the gzip stream after data
+static do_result_t export_sink_write(export_sink_t *sink, const char *data, size_t len,
+                                     bool finish) {
+    sink->bytes_in += len;
+    if (!sink->gzip) {
+        sink->bytes_out += len;
+        return export_write_all(sink->fd, data, len);
+    }
+    
+    z_stream *zstream = &sink->zstream;
+    zstream->next_in = (Bytef *)data;
+    zstream->avail_in = (uInt)len;
+    int status;
+    do {
+        zstream->next_out = sink->chunk;
+        zstream->avail_out = DO_EXPORT_CHUNK;
+        status = deflate(zstream, finish ? Z_FINISH : Z_NO_FLUSH);
+        if (status == Z_STREAM_ERROR) {
+            return DO_ERROR_MEMORY;
+        }
+        
+        size_t have = DO_EXPORT_CHUNK - zstream->avail_out;
+        sink->bytes_out += have;
+        if (have > 0 && export_write_all(sink->fd, sink->chunk, have) != DO_SUCCESS) {
+            return DO_ERROR_CONFIG;
+        }
+    } while (zstream->avail_out == 0 || (finish && status != Z_STREAM_END));
+    
+    return DO_SUCCESS;
+}
+
+static void export_sink_close(export_sink_t *sink) {
+    if (sink->gzip) {
+        deflateEnd(&sink->zstream);
+    }
+    do_free(sink->chunk);
+}
+
+// Appends one archive line per item in the page. Domain pages also queue
+// the first page of each domain's records.
+static do_result_t export_write_items(export_state_t *state, const export_job_t *job,
+                                      const json_od_value_t *items, size_t *count) {
+    const char *name = export_resources[job->resource].name;
+    const char *text = state->doc.data;
+    json_writer_t writer;
+    json_writer_continue(&writer, &state->lines);
+    
+    json_od_value_t item;
+    for (bool more = json_od_first(items, &item); more; more = json_od_next(&item)) {
+        json_writer_begin_object(&writer);
+        json_writer_member_string(&writer, "resource", name);
+        json_writer_member_string(&writer, "domain", job->domain);
+        json_writer_key(&writer, "item");
+        
+        // Raw newlines in JSON text are whitespace, never string content,
+        // so a pretty-printed item still fits on one line
+        size_t start = state->lines.length;
+        json_writer_raw(&writer, text + item.offset, json_od_end(&item) - item.offset);
+        for (size_t i = start; !writer.failed && i < state->lines.length; i++) {
+            if (state->lines.data[i] == '\n' || state->lines.data[i] == '\r') {
+                state->lines.data[i] = ' ';
+            }
+        }
+        json_writer_end_object(&writer);
+        json_writer_newline(&writer);
+        (*count)++;
+        
+        json_od_value_t domain;
+        if (job->resource == DO_EXPORT_DOMAINS && json_od_find(&item, "name", &domain)) {
+            char *domain_name = json_od_strdup(&domain);
+            do_result_t result = domain_name
+                ? export_queue(state, DO_EXPORT_DOMAIN_RECORDS, 1, domain_name, NULL)
+                : DO_ERROR_MEMORY;
+            if (result != DO_SUCCESS) {
+                return result;
+            }
+        }
+    }
+    
+    return json_writer_finish(&writer);
+}
+
+// Queues the rest of the type's pages: all of them at once when the first
+// page gives the total, otherwise the one its next link points to
+static do_result_t export_queue_rest(export_state_t *state, const export_job_t *job,
+                                     const json_od_value_t *root) {
+    json_od_value_t meta, total, links, pages, next;
+    double number;
+    if (!job->next_url && job->page == 1 && json_od_find(root, "meta", &meta) &&
+        json_od_find(&meta, "total", &total) && json_od_number(&total, &number)) {
+        uint32_t last = (uint32_t)((number + state->per_page - 1) / state->per_page);
+        for (uint32_t page = 2; page <= last; page++) {
+            char *domain = job->domain ? do_strdup(job->domain) : NULL;
+            do_result_t result = !job->domain || domain
+                ? export_queue(state, job->resource, page, domain, NULL) : DO_ERROR_MEMORY;
+            if (result != DO_SUCCESS) {
+                return result;
+            }
+        }
+        return DO_SUCCESS;
+    }
+    
+    if ((job->next_url || job->page == 1) && json_od_find(root, "links", &links) &&
+        json_od_find(&links, "pages", &pages) && json_od_find(&pages, "next", &next) &&
+        json_od_is_string(&next)) {
+        char *next_url = json_od_strdup(&next);
+        if (!next_url) {
+            return DO_ERROR_MEMORY;
+        }
+        if (next_url[0] == '\0') {
+            do_free(next_url);
+            return DO_SUCCESS;
+        }
+        char *domain = job->domain ? do_strdup(job->domain) : NULL;
+        if (job->domain && !domain) {
+            do_free(next_url);
+            return DO_ERROR_MEMORY;
+        }
+        return export_queue(state, job->resource, 0, domain, next_url);
+    }
+    
+    return DO_SUCCESS;
+}
+
+// Writes a finished page to the archive. Only a failed write or running
+// out of memory is returned; a bad response fails its type.
+static do_result_t export_page_done(export_state_t *state, export_transfer_t *transfer,
+                                    CURLcode res) {
+    do_client_t *client = state->client;
+    const export_job_t *job = &transfer->job;
+    do_export_count_t *count = &state->manifest->resources[job->resource];
+    
+    do_request_timing_t timing;
+    do_result_t result = do_http_transfer_finish(client->http_client, transfer->curl, "GET", res,
+                                                 &timing);
+    do_result_t fatal = DO_SUCCESS;
+    if (result == DO_SUCCESS) {
+        const do_http_response_t *response = transfer->response;
+        int64_t parse_start = export_clock_us();
+        json_od_value_t root, items;
+        result = response->data ? json_od_index(&state->doc, response->data, response->size)
+                                : DO_ERROR_JSON;
+        if (result == DO_SUCCESS &&
+            (!json_od_root(&state->doc, &root) ||
+             !json_od_find(&root, export_resources[job->resource].collection_key, &items) ||
+             !json_od_is_array(&items))) {
+            result = DO_ERROR_JSON;
+        }
+        timing.parse_us = export_clock_us() - parse_start;
+        
+        int64_t decode_start = export_clock_us();
+        if (result == DO_SUCCESS) {
+            state->lines.length = 0;
+            size_t items_written = 0;
+            fatal = export_write_items(state, job, &items, &items_written);
+            if (fatal == DO_SUCCESS) {
+                fatal = export_queue_rest(state, job, &root);
+            }
+            if (fatal == DO_SUCCESS) {
+                fatal = export_sink_write(&state->sink, state->lines.data, state->lines.length,
+                                          false);
+            }
+            count->items += items_written;
+            count->pages++;
+            count->bytes += response->size;
+        }
+        timing.decode_us = export_clock_us() - decode_start;
+        do_metrics_record_decode(timing.method, timing.url, timing.parse_us, timing.decode_us,
+                                 result == DO_ERROR_JSON);
+    }
+    
+    if (client->timing_callback) {
+        client->timing_callback(&timing, client->timing_userdata);
+    }
+    
+    count->elapsed_us = export_clock_us() - state->first_sent_us[job->resource];
+    if (result != DO_SUCCESS) {
+        if (count->result == DO_SUCCESS) {
+            count->result = result;
+        }
+        if (state->failure == DO_SUCCESS) {
+            state->failure = result;
+        }
+    }
+    return fatal;
+}
+
+static do_result_t export_transfer_init(export_state_t *state, export_transfer_t *transfer) {
+    do_http_client_t *http_client = state->client->http_client;
+    
+    transfer->response = do_http_client_acquire_response(http_client);
+    if (!transfer->response) {
+        return DO_ERROR_MEMORY;
+    }
+    transfer->curl = do_http_transfer_new(http_client, state->headers, transfer->response, transfer);
+    return transfer->curl ? DO_SUCCESS : DO_ERROR_MEMORY;
+}
+
+static do_result_t export_transfer_done(void *owner, CURLcode res, void *userdata) {
+    export_transfer_t *transfer = owner;
+    export_state_t *state = userdata;
+    transfer->busy = false;
+    state->running--;
+    
+    do_result_t result = export_page_done(state, transfer, res);
+    export_job_free(&transfer->job);
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    
+    // A finished page can queue many more, so every idle transfer looks
+    // for work, not just the one that finished
+    for (size_t i = 0; i < state->transfer_count; i++) {
+        if (!state->transfers[i].busy) {
+            result = export_start_next(state, &state->transfers[i]);
+            if (result != DO_SUCCESS) {
+                return result;
+            }
+        }
+    }
+    return DO_SUCCESS;
+}
+
+static do_result_t export_run(export_state_t *state, export_transfer_t *transfers,
+                              size_t transfer_count) {
+    state->transfers = transfers;
+    state->transfer_count = transfer_count;
+    for (size_t i = 0; i < transfer_count; i++) {
+        do_result_t result = export_transfer_init(state, &transfers[i]);
+        if (result == DO_SUCCESS) {
+            result = export_start_next(state, &transfers[i]);
+        }
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+    }
+    
+    return do_http_multi_run(state->multi, &state->running, export_transfer_done, state);
+}
+
+static do_result_t export_write_manifest(export_state_t *state) {
+    const do_export_manifest_t *manifest = state->manifest;
+    char started_at[32];
+    strftime(started_at, sizeof(started_at), "%Y-%m-%dT%H:%M:%SZ", gmtime(&manifest->started_at));
+    
+    json_writer_t writer;
+    json_writer_init(&writer, &state->lines);
+    json_writer_begin_object(&writer);
+    json_writer_key(&writer, "manifest");
+    json_writer_begin_object(&writer);
+    json_writer_member_string(&writer, "started_at", started_at);
+    json_writer_key(&writer, "elapsed_ms");
+    json_writer_int(&writer, manifest->elapsed_us / 1000);
+    json_writer_key(&writer, "bytes");
+    json_writer_int(&writer, (int64_t)state->sink.bytes_in);
+    json_writer_key(&writer, "resources");
+    json_writer_begin_object(&writer);
+    for (int i = 0; i < DO_EXPORT_RESOURCE_COUNT; i++) {
+        const do_export_count_t *count = &manifest->resources[i];
+        json_writer_key(&writer, export_resources[i].name);
+        json_writer_begin_object(&writer);
+        json_writer_key(&writer, "items");
+        json_writer_int(&writer, (int64_t)count->items);
+        json_writer_key(&writer, "pages");
+        json_writer_int(&writer, (int64_t)count->pages);
+        json_writer_key(&writer, "response_bytes");
+        json_writer_int(&writer, (int64_t)count->bytes);
+        json_writer_key(&writer, "elapsed_ms");
+        json_writer_int(&writer, count->elapsed_us / 1000);
+        if (count->result != DO_SUCCESS) {
+            json_writer_member_string(&writer, "error", do_client_get_error_string(count->result));
+        }
+        json_writer_end_object(&writer);
+    }
+    json_writer_end_object(&writer);
+    json_writer_end_object(&writer);
+    json_writer_end_object(&writer);
+    json_writer_newline(&writer);
+    
+    do_result_t result = json_writer_finish(&writer);
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    return export_sink_write(&state->sink, state->lines.data, state->lines.length, true);
+}
+
+do_result_t do_client_export(do_client_t *client, int fd, const do_export_options_t *options,
+                             do_export_manifest_t *manifest) {
+    do_export_manifest_t local_manifest;
+    if (!manifest) {
+        manifest = &local_manifest;
+    }
+    memset(manifest, 0, sizeof(*manifest));
+    
+    do_export_options_t defaults = {DO_EXPORT_PLAIN, 0, 0, 0};
+    if (!options) {
+        options = &defaults;
+    }
+    if (!client || !client->config || !client->http_client || fd < 0 ||
+        (options->compression != DO_EXPORT_PLAIN && options->compression != DO_EXPORT_GZIP)) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    manifest->started_at = time(NULL);
+    int64_t started_us = export_clock_us();
+    
+    export_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.client = client;
+    state.manifest = manifest;
+    state.per_page = options->per_page ? options->per_page : DO_EXPORT_DEFAULT_PER_PAGE;
+    do_string_init(&state.lines);
+    
+    do_result_t result = export_sink_open(&state.sink, fd, options);
+    for (int i = 0; result == DO_SUCCESS && i < DO_EXPORT_RESOURCE_COUNT; i++) {
+        if (export_resources[i].path) {
+            result = export_queue(&state, (do_export_resource_t)i, 1, NULL, NULL);
+        }
+    }
+    
+    size_t transfer_count = options->max_concurrency ? options->max_concurrency
+                                                     : DO_EXPORT_DEFAULT_CONCURRENCY;
+    state.multi = curl_multi_init();
+    state.headers = curl_slist_append(NULL, "Content-Type: application/json");
+    if (state.headers) {
+        struct curl_slist *auth = curl_slist_append(state.headers, client->auth_header);
+        if (!auth) {
+            curl_slist_free_all(state.headers);
+            state.headers = NULL;
+        }
+    }
+    export_transfer_t *transfers = do_calloc(transfer_count, sizeof(export_transfer_t));
+    
+    if (result == DO_SUCCESS) {
+        result = state.multi && state.headers && transfers
+            ? export_run(&state, transfers, transfer_count) : DO_ERROR_MEMORY;
+    }
+    
+    manifest->elapsed_us = export_clock_us() - started_us;
+    if (result == DO_SUCCESS) {
+        result = export_write_manifest(&state);
+        manifest->finished = result == DO_SUCCESS;
+    }
+    manifest->bytes_in = state.sink.bytes_in;
+    manifest->bytes_out = state.sink.bytes_out;
+    
+    for (size_t i = 0; transfers && i < transfer_count; i++) {
+        if (transfers[i].busy) {
+            curl_multi_remove_handle(state.multi, transfers[i].curl);
+        }
+        if (transfers[i].curl) {
+            curl_easy_cleanup(transfers[i].curl);
+        }
+        do_http_client_release_response(client->http_client, transfers[i].response);
+        export_job_free(&transfers[i].job);
+    }
+    do_free(transfers);
+    for (size_t i = state.job_head; i < state.job_count; i++) {
+        export_job_free(&state.jobs[i]);
+    }
+    do_free(state.jobs);
+    curl_slist_free_all(state.headers);
+    if (state.multi) {
+        curl_multi_cleanup(state.multi);
+    }
+    json_od_doc_free(&state.doc);
+    do_string_free(&state.lines);
+    export_sink_close(&state.sink);
+    
+    return result != DO_SUCCESS ? result : state.failure;
+}
\ No newline at end of file
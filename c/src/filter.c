@@ -0,0 +1,502 @@
+#define _GNU_SOURCE
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <cjson/cjson.h>
+#include "digitalocean/filter.h"
+#include "digitalocean/alloc.h"
+#include "client_internal.h"
+
+typedef enum {
+    FILTER_STRING,
+    FILTER_NUMBER,
+    FILTER_BOOL,
+    FILTER_TAGS     // string array; = is membership
+} filter_kind_t;
+
+typedef enum {
+    FILTER_EQ,
+    FILTER_NE,
+    FILTER_LT,
+    FILTER_LE,
+    FILTER_GT,
+    FILTER_GE,
+    FILTER_CONTAINS
+} filter_op_t;
+
+static const struct {
+    const char *name;
+    const char *key;
+    const char *subkey;  // member of key's object, e.g. region.slug
+    filter_kind_t kind;
+    const char *query;   // API parameter that evaluates = itself
+} filter_fields[] = {
+    {"id", "id", NULL, FILTER_NUMBER, NULL},
+    {"name", "name", NULL, FILTER_STRING, "name"},
+    {"status", "status", NULL, FILTER_STRING, NULL},
+    {"memory", "memory", NULL, FILTER_NUMBER, NULL},
+    {"vcpus", "vcpus", NULL, FILTER_NUMBER, NULL},
+    {"disk", "disk", NULL, FILTER_NUMBER, NULL},
+    {"locked", "locked", NULL, FILTER_BOOL, NULL},
+    {"region", "region", "slug", FILTER_STRING, NULL},
+    {"size", "size_slug", NULL, FILTER_STRING, NULL},
+    {"image", "image", "slug", FILTER_STRING, NULL},
+    {"vpc", "vpc_uuid", NULL, FILTER_STRING, NULL},
+    {"created", "created_at", NULL, FILTER_STRING, NULL},
+    {"tag", "tags", NULL, FILTER_TAGS, "tag_name"},
+};
+
+#define FILTER_FIELD_COUNT (sizeof(filter_fields) / sizeof(filter_fields[0]))
+
+// Longest first so "<=" is not read as "<"
+static const struct {
+    const char *text;
+    filter_op_t op;
+} filter_ops[] = {
+    {"!=", FILTER_NE}, {"<=", FILTER_LE}, {">=", FILTER_GE},
+    {"=", FILTER_EQ}, {"<", FILTER_LT}, {">", FILTER_GT}, {"~", FILTER_CONTAINS},
+};
+
+typedef struct {
+    size_t field;
+    filter_op_t op;
+    char *value;
+    double number;
+} filter_clause_t;
+
+struct do_droplet_filter {
+    filter_clause_t *clauses;
+    size_t count;
+    char *query;
+};
+
+static do_result_t filter_error(char *error, size_t error_size, const char *format, ...) {
+    if (error && error_size > 0) {
+        va_list args;
+        va_start(args, format);
+        vsnprintf(error, error_size, format, args);
+        va_end(args);
+    }
+    return DO_ERROR_INVALID_PARAM;
+}
+
+static char *filter_strndup(const char *text, size_t len) {
+    char *copy = do_malloc(len + 1);
+    if (copy) {
+        memcpy(copy, text, len);
+        copy[len] = '\0';
+    }
+    return copy;
+}
+
+static const char *skip_space(const char *p) {
+    while (isspace((unsigned char)*p)) {
+        p++;
+    }
+    return p;
+}
+
+// Reads one clause at *p and advances past it
+static do_result_t parse_clause(const char **p, filter_clause_t *clause,
+                                char *error, size_t error_size) {
+    const char *start = skip_space(*p);
+    const char *end = start;
+    while (isalpha((unsigned char)*end) || *end == '_') {
+        end++;
+    }
+    
+    size_t len = (size_t)(end - start);
+    if (len == 0) {
+        return filter_error(error, error_size, "expected a field name at \"%.20s\"", start);
+    }
+    
+    clause->field = FILTER_FIELD_COUNT;
+    for (size_t i = 0; i < FILTER_FIELD_COUNT; i++) {
+        if (strlen(filter_fields[i].name) == len &&
+            strncmp(filter_fields[i].name, start, len) == 0) {
+            clause->field = i;
+            break;
+        }
+    }
+    if (clause->field == FILTER_FIELD_COUNT) {
+        return filter_error(error, error_size, "unknown field \"%.*s\"", (int)len, start);
+    }
+    
+    const char *op = skip_space(end);
+    size_t op_len = 0;
+    for (size_t i = 0; i < sizeof(filter_ops) / sizeof(filter_ops[0]); i++) {
+        op_len = strlen(filter_ops[i].text);
+        if (strncmp(op, filter_ops[i].text, op_len) == 0) {
+            clause->op = filter_ops[i].op;
+            break;
+        }
+        op_len = 0;
+    }
+    if (op_len == 0) {
+        return filter_error(error, error_size, "expected an operator after %s",
+                            filter_fields[clause->field].name);
+    }
+    
+    // A quoted value may hold spaces; a bare one runs to the next space
+    const char *value = skip_space(op + op_len);
+    const char *value_end;
+    if (*value == '"' || *value == '\'') {
+        value_end = strchr(value + 1, *value);
+        if (!value_end) {
+            return filter_error(error, error_size, "unterminated quote in the %s clause",
+                                filter_fields[clause->field].name);
+        }
+        clause->value = filter_strndup(value + 1, (size_t)(value_end - value - 1));
+        value_end++;
+    } else {
+        value_end = value;
+        while (*value_end && !isspace((unsigned char)*value_end)) {
+            value_end++;
+        }
+        if (value_end == value) {
+            return filter_error(error, error_size, "missing value for %s",
+                                filter_fields[clause->field].name);
+        }
+        clause->value = filter_strndup(value, (size_t)(value_end - value));
+    }
+    if (!clause->value) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    filter_kind_t kind = filter_fields[clause->field].kind;
+    const char *name = filter_fields[clause->field].name;
+    if (kind == FILTER_NUMBER) {
+        char *number_end;
+        clause->number = strtod(clause->value, &number_end);
+        if (number_end == clause->value || *number_end != '\0') {
+            return filter_error(error, error_size, "%s must be compared with a number", name);
+        }
+    } else if (kind == FILTER_BOOL) {
+        if (strcmp(clause->value, "true") != 0 && strcmp(clause->value, "false") != 0) {
+            return filter_error(error, error_size, "%s is true or false", name);
+        }
+        clause->number = strcmp(clause->value, "true") == 0;
+    }
+    if ((kind == FILTER_BOOL || kind == FILTER_TAGS) && clause->op != FILTER_EQ &&
+        clause->op != FILTER_NE) {
+        return filter_error(error, error_size, "%s takes only = and !=", name);
+    }
+    if (kind == FILTER_NUMBER && clause->op == FILTER_CONTAINS) {
+        return filter_error(error, error_size, "~ needs a text field, not %s", name);
+    }
+    
+    *p = value_end;
+    return DO_SUCCESS;
+}
+
+// Moves one clause the API can evaluate into the query string: a tag if
+// there is one, otherwise a name, since the API takes only one of them
+static do_result_t filter_push_down(do_droplet_filter_t *filter) {
+    size_t pushed = filter->count;
+    for (size_t pass = 0; pass < 2 && pushed == filter->count; pass++) {
+        const char *query = pass == 0 ? "tag_name" : "name";
+        for (size_t i = 0; i < filter->count; i++) {
+            const filter_clause_t *clause = &filter->clauses[i];
+            const char *field_query = filter_fields[clause->field].query;
+            if (clause->op == FILTER_EQ && field_query && strcmp(field_query, query) == 0) {
+                pushed = i;
+                break;
+            }
+        }
+    }
+    
+    if (pushed == filter->count) {
+        filter->query = do_strdup("");
+        return filter->query ? DO_SUCCESS : DO_ERROR_MEMORY;
+    }
+    
+    filter_clause_t clause = filter->clauses[pushed];
+    char *escaped = curl_easy_escape(NULL, clause.value, 0);
+    if (!escaped) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    size_t len = strlen(filter_fields[clause.field].query) + 1 + strlen(escaped) + 1;
+    filter->query = do_malloc(len);
+    if (filter->query) {
+        snprintf(filter->query, len, "%s=%s", filter_fields[clause.field].query, escaped);
+    }
+    curl_free(escaped);
+    if (!filter->query) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_free(clause.value);
+    memmove(&filter->clauses[pushed], &filter->clauses[pushed + 1],
+            (filter->count - pushed - 1) * sizeof(filter_clause_t));
+    filter->count--;
+    return DO_SUCCESS;
+}
+
+do_result_t do_droplet_filter_compile(const char *expression, do_droplet_filter_t **filter,
+                                      char *error, size_t error_size) {
+    if (!expression || !filter) {
+        return filter_error(error, error_size, "no filter given");
+    }
+    *filter = NULL;
+    
+    do_droplet_filter_t *compiled = do_calloc(1, sizeof(do_droplet_filter_t));
+    if (!compiled) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_result_t result = DO_SUCCESS;
+    const char *p = skip_space(expression);
+    size_t capacity = 0;
+    while (result == DO_SUCCESS && *p) {
+        if (compiled->count == capacity) {
+            capacity = capacity ? capacity * 2 : 4;
+            filter_clause_t *clauses = do_realloc(compiled->clauses,
+                                                  capacity * sizeof(filter_clause_t));
+            if (!clauses) {
+                result = DO_ERROR_MEMORY;
+                break;
+            }
+            compiled->clauses = clauses;
+        }
+        
+        filter_clause_t *clause = &compiled->clauses[compiled->count];
+        memset(clause, 0, sizeof(*clause));
+        compiled->count++;
+        result = parse_clause(&p, clause, error, error_size);
+        
+        // Clauses are joined by "and"; "or" is not supported
+        p = skip_space(p);
+        if (result == DO_SUCCESS && *p) {
+            if (strncasecmp(p, "and", 3) != 0 || (p[3] && !isspace((unsigned char)p[3]))) {
+                result = filter_error(error, error_size, "expected \"and\" before \"%.20s\"", p);
+            } else {
+                p = skip_space(p + 3);
+                if (!*p) {
+                    result = filter_error(error, error_size, "expected a clause after \"and\"");
+                }
+            }
+        }
+    }
+    
+    if (result == DO_SUCCESS) {
+        result = filter_push_down(compiled);
+    }
+    if (result != DO_SUCCESS) {
+        if (result == DO_ERROR_MEMORY) {
+            filter_error(error, error_size, "out of memory");
+        }
+        do_droplet_filter_free(compiled);
+        return result;
+    }
+    
+    *filter = compiled;
+    return DO_SUCCESS;
+}
+
+void do_droplet_filter_free(do_droplet_filter_t *filter) {
+    if (!filter) {
+        return;
+    }
+    
+    for (size_t i = 0; i < filter->count; i++) {
+        do_free(filter->clauses[i].value);
+    }
+    do_free(filter->clauses);
+    do_free(filter->query);
+    do_free(filter);
+}
+
+const char *do_droplet_filter_query(const do_droplet_filter_t *filter) {
+    return filter && filter->query ? filter->query : "";
+}
+
+static bool compare(int order, filter_op_t op) {
+    switch (op) {
+        case FILTER_EQ: return order == 0;
+        case FILTER_NE: return order != 0;
+        case FILTER_LT: return order < 0;
+        case FILTER_LE: return order <= 0;
+        case FILTER_GT: return order > 0;
+        case FILTER_GE: return order >= 0;
+        default: return false;
+    }
+}
+
+static bool clause_matches(const filter_clause_t *clause, const cJSON *droplet) {
+    const cJSON *value = cJSON_GetObjectItemCaseSensitive(droplet, filter_fields[clause->field].key);
+    if (filter_fields[clause->field].subkey) {
+        value = cJSON_GetObjectItemCaseSensitive(value, filter_fields[clause->field].subkey);
+    }
+    
+    switch (filter_fields[clause->field].kind) {
+        case FILTER_NUMBER:
+            if (!cJSON_IsNumber(value)) {
+                return clause->op == FILTER_NE;
+            }
+            return compare((value->valuedouble > clause->number) -
+                           (value->valuedouble < clause->number), clause->op);
+        case FILTER_BOOL:
+            if (!cJSON_IsBool(value)) {
+                return clause->op == FILTER_NE;
+            }
+            return cJSON_IsTrue(value) == (clause->number != 0) ? clause->op == FILTER_EQ
+                                                                : clause->op == FILTER_NE;
+        case FILTER_TAGS: {
+            bool found = false;
+            const cJSON *tag;
+            cJSON_ArrayForEach(tag, value) {
+                if (cJSON_IsString(tag) && strcmp(tag->valuestring, clause->value) == 0) {
+                    found = true;
+                    break;
+                }
+            }
+            return found == (clause->op == FILTER_EQ);
+        }
+        default:
+            if (!cJSON_IsString(value)) {
+                return clause->op == FILTER_NE;
+            }
+            if (clause->op == FILTER_CONTAINS) {
+                return strstr(value->valuestring, clause->value) != NULL;
+            }
+            return compare(strcmp(value->valuestring, clause->value), clause->op);
+    }
+}
+
+bool do_droplet_filter_matches(const do_droplet_filter_t *filter, const cJSON *droplet) {
+    if (!filter) {
+        return true;
+    }
+    
+    for (size_t i = 0; i < filter->count; i++) {
+        if (!clause_matches(&filter->clauses[i], droplet)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// clause_matches() for a droplet read from a page's index, with strings
+// compared straight from the response text
+static bool indexed_string_matches(const filter_clause_t *clause, const json_od_value_t *value) {
+    do_str_view_t view;
+    if (!json_od_view(value, &view)) {
+        return clause->op == FILTER_NE;
+    }
+    
+    // Escapes are rare in these fields; only then is the text copied
+    char *decoded = NULL;
+    if (view.escaped) {
+        decoded = do_str_view_dup(&view);
+        if (!decoded) {
+            return clause->op == FILTER_NE;
+        }
+        view.data = decoded;
+        view.len = strlen(decoded);
+    }
+    
+    bool result;
+    size_t len = strlen(clause->value);
+    if (clause->op == FILTER_CONTAINS) {
+        result = memmem(view.data, view.len, clause->value, len) != NULL;
+    } else {
+        int order = memcmp(view.data, clause->value, view.len < len ? view.len : len);
+        if (order == 0) {
+            order = (view.len > len) - (view.len < len);
+        }
+        result = compare(order, clause->op);
+    }
+    do_free(decoded);
+    return result;
+}
+
+static bool indexed_clause_matches(const filter_clause_t *clause,
+                                   const json_od_value_t *droplet) {
+    json_od_value_t value, object;
+    bool found = json_od_find(droplet, filter_fields[clause->field].key, &value);
+    if (found && filter_fields[clause->field].subkey) {
+        object = value;
+        found = json_od_find(&object, filter_fields[clause->field].subkey, &value);
+    }
+    
+    double number;
+    bool boolean;
+    switch (filter_fields[clause->field].kind) {
+        case FILTER_NUMBER:
+            if (!found || !json_od_number(&value, &number)) {
+                return clause->op == FILTER_NE;
+            }
+            return compare((number > clause->number) - (number < clause->number), clause->op);
+        case FILTER_BOOL:
+            if (!found || !json_od_bool(&value, &boolean)) {
+                return clause->op == FILTER_NE;
+            }
+            return boolean == (clause->number != 0) ? clause->op == FILTER_EQ
+                                                    : clause->op == FILTER_NE;
+        case FILTER_TAGS: {
+            bool tagged = false;
+            json_od_value_t tag;
+            do_str_view_t view;
+            for (bool more = found && json_od_first(&value, &tag); more && !tagged;
+                 more = json_od_next(&tag)) {
+                tagged = json_od_view(&tag, &view) && do_str_view_equals(&view, clause->value);
+            }
+            return tagged == (clause->op == FILTER_EQ);
+        }
+        default:
+            if (!found) {
+                return clause->op == FILTER_NE;
+            }
+            return indexed_string_matches(clause, &value);
+    }
+}
+
+static bool filter_keep(const cJSON *item, void *userdata) {
+    return do_droplet_filter_matches(userdata, item);
+}
+
+// do_droplet_filter_matches() against one droplet in a page's index
+bool do_droplet_filter_matches_indexed(const do_droplet_filter_t *filter,
+                                       const json_od_value_t *droplet) {
+    if (!filter) {
+        return true;
+    }
+    
+    for (size_t i = 0; i < filter->count; i++) {
+        if (!indexed_clause_matches(&filter->clauses[i], droplet)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool filter_keep_indexed(const json_od_value_t *item, void *userdata) {
+    return do_droplet_filter_matches_indexed(userdata, item);
+}
+
+static do_result_t filter_cursor_open(do_client_t *client, const do_list_type_t *type,
+                                      const do_droplet_filter_t *filter,
+                                      do_list_cursor_t **cursor) {
+    if (!filter) {
+        return do_cursor_open(client, type, cursor);
+    }
+    return do_cursor_open_indexed(client, type, filter->query,
+                                  filter->count ? filter_keep : NULL, filter_keep_indexed,
+                                  (void *)filter, cursor);
+}
+
+do_result_t do_cursor_open_droplets_filtered(do_client_t *client,
+                                             const do_droplet_filter_t *filter,
+                                             do_list_cursor_t **cursor) {
+    return filter_cursor_open(client, &do_list_droplets, filter, cursor);
+}
+
+do_result_t do_cursor_open_droplet_views_filtered(do_client_t *client,
+                                                  const do_droplet_filter_t *filter,
+                                                  do_list_cursor_t **cursor) {
+    return filter_cursor_open(client, &do_list_droplet_views, filter, cursor);
+}
\ No newline at end of file
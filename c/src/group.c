@@ -0,0 +1,505 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <cjson/cjson.h>
+#include "digitalocean/group.h"
+#include "digitalocean/alloc.h"
+#include "client_internal.h"
+#include "http_transfer.h"
+#include "json_internal.h"
+
+#define DO_GROUP_PAGE_SIZE 200
+
+typedef struct {
+    char *name;
+    do_client_t *client;
+    struct curl_slist *headers;   // built once; the token never changes
+    do_result_t result;           // outcome of the last fan-out
+    do_http_response_t *response; // page buffer, held for one fan-out
+    do_list_position_t position;
+    bool running;                 // handle is on the group's multi
+} do_group_member_t;
+
+struct do_client_group {
+    do_group_member_t *members;
+    size_t count;
+    size_t capacity;
+    CURLSH *share;  // DNS, TLS sessions and connections for every member
+    CURLM *multi;
+    int64_t reserve;
+};
+
+// Called once per page with the member it belongs to and the collection
+// array. Anything other than DO_SUCCESS stops the whole fan-out.
+typedef do_result_t (*do_group_page_handler_t)(do_client_group_t *group, do_group_member_t *member,
+                                               const cJSON *items, void *userdata);
+
+static int64_t do_group_clock_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+do_client_group_t *do_client_group_new(void) {
+    do_client_group_t *group = do_calloc(1, sizeof(do_client_group_t));
+    if (!group) {
+        return NULL;
+    }
+    
+    group->share = curl_share_init();
+    group->multi = curl_multi_init();
+    if (!group->share || !group->multi) {
+        do_client_group_free(group);
+        return NULL;
+    }
+    
+    curl_share_setopt(group->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(group->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900 // 7.57.0
+    curl_share_setopt(group->share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+
+    return group;
+}
+
+void do_client_group_free(do_client_group_t *group) {
+    if (!group) {
+        return;
+    }
+    
+    // Members first: the share cannot go while handles still use it
+    for (size_t i = 0; i < group->count; i++) {
+        do_client_free(group->members[i].client);
+        curl_slist_free_all(group->members[i].headers);
+        do_free(group->members[i].name);
+    }
+    do_free(group->members);
+    
+    if (group->share) {
+        curl_share_cleanup(group->share);
+    }
+    if (group->multi) {
+        curl_multi_cleanup(group->multi);
+    }
+    do_free(group);
+}
+
+do_result_t do_client_group_add(do_client_group_t *group, const char *name, do_config_t *config) {
+    if (!group || !name || !config || do_client_group_find(group, name)) {
+        do_config_free(config);
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    if (group->count == group->capacity) {
+        size_t new_capacity = group->capacity ? group->capacity * 2 : 8;
+        do_group_member_t *new_members = do_realloc(group->members,
+                                                    new_capacity * sizeof(do_group_member_t));
+        if (!new_members) {
+            do_config_free(config);
+            return DO_ERROR_MEMORY;
+        }
+        
+        group->members = new_members;
+        group->capacity = new_capacity;
+    }
+    
+    do_group_member_t *member = &group->members[group->count];
+    memset(member, 0, sizeof(*member));
+    member->name = do_strdup(name);
+    member->client = do_client_new();
+    if (!member->name || !member->client) {
+        do_free(member->name);
+        do_client_free(member->client);
+        do_config_free(config);
+        return DO_ERROR_MEMORY;
+    }
+    
+    // The client owns config once init gets far enough to store it
+    do_result_t result = do_client_init(member->client, config);
+    if (result == DO_SUCCESS) {
+        member->headers = curl_slist_append(NULL, "Content-Type: application/json");
+        struct curl_slist *auth = member->headers
+            ? curl_slist_append(member->headers, member->client->auth_header) : NULL;
+        if (!auth) {
+            result = DO_ERROR_MEMORY;
+        }
+    }
+    if (result != DO_SUCCESS) {
+        if (member->client->config != config) {
+            do_config_free(config);
+        }
+        do_client_free(member->client);
+        curl_slist_free_all(member->headers);
+        do_free(member->name);
+        return result;
+    }
+    
+    curl_easy_setopt(member->client->http_client->curl, CURLOPT_SHARE, group->share);
+    group->count++;
+    return DO_SUCCESS;
+}
+
+do_result_t do_client_group_load_profiles(do_client_group_t *group) {
+    if (!group) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    do_string_array_t names;
+    do_string_array_init(&names);
+    
+    do_result_t result = do_config_list_profiles(&names);
+    for (size_t i = 0; result == DO_SUCCESS && i < names.count; i++) {
+        do_config_t *config = do_config_new();
+        if (!config) {
+            result = DO_ERROR_MEMORY;
+            break;
+        }
+        
+        result = do_config_load_profile(config, names.items[i]);
+        if (result != DO_SUCCESS) {
+            do_config_free(config);
+            break;
+        }
+        
+        result = do_client_group_add(group, names.items[i], config);
+    }
+    
+    do_string_array_free(&names);
+    return result;
+}
+
+size_t do_client_group_count(const do_client_group_t *group) {
+    return group ? group->count : 0;
+}
+
+const char *do_client_group_name(const do_client_group_t *group, size_t index) {
+    return group && index < group->count ? group->members[index].name : NULL;
+}
+
+do_client_t *do_client_group_client(do_client_group_t *group, size_t index) {
+    return group && index < group->count ? group->members[index].client : NULL;
+}
+
+do_client_t *do_client_group_find(do_client_group_t *group, const char *name) {
+    if (!group || !name) {
+        return NULL;
+    }
+    
+    for (size_t i = 0; i < group->count; i++) {
+        if (strcmp(group->members[i].name, name) == 0) {
+            return group->members[i].client;
+        }
+    }
+    return NULL;
+}
+
+void do_client_group_set_reserve(do_client_group_t *group, int64_t reserve) {
+    if (group) {
+        group->reserve = reserve < 0 ? 0 : reserve;
+    }
+}
+
+do_result_t do_client_group_result(const do_client_group_t *group, size_t index) {
+    if (!group || index >= group->count) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    return group->members[index].result;
+}
+
+// Queues the member's next page on the group's multi handle. Its own easy
+// handle is used, so rate-limit headers land in its own counters.
+static do_result_t do_client_group_start_page(do_client_group_t *group, do_group_member_t *member,
+                                              const char *url) {
+    do_http_client_t *http_client = member->client->http_client;
+    if (http_client->rate_limit_remaining >= 0 &&
+        http_client->rate_limit_remaining <= group->reserve) {
+        return DO_ERROR_RATE_LIMIT;
+    }
+    
+    do_http_response_clear(member->response);
+    
+    CURL *curl = http_client->curl;
+    curl_easy_setopt(curl, CURLOPT_URL, url);
+    curl_easy_setopt(curl, CURLOPT_HTTPGET, 1L);
+    curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, NULL);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, member->headers);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, do_http_write_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, member->response);
+    curl_easy_setopt(curl, CURLOPT_PRIVATE, member);
+    
+    // Wait for a connection that can multiplex rather than opening one per
+    // member when the server speaks HTTP/2
+    curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+    
+    http_client->pending = member->response;
+    do_result_t result = do_http_transfer_start(http_client, group->multi, curl);
+    if (result != DO_SUCCESS) {
+        http_client->pending = NULL;
+        return result;
+    }
+    
+    member->running = true;
+    return DO_SUCCESS;
+}
+
+static void do_client_group_stop_member(do_client_group_t *group, do_group_member_t *member) {
+    CURL *curl = member->client->http_client->curl;
+    
+    if (member->running) {
+        curl_multi_remove_handle(group->multi, curl);
+        member->running = false;
+    }
+    curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 0L);
+    member->client->http_client->pending = NULL;
+}
+
+// Decodes a finished page and queues the member's next one. Failures are
+// the member's own and only recorded; the handler's verdict is returned.
+static do_result_t do_client_group_page_done(do_client_group_t *group, do_group_member_t *member,
+                                             CURLcode res, do_group_page_handler_t handler,
+                                             void *userdata) {
+    do_client_t *client = member->client;
+    do_http_client_t *http_client = client->http_client;
+    
+    do_result_t result = do_http_transfer_finish(http_client, http_client->curl, "GET", res,
+                                                 &http_client->timing);
+    
+    cJSON *json = NULL;
+    int64_t parse_us = 0;
+    if (result == DO_SUCCESS) {
+        int64_t parse_start = do_group_clock_us();
+        json = member->response->data ? cJSON_Parse(member->response->data) : NULL;
+        parse_us = do_group_clock_us() - parse_start;
+    }
+    
+    const cJSON *items = cJSON_GetObjectItemCaseSensitive(json, "droplets");
+    if (result == DO_SUCCESS && !cJSON_IsArray(items)) {
+        result = DO_ERROR_JSON;
+    }
+    
+    do_result_t verdict = DO_SUCCESS;
+    int64_t decode_us = 0;
+    if (result == DO_SUCCESS) {
+        member->position.total = json_page_total(json);
+        member->position.page_count = cJSON_GetArraySize(items);
+        member->position.page_index = 0;
+        
+        int64_t decode_start = do_group_clock_us();
+        verdict = handler(group, member, items, userdata);
+        decode_us = do_group_clock_us() - decode_start;
+        result = verdict;
+    }
+    do_client_request_done(client, result, parse_us, decode_us);
+    
+    // The API hands back absolute URLs for the following page
+    const cJSON *links = cJSON_GetObjectItemCaseSensitive(json, "links");
+    const cJSON *pages = cJSON_GetObjectItemCaseSensitive(links, "pages");
+    const cJSON *next = cJSON_GetObjectItemCaseSensitive(pages, "next");
+    if (result == DO_SUCCESS && cJSON_IsString(next) && next->valuestring[0] != '\0' &&
+        cJSON_GetArraySize(items) > 0) {
+        result = do_client_group_start_page(group, member, next->valuestring);
+    }
+    
+    cJSON_Delete(json);
+    member->result = result;
+    return verdict;
+}
+
+// A fan-out in progress
+typedef struct {
+    do_client_group_t *group;
+    do_group_page_handler_t handler;
+    void *userdata;
+    size_t running; // members with a page in flight
+} do_group_fan_out_t;
+
+static do_result_t do_client_group_transfer_done(void *owner, CURLcode res, void *userdata) {
+    do_group_member_t *member = owner;
+    do_group_fan_out_t *fan_out = userdata;
+    member->running = false;
+    member->client->http_client->pending = NULL;
+    
+    do_result_t verdict = do_client_group_page_done(fan_out->group, member, res,
+                                                    fan_out->handler, fan_out->userdata);
+    if (!member->running) {
+        fan_out->running--;
+    }
+    return verdict;
+}
+
+// Runs the droplet listing for every member at once on the group's multi
+// handle. Returns the handler's verdict; member failures are left in
+// their result fields.
+static do_result_t do_client_group_fan_out(do_client_group_t *group, do_group_page_handler_t handler,
+                                           void *userdata) {
+    char first_page[64];
+    snprintf(first_page, sizeof(first_page), "/v2/droplets?per_page=%d", DO_GROUP_PAGE_SIZE);
+    
+    do_group_fan_out_t fan_out = {group, handler, userdata, 0};
+    for (size_t i = 0; i < group->count; i++) {
+        do_group_member_t *member = &group->members[i];
+        memset(&member->position, 0, sizeof(member->position));
+        member->response = do_http_client_acquire_response(member->client->http_client);
+        
+        char *url = do_http_build_url(member->client->config->base_url, first_page);
+        if (!member->response || !url) {
+            member->result = DO_ERROR_MEMORY;
+        } else {
+            member->result = do_client_group_start_page(group, member, url);
+        }
+        do_free(url);
+        
+        if (member->running) {
+            fan_out.running++;
+        }
+    }
+    
+    do_result_t verdict = do_http_multi_run(group->multi, &fan_out.running,
+                                            do_client_group_transfer_done, &fan_out);
+    
+    // Members still in flight when the walk was stopped take its verdict
+    for (size_t i = 0; i < group->count; i++) {
+        do_group_member_t *member = &group->members[i];
+        if (member->running) {
+            member->result = verdict;
+        }
+        do_client_group_stop_member(group, member);
+        do_http_client_release_response(member->client->http_client, member->response);
+        member->response = NULL;
+    }
+    
+    return verdict;
+}
+
+static do_result_t do_client_group_first_failure(const do_client_group_t *group) {
+    for (size_t i = 0; i < group->count; i++) {
+        if (group->members[i].result != DO_SUCCESS) {
+            return group->members[i].result;
+        }
+    }
+    return DO_SUCCESS;
+}
+
+typedef struct {
+    do_group_droplet_visitor_t visitor;
+    void *userdata;
+} group_visit_t;
+
+static do_result_t visit_group_page(do_client_group_t *group, do_group_member_t *member,
+                                    const cJSON *items, void *userdata) {
+    (void)group;
+    group_visit_t *visit = userdata;
+    
+    const cJSON *droplet_json;
+    cJSON_ArrayForEach(droplet_json, items) {
+        do_droplet_t droplet;
+        memset(&droplet, 0, sizeof(droplet));
+        
+        do_result_t result = json_parse_droplet(droplet_json, &droplet);
+        if (result == DO_SUCCESS) {
+            result = visit->visitor(member->name, &droplet, &member->position, visit->userdata);
+        }
+        do_droplet_free(&droplet);
+        
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+        
+        member->position.index++;
+        member->position.page_index++;
+    }
+    
+    return DO_SUCCESS;
+}
+
+do_result_t do_client_group_list_droplets_each(do_client_group_t *group,
+                                               do_group_droplet_visitor_t visitor,
+                                               void *userdata) {
+    if (!group || !visitor) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    group_visit_t visit = {visitor, userdata};
+    do_result_t result = do_client_group_fan_out(group, visit_group_page, &visit);
+    return result != DO_SUCCESS ? result : do_client_group_first_failure(group);
+}
+
+static do_result_t collect_group_page(do_client_group_t *group, do_group_member_t *member,
+                                      const cJSON *items, void *userdata) {
+    do_group_droplet_list_t *list = userdata;
+    size_t count = cJSON_GetArraySize(items);
+    
+    if (list->count + count > list->capacity) {
+        size_t new_capacity = list->capacity ? list->capacity : count;
+        while (new_capacity < list->count + count) {
+            new_capacity *= 2;
+        }
+        
+        do_droplet_t *new_items = do_realloc(list->items, new_capacity * sizeof(do_droplet_t));
+        if (!new_items) {
+            return DO_ERROR_MEMORY;
+        }
+        list->items = new_items;
+        
+        size_t *new_members = do_realloc(list->members, new_capacity * sizeof(size_t));
+        if (!new_members) {
+            return DO_ERROR_MEMORY;
+        }
+        list->members = new_members;
+        list->capacity = new_capacity;
+    }
+    
+    size_t index = (size_t)(member - group->members);
+    const cJSON *droplet_json;
+    cJSON_ArrayForEach(droplet_json, items) {
+        do_droplet_t *droplet = &list->items[list->count];
+        memset(droplet, 0, sizeof(*droplet));
+        list->members[list->count] = index;
+        
+        // Count it first so a partial parse is released with the list
+        list->count++;
+        do_result_t result = json_parse_droplet(droplet_json, droplet);
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+        member->position.index++;
+    }
+    
+    return DO_SUCCESS;
+}
+
+do_result_t do_client_group_list_droplets(do_client_group_t *group,
+                                          do_group_droplet_list_t **droplets) {
+    if (!group || !droplets) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    *droplets = do_calloc(1, sizeof(do_group_droplet_list_t));
+    if (!*droplets) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_result_t result = do_client_group_fan_out(group, collect_group_page, *droplets);
+    if (result != DO_SUCCESS) {
+        do_group_droplet_list_free(*droplets);
+        *droplets = NULL;
+        return result;
+    }
+    
+    return do_client_group_first_failure(group);
+}
+
+void do_group_droplet_list_free(do_group_droplet_list_t *list) {
+    if (!list) {
+        return;
+    }
+    
+    for (size_t i = 0; i < list->count; i++) {
+        do_droplet_free(&list->items[i]);
+    }
+    do_free(list->items);
+    do_free(list->members);
+    do_free(list);
+}
\ No newline at end of file
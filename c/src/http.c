@@ -1,26 +1,124 @@
+#include <pthread.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <sys/socket.h>
 #include "digitalocean/http.h"
+#include "digitalocean/alloc.h"
+#include "http_internal.h"
+#include "http_transfer.h"
+#include "metrics_internal.h"
+#include "ratelimit.h"
 
-// Write callback for libcurl
-size_t do_http_write_callback(void *contents, size_t size, size_t nmemb, do_http_response_t *response) {
-    size_t real_size = size * nmemb;
+// Size class of a pooled buffer, or -1 when it is too small or too big to keep
+static int do_http_pool_class(size_t capacity) {
+    if (capacity < DO_HTTP_POOL_MIN_BUFFER) {
+        return -1;
+    }
     
-    // Resize buffer if needed
-    if (response->size + real_size + 1 > response->capacity) {
-        size_t new_capacity = response->capacity ? response->capacity * 2 : 1024;
-        while (new_capacity < response->size + real_size + 1) {
+    int index = 0;
+    while (index < DO_HTTP_POOL_CLASSES && capacity >= ((size_t)DO_HTTP_POOL_MIN_BUFFER << (index + 1))) {
+        index++;
+    }
+    return index < DO_HTTP_POOL_CLASSES ? index : -1;
+}
+
+// Takes a free buffer of at least need bytes. Only the next two classes up
+// are searched so a small response never pins a multi-megabyte buffer.
+static bool do_http_pool_take(do_http_buffer_pool_t *pool, size_t need, do_http_pool_buffer_t *out) {
+    int first = do_http_pool_class(need);
+    if (first < 0) {
+        first = need < DO_HTTP_POOL_MIN_BUFFER ? 0 : DO_HTTP_POOL_CLASSES;
+    }
+    
+    for (int index = first; index < DO_HTTP_POOL_CLASSES && index <= first + 2; index++) {
+        for (size_t i = 0; i < pool->count[index]; i++) {
+            if (pool->free[index][i].capacity >= need) {
+                *out = pool->free[index][i];
+                pool->free[index][i] = pool->free[index][--pool->count[index]];
+                pool->hits++;
+                return true;
+            }
+        }
+    }
+    
+    pool->misses++;
+    return false;
+}
+
+static void do_http_pool_put(do_http_buffer_pool_t *pool, char *data, size_t capacity) {
+    int index = do_http_pool_class(capacity);
+    if (!data || index < 0 || pool->count[index] == DO_HTTP_POOL_DEPTH) {
+        do_free(data);
+        return;
+    }
+    
+    pool->free[index][pool->count[index]++] = (do_http_pool_buffer_t){data, capacity};
+}
+
+// Makes room for need bytes. exact is used when Content-Length tells us the
+// final size; otherwise capacity doubles. Pooled responses move to a
+// recycled buffer instead of reallocating in place.
+static bool do_http_response_reserve(do_http_response_t *response, size_t need, bool exact) {
+    if (need <= response->capacity) {
+        return true;
+    }
+    
+    size_t new_capacity = need;
+    if (!exact) {
+        new_capacity = response->capacity ? response->capacity * 2 : 1024;
+        while (new_capacity < need) {
             new_capacity *= 2;
         }
-        
-        char *new_data = realloc(response->data, new_capacity);
+    }
+    
+    // Anything smaller could not be pooled once released
+    if (response->pool && new_capacity < DO_HTTP_POOL_MIN_BUFFER) {
+        new_capacity = DO_HTTP_POOL_MIN_BUFFER;
+    }
+    
+    if (!response->pool) {
+        char *new_data = do_realloc(response->data, new_capacity);
         if (!new_data) {
-            return 0; // Error
+            return false;
         }
         
         response->data = new_data;
         response->capacity = new_capacity;
+        return true;
+    }
+    
+    do_http_pool_buffer_t buffer;
+    if (!do_http_pool_take(response->pool, need, &buffer)) {
+        buffer.data = do_malloc(new_capacity);
+        buffer.capacity = new_capacity;
+        if (!buffer.data) {
+            return false;
+        }
+    }
+    
+    if (response->data) {
+        memcpy(buffer.data, response->data, response->size + 1);
+    } else {
+        buffer.data[0] = '\0';
+    }
+    
+    do_http_pool_put(response->pool, response->data, response->capacity);
+    response->data = buffer.data;
+    response->capacity = buffer.capacity;
+    return true;
+}
+
+// Write callback for libcurl
+size_t do_http_write_callback(void *contents, size_t size, size_t nmemb, do_http_response_t *response) {
+    size_t real_size = size * nmemb;
+    
+    // Resize buffer if needed
+    if (!do_http_response_reserve(response, response->size + real_size + 1, false)) {
+        return 0; // Error
     }
     
     memcpy(response->data + response->size, contents, real_size);
@@ -30,14 +128,363 @@ size_t do_http_write_callback(void *contents, size_t size, size_t nmemb, do_http
     return real_size;
 }
 
+// Header callback: picks up the API's rate-limit headers as they arrive.
+// Async transfers share it with the client's own handle.
+size_t do_http_header_callback(char *buffer, size_t size, size_t nitems, void *userdata) {
+    do_http_client_t *client = userdata;
+    size_t len = size * nitems;
+    
+    static const struct {
+        const char *name;
+        size_t offset;
+    } headers[] = {
+        {"ratelimit-limit:", offsetof(do_http_client_t, rate_limit)},
+        {"ratelimit-remaining:", offsetof(do_http_client_t, rate_limit_remaining)},
+        {"ratelimit-reset:", offsetof(do_http_client_t, rate_limit_reset)},
+    };
+    
+    for (size_t i = 0; i < sizeof(headers) / sizeof(headers[0]); i++) {
+        size_t name_len = strlen(headers[i].name);
+        if (len > name_len && strncasecmp(buffer, headers[i].name, name_len) == 0) {
+            int64_t *field = (int64_t *)((char *)client + headers[i].offset);
+            *field = strtoll(buffer + name_len, NULL, 10);
+            break;
+        }
+    }
+    
+    // The blank line after the headers: let other processes see the budget
+    if (client->rate_budget && len <= 2 && (buffer[0] == '\r' || buffer[0] == '\n') &&
+        client->rate_limit_remaining >= 0) {
+        do_rate_budget_update(client->rate_budget, client->rate_limit_remaining,
+                              client->rate_limit_reset);
+    }
+    
+    // Reserve the whole body before the first byte arrives. Headers of
+    // redirects and interim responses come through here too, which is
+    // harmless: the reservation is only ever grown.
+    static const char content_length[] = "content-length:";
+    size_t cl_len = sizeof(content_length) - 1;
+    do_http_response_t *response = client->pending;
+    if (response && response->size == 0 && len > cl_len &&
+        strncasecmp(buffer, content_length, cl_len) == 0) {
+        long long body_size = strtoll(buffer + cl_len, NULL, 10);
+        if (body_size > 0 && body_size <= DO_HTTP_MAX_PRESIZE) {
+            do_http_response_reserve(response, (size_t)body_size + 1, true);
+        }
+    }
+    
+    return len;
+}
+
+// Captures libcurl's phase timers for a transfer that just finished and
+// feeds the metrics registry. Shared with the async layer (async.c).
+void do_http_capture_timing(CURL *curl, const char *method, CURLcode res, do_request_timing_t *timing) {
+    curl_off_t value;
+    char *url = NULL;
+    
+    memset(timing, 0, sizeof(*timing));
+    timing->method = method;
+    
+    curl_easy_getinfo(curl, CURLINFO_EFFECTIVE_URL, &url);
+    timing->url = url;
+    curl_easy_getinfo(curl, CURLINFO_RESPONSE_CODE, &timing->status_code);
+    
+    if (curl_easy_getinfo(curl, CURLINFO_NAMELOOKUP_TIME_T, &value) == CURLE_OK) {
+        timing->name_lookup_us = value;
+    }
+    if (curl_easy_getinfo(curl, CURLINFO_CONNECT_TIME_T, &value) == CURLE_OK) {
+        timing->connect_us = value;
+    }
+    if (curl_easy_getinfo(curl, CURLINFO_APPCONNECT_TIME_T, &value) == CURLE_OK) {
+        timing->app_connect_us = value;
+    }
+    if (curl_easy_getinfo(curl, CURLINFO_STARTTRANSFER_TIME_T, &value) == CURLE_OK) {
+        timing->first_byte_us = value;
+    }
+    if (curl_easy_getinfo(curl, CURLINFO_TOTAL_TIME_T, &value) == CURLE_OK) {
+        timing->total_us = value;
+    }
+    if (curl_easy_getinfo(curl, CURLINFO_SIZE_DOWNLOAD_T, &value) == CURLE_OK) {
+        timing->bytes_received = value;
+    }
+    if (curl_easy_getinfo(curl, CURLINFO_SIZE_UPLOAD_T, &value) == CURLE_OK) {
+        timing->bytes_sent = value;
+    }
+    
+    do_metrics_record_request(method, url, timing->status_code, res == CURLE_OK, timing->total_us,
+                              timing->bytes_received, timing->bytes_sent);
+}
+
+// With a shared budget, waits for a request's share of it before sending
+static do_result_t do_http_take_budget(do_http_client_t *client) {
+    return client->rate_budget ? do_rate_budget_acquire(client->rate_budget) : DO_SUCCESS;
+}
+
+static void do_http_record_timing(do_http_client_t *client, const char *method, CURLcode res) {
+    do_http_capture_timing(client->curl, method, res, &client->timing);
+    if (client->rate_limit >= 0) {
+        do_metrics_record_rate_limit(client->rate_limit, client->rate_limit_remaining,
+                                     client->rate_limit_reset);
+    }
+}
+
+// Options every easy handle of a client gets
+static void do_http_apply_options(do_http_client_t *client, CURL *curl) {
+    curl_easy_setopt(curl, CURLOPT_TIMEOUT, client->timeout);
+    curl_easy_setopt(curl, CURLOPT_USERAGENT, client->user_agent);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 1L);
+    curl_easy_setopt(curl, CURLOPT_SSL_VERIFYHOST, 2L);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, do_http_header_callback);
+    curl_easy_setopt(curl, CURLOPT_HEADERDATA, client);
+}
+
+CURL *do_http_transfer_new(do_http_client_t *client, struct curl_slist *headers,
+                           do_http_response_t *response, void *owner) {
+    CURL *curl = curl_easy_init();
+    if (!curl) {
+        return NULL;
+    }
+    
+    do_http_apply_options(client, curl);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, do_http_write_callback);
+    curl_easy_setopt(curl, CURLOPT_WRITEDATA, response);
+    curl_easy_setopt(curl, CURLOPT_PRIVATE, owner);
+    return curl;
+}
+
+do_result_t do_http_transfer_start(do_http_client_t *client, CURLM *multi, CURL *curl) {
+    do_result_t result = do_http_take_budget(client);
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    
+    CURLMcode code = curl_multi_add_handle(multi, curl);
+    if (code != CURLM_OK) {
+        return code == CURLM_OUT_OF_MEMORY ? DO_ERROR_MEMORY : DO_ERROR_HTTP;
+    }
+    return DO_SUCCESS;
+}
+
+do_result_t do_http_transfer_finish(do_http_client_t *client, CURL *curl, const char *method,
+                                    CURLcode res, do_request_timing_t *timing) {
+    do_http_capture_timing(curl, method, res, timing);
+    if (client->rate_limit >= 0) {
+        do_metrics_record_rate_limit(client->rate_limit, client->rate_limit_remaining,
+                                     client->rate_limit_reset);
+    }
+    return res == CURLE_OK ? do_http_status_to_result(timing->status_code)
+                           : do_http_code_to_result(res);
+}
+
+do_result_t do_http_multi_drain(CURLM *multi, do_http_transfer_done_t done, void *userdata) {
+    CURLMsg *msg;
+    int queued;
+    
+    while ((msg = curl_multi_info_read(multi, &queued))) {
+        if (msg->msg != CURLMSG_DONE) {
+            continue;
+        }
+        
+        // msg is invalid once the handle is removed
+        CURLcode res = msg->data.result;
+        CURL *curl = msg->easy_handle;
+        void *owner = NULL;
+        curl_easy_getinfo(curl, CURLINFO_PRIVATE, (char **)&owner);
+        curl_multi_remove_handle(multi, curl);
+        
+        do_result_t result = done(owner, res, userdata);
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+    }
+    
+    return DO_SUCCESS;
+}
+
+do_result_t do_http_multi_run(CURLM *multi, const size_t *running, do_http_transfer_done_t done,
+                              void *userdata) {
+    while (*running > 0) {
+        int still_running;
+        if (curl_multi_perform(multi, &still_running) != CURLM_OK) {
+            return DO_ERROR_HTTP;
+        }
+        
+        do_result_t result = do_http_multi_drain(multi, done, userdata);
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+        
+        if (*running > 0) {
+            curl_multi_poll(multi, NULL, 0, 1000, NULL);
+        }
+    }
+    
+    return DO_SUCCESS;
+}
+
+struct do_http_warm_up {
+    pthread_t thread;
+    char *url;
+    // Guards the two below against the warm-up's own thread. A cancel
+    // shuts the socket down so a handshake in progress fails at once
+    // instead of making do_http_client_free() wait for it.
+    pthread_mutex_t lock;
+    curl_socket_t socket;
+    bool cancel;
+};
+
+static size_t do_http_discard(char *buffer, size_t size, size_t nitems, void *userdata) {
+    (void)buffer;
+    (void)userdata;
+    return size * nitems;
+}
+
+// Catches a cancel while no socket is open yet, e.g. during DNS
+static int do_http_warm_up_progress(void *userdata, curl_off_t dltotal, curl_off_t dlnow,
+                                    curl_off_t ultotal, curl_off_t ulnow) {
+    (void)dltotal;
+    (void)dlnow;
+    (void)ultotal;
+    (void)ulnow;
+    do_http_warm_up_t *warm_up = userdata;
+    
+    pthread_mutex_lock(&warm_up->lock);
+    bool cancel = warm_up->cancel;
+    pthread_mutex_unlock(&warm_up->lock);
+    return cancel ? 1 : 0;
+}
+
+static curl_socket_t do_http_warm_up_open_socket(void *clientp, curlsocktype purpose,
+                                                 struct curl_sockaddr *address) {
+    (void)purpose;
+    do_http_warm_up_t *warm_up = ((do_http_client_t *)clientp)->warm_up;
+    
+    pthread_mutex_lock(&warm_up->lock);
+    curl_socket_t fd = CURL_SOCKET_BAD;
+    if (!warm_up->cancel) {
+        fd = socket(address->family, address->socktype, address->protocol);
+        warm_up->socket = fd;
+    }
+    pthread_mutex_unlock(&warm_up->lock);
+    return fd;
+}
+
+// Stays with the connection after the warm-up, so it looks the warm-up up
+// through the client rather than holding on to it
+static int do_http_warm_up_close_socket(void *clientp, curl_socket_t fd) {
+    do_http_warm_up_t *warm_up = ((do_http_client_t *)clientp)->warm_up;
+    if (!warm_up) {
+        return close(fd);
+    }
+    
+    pthread_mutex_lock(&warm_up->lock);
+    if (warm_up->socket == fd) {
+        warm_up->socket = CURL_SOCKET_BAD;
+    }
+    int result = close(fd);
+    pthread_mutex_unlock(&warm_up->lock);
+    return result;
+}
+
+static void *do_http_warm_up_thread(void *arg) {
+    do_http_client_t *client = arg;
+    do_http_warm_up_t *warm_up = client->warm_up;
+    CURL *curl = client->curl;
+    
+    // A bare HEAD: no token, no redirects, and nothing reaches the
+    // rate-limit bookkeeping, the metrics or the timing record. Once it
+    // finishes the connection waits in the handle's cache for the next
+    // request; a CONNECT_ONLY connection would not be handed on.
+    curl_easy_setopt(curl, CURLOPT_URL, warm_up->url);
+    curl_easy_setopt(curl, CURLOPT_NOBODY, 1L);
+    curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST, NULL);
+    curl_easy_setopt(curl, CURLOPT_HTTPHEADER, NULL);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 0L);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, do_http_discard);
+    curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+    curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, do_http_warm_up_progress);
+    curl_easy_setopt(curl, CURLOPT_XFERINFODATA, warm_up);
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 0L);
+    curl_easy_setopt(curl, CURLOPT_OPENSOCKETFUNCTION, do_http_warm_up_open_socket);
+    curl_easy_setopt(curl, CURLOPT_OPENSOCKETDATA, client);
+    curl_easy_setopt(curl, CURLOPT_CLOSESOCKETFUNCTION, do_http_warm_up_close_socket);
+    curl_easy_setopt(curl, CURLOPT_CLOSESOCKETDATA, client);
+    
+    curl_easy_perform(curl);
+    
+    curl_easy_setopt(curl, CURLOPT_OPENSOCKETFUNCTION, NULL);
+    curl_easy_setopt(curl, CURLOPT_OPENSOCKETDATA, NULL);
+    curl_easy_setopt(curl, CURLOPT_CLOSESOCKETFUNCTION, NULL);
+    curl_easy_setopt(curl, CURLOPT_CLOSESOCKETDATA, NULL);
+    curl_easy_setopt(curl, CURLOPT_NOPROGRESS, 1L);
+    curl_easy_setopt(curl, CURLOPT_XFERINFOFUNCTION, NULL);
+    curl_easy_setopt(curl, CURLOPT_XFERINFODATA, NULL);
+    curl_easy_setopt(curl, CURLOPT_HEADERFUNCTION, do_http_header_callback);
+    curl_easy_setopt(curl, CURLOPT_FOLLOWLOCATION, 1L);
+    curl_easy_setopt(curl, CURLOPT_NOBODY, 0L);
+    return NULL;
+}
+
+do_result_t do_http_client_warm_up(do_http_client_t *client, const char *url) {
+    if (!client || !client->curl || !url) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    if (client->warm_up) {
+        return DO_SUCCESS;
+    }
+    
+    do_http_warm_up_t *warm_up = do_calloc(1, sizeof(do_http_warm_up_t));
+    if (!warm_up) {
+        return DO_ERROR_MEMORY;
+    }
+    warm_up->url = do_strdup(url);
+    if (!warm_up->url) {
+        do_free(warm_up);
+        return DO_ERROR_MEMORY;
+    }
+    pthread_mutex_init(&warm_up->lock, NULL);
+    warm_up->socket = CURL_SOCKET_BAD;
+    
+    client->warm_up = warm_up;
+    if (pthread_create(&warm_up->thread, NULL, do_http_warm_up_thread, client) != 0) {
+        client->warm_up = NULL;
+        pthread_mutex_destroy(&warm_up->lock);
+        do_free(warm_up->url);
+        do_free(warm_up);
+        return DO_ERROR_HTTP;
+    }
+    return DO_SUCCESS;
+}
+
+// Waits for a warm-up still using the handle. Anything that touches
+// client->curl calls this first; shared with the cursor and TLS session
+// code (cursor.c, tls_sessions.c).
+void do_http_client_settle(do_http_client_t *client) {
+    do_http_warm_up_t *warm_up = client->warm_up;
+    if (!warm_up) {
+        return;
+    }
+    
+    pthread_join(warm_up->thread, NULL);
+    client->warm_up = NULL;
+    pthread_mutex_destroy(&warm_up->lock);
+    do_free(warm_up->url);
+    do_free(warm_up);
+}
+
 do_http_client_t *do_http_client_new(void) {
-    do_http_client_t *client = calloc(1, sizeof(do_http_client_t));
+    do_http_client_t *client = do_calloc(1, sizeof(do_http_client_t));
     if (!client) {
         return NULL;
     }
     
     client->timeout = 30; // 30 seconds default
-    client->user_agent = strdup("digitalocean-c/1.0.0");
+    client->user_agent = do_strdup("digitalocean-c/1.0.0");
+    client->rate_limit = -1;
+    client->rate_limit_remaining = -1;
+    client->rate_limit_reset = -1;
     
     return client;
 }
@@ -47,12 +494,29 @@ void do_http_client_free(do_http_client_t *client) {
         return;
     }
     
+    // Nobody is waiting for the connection any more
+    do_http_warm_up_t *warm_up = client->warm_up;
+    if (warm_up) {
+        pthread_mutex_lock(&warm_up->lock);
+        warm_up->cancel = true;
+        if (warm_up->socket != CURL_SOCKET_BAD) {
+            shutdown(warm_up->socket, SHUT_RDWR);
+        }
+        pthread_mutex_unlock(&warm_up->lock);
+        do_http_client_settle(client);
+    }
     if (client->curl) {
         curl_easy_cleanup(client->curl);
     }
     
-    free(client->user_agent);
-    free(client);
+    for (int index = 0; index < DO_HTTP_POOL_CLASSES; index++) {
+        for (size_t i = 0; i < client->pool.count[index]; i++) {
+            do_free(client->pool.free[index][i].data);
+        }
+    }
+    
+    do_free(client->user_agent);
+    do_free(client);
 }
 
 do_result_t do_http_client_init(do_http_client_t *client) {
@@ -65,12 +529,7 @@ do_result_t do_http_client_init(do_http_client_t *client) {
         return DO_ERROR_HTTP;
     }
     
-    // Set common options
-    curl_easy_setopt(client->curl, CURLOPT_TIMEOUT, client->timeout);
-    curl_easy_setopt(client->curl, CURLOPT_USERAGENT, client->user_agent);
-    curl_easy_setopt(client->curl, CURLOPT_FOLLOWLOCATION, 1L);
-    curl_easy_setopt(client->curl, CURLOPT_SSL_VERIFYPEER, 1L);
-    curl_easy_setopt(client->curl, CURLOPT_SSL_VERIFYHOST, 2L);
+    do_http_apply_options(client, client->curl);
     
     return DO_SUCCESS;
 }
@@ -81,6 +540,7 @@ do_result_t do_http_client_set_timeout(do_http_client_t *client, long timeout_se
     }
     
     client->timeout = timeout_seconds;
+    do_http_client_settle(client);
     if (client->curl) {
         curl_easy_setopt(client->curl, CURLOPT_TIMEOUT, timeout_seconds);
     }
@@ -93,12 +553,13 @@ do_result_t do_http_client_set_user_agent(do_http_client_t *client, const char *
         return DO_ERROR_INVALID_PARAM;
     }
     
-    free(client->user_agent);
-    client->user_agent = strdup(user_agent);
+    do_free(client->user_agent);
+    client->user_agent = do_strdup(user_agent);
     if (!client->user_agent) {
         return DO_ERROR_MEMORY;
     }
     
+    do_http_client_settle(client);
     if (client->curl) {
         curl_easy_setopt(client->curl, CURLOPT_USERAGENT, client->user_agent);
     }
@@ -107,7 +568,7 @@ do_result_t do_http_client_set_user_agent(do_http_client_t *client, const char *
 }
 
 do_http_response_t *do_http_response_new(void) {
-    do_http_response_t *response = calloc(1, sizeof(do_http_response_t));
+    do_http_response_t *response = do_calloc(1, sizeof(do_http_response_t));
     return response;
 }
 
@@ -116,8 +577,33 @@ void do_http_response_free(do_http_response_t *response) {
         return;
     }
     
-    free(response->data);
-    free(response);
+    do_free(response->data);
+    do_free(response);
+}
+
+do_http_response_t *do_http_client_acquire_response(do_http_client_t *client) {
+    if (!client) {
+        return NULL;
+    }
+    
+    do_http_response_t *response = do_calloc(1, sizeof(do_http_response_t));
+    if (response) {
+        response->pool = &client->pool;
+    }
+    return response;
+}
+
+void do_http_client_release_response(do_http_client_t *client, do_http_response_t *response) {
+    if (!response) {
+        return;
+    }
+    
+    if (client && response->pool == &client->pool) {
+        do_http_pool_put(&client->pool, response->data, response->capacity);
+    } else {
+        do_free(response->data);
+    }
+    do_free(response);
 }
 
 void do_http_response_clear(do_http_response_t *response) {
@@ -137,6 +623,12 @@ do_result_t do_http_get(do_http_client_t *client, const char *url,
         return DO_ERROR_INVALID_PARAM;
     }
     
+    do_http_client_settle(client);
+    do_result_t budget = do_http_take_budget(client);
+    if (budget != DO_SUCCESS) {
+        return budget;
+    }
+    
     struct curl_slist *headers = NULL;
     
     // Set headers
@@ -148,12 +640,16 @@ do_result_t do_http_get(do_http_client_t *client, const char *url,
     // Configure request
     curl_easy_setopt(client->curl, CURLOPT_URL, url);
     curl_easy_setopt(client->curl, CURLOPT_HTTPGET, 1L);
+    curl_easy_setopt(client->curl, CURLOPT_CUSTOMREQUEST, NULL);
     curl_easy_setopt(client->curl, CURLOPT_HTTPHEADER, headers);
     curl_easy_setopt(client->curl, CURLOPT_WRITEFUNCTION, do_http_write_callback);
     curl_easy_setopt(client->curl, CURLOPT_WRITEDATA, response);
     
     // Perform request
+    client->pending = response;
     CURLcode res = curl_easy_perform(client->curl);
+    client->pending = NULL;
+    do_http_record_timing(client, "GET", res);
     
     // Clean up
     curl_slist_free_all(headers);
@@ -168,6 +664,12 @@ do_result_t do_http_post(do_http_client_t *client, const char *url,
         return DO_ERROR_INVALID_PARAM;
     }
     
+    do_http_client_settle(client);
+    do_result_t budget = do_http_take_budget(client);
+    if (budget != DO_SUCCESS) {
+        return budget;
+    }
+    
     struct curl_slist *headers = NULL;
     
     // Set headers
@@ -179,6 +681,7 @@ do_result_t do_http_post(do_http_client_t *client, const char *url,
     // Configure request
     curl_easy_setopt(client->curl, CURLOPT_URL, url);
     curl_easy_setopt(client->curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(client->curl, CURLOPT_CUSTOMREQUEST, NULL);
     curl_easy_setopt(client->curl, CURLOPT_HTTPHEADER, headers);
     curl_easy_setopt(client->curl, CURLOPT_WRITEFUNCTION, do_http_write_callback);
     curl_easy_setopt(client->curl, CURLOPT_WRITEDATA, response);
@@ -189,7 +692,10 @@ do_result_t do_http_post(do_http_client_t *client, const char *url,
     }
     
     // Perform request
+    client->pending = response;
     CURLcode res = curl_easy_perform(client->curl);
+    client->pending = NULL;
+    do_http_record_timing(client, "POST", res);
     
     // Clean up
     curl_slist_free_all(headers);
@@ -203,6 +709,12 @@ do_result_t do_http_delete(do_http_client_t *client, const char *url,
         return DO_ERROR_INVALID_PARAM;
     }
     
+    do_http_client_settle(client);
+    do_result_t budget = do_http_take_budget(client);
+    if (budget != DO_SUCCESS) {
+        return budget;
+    }
+    
     struct curl_slist *headers = NULL;
     
     // Set headers
@@ -219,7 +731,10 @@ do_result_t do_http_delete(do_http_client_t *client, const char *url,
     curl_easy_setopt(client->curl, CURLOPT_WRITEDATA, response);
     
     // Perform request
+    client->pending = response;
     CURLcode res = curl_easy_perform(client->curl);
+    client->pending = NULL;
+    do_http_record_timing(client, "DELETE", res);
     
     // Clean up
     curl_slist_free_all(headers);
@@ -227,13 +742,77 @@ do_result_t do_http_delete(do_http_client_t *client, const char *url,
     return do_http_code_to_result(res);
 }
 
+// do_http_stream() plus extra "Name: value" header lines, for the generic
+// invoker (invoke.c via client.c)
+do_result_t do_http_stream_with_headers(do_http_client_t *client, const char *method,
+                                        const char *url, const char *auth_header,
+                                        const struct curl_slist *extra_headers, const char *body,
+                                        curl_write_callback write_fn, void *userdata,
+                                        long *status_code) {
+    if (!client || !client->curl || !method || !url || !write_fn) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    do_http_client_settle(client);
+    do_result_t budget = do_http_take_budget(client);
+    if (budget != DO_SUCCESS) {
+        return budget;
+    }
+    
+    struct curl_slist *headers = NULL;
+    
+    // Set headers
+    headers = curl_slist_append(headers, "Content-Type: application/json");
+    if (auth_header) {
+        headers = curl_slist_append(headers, auth_header);
+    }
+    for (const struct curl_slist *extra = extra_headers; extra; extra = extra->next) {
+        headers = curl_slist_append(headers, extra->data);
+    }
+    
+    // Configure request; the body goes to write_fn as each chunk arrives
+    curl_easy_setopt(client->curl, CURLOPT_URL, url);
+    if (strcmp(method, "GET") == 0) {
+        curl_easy_setopt(client->curl, CURLOPT_HTTPGET, 1L);
+        curl_easy_setopt(client->curl, CURLOPT_CUSTOMREQUEST, NULL);
+    } else {
+        curl_easy_setopt(client->curl, CURLOPT_POST, 1L);
+        curl_easy_setopt(client->curl, CURLOPT_CUSTOMREQUEST, strcmp(method, "POST") == 0 ? NULL : method);
+        curl_easy_setopt(client->curl, CURLOPT_POSTFIELDS, body ? body : "");
+        curl_easy_setopt(client->curl, CURLOPT_POSTFIELDSIZE, body ? (long)strlen(body) : 0L);
+    }
+    curl_easy_setopt(client->curl, CURLOPT_HTTPHEADER, headers);
+    curl_easy_setopt(client->curl, CURLOPT_WRITEFUNCTION, write_fn);
+    curl_easy_setopt(client->curl, CURLOPT_WRITEDATA, userdata);
+    
+    // Perform request
+    CURLcode res = curl_easy_perform(client->curl);
+    do_http_record_timing(client, method, res);
+    
+    if (status_code) {
+        *status_code = client->timing.status_code;
+    }
+    
+    // Clean up
+    curl_slist_free_all(headers);
+    
+    return do_http_code_to_result(res);
+}
+
+do_result_t do_http_stream(do_http_client_t *client, const char *method, const char *url,
+                           const char *auth_header, const char *body,
+                           curl_write_callback write_fn, void *userdata, long *status_code) {
+    return do_http_stream_with_headers(client, method, url, auth_header, NULL, body,
+                                       write_fn, userdata, status_code);
+}
+
 char *do_http_build_auth_header(const char *token) {
     if (!token) {
         return NULL;
     }
     
     size_t len = strlen("Authorization: Bearer ") + strlen(token) + 1;
-    char *header = malloc(len);
+    char *header = do_malloc(len);
     if (!header) {
         return NULL;
     }
@@ -248,7 +827,7 @@ char *do_http_build_url(const char *base_url, const char *endpoint) {
     }
     
     size_t len = strlen(base_url) + strlen(endpoint) + 1;
-    char *url = malloc(len);
+    char *url = do_malloc(len);
     if (!url) {
         return NULL;
     }
@@ -274,4 +853,22 @@ do_result_t do_http_code_to_result(CURLcode code) {
         default:
             return DO_ERROR_HTTP;
     }
+}
+
+do_result_t do_http_status_to_result(long status_code) {
+    if (status_code >= 200 && status_code < 300) {
+        return DO_SUCCESS;
+    }
+    
+    switch (status_code) {
+        case 401:
+        case 403:
+            return DO_ERROR_AUTH;
+        case 404:
+            return DO_ERROR_NOT_FOUND;
+        case 429:
+            return DO_ERROR_RATE_LIMIT;
+        default:
+            return DO_ERROR_HTTP;
+    }
 }
\ No newline at end of file
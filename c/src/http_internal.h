@@ -0,0 +1,20 @@
+#ifndef DO_HTTP_INTERNAL_H
+#define DO_HTTP_INTERNAL_H
+
+#include "digitalocean/http.h"
+
+// Handle-level helpers shared beyond http.c
+
+// Waits for a warm-up still using the handle. Anything that touches
+// client->curl calls this first (cursor.c, tls_sessions.c).
+void do_http_client_settle(do_http_client_t *client);
+
+// do_http_stream() plus extra "Name: value" header lines, for the generic
+// invoker (invoke.c via client.c)
+do_result_t do_http_stream_with_headers(do_http_client_t *client, const char *method,
+                                        const char *url, const char *auth_header,
+                                        const struct curl_slist *extra_headers, const char *body,
+                                        curl_write_callback write_fn, void *userdata,
+                                        long *status_code);
+
+#endif // DO_HTTP_INTERNAL_H
\ No newline at end of file
@@ -0,0 +1,37 @@
+#ifndef DO_HTTP_TRANSFER_H
+#define DO_HTTP_TRANSFER_H
+
+#include <stddef.h>
+#include "digitalocean/http.h"
+
+// Transfers run on a multi handle next to the client's blocking one
+// (async.c, export.c, group.c, monitoring.c, tags.c). Each owner keeps its
+// own state and hands these the parts every transfer shares.
+
+// Called for each finished transfer once its handle has left the multi
+// handle. owner is what the transfer carries as CURLINFO_PRIVATE; done may
+// start further transfers. Anything but DO_SUCCESS stops the run.
+typedef do_result_t (*do_http_transfer_done_t)(void *owner, CURLcode res, void *userdata);
+
+// A new easy handle with the options of the client's blocking handle,
+// writing into response and carrying owner. NULL when out of memory.
+CURL *do_http_transfer_new(do_http_client_t *client, struct curl_slist *headers,
+                           do_http_response_t *response, void *owner);
+
+// Waits for the client's share of a shared rate budget, then adds curl to
+// multi
+do_result_t do_http_transfer_start(do_http_client_t *client, CURLM *multi, CURL *curl);
+
+// Fills in timing for a finished transfer, feeds the metrics registry and
+// returns the transfer's result
+do_result_t do_http_transfer_finish(do_http_client_t *client, CURL *curl, const char *method,
+                                    CURLcode res, do_request_timing_t *timing);
+
+// Hands every transfer that has finished so far to done
+do_result_t do_http_multi_drain(CURLM *multi, do_http_transfer_done_t done, void *userdata);
+
+// Performs, drains and polls until *running, which done keeps, reaches 0
+do_result_t do_http_multi_run(CURLM *multi, const size_t *running, do_http_transfer_done_t done,
+                              void *userdata);
+
+#endif // DO_HTTP_TRANSFER_H
\ No newline at end of file
@@ -0,0 +1,346 @@
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <cjson/cjson.h>
+#include "digitalocean/invoke.h"
+#include "digitalocean/alloc.h"
+#include "client_internal.h"
+#include "optable.h"
+
+// FNV-1a with the seed folded into the offset basis; must match fnv1a() in
+// scripts/gen_optable.py
+static uint32_t do_optable_hash(const char *key, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+    for (const unsigned char *p = (const unsigned char *)key; *p; p++) {
+        hash ^= *p;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+const do_operation_t *do_operation_find(const char *operation_id) {
+    if (!operation_id) {
+        return NULL;
+    }
+    
+    // One probe: the first hash picks the seed, the seeded hash the slot
+    uint16_t seed = do_optable_seeds[do_optable_hash(operation_id, 0) % do_optable_seed_count];
+    size_t slot = do_optable_hash(operation_id, seed) % do_optable_op_count;
+    const do_operation_t *op = &do_optable_ops[slot];
+    return strcmp(do_optable_strings + op->id, operation_id) == 0 ? op : NULL;
+}
+
+size_t do_operation_count(void) {
+    return do_optable_op_count;
+}
+
+const do_operation_t *do_operation_at(size_t index) {
+    return index < do_optable_op_count ? &do_optable_ops[index] : NULL;
+}
+
+const char *do_operation_id(const do_operation_t *op) {
+    return op ? do_optable_strings + op->id : NULL;
+}
+
+const char *do_operation_method(const do_operation_t *op) {
+    return op ? do_optable_strings + op->method : NULL;
+}
+
+const char *do_operation_path(const do_operation_t *op) {
+    return op ? do_optable_strings + op->path : NULL;
+}
+
+size_t do_operation_param_count(const do_operation_t *op) {
+    return op ? op->param_count : 0;
+}
+
+do_param_info_t do_operation_param(const do_operation_t *op, size_t index) {
+    do_param_info_t info = {NULL, DO_PARAM_QUERY, DO_PARAM_STRING, false};
+    if (op && index < op->param_count) {
+        const do_optable_param_t *param = &do_optable_params[op->param_first + index];
+        info.name = do_optable_strings + param->name;
+        info.location = (do_param_location_t)param->location;
+        info.kind = (do_param_kind_t)param->kind;
+        info.required = param->required;
+    }
+    return info;
+}
+
+bool do_operation_has_body(const do_operation_t *op) {
+    return op && (op->flags & DO_OP_HAS_BODY);
+}
+
+bool do_operation_body_required(const do_operation_t *op) {
+    return op && (op->flags & DO_OP_BODY_REQUIRED);
+}
+
+size_t do_operation_body_field_count(const do_operation_t *op) {
+    return op ? op->field_count : 0;
+}
+
+const char *do_operation_body_field(const do_operation_t *op, size_t index) {
+    if (!op || index >= op->field_count) {
+        return NULL;
+    }
+    return do_optable_strings + do_optable_fields[op->field_first + index];
+}
+
+static const do_optable_param_t *find_param(const do_operation_t *op, const char *name) {
+    for (size_t i = 0; i < op->param_count; i++) {
+        const do_optable_param_t *param = &do_optable_params[op->param_first + i];
+        if (strcmp(do_optable_strings + param->name, name) == 0) {
+            return param;
+        }
+    }
+    return NULL;
+}
+
+static const char *find_value(const do_param_t *params, size_t count, const char *name) {
+    for (size_t i = 0; i < count; i++) {
+        if (strcmp(params[i].name, name) == 0) {
+            return params[i].value;
+        }
+    }
+    return NULL;
+}
+
+static bool value_has_kind(const char *value, do_param_kind_t kind) {
+    char *end;
+    switch (kind) {
+        case DO_PARAM_INTEGER:
+            if (*value == '-') value++;
+            if (*value == '\0') return false;
+            for (; *value; value++) {
+                if (*value < '0' || *value > '9') return false;
+            }
+            return true;
+        case DO_PARAM_NUMBER:
+            strtod(value, &end);
+            return end != value && *end == '\0';
+        case DO_PARAM_BOOLEAN:
+            return strcmp(value, "true") == 0 || strcmp(value, "false") == 0;
+        default:
+            return true;
+    }
+}
+
+static do_result_t invalid(char *error, size_t error_size, const char *format, ...) {
+    if (error && error_size > 0) {
+        va_list args;
+        va_start(args, format);
+        vsnprintf(error, error_size, format, args);
+        va_end(args);
+    }
+    return DO_ERROR_INVALID_PARAM;
+}
+
+static const char *kind_name(do_param_kind_t kind) {
+    switch (kind) {
+        case DO_PARAM_INTEGER: return "an integer";
+        case DO_PARAM_NUMBER: return "a number";
+        case DO_PARAM_BOOLEAN: return "true or false";
+        default: return "a string";
+    }
+}
+
+do_result_t do_operation_validate(const do_operation_t *op, const do_param_t *params,
+                                  size_t param_count, const char *body,
+                                  char *error, size_t error_size) {
+    if (!op || (param_count && !params)) {
+        return invalid(error, error_size, "no operation given");
+    }
+    const char *op_id = do_optable_strings + op->id;
+    
+    for (size_t i = 0; i < param_count; i++) {
+        if (!params[i].name || !params[i].value) {
+            return invalid(error, error_size, "%s: parameter %s has no value", op_id,
+                           params[i].name ? params[i].name : "(null)");
+        }
+        const do_optable_param_t *param = find_param(op, params[i].name);
+        if (!param) {
+            return invalid(error, error_size, "%s takes no parameter %s", op_id, params[i].name);
+        }
+        if (!value_has_kind(params[i].value, (do_param_kind_t)param->kind)) {
+            return invalid(error, error_size, "%s: %s must be %s", op_id, params[i].name,
+                           kind_name((do_param_kind_t)param->kind));
+        }
+        // A line break would end the header and start another
+        if (param->location == DO_PARAM_HEADER && strpbrk(params[i].value, "\r\n")) {
+            return invalid(error, error_size, "%s: %s must not contain a line break", op_id,
+                           params[i].name);
+        }
+    }
+    
+    for (size_t i = 0; i < op->param_count; i++) {
+        const do_optable_param_t *param = &do_optable_params[op->param_first + i];
+        const char *name = do_optable_strings + param->name;
+        if (param->required && !find_value(params, param_count, name)) {
+            return invalid(error, error_size, "%s: missing required parameter %s", op_id, name);
+        }
+    }
+    
+    if (!body) {
+        return (op->flags & DO_OP_BODY_REQUIRED)
+            ? invalid(error, error_size, "%s: a request body is required", op_id)
+            : DO_SUCCESS;
+    }
+    if (!(op->flags & DO_OP_HAS_BODY)) {
+        return invalid(error, error_size, "%s takes no request body", op_id);
+    }
+    
+    cJSON *json = cJSON_Parse(body);
+    if (!json) {
+        return invalid(error, error_size, "%s: the request body is not valid JSON", op_id);
+    }
+    
+    do_result_t result = DO_SUCCESS;
+    if (op->flags & DO_OP_BODY_OBJECT) {
+        if (!cJSON_IsObject(json)) {
+            result = invalid(error, error_size, "%s: the request body must be a JSON object",
+                             op_id);
+        }
+        for (size_t i = 0; result == DO_SUCCESS && i < op->field_count; i++) {
+            const char *field = do_optable_strings + do_optable_fields[op->field_first + i];
+            if (!cJSON_GetObjectItemCaseSensitive(json, field)) {
+                result = invalid(error, error_size, "%s: the request body is missing \"%s\"",
+                                 op_id, field);
+            }
+        }
+    }
+    
+    cJSON_Delete(json);
+    return result;
+}
+
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+    bool failed;
+} invoke_buffer_t;
+
+static void invoke_append(invoke_buffer_t *buffer, const char *data, size_t len) {
+    if (buffer->failed) {
+        return;
+    }
+    
+    if (buffer->length + len + 1 > buffer->capacity) {
+        size_t capacity = buffer->capacity ? buffer->capacity : 256;
+        while (capacity < buffer->length + len + 1) {
+            capacity *= 2;
+        }
+        char *data_new = do_realloc(buffer->data, capacity);
+        if (!data_new) {
+            buffer->failed = true;
+            return;
+        }
+        buffer->data = data_new;
+        buffer->capacity = capacity;
+    }
+    
+    memcpy(buffer->data + buffer->length, data, len);
+    buffer->length += len;
+    buffer->data[buffer->length] = '\0';
+}
+
+static void invoke_append_escaped(invoke_buffer_t *buffer, const char *value, size_t len) {
+    char *escaped = curl_easy_escape(NULL, value, (int)len);
+    if (!escaped) {
+        buffer->failed = true;
+        return;
+    }
+    invoke_append(buffer, escaped, strlen(escaped));
+    curl_free(escaped);
+}
+
+// Fills in the path template and appends the query string
+static do_result_t build_path(const do_operation_t *op, const do_param_t *params,
+                              size_t param_count, invoke_buffer_t *path) {
+    const char *rest = do_optable_strings + op->path;
+    while (*rest) {
+        const char *open = strchr(rest, '{');
+        const char *close = open ? strchr(open, '}') : NULL;
+        if (!close) {
+            invoke_append(path, rest, strlen(rest));
+            break;
+        }
+        
+        invoke_append(path, rest, (size_t)(open - rest));
+        size_t name_len = (size_t)(close - open - 1);
+        for (size_t i = 0; i < param_count; i++) {
+            const char *name = params[i].name;
+            if (strlen(name) == name_len && strncmp(name, open + 1, name_len) == 0) {
+                invoke_append_escaped(path, params[i].value, strlen(params[i].value));
+                break;
+            }
+        }
+        rest = close + 1;
+    }
+    
+    char separator = '?';
+    for (size_t i = 0; i < param_count; i++) {
+        const do_optable_param_t *param = find_param(op, params[i].name);
+        if (param->location != DO_PARAM_QUERY) {
+            continue;
+        }
+        
+        // Arrays go out as one name=item pair per item
+        const char *value = params[i].value;
+        do {
+            size_t len = param->kind == DO_PARAM_ARRAY ? strcspn(value, ",") : strlen(value);
+            invoke_append(path, &separator, 1);
+            invoke_append_escaped(path, params[i].name, strlen(params[i].name));
+            invoke_append(path, "=", 1);
+            invoke_append_escaped(path, value, len);
+            separator = '&';
+            value += len;
+        } while (*value++ == ',');
+    }
+    
+    return path->failed ? DO_ERROR_MEMORY : DO_SUCCESS;
+}
+
+do_result_t do_client_invoke(do_client_t *client, const do_operation_t *op,
+                             const do_param_t *params, size_t param_count, const char *body,
+                             int fd, unsigned flags) {
+    if (!client) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    do_result_t result = do_operation_validate(op, params, param_count, body, NULL, 0);
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    
+    invoke_buffer_t path = {0};
+    result = build_path(op, params, param_count, &path);
+    
+    struct curl_slist *headers = NULL;
+    for (size_t i = 0; result == DO_SUCCESS && i < param_count; i++) {
+        if (find_param(op, params[i].name)->location != DO_PARAM_HEADER) {
+            continue;
+        }
+        
+        invoke_buffer_t line = {0};
+        invoke_append(&line, params[i].name, strlen(params[i].name));
+        invoke_append(&line, ": ", 2);
+        invoke_append(&line, params[i].value, strlen(params[i].value));
+        struct curl_slist *appended = line.failed ? NULL : curl_slist_append(headers, line.data);
+        do_free(line.data);
+        if (!appended) {
+            result = DO_ERROR_MEMORY;
+            break;
+        }
+        headers = appended;
+    }
+    
+    if (result == DO_SUCCESS) {
+        result = do_client_raw_with_headers(client, do_optable_strings + op->method, path.data,
+                                            headers, body, fd, flags);
+    }
+    
+    curl_slist_free_all(headers);
+    do_free(path.data);
+    return result;
+}
\ No newline at end of file
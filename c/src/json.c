@@ -1,7 +1,10 @@
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <cjson/cjson.h>
 #include "digitalocean/types.h"
+#include "digitalocean/alloc.h"
+#include "json_internal.h"
 
 // Helper function to safely get string from JSON
 static char *json_get_string(const cJSON *json, const char *key) {
@@ -9,7 +12,7 @@ static char *json_get_string(const cJSON *json, const char *key) {
     if (!cJSON_IsString(item) || item->valuestring == NULL) {
         return NULL;
     }
-    return strdup(item->valuestring);
+    return do_strdup(item->valuestring);
 }
 
 // Helper function to safely get number from JSON
@@ -30,6 +33,25 @@ static bool json_get_bool(const cJSON *json, const char *key, bool default_value
     return cJSON_IsTrue(item);
 }
 
+// Parse an RFC 3339 UTC timestamp ("2020-07-21T18:37:44Z"); 0 if malformed
+static time_t json_parse_timestamp(const char *value) {
+    int year, month, day, hour, minute, second;
+    if (sscanf(value, "%4d-%2d-%2dT%2d:%2d:%2d", &year, &month, &day, &hour, &minute, &second) != 6) {
+        return 0;
+    }
+    
+    // Days since 1970-01-01 for the proleptic Gregorian calendar; avoids
+    // timegm(), which is not part of C99/POSIX
+    int y = year - (month <= 2);
+    int era = (y >= 0 ? y : y - 399) / 400;
+    int yoe = y - era * 400;
+    int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    long days = (long)era * 146097 + doe - 719468;
+    
+    return (time_t)(days * 86400L + hour * 3600L + minute * 60L + second);
+}
+
 // Parse string array from JSON
 static do_result_t json_parse_string_array(const cJSON *json, const char *key, 
                                            do_string_array_t *array) {
@@ -51,7 +73,7 @@ static do_result_t json_parse_string_array(const cJSON *json, const char *key,
 }
 
 // Parse region from JSON
-static do_result_t json_parse_region(const cJSON *json, do_region_t *region) {
+do_result_t json_parse_region(const cJSON *json, do_region_t *region) {
     if (!json || !region) {
         return DO_ERROR_INVALID_PARAM;
     }
@@ -70,7 +92,7 @@ static do_result_t json_parse_region(const cJSON *json, do_region_t *region) {
 }
 
 // Parse size from JSON
-static do_result_t json_parse_size(const cJSON *json, do_size_t *size) {
+do_result_t json_parse_size(const cJSON *json, do_size_t *size) {
     if (!json || !size) {
         return DO_ERROR_INVALID_PARAM;
     }
@@ -90,6 +112,38 @@ static do_result_t json_parse_size(const cJSON *json, do_size_t *size) {
     return DO_SUCCESS;
 }
 
+// Parse image from JSON
+do_result_t json_parse_image(const cJSON *json, do_image_t *image) {
+    if (!json || !image) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    image->id = (uint32_t)json_get_number(json, "id", 0);
+    image->name = json_get_string(json, "name");
+    image->type = json_get_string(json, "type");
+    image->distribution = json_get_string(json, "distribution");
+    image->slug = json_get_string(json, "slug");
+    image->is_public = json_get_bool(json, "public", false);
+    image->min_disk_size = (uint32_t)json_get_number(json, "min_disk_size", 0);
+    image->size_gigabytes = json_get_number(json, "size_gigabytes", 0.0);
+    image->description = json_get_string(json, "description");
+    image->status = json_get_string(json, "status");
+    image->error_message = json_get_string(json, "error_message");
+    
+    const cJSON *created_json = cJSON_GetObjectItemCaseSensitive(json, "created_at");
+    if (cJSON_IsString(created_json) && created_json->valuestring) {
+        image->created_at = json_parse_timestamp(created_json->valuestring);
+    }
+    
+    do_string_array_init(&image->regions);
+    json_parse_string_array(json, "regions", &image->regions);
+    
+    do_string_array_init(&image->tags);
+    json_parse_string_array(json, "tags", &image->tags);
+    
+    return DO_SUCCESS;
+}
+
 // Parse networks from JSON
 static do_result_t json_parse_networks(const cJSON *json, do_networks_t *networks) {
     if (!json || !networks) {
@@ -101,7 +155,7 @@ static do_result_t json_parse_networks(const cJSON *json, do_networks_t *network
     if (cJSON_IsArray(v4_array)) {
         networks->v4_count = cJSON_GetArraySize(v4_array);
         if (networks->v4_count > 0) {
-            networks->v4 = calloc(networks->v4_count, sizeof(do_network_v4_t));
+            networks->v4 = do_calloc(networks->v4_count, sizeof(do_network_v4_t));
             if (!networks->v4) {
                 return DO_ERROR_MEMORY;
             }
@@ -123,7 +177,7 @@ static do_result_t json_parse_networks(const cJSON *json, do_networks_t *network
     if (cJSON_IsArray(v6_array)) {
         networks->v6_count = cJSON_GetArraySize(v6_array);
         if (networks->v6_count > 0) {
-            networks->v6 = calloc(networks->v6_count, sizeof(do_network_v6_t));
+            networks->v6 = do_calloc(networks->v6_count, sizeof(do_network_v6_t));
             if (!networks->v6) {
                 return DO_ERROR_MEMORY;
             }
@@ -159,18 +213,15 @@ do_result_t json_parse_droplet(const cJSON *json, do_droplet_t *droplet) {
     droplet->size_slug = json_get_string(json, "size_slug");
     droplet->vpc_uuid = json_get_string(json, "vpc_uuid");
     
-    // Parse created_at (simplified - would need proper ISO 8601 parsing)
-    const char *created_str = json_get_string(json, "created_at");
-    if (created_str) {
-        // This is a simplified parsing - in production, use strptime or similar
-        droplet->created_at = time(NULL); // Placeholder
-        free((char*)created_str);
+    const cJSON *created_json = cJSON_GetObjectItemCaseSensitive(json, "created_at");
+    if (cJSON_IsString(created_json) && created_json->valuestring) {
+        droplet->created_at = json_parse_timestamp(created_json->valuestring);
     }
     
     // Parse nested objects
     const cJSON *region_json = cJSON_GetObjectItemCaseSensitive(json, "region");
     if (region_json) {
-        droplet->region = calloc(1, sizeof(do_region_t));
+        droplet->region = do_calloc(1, sizeof(do_region_t));
         if (droplet->region) {
             json_parse_region(region_json, droplet->region);
         }
@@ -178,7 +229,7 @@ do_result_t json_parse_droplet(const cJSON *json, do_droplet_t *droplet) {
     
     const cJSON *size_json = cJSON_GetObjectItemCaseSensitive(json, "size");
     if (size_json) {
-        droplet->size = calloc(1, sizeof(do_size_t));
+        droplet->size = do_calloc(1, sizeof(do_size_t));
         if (droplet->size) {
             json_parse_size(size_json, droplet->size);
         }
@@ -186,7 +237,7 @@ do_result_t json_parse_droplet(const cJSON *json, do_droplet_t *droplet) {
     
     const cJSON *networks_json = cJSON_GetObjectItemCaseSensitive(json, "networks");
     if (networks_json) {
-        droplet->networks = calloc(1, sizeof(do_networks_t));
+        droplet->networks = do_calloc(1, sizeof(do_networks_t));
         if (droplet->networks) {
             json_parse_networks(networks_json, droplet->networks);
         }
@@ -205,6 +256,265 @@ do_result_t json_parse_droplet(const cJSON *json, do_droplet_t *droplet) {
     return DO_SUCCESS;
 }
 
+// The droplet decoders again, reading fields straight from the page text
+// through the on-demand index (json_ondemand.c) instead of a cJSON tree.
+// They fill in exactly what the cJSON versions do.
+static char *json_od_get_string(const json_od_value_t *json, const char *key) {
+    json_od_value_t item;
+    return json_od_find(json, key, &item) ? json_od_strdup(&item) : NULL;
+}
+
+static double json_od_get_number(const json_od_value_t *json, const char *key, double default_value) {
+    json_od_value_t item;
+    double value;
+    return json_od_find(json, key, &item) && json_od_number(&item, &value) ? value : default_value;
+}
+
+static bool json_od_get_bool(const json_od_value_t *json, const char *key, bool default_value) {
+    json_od_value_t item;
+    bool value;
+    return json_od_find(json, key, &item) && json_od_bool(&item, &value) ? value : default_value;
+}
+
+// do_string_array_add() without the copy: the array takes value over
+static do_result_t json_od_string_array_take(do_string_array_t *array, char *value) {
+    if (array->count >= array->capacity) {
+        size_t capacity = array->capacity ? array->capacity * 2 : 4;
+        char **items = do_realloc(array->items, capacity * sizeof(char *));
+        if (!items) {
+            do_free(value);
+            return DO_ERROR_MEMORY;
+        }
+        array->items = items;
+        array->capacity = capacity;
+    }
+    
+    array->items[array->count++] = value;
+    return DO_SUCCESS;
+}
+
+static do_result_t json_od_parse_string_array(const json_od_value_t *json, const char *key,
+                                              do_string_array_t *array) {
+    json_od_value_t json_array, item;
+    if (!json_od_find(json, key, &json_array)) {
+        return DO_SUCCESS; // Empty array is OK
+    }
+    
+    for (bool more = json_od_first(&json_array, &item); more; more = json_od_next(&item)) {
+        if (!json_od_is_string(&item)) {
+            continue;
+        }
+        char *value = json_od_strdup(&item);
+        if (!value || json_od_string_array_take(array, value) != DO_SUCCESS) {
+            return DO_ERROR_MEMORY;
+        }
+    }
+    
+    return DO_SUCCESS;
+}
+
+static void json_od_parse_region(const json_od_value_t *json, do_region_t *region) {
+    region->name = json_od_get_string(json, "name");
+    region->slug = json_od_get_string(json, "slug");
+    region->available = json_od_get_bool(json, "available", false);
+    
+    do_string_array_init(&region->features);
+    json_od_parse_string_array(json, "features", &region->features);
+    
+    do_string_array_init(&region->sizes);
+    json_od_parse_string_array(json, "sizes", &region->sizes);
+}
+
+static void json_od_parse_size(const json_od_value_t *json, do_size_t *size) {
+    size->slug = json_od_get_string(json, "slug");
+    size->memory = (uint32_t)json_od_get_number(json, "memory", 0);
+    size->vcpus = (uint32_t)json_od_get_number(json, "vcpus", 0);
+    size->disk = (uint32_t)json_od_get_number(json, "disk", 0);
+    size->transfer = json_od_get_number(json, "transfer", 0.0);
+    size->price_monthly = json_od_get_number(json, "price_monthly", 0.0);
+    size->price_hourly = json_od_get_number(json, "price_hourly", 0.0);
+    size->available = json_od_get_bool(json, "available", false);
+    
+    do_string_array_init(&size->regions);
+    json_od_parse_string_array(json, "regions", &size->regions);
+}
+
+static do_result_t json_od_parse_networks(const json_od_value_t *json, do_networks_t *networks) {
+    json_od_value_t v4_array, v6_array, item;
+    
+    // Parse IPv4 networks
+    if (json_od_find(json, "v4", &v4_array) && json_od_is_array(&v4_array)) {
+        networks->v4_count = json_od_count(&v4_array);
+        if (networks->v4_count > 0) {
+            networks->v4 = do_calloc(networks->v4_count, sizeof(do_network_v4_t));
+            if (!networks->v4) {
+                return DO_ERROR_MEMORY;
+            }
+            
+            size_t i = 0;
+            for (bool more = json_od_first(&v4_array, &item); more; more = json_od_next(&item)) {
+                networks->v4[i].ip_address = json_od_get_string(&item, "ip_address");
+                networks->v4[i].netmask = json_od_get_string(&item, "netmask");
+                networks->v4[i].gateway = json_od_get_string(&item, "gateway");
+                networks->v4[i].type = json_od_get_string(&item, "type");
+                i++;
+            }
+        }
+    }
+    
+    // Parse IPv6 networks
+    if (json_od_find(json, "v6", &v6_array) && json_od_is_array(&v6_array)) {
+        networks->v6_count = json_od_count(&v6_array);
+        if (networks->v6_count > 0) {
+            networks->v6 = do_calloc(networks->v6_count, sizeof(do_network_v6_t));
+            if (!networks->v6) {
+                return DO_ERROR_MEMORY;
+            }
+            
+            size_t i = 0;
+            for (bool more = json_od_first(&v6_array, &item); more; more = json_od_next(&item)) {
+                networks->v6[i].ip_address = json_od_get_string(&item, "ip_address");
+                networks->v6[i].netmask = (uint32_t)json_od_get_number(&item, "netmask", 0);
+                networks->v6[i].gateway = json_od_get_string(&item, "gateway");
+                networks->v6[i].type = json_od_get_string(&item, "type");
+                i++;
+            }
+        }
+    }
+    
+    return DO_SUCCESS;
+}
+
+do_result_t json_od_parse_droplet(const json_od_value_t *json, do_droplet_t *droplet) {
+    if (!json || !droplet) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    droplet->id = (uint32_t)json_od_get_number(json, "id", 0);
+    droplet->name = json_od_get_string(json, "name");
+    droplet->memory = (uint32_t)json_od_get_number(json, "memory", 0);
+    droplet->vcpus = (uint32_t)json_od_get_number(json, "vcpus", 0);
+    droplet->disk = (uint32_t)json_od_get_number(json, "disk", 0);
+    droplet->locked = json_od_get_bool(json, "locked", false);
+    droplet->status = json_od_get_string(json, "status");
+    droplet->size_slug = json_od_get_string(json, "size_slug");
+    droplet->vpc_uuid = json_od_get_string(json, "vpc_uuid");
+    
+    char *created = json_od_get_string(json, "created_at");
+    if (created) {
+        droplet->created_at = json_parse_timestamp(created);
+        do_free(created);
+    }
+    
+    // Parse nested objects
+    json_od_value_t nested;
+    if (json_od_find(json, "region", &nested)) {
+        droplet->region = do_calloc(1, sizeof(do_region_t));
+        if (droplet->region) {
+            json_od_parse_region(&nested, droplet->region);
+        }
+    }
+    
+    if (json_od_find(json, "size", &nested)) {
+        droplet->size = do_calloc(1, sizeof(do_size_t));
+        if (droplet->size) {
+            json_od_parse_size(&nested, droplet->size);
+        }
+    }
+    
+    if (json_od_find(json, "networks", &nested)) {
+        droplet->networks = do_calloc(1, sizeof(do_networks_t));
+        if (droplet->networks) {
+            json_od_parse_networks(&nested, droplet->networks);
+        }
+    }
+    
+    // Parse string arrays
+    do_string_array_init(&droplet->features);
+    json_od_parse_string_array(json, "features", &droplet->features);
+    
+    do_string_array_init(&droplet->tags);
+    json_od_parse_string_array(json, "tags", &droplet->tags);
+    
+    do_string_array_init(&droplet->volume_ids);
+    json_od_parse_string_array(json, "volume_ids", &droplet->volume_ids);
+    
+    return DO_SUCCESS;
+}
+
+static do_str_view_t json_od_get_view(const json_od_value_t *json, const char *key) {
+    json_od_value_t item;
+    do_str_view_t view = {0};
+    if (json_od_find(json, key, &item)) {
+        json_od_view(&item, &view);
+    }
+    return view;
+}
+
+// Room json_od_parse_droplet_view() needs for the droplet's tags
+size_t json_od_droplet_view_tags(const json_od_value_t *json) {
+    json_od_value_t tags;
+    return json_od_find(json, "tags", &tags) ? json_od_count(&tags) : 0;
+}
+
+// The listing fields of a droplet as views into the document's text;
+// nothing is allocated. The tags go to tags, which has room for
+// json_od_droplet_view_tags() of them.
+do_result_t json_od_parse_droplet_view(const json_od_value_t *json, do_droplet_view_t *view,
+                                       do_str_view_t *tags) {
+    if (!json || !view) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    view->id = (uint32_t)json_od_get_number(json, "id", 0);
+    view->name = json_od_get_view(json, "name");
+    view->memory = (uint32_t)json_od_get_number(json, "memory", 0);
+    view->vcpus = (uint32_t)json_od_get_number(json, "vcpus", 0);
+    view->disk = (uint32_t)json_od_get_number(json, "disk", 0);
+    view->locked = json_od_get_bool(json, "locked", false);
+    view->status = json_od_get_view(json, "status");
+    view->size_slug = json_od_get_view(json, "size_slug");
+    view->vpc_uuid = json_od_get_view(json, "vpc_uuid");
+    
+    // The text stays NUL-terminated past the view, which is all sscanf() needs
+    do_str_view_t created = json_od_get_view(json, "created_at");
+    if (created.data && !created.escaped) {
+        view->created_at = json_parse_timestamp(created.data);
+    }
+    
+    json_od_value_t nested, item;
+    if (json_od_find(json, "region", &nested)) {
+        view->region = json_od_get_view(&nested, "slug");
+    }
+    if (json_od_find(json, "image", &nested)) {
+        view->image = json_od_get_view(&nested, "slug");
+    }
+    
+    json_od_value_t networks;
+    if (json_od_find(json, "networks", &networks) && json_od_find(&networks, "v4", &nested)) {
+        for (bool more = json_od_first(&nested, &item); more; more = json_od_next(&item)) {
+            do_str_view_t type = json_od_get_view(&item, "type");
+            if (!view->public_ipv4.data && do_str_view_equals(&type, "public")) {
+                view->public_ipv4 = json_od_get_view(&item, "ip_address");
+            } else if (!view->private_ipv4.data && do_str_view_equals(&type, "private")) {
+                view->private_ipv4 = json_od_get_view(&item, "ip_address");
+            }
+        }
+    }
+    
+    view->tags = tags;
+    view->tags_count = 0;
+    if (tags && json_od_find(json, "tags", &nested)) {
+        for (bool more = json_od_first(&nested, &item); more; more = json_od_next(&item)) {
+            if (json_od_view(&item, &tags[view->tags_count])) {
+                view->tags_count++;
+            }
+        }
+    }
+    
+    return DO_SUCCESS;
+}
+
 // Parse account from JSON
 do_result_t json_parse_account(const cJSON *json, do_account_t *account) {
     if (!json || !account) {
@@ -223,7 +533,7 @@ do_result_t json_parse_account(const cJSON *json, do_account_t *account) {
     // Parse team if present
     const cJSON *team_json = cJSON_GetObjectItemCaseSensitive(json, "team");
     if (team_json) {
-        account->team = calloc(1, sizeof(do_team_t));
+        account->team = do_calloc(1, sizeof(do_team_t));
         if (account->team) {
             account->team->uuid = json_get_string(team_json, "uuid");
             account->team->name = json_get_string(team_json, "name");
@@ -231,4 +541,477 @@ do_result_t json_parse_account(const cJSON *json, do_account_t *account) {
     }
     
     return DO_SUCCESS;
+}
+
+// Parse action from JSON
+do_result_t json_parse_action(const cJSON *json, do_action_t *action) {
+    if (!json || !action) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    action->id = (uint32_t)json_get_number(json, "id", 0);
+    action->status = json_get_string(json, "status");
+    action->type = json_get_string(json, "type");
+    action->resource_id = (uint32_t)json_get_number(json, "resource_id", 0);
+    action->resource_type = json_get_string(json, "resource_type");
+    action->region_slug = json_get_string(json, "region_slug");
+    
+    const cJSON *started_json = cJSON_GetObjectItemCaseSensitive(json, "started_at");
+    if (cJSON_IsString(started_json) && started_json->valuestring) {
+        action->started_at = json_parse_timestamp(started_json->valuestring);
+    }
+    
+    const cJSON *completed_json = cJSON_GetObjectItemCaseSensitive(json, "completed_at");
+    if (cJSON_IsString(completed_json) && completed_json->valuestring) {
+        action->completed_at = json_parse_timestamp(completed_json->valuestring);
+    }
+    
+    return DO_SUCCESS;
+}
+
+// Serialize a create-droplet request body. Booleans are always sent so the
+// API never has to guess at defaults; optional strings and empty arrays are
+// left out.
+do_result_t json_write_create_droplet_request(json_writer_t *writer,
+                                              const do_create_droplet_request_t *request) {
+    if (!writer || !request) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    json_writer_begin_object(writer);
+    json_writer_member_string(writer, "name", request->name);
+    json_writer_member_string(writer, "region", request->region);
+    json_writer_member_string(writer, "size", request->size);
+    
+    // Images are addressed by slug or by numeric ID
+    if (request->image) {
+        json_writer_key(writer, "image");
+        json_writer_id_or_string(writer, request->image);
+    }
+    
+    // SSH keys likewise take either an ID or a fingerprint
+    if (request->ssh_keys.count > 0) {
+        json_writer_key(writer, "ssh_keys");
+        json_writer_begin_array(writer);
+        for (size_t i = 0; i < request->ssh_keys.count; i++) {
+            json_writer_id_or_string(writer, request->ssh_keys.items[i]);
+        }
+        json_writer_end_array(writer);
+    }
+    
+    json_writer_member_bool(writer, "backups", request->backups);
+    json_writer_member_bool(writer, "ipv6", request->ipv6);
+    json_writer_member_bool(writer, "monitoring", request->monitoring);
+    json_writer_member_bool(writer, "private_networking", request->private_networking);
+    json_writer_member_string_array(writer, "tags", &request->tags);
+    json_writer_member_string(writer, "user_data", request->user_data);
+    json_writer_member_string_array(writer, "volumes", &request->volumes);
+    json_writer_member_string(writer, "vpc_uuid", request->vpc_uuid);
+    json_writer_end_object(writer);
+    
+    return json_writer_finish(writer);
+}
+
+// Incremental scanner that picks links.pages.next out of a response body as
+// it streams past, without building a DOM. Chunk boundaries may fall
+// anywhere, including inside strings and escape sequences.
+#define JSON_SCAN_MAX_DEPTH 64
+#define JSON_SCAN_KEY_MAX 16
+#define JSON_SCAN_URL_MAX 2048
+
+typedef enum {
+    JSON_CAPTURE_NONE,
+    JSON_CAPTURE_KEY,
+    JSON_CAPTURE_NEXT
+} json_capture_t;
+
+struct json_next_scanner {
+    int depth;
+    uint64_t object_levels;   // bit n set when the container at depth n is an object
+    bool expect_key;
+    bool in_string;
+    bool escaped;
+    int unicode_digits;       // hex digits still expected after \u
+    unsigned unicode_value;
+    json_capture_t capture;
+    bool capture_overflow;
+    char keys[4][JSON_SCAN_KEY_MAX]; // most recent key at depths 1-3
+    char buffer[JSON_SCAN_URL_MAX];
+    size_t length;
+    char next[JSON_SCAN_URL_MAX];
+    bool has_next;
+};
+
+json_next_scanner_t *json_next_scanner_new(void) {
+    return do_calloc(1, sizeof(json_next_scanner_t));
+}
+
+void json_next_scanner_reset(json_next_scanner_t *scanner) {
+    memset(scanner, 0, sizeof(*scanner));
+}
+
+void json_next_scanner_free(json_next_scanner_t *scanner) {
+    do_free(scanner);
+}
+
+const char *json_next_scanner_next(const json_next_scanner_t *scanner) {
+    return scanner->has_next ? scanner->next : NULL;
+}
+
+static void json_scan_capture(json_next_scanner_t *scanner, char c) {
+    size_t limit = scanner->capture == JSON_CAPTURE_KEY ? JSON_SCAN_KEY_MAX : JSON_SCAN_URL_MAX;
+    if (scanner->length + 1 >= limit) {
+        scanner->capture_overflow = true;
+        return;
+    }
+    scanner->buffer[scanner->length++] = c;
+}
+
+static void json_scan_string_end(json_next_scanner_t *scanner) {
+    scanner->buffer[scanner->length] = '\0';
+    
+    if (scanner->capture == JSON_CAPTURE_KEY) {
+        // An oversized key cannot match anything we look for
+        strcpy(scanner->keys[scanner->depth], scanner->capture_overflow ? "" : scanner->buffer);
+    } else if (scanner->capture == JSON_CAPTURE_NEXT && !scanner->capture_overflow) {
+        memcpy(scanner->next, scanner->buffer, scanner->length + 1);
+        scanner->has_next = scanner->length > 0;
+    }
+    
+    scanner->capture = JSON_CAPTURE_NONE;
+}
+
+static void json_scan_string_start(json_next_scanner_t *scanner) {
+    scanner->in_string = true;
+    scanner->length = 0;
+    scanner->capture_overflow = false;
+    scanner->capture = JSON_CAPTURE_NONE;
+    
+    if (scanner->expect_key) {
+        if (scanner->depth >= 1 && scanner->depth <= 3) {
+            scanner->capture = JSON_CAPTURE_KEY;
+        }
+    } else if (scanner->depth == 3 &&
+               strcmp(scanner->keys[1], "links") == 0 &&
+               strcmp(scanner->keys[2], "pages") == 0 &&
+               strcmp(scanner->keys[3], "next") == 0) {
+        scanner->capture = JSON_CAPTURE_NEXT;
+    }
+}
+
+static bool json_scan_is_object(const json_next_scanner_t *scanner) {
+    return scanner->depth > 0 && scanner->depth < JSON_SCAN_MAX_DEPTH &&
+           (scanner->object_levels >> scanner->depth) & 1;
+}
+
+void json_next_scanner_feed(json_next_scanner_t *scanner, const char *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        char c = data[i];
+        
+        if (scanner->in_string) {
+            if (scanner->unicode_digits > 0) {
+                int digit = (c >= '0' && c <= '9') ? c - '0' :
+                            (c >= 'a' && c <= 'f') ? c - 'a' + 10 :
+                            (c >= 'A' && c <= 'F') ? c - 'A' + 10 : -1;
+                if (digit < 0) {
+                    scanner->capture_overflow = true;
+                    scanner->unicode_digits = 0;
+                    continue;
+                }
+                
+                scanner->unicode_value = (scanner->unicode_value << 4) | (unsigned)digit;
+                if (--scanner->unicode_digits == 0) {
+                    // URLs and keys are ASCII; anything else cannot match
+                    if (scanner->unicode_value < 0x80 && scanner->unicode_value != 0) {
+                        json_scan_capture(scanner, (char)scanner->unicode_value);
+                    } else {
+                        scanner->capture_overflow = true;
+                    }
+                }
+            } else if (scanner->escaped) {
+                scanner->escaped = false;
+                if (c == 'u') {
+                    scanner->unicode_digits = 4;
+                    scanner->unicode_value = 0;
+                } else if (c == '"' || c == '\\' || c == '/') {
+                    json_scan_capture(scanner, c);
+                } else {
+                    scanner->capture_overflow = true;
+                }
+            } else if (c == '\\') {
+                scanner->escaped = true;
+            } else if (c == '"') {
+                scanner->in_string = false;
+                json_scan_string_end(scanner);
+            } else if (scanner->capture != JSON_CAPTURE_NONE) {
+                json_scan_capture(scanner, c);
+            }
+            continue;
+        }
+        
+        switch (c) {
+            case '{':
+            case '[':
+                scanner->depth++;
+                if (scanner->depth < JSON_SCAN_MAX_DEPTH) {
+                    if (c == '{') {
+                        scanner->object_levels |= (uint64_t)1 << scanner->depth;
+                    } else {
+                        scanner->object_levels &= ~((uint64_t)1 << scanner->depth);
+                    }
+                }
+                if (scanner->depth <= 3) {
+                    scanner->keys[scanner->depth][0] = '\0';
+                }
+                scanner->expect_key = (c == '{');
+                break;
+            case '}':
+            case ']':
+                if (scanner->depth > 0) {
+                    scanner->depth--;
+                }
+                scanner->expect_key = false;
+                break;
+            case ',':
+                scanner->expect_key = json_scan_is_object(scanner);
+                break;
+            case ':':
+                scanner->expect_key = false;
+                break;
+            case '"':
+                json_scan_string_start(scanner);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static size_t json_skip_space(const char *data, size_t len, size_t i) {
+    while (i < len && (data[i] == ' ' || data[i] == '\t' || data[i] == '\n' || data[i] == '\r')) {
+        i++;
+    }
+    return i;
+}
+
+// Monitoring responses are Prometheus-style matrices:
+//   {"status":"success","data":{"resultType":"matrix","result":[
+//     {"metric":{"host_id":"1","mode":"idle"},"values":[[1700000000,"0.5"],...]},...]}}
+// Each series' labels are parsed with cJSON, but its samples are decoded
+// straight from the text in batches, with no object built per point.
+// data must be NUL-terminated.
+
+#define JSON_METRIC_BATCH 256
+
+// Index just past the string that opens at data[i]
+static size_t json_skip_string(const char *data, size_t len, size_t i) {
+    for (i++; i < len; i++) {
+        if (data[i] == '\\') {
+            i++;
+        } else if (data[i] == '"') {
+            return i + 1;
+        }
+    }
+    return len;
+}
+
+// Index just past the value that starts at data[i]
+static size_t json_skip_value(const char *data, size_t len, size_t i) {
+    if (i >= len) {
+        return len;
+    }
+    if (data[i] == '"') {
+        return json_skip_string(data, len, i);
+    }
+    if (data[i] != '{' && data[i] != '[') {
+        while (i < len && data[i] != ',' && data[i] != '}' && data[i] != ']') {
+            i++;
+        }
+        return i;
+    }
+    
+    int depth = 0;
+    while (i < len) {
+        if (data[i] == '"') {
+            i = json_skip_string(data, len, i);
+            continue;
+        }
+        if (data[i] == '{' || data[i] == '[') {
+            depth++;
+        } else if ((data[i] == '}' || data[i] == ']') && --depth == 0) {
+            return i + 1;
+        }
+        i++;
+    }
+    return len;
+}
+
+// Index of the value stored under key in the object that starts at
+// data[start], or end when the key is absent
+static size_t json_find_member(const char *data, size_t start, size_t end, const char *key) {
+    size_t key_len = strlen(key);
+    size_t i = json_skip_space(data, end, start);
+    if (i >= end || data[i] != '{') {
+        return end;
+    }
+    
+    for (i++; ; i++) {
+        i = json_skip_space(data, end, i);
+        if (i >= end || data[i] != '"') {
+            return end;
+        }
+        
+        size_t key_start = i + 1;
+        i = json_skip_string(data, end, i);
+        if (i >= end) {
+            return end;
+        }
+        size_t key_end = i - 1;
+        
+        i = json_skip_space(data, end, i);
+        if (i >= end || data[i] != ':') {
+            return end;
+        }
+        i = json_skip_space(data, end, i + 1);
+        if (key_end - key_start == key_len && memcmp(data + key_start, key, key_len) == 0) {
+            return i;
+        }
+        
+        i = json_skip_space(data, end, json_skip_value(data, end, i));
+        if (i >= end || data[i] != ',') {
+            return end;
+        }
+    }
+}
+
+static do_result_t json_scan_metric_values(const char *data, size_t end, size_t i, void *series,
+                                           json_metric_points_fn points, void *userdata) {
+    int64_t timestamps[JSON_METRIC_BATCH];
+    double values[JSON_METRIC_BATCH];
+    size_t count = 0;
+    
+    if (i >= end || data[i] != '[') {
+        return DO_ERROR_JSON;
+    }
+    
+    for (i++; ; ) {
+        i = json_skip_space(data, end, i);
+        if (i >= end) {
+            return DO_ERROR_JSON;
+        }
+        if (data[i] == ']') {
+            break;
+        }
+        if (data[i] == ',') {
+            i++;
+            continue;
+        }
+        if (data[i] != '[') {
+            return DO_ERROR_JSON;
+        }
+        
+        // [timestamp, "value"]; the value is quoted so NaN and Inf survive
+        char *next;
+        i = json_skip_space(data, end, i + 1);
+        double timestamp = strtod(data + i, &next);
+        if (next == data + i) {
+            return DO_ERROR_JSON;
+        }
+        
+        i = json_skip_space(data, end, (size_t)(next - data));
+        if (i >= end || data[i] != ',') {
+            return DO_ERROR_JSON;
+        }
+        i = json_skip_space(data, end, i + 1);
+        
+        bool quoted = i < end && data[i] == '"';
+        if (quoted) {
+            i++;
+        }
+        double value = strtod(data + i, &next);
+        if (next == data + i) {
+            return DO_ERROR_JSON;
+        }
+        i = (size_t)(next - data);
+        if (quoted) {
+            if (i >= end || data[i] != '"') {
+                return DO_ERROR_JSON;
+            }
+            i++;
+        }
+        
+        i = json_skip_space(data, end, i);
+        if (i >= end || data[i] != ']') {
+            return DO_ERROR_JSON;
+        }
+        i++;
+        
+        timestamps[count] = (int64_t)timestamp;
+        values[count] = value;
+        if (++count == JSON_METRIC_BATCH) {
+            do_result_t result = points(series, timestamps, values, count, userdata);
+            if (result != DO_SUCCESS) {
+                return result;
+            }
+            count = 0;
+        }
+    }
+    
+    return count ? points(series, timestamps, values, count, userdata) : DO_SUCCESS;
+}
+
+do_result_t json_scan_metric_matrix(const char *data, size_t len, json_metric_series_fn open_series,
+                                    json_metric_points_fn points, void *userdata) {
+    size_t at = json_find_member(data, 0, len, "data");
+    if (at >= len) {
+        return DO_ERROR_JSON;
+    }
+    
+    size_t data_end = json_skip_value(data, len, at);
+    at = json_find_member(data, at, data_end, "result");
+    if (at >= data_end || data[at] != '[') {
+        return DO_ERROR_JSON;
+    }
+    
+    for (size_t i = at + 1; ; ) {
+        i = json_skip_space(data, data_end, i);
+        if (i >= data_end) {
+            return DO_ERROR_JSON;
+        }
+        if (data[i] == ']') {
+            return DO_SUCCESS;
+        }
+        if (data[i] == ',') {
+            i++;
+            continue;
+        }
+        if (data[i] != '{') {
+            return DO_ERROR_JSON;
+        }
+        
+        size_t item_end = json_skip_value(data, data_end, i);
+        size_t metric_at = json_find_member(data, i, item_end, "metric");
+        size_t values_at = json_find_member(data, i, item_end, "values");
+        if (values_at >= item_end) {
+            return DO_ERROR_JSON;
+        }
+        
+        cJSON *labels = NULL;
+        if (metric_at < item_end) {
+            size_t metric_end = json_skip_value(data, item_end, metric_at);
+            labels = cJSON_ParseWithLength(data + metric_at, metric_end - metric_at);
+        }
+        
+        void *series = NULL;
+        do_result_t result = open_series(labels, &series, userdata);
+        cJSON_Delete(labels);
+        if (result == DO_SUCCESS) {
+            result = json_scan_metric_values(data, item_end, values_at, series, points, userdata);
+        }
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+        
+        i = item_end;
+    }
 }
\ No newline at end of file
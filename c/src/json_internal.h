@@ -0,0 +1,55 @@
+#ifndef DO_JSON_INTERNAL_H
+#define DO_JSON_INTERNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <cjson/cjson.h>
+#include "digitalocean/types.h"
+#include "json_ondemand.h"
+#include "json_writer.h"
+
+// Decoders and scanners shared across the library (json.c)
+
+do_result_t json_parse_region(const cJSON *json, do_region_t *region);
+do_result_t json_parse_size(const cJSON *json, do_size_t *size);
+do_result_t json_parse_image(const cJSON *json, do_image_t *image);
+do_result_t json_parse_droplet(const cJSON *json, do_droplet_t *droplet);
+do_result_t json_parse_account(const cJSON *json, do_account_t *account);
+do_result_t json_parse_action(const cJSON *json, do_action_t *action);
+
+// json_parse_droplet() over an on-demand index instead of a cJSON tree
+do_result_t json_od_parse_droplet(const json_od_value_t *json, do_droplet_t *droplet);
+
+// Room json_od_parse_droplet_view() needs for the droplet's tags
+size_t json_od_droplet_view_tags(const json_od_value_t *json);
+
+// The listing fields of a droplet as views into the document's text;
+// nothing is allocated. The tags go to tags, which has room for
+// json_od_droplet_view_tags() of them.
+do_result_t json_od_parse_droplet_view(const json_od_value_t *json, do_droplet_view_t *view,
+                                       do_str_view_t *tags);
+
+do_result_t json_write_create_droplet_request(json_writer_t *writer,
+                                              const do_create_droplet_request_t *request);
+
+// Streaming scanner for links.pages.next, fed a response as it arrives
+typedef struct json_next_scanner json_next_scanner_t;
+
+json_next_scanner_t *json_next_scanner_new(void);
+void json_next_scanner_reset(json_next_scanner_t *scanner);
+void json_next_scanner_feed(json_next_scanner_t *scanner, const char *data, size_t len);
+const char *json_next_scanner_next(const json_next_scanner_t *scanner); // NULL when absent
+void json_next_scanner_free(json_next_scanner_t *scanner);
+
+// Monitoring matrix scan: open_series is called with each series' labels
+// and sets *series, then points receives its samples in batches. data must
+// be NUL-terminated.
+typedef do_result_t (*json_metric_series_fn)(const cJSON *labels, void **series, void *userdata);
+typedef do_result_t (*json_metric_points_fn)(void *series, const int64_t *timestamps,
+                                             const double *values, size_t count, void *userdata);
+
+do_result_t json_scan_metric_matrix(const char *data, size_t len, json_metric_series_fn open_series,
+                                    json_metric_points_fn points, void *userdata);
+
+#endif // DO_JSON_INTERNAL_H
\ No newline at end of file
@@ -0,0 +1,747 @@
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include "digitalocean/alloc.h"
+#include "json_ondemand.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define JSON_OD_X86 1
+#else
+#define JSON_OD_X86 0
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define JSON_OD_INLINE static inline __attribute__((always_inline))
+#else
+#define JSON_OD_INLINE static inline
+#endif
+
+// Bitmasks for one 64-byte block: bit i describes byte i
+typedef struct {
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t op; // { } [ ] : ,
+} json_od_block_t;
+
+typedef void (*json_od_classify_fn)(const unsigned char *block, json_od_block_t *out);
+
+static const unsigned char json_od_class[256] = {
+    ['"'] = 1, ['\\'] = 2,
+    ['{'] = 4, ['}'] = 4, ['['] = 4, [']'] = 4, [':'] = 4, [','] = 4
+};
+
+JSON_OD_INLINE void json_od_classify_scalar(const unsigned char *block, json_od_block_t *out) {
+    uint64_t quote = 0, backslash = 0, op = 0;
+    for (int i = 0; i < 64; i++) {
+        unsigned char c = json_od_class[block[i]];
+        quote |= (uint64_t)(c & 1) << i;
+        backslash |= (uint64_t)((c >> 1) & 1) << i;
+        op |= (uint64_t)((c >> 2) & 1) << i;
+    }
+    out->quote = quote;
+    out->backslash = backslash;
+    out->op = op;
+}
+
+#if JSON_OD_X86
+
+// One PCMPESTRM per 16 bytes matches the whole operator set
+__attribute__((target("sse4.2")))
+static inline void json_od_classify_sse42(const unsigned char *block, json_od_block_t *out) {
+    const __m128i ops = _mm_setr_epi8('{', '}', '[', ']', ':', ',', 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    
+    uint64_t quote_bits = 0, backslash_bits = 0, op_bits = 0;
+    for (int i = 0; i < 4; i++) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(block + 16 * i));
+        __m128i op = _mm_cmpestrm(ops, 6, chunk, 16,
+                                  _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY | _SIDD_BIT_MASK);
+        op_bits |= (uint64_t)(uint16_t)_mm_cvtsi128_si32(op) << (16 * i);
+        quote_bits |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, quote)) << (16 * i);
+        backslash_bits |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, backslash))
+                          << (16 * i);
+    }
+    out->quote = quote_bits;
+    out->backslash = backslash_bits;
+    out->op = op_bits;
+}
+
+// { and [ differ from } and ] only in bit 5, so setting it leaves four
+// comparisons for the six operators
+__attribute__((target("avx2")))
+static inline void json_od_classify_avx2(const unsigned char *block, json_od_block_t *out) {
+    const __m256i case_bit = _mm256_set1_epi8(0x20);
+    const __m256i open = _mm256_set1_epi8('{');
+    const __m256i close = _mm256_set1_epi8('}');
+    const __m256i colon = _mm256_set1_epi8(':');
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    
+    uint64_t quote_bits = 0, backslash_bits = 0, op_bits = 0;
+    for (int i = 0; i < 2; i++) {
+        __m256i chunk = _mm256_loadu_si256((const __m256i *)(block + 32 * i));
+        __m256i folded = _mm256_or_si256(chunk, case_bit);
+        __m256i op = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(folded, open), _mm256_cmpeq_epi8(folded, close)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, colon), _mm256_cmpeq_epi8(chunk, comma)));
+        op_bits |= (uint64_t)(uint32_t)_mm256_movemask_epi8(op) << (32 * i);
+        quote_bits |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, quote))
+                      << (32 * i);
+        backslash_bits |= (uint64_t)(uint32_t)_mm256_movemask_epi8(
+                              _mm256_cmpeq_epi8(chunk, backslash)) << (32 * i);
+    }
+    out->quote = quote_bits;
+    out->backslash = backslash_bits;
+    out->op = op_bits;
+}
+
+#endif // JSON_OD_X86
+
+static do_result_t json_od_reserve(json_od_doc_t *doc, size_t need) {
+    if (need <= doc->capacity) {
+        return DO_SUCCESS;
+    }
+    
+    size_t capacity = doc->capacity ? doc->capacity : 1024;
+    while (capacity < need) {
+        capacity *= 2;
+    }
+    
+    uint32_t *pos = do_realloc(doc->pos, capacity * sizeof(uint32_t));
+    if (!pos) {
+        return DO_ERROR_MEMORY;
+    }
+    doc->pos = pos;
+    
+    uint32_t *match = do_realloc(doc->match, capacity * sizeof(uint32_t));
+    if (!match) {
+        return DO_ERROR_MEMORY;
+    }
+    doc->match = match;
+    doc->capacity = capacity;
+    return DO_SUCCESS;
+}
+
+// Each x ^= x << n step folds in twice as many lower bits: afterwards bit
+// i is the XOR of bits 0..i, i.e. 1 from an opening quote up to, not
+// including, its closing one
+JSON_OD_INLINE uint64_t json_od_prefix_xor(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+// Finds the structurals block by block. Escapes are rare in API output,
+// so the backslashes are walked one by one rather than with carry tricks.
+JSON_OD_INLINE do_result_t json_od_index_blocks(json_od_doc_t *doc, json_od_classify_fn classify) {
+    const unsigned char *data = (const unsigned char *)doc->data;
+    size_t len = doc->len;
+    unsigned char tail[64];
+    uint64_t prev_escaped = 0;   // 1 when the block starts with an escaped byte
+    uint64_t prev_in_string = 0; // all ones when it starts inside a string
+    
+    for (size_t base = 0; base < len; base += 64) {
+        const unsigned char *block = data + base;
+        if (len - base < 64) {
+            memset(tail, ' ', sizeof(tail));
+            memcpy(tail, block, len - base);
+            block = tail;
+        }
+        
+        json_od_block_t bits;
+        classify(block, &bits);
+        
+        uint64_t escaped = prev_escaped;
+        uint64_t backslash = bits.backslash & ~prev_escaped;
+        prev_escaped = 0;
+        while (backslash) {
+            int at = __builtin_ctzll(backslash);
+            backslash &= backslash - 1;
+            if (at == 63) {
+                prev_escaped = 1;
+            } else {
+                escaped |= 1ULL << (at + 1);
+                backslash &= ~(1ULL << (at + 1));
+            }
+        }
+        
+        uint64_t quote = bits.quote & ~escaped;
+        uint64_t in_string = json_od_prefix_xor(quote) ^ prev_in_string;
+        prev_in_string = (uint64_t)((int64_t)in_string >> 63);
+        uint64_t structural = (bits.op & ~in_string) | (quote & in_string);
+        
+        if (json_od_reserve(doc, doc->count + 64) != DO_SUCCESS) {
+            return DO_ERROR_MEMORY;
+        }
+        uint32_t *out = doc->pos + doc->count;
+        while (structural) {
+            *out++ = (uint32_t)(base + (size_t)__builtin_ctzll(structural));
+            structural &= structural - 1;
+        }
+        doc->count = (size_t)(out - doc->pos);
+    }
+    
+    return prev_in_string ? DO_ERROR_JSON : DO_SUCCESS;
+}
+
+static do_result_t json_od_index_scalar(json_od_doc_t *doc) {
+    return json_od_index_blocks(doc, json_od_classify_scalar);
+}
+
+#if JSON_OD_X86
+
+__attribute__((target("sse4.2")))
+static do_result_t json_od_index_sse42(json_od_doc_t *doc) {
+    return json_od_index_blocks(doc, json_od_classify_sse42);
+}
+
+__attribute__((target("avx2")))
+static do_result_t json_od_index_avx2(json_od_doc_t *doc) {
+    return json_od_index_blocks(doc, json_od_classify_avx2);
+}
+
+#endif // JSON_OD_X86
+
+typedef struct {
+    const char *name;
+    do_result_t (*index)(json_od_doc_t *doc);
+} json_od_indexer_t;
+
+static const json_od_indexer_t json_od_indexers[] = {
+    {"scalar", json_od_index_scalar},
+#if JSON_OD_X86
+    {"sse4.2", json_od_index_sse42},
+    {"avx2", json_od_index_avx2},
+#endif
+};
+
+static _Atomic(const json_od_indexer_t *) json_od_chosen = NULL;
+
+static bool json_od_cpu_has(const char *name) {
+#if JSON_OD_X86
+    __builtin_cpu_init();
+    if (strcmp(name, "avx2") == 0) {
+        return __builtin_cpu_supports("avx2");
+    }
+    if (strcmp(name, "sse4.2") == 0) {
+        return __builtin_cpu_supports("sse4.2");
+    }
+#endif
+    return strcmp(name, "scalar") == 0;
+}
+
+// Picked on first use: the last listed one the CPU supports
+static const json_od_indexer_t *json_od_indexer(void) {
+    const json_od_indexer_t *indexer = atomic_load_explicit(&json_od_chosen, memory_order_relaxed);
+    if (indexer) {
+        return indexer;
+    }
+    
+    size_t count = sizeof(json_od_indexers) / sizeof(json_od_indexers[0]);
+    indexer = &json_od_indexers[0];
+    for (size_t i = count; i-- > 1;) {
+        if (json_od_cpu_has(json_od_indexers[i].name)) {
+            indexer = &json_od_indexers[i];
+            break;
+        }
+    }
+    atomic_store_explicit(&json_od_chosen, indexer, memory_order_relaxed);
+    return indexer;
+}
+
+const char *json_od_backend(void) {
+    return json_od_indexer()->name;
+}
+
+bool json_od_use_backend(const char *name) {
+    size_t count = sizeof(json_od_indexers) / sizeof(json_od_indexers[0]);
+    for (size_t i = 0; name && i < count; i++) {
+        if (strcmp(json_od_indexers[i].name, name) == 0 && json_od_cpu_has(name)) {
+            atomic_store_explicit(&json_od_chosen, &json_od_indexers[i], memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Pairs brackets. The open ones still waiting for a partner are chained
+// through match[] itself, each pointing at the one enclosing it.
+static do_result_t json_od_pair(json_od_doc_t *doc) {
+    const char *data = doc->data;
+    uint32_t open = UINT32_MAX;
+    
+    for (size_t i = 0; i < doc->count; i++) {
+        char c = data[doc->pos[i]];
+        if (c == '{' || c == '[') {
+            doc->match[i] = open;
+            open = (uint32_t)i;
+        } else if (c == '}' || c == ']') {
+            if (open == UINT32_MAX || data[doc->pos[open]] != (c == '}' ? '{' : '[')) {
+                return DO_ERROR_JSON;
+            }
+            uint32_t parent = doc->match[open];
+            doc->match[open] = (uint32_t)i;
+            open = parent;
+        }
+    }
+    
+    return open == UINT32_MAX ? DO_SUCCESS : DO_ERROR_JSON;
+}
+
+do_result_t json_od_index(json_od_doc_t *doc, const char *data, size_t len) {
+    if (!doc || !data || len >= UINT32_MAX) {
+        return DO_ERROR_JSON;
+    }
+    
+    doc->data = data;
+    doc->len = len;
+    doc->count = 0;
+    
+    do_result_t result = json_od_indexer()->index(doc);
+    return result == DO_SUCCESS ? json_od_pair(doc) : result;
+}
+
+void json_od_doc_free(json_od_doc_t *doc) {
+    if (!doc) {
+        return;
+    }
+    
+    do_free(doc->pos);
+    do_free(doc->match);
+    memset(doc, 0, sizeof(*doc));
+}
+
+static uint32_t json_od_skip_space(const json_od_doc_t *doc, size_t i) {
+    const char *data = doc->data;
+    while (i < doc->len && (data[i] == ' ' || data[i] == '\t' || data[i] == '\n' || data[i] == '\r')) {
+        i++;
+    }
+    return (uint32_t)i;
+}
+
+static char json_od_first_byte(const json_od_value_t *value) {
+    return value->offset < value->doc->len ? value->doc->data[value->offset] : '\0';
+}
+
+// Whether the value is a container or string whose own structural it holds
+static bool json_od_indexed(const json_od_value_t *value, char kind) {
+    const json_od_doc_t *doc = value->doc;
+    return json_od_first_byte(value) == kind && value->index < doc->count &&
+           doc->pos[value->index] == value->offset;
+}
+
+bool json_od_is_object(const json_od_value_t *value) {
+    return value && json_od_indexed(value, '{');
+}
+
+bool json_od_is_array(const json_od_value_t *value) {
+    return value && json_od_indexed(value, '[');
+}
+
+bool json_od_is_string(const json_od_value_t *value) {
+    return value && json_od_indexed(value, '"');
+}
+
+// The index of the first structural after the value
+static uint32_t json_od_skip(const json_od_value_t *value) {
+    if (json_od_is_object(value) || json_od_is_array(value)) {
+        return value->doc->match[value->index] + 1;
+    }
+    return json_od_is_string(value) ? value->index + 1 : value->index;
+}
+
+bool json_od_root(const json_od_doc_t *doc, json_od_value_t *value) {
+    if (!doc || doc->count == 0) {
+        return false;
+    }
+    
+    value->doc = doc;
+    value->index = 0;
+    value->offset = json_od_skip_space(doc, 0);
+    return json_od_is_object(value) || json_od_is_array(value);
+}
+
+bool json_od_find(const json_od_value_t *object, const char *key, json_od_value_t *value) {
+    if (!json_od_is_object(object) || !key) {
+        return false;
+    }
+    
+    const json_od_doc_t *doc = object->doc;
+    const char *data = doc->data;
+    size_t key_len = strlen(key);
+    uint32_t close = doc->match[object->index];
+    
+    // Members are "key" : value , ... with the value's structural at i + 2
+    for (uint32_t i = object->index + 1; i + 1 < close && data[doc->pos[i]] == '"'; ) {
+        if (data[doc->pos[i + 1]] != ':') {
+            return false;
+        }
+        json_od_value_t member = {doc, i + 2, json_od_skip_space(doc, doc->pos[i + 1] + 1)};
+        
+        size_t key_start = doc->pos[i] + 1;
+        if (key_start + key_len < doc->len && memcmp(data + key_start, key, key_len) == 0 &&
+            data[key_start + key_len] == '"') {
+            *value = member;
+            return true;
+        }
+        
+        uint32_t after = json_od_skip(&member);
+        if (after >= close || data[doc->pos[after]] != ',') {
+            return false;
+        }
+        i = after + 1;
+    }
+    return false;
+}
+
+bool json_od_first(const json_od_value_t *array, json_od_value_t *element) {
+    if (!json_od_is_array(array)) {
+        return false;
+    }
+    
+    const json_od_doc_t *doc = array->doc;
+    element->doc = doc;
+    element->index = array->index + 1;
+    element->offset = json_od_skip_space(doc, doc->pos[array->index] + 1);
+    return doc->data[element->offset] != ']';
+}
+
+bool json_od_next(json_od_value_t *element) {
+    const json_od_doc_t *doc = element->doc;
+    uint32_t after = json_od_skip(element);
+    if (after >= doc->count || doc->data[doc->pos[after]] != ',') {
+        return false;
+    }
+    
+    element->index = after + 1;
+    element->offset = json_od_skip_space(doc, doc->pos[after] + 1);
+    return true;
+}
+
+size_t json_od_count(const json_od_value_t *array) {
+    size_t count = 0;
+    json_od_value_t element;
+    for (bool more = json_od_first(array, &element); more; more = json_od_next(&element)) {
+        count++;
+    }
+    return count;
+}
+
+static const double json_od_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static bool json_od_is_delimiter(char c) {
+    return c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' ||
+           c == '\r' || c == '\0';
+}
+
+// Up to 19 significant digits and a power of ten within 10^22 give an
+// exact double from one multiply or divide (Clinger's fast path), which
+// covers every ID, size and price the API sends. Anything else goes to
+// strtod().
+bool json_od_number(const json_od_value_t *value, double *number) {
+    if (!value || !number) {
+        return false;
+    }
+    
+    const char *start = value->doc->data + value->offset;
+    const char *p = start;
+    bool negative = *p == '-';
+    if (negative) {
+        p++;
+    }
+    if (*p < '0' || *p > '9') {
+        return false;
+    }
+    
+    uint64_t mantissa = 0;
+    int digits = 0;
+    int exponent = 0;
+    for (; *p >= '0' && *p <= '9'; p++) {
+        if (digits < 19) {
+            mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+            digits += mantissa != 0;
+        } else {
+            exponent++;
+        }
+    }
+    if (*p == '.') {
+        for (p++; *p >= '0' && *p <= '9'; p++) {
+            if (digits < 19) {
+                mantissa = mantissa * 10 + (uint64_t)(*p - '0');
+                digits += mantissa != 0;
+                exponent--;
+            }
+        }
+    }
+    
+    bool fast = true;
+    if (*p == 'e' || *p == 'E') {
+        fast = false;
+        p++;
+        if (*p == '+' || *p == '-') {
+            p++;
+        }
+        while (*p >= '0' && *p <= '9') {
+            p++;
+        }
+    }
+    if (!json_od_is_delimiter(*p)) {
+        return false;
+    }
+    
+    if (fast && digits < 19 && mantissa <= (1ULL << 53) && exponent >= -22 && exponent <= 22) {
+        double result = (double)mantissa;
+        result = exponent < 0 ? result / json_od_pow10[-exponent] : result * json_od_pow10[exponent];
+        *number = negative ? -result : result;
+        return true;
+    }
+    
+    char *end;
+    *number = strtod(start, &end);
+    return end == p;
+}
+
+bool json_od_bool(const json_od_value_t *value, bool *boolean) {
+    if (!value || !boolean) {
+        return false;
+    }
+    
+    const char *p = value->doc->data + value->offset;
+    if (strncmp(p, "true", 4) == 0 && json_od_is_delimiter(p[4])) {
+        *boolean = true;
+        return true;
+    }
+    if (strncmp(p, "false", 5) == 0 && json_od_is_delimiter(p[5])) {
+        *boolean = false;
+        return true;
+    }
+    return false;
+}
+
+static int json_od_hex4(const char *p) {
+    int code = 0;
+    for (int i = 0; i < 4; i++) {
+        char c = p[i];
+        code <<= 4;
+        if (c >= '0' && c <= '9') {
+            code |= c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            code |= c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            code |= c - 'A' + 10;
+        } else {
+            return -1;
+        }
+    }
+    return code;
+}
+
+// Decodes the escapes between p and the closing quote into out, which has
+// room for at least as many bytes as the raw text. Returns the number of
+// bytes written, or -1 when an escape is malformed.
+static long json_od_unescape(const char *p, const char *end, char *out) {
+    char *o = out;
+    while (p < end && *p != '"') {
+        if (*p != '\\') {
+            *o++ = *p++;
+            continue;
+        }
+        if (p + 1 >= end) {
+            return -1;
+        }
+        
+        char c = p[1];
+        p += 2;
+        switch (c) {
+            case '"': *o++ = '"'; break;
+            case '\\': *o++ = '\\'; break;
+            case '/': *o++ = '/'; break;
+            case 'b': *o++ = '\b'; break;
+            case 'f': *o++ = '\f'; break;
+            case 'n': *o++ = '\n'; break;
+            case 'r': *o++ = '\r'; break;
+            case 't': *o++ = '\t'; break;
+            case 'u': {
+                long code = end - p >= 4 ? json_od_hex4(p) : -1;
+                if (code < 0) {
+                    return -1;
+                }
+                p += 4;
+                
+                // A high surrogate needs its low half from the next escape
+                if (code >= 0xD800 && code <= 0xDBFF) {
+                    long low = end - p >= 6 && p[0] == '\\' && p[1] == 'u' ? json_od_hex4(p + 2) : -1;
+                    if (low < 0xDC00 || low > 0xDFFF) {
+                        return -1;
+                    }
+                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    p += 6;
+                } else if (code >= 0xDC00 && code <= 0xDFFF) {
+                    return -1;
+                }
+                
+                if (code < 0x80) {
+                    *o++ = (char)code;
+                } else if (code < 0x800) {
+                    *o++ = (char)(0xC0 | (code >> 6));
+                    *o++ = (char)(0x80 | (code & 0x3F));
+                } else if (code < 0x10000) {
+                    *o++ = (char)(0xE0 | (code >> 12));
+                    *o++ = (char)(0x80 | ((code >> 6) & 0x3F));
+                    *o++ = (char)(0x80 | (code & 0x3F));
+                } else {
+                    *o++ = (char)(0xF0 | (code >> 18));
+                    *o++ = (char)(0x80 | ((code >> 12) & 0x3F));
+                    *o++ = (char)(0x80 | ((code >> 6) & 0x3F));
+                    *o++ = (char)(0x80 | (code & 0x3F));
+                }
+                break;
+            }
+            default:
+                return -1;
+        }
+    }
+    return p < end ? (long)(o - out) : -1;
+}
+
+char *json_od_strdup(const json_od_value_t *value) {
+    if (!json_od_is_string(value)) {
+        return NULL;
+    }
+    
+    const json_od_doc_t *doc = value->doc;
+    const char *start = doc->data + value->offset + 1;
+    const char *end = doc->data + doc->len;
+    const char *quote = memchr(start, '"', (size_t)(end - start));
+    if (!quote) {
+        return NULL;
+    }
+    
+    // Most strings have no escapes and are copied as they are
+    const char *escape = memchr(start, '\\', (size_t)(quote - start));
+    if (!escape) {
+        size_t len = (size_t)(quote - start);
+        char *copy = do_malloc(len + 1);
+        if (copy) {
+            memcpy(copy, start, len);
+            copy[len] = '\0';
+        }
+        return copy;
+    }
+    
+    // An escaped quote ends the memchr() early, so the buffer is sized by
+    // the next structural, which no string reaches past
+    const char *limit = value->index + 1 < doc->count ? doc->data + doc->pos[value->index + 1] : end;
+    char *copy = do_malloc((size_t)(limit - start) + 1);
+    if (!copy) {
+        return NULL;
+    }
+    long len = json_od_unescape(start, limit, copy);
+    if (len < 0) {
+        do_free(copy);
+        return NULL;
+    }
+    copy[len] = '\0';
+    return copy;
+}
+
+size_t json_od_end(const json_od_value_t *value) {
+    const json_od_doc_t *doc = value->doc;
+    if (json_od_is_object(value) || json_od_is_array(value)) {
+        return doc->pos[doc->match[value->index]] + 1;
+    }
+    
+    const char *data = doc->data;
+    size_t i = value->offset;
+    if (json_od_is_string(value)) {
+        for (i++; i < doc->len && data[i] != '"'; i++) {
+            if (data[i] == '\\') {
+                i++;
+            }
+        }
+        return i < doc->len ? i + 1 : doc->len;
+    }
+    
+    while (i < doc->len && !json_od_is_delimiter(data[i])) {
+        i++;
+    }
+    return i;
+}
+
+bool json_od_view(const json_od_value_t *value, do_str_view_t *view) {
+    memset(view, 0, sizeof(*view));
+    if (!json_od_is_string(value)) {
+        return false;
+    }
+    
+    const json_od_doc_t *doc = value->doc;
+    const char *start = doc->data + value->offset + 1;
+    const char *quote = memchr(start, '"', doc->len - value->offset - 1);
+    if (!quote) {
+        return false;
+    }
+    
+    // Only a backslash can hide the real closing quote further on
+    view->data = start;
+    view->escaped = memchr(start, '\\', (size_t)(quote - start)) != NULL;
+    view->len = view->escaped ? json_od_end(value) - 1 - (value->offset + 1)
+                              : (size_t)(quote - start);
+    return true;
+}
+
+// String views (types.h). A view from a response ends just before its
+// closing quote, which is what stops the unescaping.
+
+long do_str_view_decode(const do_str_view_t *view, char *buffer) {
+    if (!view || !view->data || !buffer) {
+        return -1;
+    }
+    
+    long len = (long)view->len;
+    if (view->escaped) {
+        len = json_od_unescape(view->data, view->data + view->len + 1, buffer);
+    } else {
+        memcpy(buffer, view->data, view->len);
+    }
+    if (len >= 0) {
+        buffer[len] = '\0';
+    }
+    return len;
+}
+
+char *do_str_view_dup(const do_str_view_t *view) {
+    if (!view || !view->data) {
+        return NULL;
+    }
+    
+    char *copy = do_malloc(view->len + 1);
+    if (copy && do_str_view_decode(view, copy) < 0) {
+        do_free(copy);
+        return NULL;
+    }
+    return copy;
+}
+
+bool do_str_view_equals(const do_str_view_t *view, const char *str) {
+    if (!view || !view->data || !str) {
+        return false;
+    }
+    if (!view->escaped) {
+        return view->len == strlen(str) && memcmp(view->data, str, view->len) == 0;
+    }
+    
+    char *decoded = do_str_view_dup(view);
+    bool equal = decoded && strcmp(decoded, str) == 0;
+    do_free(decoded);
+    return equal;
+}
\ No newline at end of file
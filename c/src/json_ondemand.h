@@ -0,0 +1,82 @@
+#ifndef DO_JSON_ONDEMAND_H
+#define DO_JSON_ONDEMAND_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "digitalocean/types.h"
+
+// On-demand JSON access for large list pages. Indexing records where every
+// structural character outside strings is ({ } [ ] : , and each string's
+// opening quote) in one pass over the text, 64 bytes at a time with AVX2 or
+// SSE4.2 when the CPU has them and a scalar loop otherwise, and pairs each
+// bracket with its match. Values are then read straight from the text when
+// asked for: nothing is built per node, and skipping a container is one
+// lookup.
+//
+// Only the structure is checked up front (brackets, strings, the index);
+// a malformed scalar shows up as a failed read of that value. The text must
+// be NUL-terminated and outlive the document. The index is kept between
+// uses, so indexing page after page into one document stops allocating.
+typedef struct {
+    const char *data;
+    size_t len;
+    uint32_t *pos;    // byte offset of each structural
+    uint32_t *match;  // for an opening bracket, the index of its closing one
+    size_t count;
+    size_t capacity;
+} json_od_doc_t;
+
+// A value in a document: the first byte of its text and the first
+// structural at or after it (its own for containers and strings, the
+// separator that follows it for numbers and literals)
+typedef struct {
+    const json_od_doc_t *doc;
+    uint32_t index;
+    uint32_t offset;
+} json_od_value_t;
+
+// DO_ERROR_JSON when the structure is broken, DO_ERROR_MEMORY when the
+// index cannot grow; documents over 4 GB are rejected
+do_result_t json_od_index(json_od_doc_t *doc, const char *data, size_t len);
+void json_od_doc_free(json_od_doc_t *doc);
+
+// Which indexer json_od_index() uses on this CPU: "avx2", "sse4.2" or "scalar"
+const char *json_od_backend(void);
+
+// Makes json_od_index() use the named indexer from then on, to compare
+// them; false when this build or CPU does not have it
+bool json_od_use_backend(const char *name);
+
+// The top-level object or array
+bool json_od_root(const json_od_doc_t *doc, json_od_value_t *value);
+
+// The member named key; false when object is not an object or lacks it.
+// Keys are compared as raw text, so escaped keys never match.
+bool json_od_find(const json_od_value_t *object, const char *key, json_od_value_t *value);
+
+// Array iteration: first element, then each following one in turn
+bool json_od_first(const json_od_value_t *array, json_od_value_t *element);
+bool json_od_next(json_od_value_t *element);
+size_t json_od_count(const json_od_value_t *array);
+
+bool json_od_is_object(const json_od_value_t *value);
+bool json_od_is_array(const json_od_value_t *value);
+bool json_od_is_string(const json_od_value_t *value);
+
+// Scalar reads; false when the value has another type or does not parse
+bool json_od_number(const json_od_value_t *value, double *number);
+bool json_od_bool(const json_od_value_t *value, bool *boolean);
+
+// The unescaped string in memory from do_malloc(); NULL when the value is
+// not a string or memory runs out
+char *json_od_strdup(const json_od_value_t *value);
+
+// One past the last byte of the value's text
+size_t json_od_end(const json_od_value_t *value);
+
+// The string's text between its quotes, escapes left in place; a cleared
+// view and false when the value is not a string
+bool json_od_view(const json_od_value_t *value, do_str_view_t *view);
+
+#endif // DO_JSON_ONDEMAND_H
\ No newline at end of file
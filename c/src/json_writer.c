@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <string.h>
+#include "digitalocean/alloc.h"
+#include "json_writer.h"
+
+static void json_writer_append(json_writer_t *writer, const char *data, size_t len) {
+    if (writer->failed) {
+        return;
+    }
+    
+    do_string_t *out = writer->out;
+    if (out->length + len + 1 > out->capacity) {
+        size_t new_capacity = out->capacity ? out->capacity * 2 : 256;
+        while (new_capacity < out->length + len + 1) {
+            new_capacity *= 2;
+        }
+        
+        char *new_data = do_realloc(out->data, new_capacity);
+        if (!new_data) {
+            writer->failed = true;
+            return;
+        }
+        
+        out->data = new_data;
+        out->capacity = new_capacity;
+    }
+    
+    memcpy(out->data + out->length, data, len);
+    out->length += len;
+    out->data[out->length] = '\0';
+}
+
+static void json_writer_char(json_writer_t *writer, char c) {
+    json_writer_append(writer, &c, 1);
+}
+
+// Every value goes through here so separators are always right
+static void json_writer_before_value(json_writer_t *writer) {
+    if (writer->need_comma) {
+        json_writer_char(writer, ',');
+    }
+    writer->need_comma = true;
+}
+
+static void json_writer_escaped(json_writer_t *writer, const char *value) {
+    static const char hex[] = "0123456789abcdef";
+    
+    json_writer_char(writer, '"');
+    
+    const char *run = value;
+    for (const char *p = value; *p; p++) {
+        unsigned char c = (unsigned char)*p;
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;
+        }
+        
+        json_writer_append(writer, run, (size_t)(p - run));
+        run = p + 1;
+        
+        switch (c) {
+            case '"': json_writer_append(writer, "\\\"", 2); break;
+            case '\\': json_writer_append(writer, "\\\\", 2); break;
+            case '\n': json_writer_append(writer, "\\n", 2); break;
+            case '\r': json_writer_append(writer, "\\r", 2); break;
+            case '\t': json_writer_append(writer, "\\t", 2); break;
+            default: {
+                char escape[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xf]};
+                json_writer_append(writer, escape, sizeof(escape));
+                break;
+            }
+        }
+    }
+    
+    json_writer_append(writer, run, strlen(run));
+    json_writer_char(writer, '"');
+}
+
+void json_writer_init(json_writer_t *writer, do_string_t *out) {
+    writer->out = out;
+    writer->need_comma = false;
+    writer->failed = false;
+    
+    out->length = 0;
+    if (out->data) {
+        out->data[0] = '\0';
+    }
+}
+
+void json_writer_continue(json_writer_t *writer, do_string_t *out) {
+    writer->out = out;
+    writer->need_comma = false;
+    writer->failed = false;
+}
+
+do_result_t json_writer_finish(const json_writer_t *writer) {
+    return writer->failed ? DO_ERROR_MEMORY : DO_SUCCESS;
+}
+
+void json_writer_begin_object(json_writer_t *writer) {
+    json_writer_before_value(writer);
+    json_writer_char(writer, '{');
+    writer->need_comma = false;
+}
+
+void json_writer_end_object(json_writer_t *writer) {
+    json_writer_char(writer, '}');
+    writer->need_comma = true;
+}
+
+void json_writer_begin_array(json_writer_t *writer) {
+    json_writer_before_value(writer);
+    json_writer_char(writer, '[');
+    writer->need_comma = false;
+}
+
+void json_writer_end_array(json_writer_t *writer) {
+    json_writer_char(writer, ']');
+    writer->need_comma = true;
+}
+
+void json_writer_key(json_writer_t *writer, const char *key) {
+    json_writer_before_value(writer);
+    json_writer_escaped(writer, key);
+    json_writer_char(writer, ':');
+    writer->need_comma = false;
+}
+
+void json_writer_string(json_writer_t *writer, const char *value) {
+    if (!value) {
+        json_writer_null(writer);
+        return;
+    }
+    
+    json_writer_before_value(writer);
+    json_writer_escaped(writer, value);
+}
+
+void json_writer_int(json_writer_t *writer, int64_t value) {
+    char digits[24];
+    int len = snprintf(digits, sizeof(digits), "%lld", (long long)value);
+    
+    json_writer_before_value(writer);
+    json_writer_append(writer, digits, (size_t)len);
+}
+
+void json_writer_number(json_writer_t *writer, double value) {
+    char digits[32];
+    int len = snprintf(digits, sizeof(digits), "%.15g", value);
+    
+    json_writer_before_value(writer);
+    json_writer_append(writer, digits, (size_t)len);
+}
+
+void json_writer_bool(json_writer_t *writer, bool value) {
+    json_writer_before_value(writer);
+    json_writer_append(writer, value ? "true" : "false", value ? 4 : 5);
+}
+
+void json_writer_null(json_writer_t *writer) {
+    json_writer_before_value(writer);
+    json_writer_append(writer, "null", 4);
+}
+
+void json_writer_raw(json_writer_t *writer, const char *json, size_t len) {
+    json_writer_before_value(writer);
+    json_writer_append(writer, json, len);
+}
+
+void json_writer_newline(json_writer_t *writer) {
+    json_writer_char(writer, '\n');
+    writer->need_comma = false;
+}
+
+void json_writer_id_or_string(json_writer_t *writer, const char *value) {
+    size_t len = value ? strlen(value) : 0;
+    bool numeric = len > 0 && len < 19 && strspn(value, "0123456789") == len;
+    
+    if (numeric) {
+        json_writer_before_value(writer);
+        json_writer_append(writer, value, len);
+    } else {
+        json_writer_string(writer, value);
+    }
+}
+
+void json_writer_member_string(json_writer_t *writer, const char *key, const char *value) {
+    if (!value) {
+        return;
+    }
+    
+    json_writer_key(writer, key);
+    json_writer_string(writer, value);
+}
+
+void json_writer_member_bool(json_writer_t *writer, const char *key, bool value) {
+    json_writer_key(writer, key);
+    json_writer_bool(writer, value);
+}
+
+void json_writer_member_string_array(json_writer_t *writer, const char *key,
+                                     const do_string_array_t *values) {
+    if (values->count == 0) {
+        return;
+    }
+    
+    json_writer_key(writer, key);
+    json_writer_begin_array(writer);
+    for (size_t i = 0; i < values->count; i++) {
+        json_writer_string(writer, values->items[i]);
+    }
+    json_writer_end_array(writer);
+}
\ No newline at end of file
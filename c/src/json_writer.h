@@ -0,0 +1,55 @@
+#ifndef DO_JSON_WRITER_H
+#define DO_JSON_WRITER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "digitalocean/types.h"
+
+// Append-only JSON writer. Output goes straight into a do_string_t whose
+// capacity is kept between uses, so a reused buffer stops allocating once
+// it has grown to the largest body written. Commas are inserted
+// automatically; callers only describe structure. Allocation failures are
+// sticky and reported by json_writer_finish().
+typedef struct {
+    do_string_t *out;
+    bool need_comma; // a value precedes the next member or element
+    bool failed;
+} json_writer_t;
+
+// Starts a new document in out, discarding its previous contents
+void json_writer_init(json_writer_t *writer, do_string_t *out);
+
+// Starts a new document after what out already holds, for buffers of
+// several newline-separated documents (NDJSON)
+void json_writer_continue(json_writer_t *writer, do_string_t *out);
+do_result_t json_writer_finish(const json_writer_t *writer);
+
+void json_writer_begin_object(json_writer_t *writer);
+void json_writer_end_object(json_writer_t *writer);
+void json_writer_begin_array(json_writer_t *writer);
+void json_writer_end_array(json_writer_t *writer);
+
+void json_writer_key(json_writer_t *writer, const char *key);
+void json_writer_string(json_writer_t *writer, const char *value); // NULL writes null
+void json_writer_int(json_writer_t *writer, int64_t value);
+void json_writer_number(json_writer_t *writer, double value); // 15 significant digits
+void json_writer_bool(json_writer_t *writer, bool value);
+void json_writer_null(json_writer_t *writer);
+
+// Text that is already JSON, written as the next value unchanged
+void json_writer_raw(json_writer_t *writer, const char *json, size_t len);
+
+// Ends the document with a newline
+void json_writer_newline(json_writer_t *writer);
+
+// Writes an integer when the text is all digits, otherwise a string. For
+// API fields that take either an ID or a slug.
+void json_writer_id_or_string(json_writer_t *writer, const char *value);
+
+// Member shorthands; the string forms skip NULL values entirely
+void json_writer_member_string(json_writer_t *writer, const char *key, const char *value);
+void json_writer_member_bool(json_writer_t *writer, const char *key, bool value);
+void json_writer_member_string_array(json_writer_t *writer, const char *key,
+                                     const do_string_array_t *values);
+
+#endif // DO_JSON_WRITER_H
\ No newline at end of file
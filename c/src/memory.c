@@ -1,6 +1,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include "digitalocean/types.h"
+#include "digitalocean/alloc.h"
 
 void do_string_init(do_string_t *str) {
     if (!str) return;
@@ -11,7 +12,7 @@ void do_string_init(do_string_t *str) {
 
 void do_string_free(do_string_t *str) {
     if (!str) return;
-    free(str->data);
+    do_free(str->data);
     str->data = NULL;
     str->length = 0;
     str->capacity = 0;
@@ -25,7 +26,7 @@ do_result_t do_string_set(do_string_t *str, const char *value) {
     if (!value) return DO_SUCCESS;
     
     size_t len = strlen(value);
-    str->data = malloc(len + 1);
+    str->data = do_malloc(len + 1);
     if (!str->data) return DO_ERROR_MEMORY;
     
     strcpy(str->data, value);
@@ -46,9 +47,9 @@ void do_string_array_free(do_string_array_t *arr) {
     if (!arr) return;
     
     for (size_t i = 0; i < arr->count; i++) {
-        free(arr->items[i]);
+        do_free(arr->items[i]);
     }
-    free(arr->items);
+    do_free(arr->items);
     
     arr->items = NULL;
     arr->count = 0;
@@ -60,14 +61,14 @@ do_result_t do_string_array_add(do_string_array_t *arr, const char *item) {
     
     if (arr->count >= arr->capacity) {
         size_t new_capacity = arr->capacity ? arr->capacity * 2 : 4;
-        char **new_items = realloc(arr->items, new_capacity * sizeof(char*));
+        char **new_items = do_realloc(arr->items, new_capacity * sizeof(char*));
         if (!new_items) return DO_ERROR_MEMORY;
         
         arr->items = new_items;
         arr->capacity = new_capacity;
     }
     
-    arr->items[arr->count] = strdup(item);
+    arr->items[arr->count] = do_strdup(item);
     if (!arr->items[arr->count]) return DO_ERROR_MEMORY;
     
     arr->count++;
@@ -78,68 +79,68 @@ static void do_networks_free(do_networks_t *networks) {
     if (!networks) return;
     
     for (size_t i = 0; i < networks->v4_count; i++) {
-        free(networks->v4[i].ip_address);
-        free(networks->v4[i].netmask);
-        free(networks->v4[i].gateway);
-        free(networks->v4[i].type);
+        do_free(networks->v4[i].ip_address);
+        do_free(networks->v4[i].netmask);
+        do_free(networks->v4[i].gateway);
+        do_free(networks->v4[i].type);
     }
-    free(networks->v4);
+    do_free(networks->v4);
     
     for (size_t i = 0; i < networks->v6_count; i++) {
-        free(networks->v6[i].ip_address);
-        free(networks->v6[i].gateway);
-        free(networks->v6[i].type);
+        do_free(networks->v6[i].ip_address);
+        do_free(networks->v6[i].gateway);
+        do_free(networks->v6[i].type);
     }
-    free(networks->v6);
+    do_free(networks->v6);
     
-    free(networks);
+    do_free(networks);
 }
 
 static void do_region_free(do_region_t *region) {
     if (!region) return;
     
-    free(region->name);
-    free(region->slug);
+    do_free(region->name);
+    do_free(region->slug);
     do_string_array_free(&region->features);
     do_string_array_free(&region->sizes);
-    free(region);
+    do_free(region);
 }
 
 static void do_size_free(do_size_t *size) {
     if (!size) return;
     
-    free(size->slug);
+    do_free(size->slug);
     do_string_array_free(&size->regions);
-    free(size);
+    do_free(size);
 }
 
 static void do_image_free(do_image_t *image) {
     if (!image) return;
     
-    free(image->name);
-    free(image->type);
-    free(image->distribution);
-    free(image->slug);
-    free(image->description);
-    free(image->status);
-    free(image->error_message);
+    do_free(image->name);
+    do_free(image->type);
+    do_free(image->distribution);
+    do_free(image->slug);
+    do_free(image->description);
+    do_free(image->status);
+    do_free(image->error_message);
     do_string_array_free(&image->regions);
     do_string_array_free(&image->tags);
-    free(image);
+    do_free(image);
 }
 
 void do_droplet_free(do_droplet_t *droplet) {
     if (!droplet) return;
     
-    free(droplet->name);
-    free(droplet->status);
-    free(droplet->size_slug);
-    free(droplet->vpc_uuid);
+    do_free(droplet->name);
+    do_free(droplet->status);
+    do_free(droplet->size_slug);
+    do_free(droplet->vpc_uuid);
     
     if (droplet->kernel) {
-        free(droplet->kernel->name);
-        free(droplet->kernel->version);
-        free(droplet->kernel);
+        do_free(droplet->kernel->name);
+        do_free(droplet->kernel->version);
+        do_free(droplet->kernel);
     }
     
     do_image_free(droplet->image);
@@ -151,8 +152,8 @@ void do_droplet_free(do_droplet_t *droplet) {
     do_string_array_free(&droplet->tags);
     do_string_array_free(&droplet->volume_ids);
     
-    free(droplet->backup_ids);
-    free(droplet->snapshot_ids);
+    do_free(droplet->backup_ids);
+    do_free(droplet->snapshot_ids);
 }
 
 void do_droplet_list_free(do_droplet_list_t *list) {
@@ -161,23 +162,55 @@ void do_droplet_list_free(do_droplet_list_t *list) {
     for (size_t i = 0; i < list->count; i++) {
         do_droplet_free(&list->items[i]);
     }
-    free(list->items);
-    free(list);
+    do_free(list->items);
+    do_free(list->hashes);
+    do_free(list);
+}
+
+void do_droplet_changes_free(do_droplet_changes_t *changes) {
+    if (!changes) return;
+    
+    for (size_t i = 0; i < changes->removed_count; i++) {
+        do_droplet_free(&changes->removed[i]);
+    }
+    do_free(changes->removed);
+    do_free(changes->added);
+    do_free(changes->modified);
+    memset(changes, 0, sizeof(*changes));
 }
 
 void do_account_free(do_account_t *account) {
     if (!account) return;
     
-    free(account->email);
-    free(account->uuid);
-    free(account->status);
-    free(account->status_message);
+    do_free(account->email);
+    do_free(account->uuid);
+    do_free(account->status);
+    do_free(account->status_message);
     
     if (account->team) {
-        free(account->team->uuid);
-        free(account->team->name);
-        free(account->team);
+        do_free(account->team->uuid);
+        do_free(account->team->name);
+        do_free(account->team);
     }
     
-    free(account);
+    do_free(account);
+}
+
+void do_action_free(do_action_t *action) {
+    if (!action) return;
+    
+    do_free(action->status);
+    do_free(action->type);
+    do_free(action->resource_type);
+    do_free(action->region_slug);
+}
+
+void do_action_list_free(do_action_list_t *list) {
+    if (!list) return;
+    
+    for (size_t i = 0; i < list->count; i++) {
+        do_action_free(&list->items[i]);
+    }
+    do_free(list->items);
+    do_free(list);
 }
\ No newline at end of file
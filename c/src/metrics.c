@@ -0,0 +1,437 @@
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "digitalocean/metrics.h"
+#include "metrics_internal.h"
+
+// Writers never lock: each thread adds into its own shard with relaxed
+// atomics, and shards are cache-line aligned so threads do not contend on
+// the same line. The dump sums the shards.
+#define DO_METRICS_SHARDS 8
+#define DO_METRICS_CACHE_LINE 64
+#define DO_METRICS_METHOD_MAX 8
+#define DO_METRICS_ENDPOINT_MAX 96
+#define DO_METRICS_BUCKETS 11
+#define DO_METRICS_OVERFLOW (DO_METRICS_MAX_SERIES - 1) // catch-all once the table is full
+
+// Request latency bucket bounds in microseconds; the last bucket is +Inf
+static const int64_t latency_bounds_us[DO_METRICS_BUCKETS] = {
+    5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000, 2500000, 5000000, 10000000
+};
+
+typedef enum {
+    METRICS_CODE_2XX,
+    METRICS_CODE_3XX,
+    METRICS_CODE_4XX,
+    METRICS_CODE_429,
+    METRICS_CODE_5XX,
+    METRICS_CODE_FAILED, // no HTTP response at all
+    METRICS_CODE_CLASSES
+} metrics_code_class_t;
+
+static const char *const code_class_names[METRICS_CODE_CLASSES] = {
+    "2xx", "3xx", "4xx", "429", "5xx", "failed"
+};
+
+typedef struct {
+    _Alignas(DO_METRICS_CACHE_LINE) _Atomic uint64_t requests[METRICS_CODE_CLASSES];
+    _Atomic uint64_t json_errors;
+    _Atomic uint64_t bytes_received;
+    _Atomic uint64_t bytes_sent;
+    _Atomic uint64_t latency_buckets[DO_METRICS_BUCKETS + 1];
+    _Atomic uint64_t latency_sum_us;
+    _Atomic uint64_t parse_us;
+    _Atomic uint64_t decode_us;
+} metrics_cell_t;
+
+typedef enum {
+    SERIES_FREE,
+    SERIES_CLAIMED, // being filled in by the thread that won the slot
+    SERIES_READY
+} series_state_t;
+
+typedef struct {
+    _Atomic int state;
+    uint64_t hash;
+    char method[DO_METRICS_METHOD_MAX];
+    char endpoint[DO_METRICS_ENDPOINT_MAX];
+} metrics_series_t;
+
+static metrics_series_t series_table[DO_METRICS_MAX_SERIES] = {
+    [DO_METRICS_OVERFLOW] = {SERIES_READY, 0, "OTHER", "(other)"}
+};
+
+// Indexed [shard][series] so one thread's updates stay in its own lines
+static metrics_cell_t cells[DO_METRICS_SHARDS][DO_METRICS_MAX_SERIES];
+
+static _Atomic unsigned next_shard = 0;
+static _Thread_local int thread_shard = -1;
+
+static _Atomic int64_t rate_limit = -1;
+static _Atomic int64_t rate_limit_remaining = -1;
+static _Atomic int64_t rate_limit_reset = -1;
+
+static metrics_cell_t *metrics_cell(int series) {
+    if (thread_shard < 0) {
+        thread_shard = (int)(atomic_fetch_add_explicit(&next_shard, 1, memory_order_relaxed) % DO_METRICS_SHARDS);
+    }
+    return &cells[thread_shard][series];
+}
+
+static void metrics_add(_Atomic uint64_t *counter, uint64_t value) {
+    atomic_fetch_add_explicit(counter, value, memory_order_relaxed);
+}
+
+static bool is_id_segment(const char *segment, size_t len) {
+    bool digits = len > 0;
+    for (size_t i = 0; i < len && digits; i++) {
+        digits = segment[i] >= '0' && segment[i] <= '9';
+    }
+    if (digits) {
+        return true;
+    }
+    
+    // UUIDs: 8-4-4-4-12 hex digits
+    if (len != 36) {
+        return false;
+    }
+    for (size_t i = 0; i < len; i++) {
+        char c = segment[i];
+        bool dash = (i == 8 || i == 13 || i == 18 || i == 23);
+        bool hex = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+        if (dash ? c != '-' : !hex) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// "https://host/v2/droplets/123?page=2" -> "/v2/droplets/:id"
+static void metrics_normalize_endpoint(const char *url, char *out, size_t size) {
+    const char *path = url ? strstr(url, "://") : NULL;
+    path = path ? strchr(path + 3, '/') : url;
+    if (!path) {
+        path = "/";
+    }
+    
+    size_t length = 0;
+    while (*path && *path != '?' && *path != '#') {
+        const char *segment = path + 1;
+        size_t segment_len = strcspn(segment, "/?#");
+        const char *text = is_id_segment(segment, segment_len) ? ":id" : segment;
+        size_t text_len = text == segment ? segment_len : 3;
+        
+        if (length + 1 + text_len >= size) {
+            break;
+        }
+        out[length++] = '/';
+        memcpy(out + length, text, text_len);
+        length += text_len;
+        path = segment + segment_len;
+    }
+    
+    if (length == 0) {
+        out[length++] = '/';
+    }
+    out[length] = '\0';
+}
+
+static uint64_t metrics_hash(const char *method, const char *endpoint) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (const char *p = method; *p; p++) {
+        hash = (hash ^ (unsigned char)*p) * 1099511628211ULL;
+    }
+    hash = (hash ^ ' ') * 1099511628211ULL;
+    for (const char *p = endpoint; *p; p++) {
+        hash = (hash ^ (unsigned char)*p) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+// Finds or registers the series for a request. Registration claims a free
+// slot with a CAS, so lookups never block; the table never shrinks.
+static int metrics_series(const char *method, const char *url) {
+    char endpoint[DO_METRICS_ENDPOINT_MAX];
+    metrics_normalize_endpoint(url, endpoint, sizeof(endpoint));
+    if (!method) {
+        method = "?";
+    }
+    
+    uint64_t hash = metrics_hash(method, endpoint);
+    int slots = DO_METRICS_OVERFLOW;
+    
+    for (int probe = 0; probe < slots; probe++) {
+        int index = (int)((hash + (uint64_t)probe) % (uint64_t)slots);
+        metrics_series_t *series = &series_table[index];
+        
+        int state = atomic_load_explicit(&series->state, memory_order_acquire);
+        if (state == SERIES_FREE) {
+            int expected = SERIES_FREE;
+            if (atomic_compare_exchange_strong_explicit(&series->state, &expected, SERIES_CLAIMED,
+                                                        memory_order_acq_rel, memory_order_acquire)) {
+                series->hash = hash;
+                snprintf(series->method, sizeof(series->method), "%s", method);
+                snprintf(series->endpoint, sizeof(series->endpoint), "%s", endpoint);
+                atomic_store_explicit(&series->state, SERIES_READY, memory_order_release);
+                return index;
+            }
+            state = expected;
+        }
+        
+        // Another thread is filling the slot in; it only takes a moment
+        while (state == SERIES_CLAIMED) {
+            state = atomic_load_explicit(&series->state, memory_order_acquire);
+        }
+        
+        if (series->hash == hash && strncmp(series->method, method, sizeof(series->method) - 1) == 0 &&
+            strcmp(series->endpoint, endpoint) == 0) {
+            return index;
+        }
+    }
+    
+    return DO_METRICS_OVERFLOW;
+}
+
+void do_metrics_record_request(const char *method, const char *url, long status_code,
+                               bool completed, int64_t total_us,
+                               int64_t bytes_received, int64_t bytes_sent) {
+    metrics_cell_t *cell = metrics_cell(metrics_series(method, url));
+    
+    metrics_code_class_t code = METRICS_CODE_FAILED;
+    if (completed) {
+        if (status_code == 429) {
+            code = METRICS_CODE_429;
+        } else if (status_code >= 500) {
+            code = METRICS_CODE_5XX;
+        } else if (status_code >= 400) {
+            code = METRICS_CODE_4XX;
+        } else if (status_code >= 300) {
+            code = METRICS_CODE_3XX;
+        } else if (status_code >= 200) {
+            code = METRICS_CODE_2XX;
+        }
+    }
+    metrics_add(&cell->requests[code], 1);
+    
+    if (bytes_received > 0) {
+        metrics_add(&cell->bytes_received, (uint64_t)bytes_received);
+    }
+    if (bytes_sent > 0) {
+        metrics_add(&cell->bytes_sent, (uint64_t)bytes_sent);
+    }
+    
+    int bucket = 0;
+    while (bucket < DO_METRICS_BUCKETS && total_us > latency_bounds_us[bucket]) {
+        bucket++;
+    }
+    metrics_add(&cell->latency_buckets[bucket], 1);
+    metrics_add(&cell->latency_sum_us, total_us > 0 ? (uint64_t)total_us : 0);
+}
+
+void do_metrics_record_decode(const char *method, const char *url, int64_t parse_us,
+                              int64_t decode_us, bool json_error) {
+    if (parse_us <= 0 && decode_us <= 0 && !json_error) {
+        return;
+    }
+    
+    metrics_cell_t *cell = metrics_cell(metrics_series(method, url));
+    metrics_add(&cell->parse_us, parse_us > 0 ? (uint64_t)parse_us : 0);
+    metrics_add(&cell->decode_us, decode_us > 0 ? (uint64_t)decode_us : 0);
+    if (json_error) {
+        metrics_add(&cell->json_errors, 1);
+    }
+}
+
+void do_metrics_record_rate_limit(int64_t limit, int64_t remaining, int64_t reset) {
+    atomic_store_explicit(&rate_limit, limit, memory_order_relaxed);
+    atomic_store_explicit(&rate_limit_remaining, remaining, memory_order_relaxed);
+    atomic_store_explicit(&rate_limit_reset, reset, memory_order_relaxed);
+}
+
+void do_metrics_reset(void) {
+    for (int shard = 0; shard < DO_METRICS_SHARDS; shard++) {
+        for (int series = 0; series < DO_METRICS_MAX_SERIES; series++) {
+            metrics_cell_t *cell = &cells[shard][series];
+            for (int i = 0; i < METRICS_CODE_CLASSES; i++) {
+                atomic_store_explicit(&cell->requests[i], 0, memory_order_relaxed);
+            }
+            for (int i = 0; i <= DO_METRICS_BUCKETS; i++) {
+                atomic_store_explicit(&cell->latency_buckets[i], 0, memory_order_relaxed);
+            }
+            atomic_store_explicit(&cell->json_errors, 0, memory_order_relaxed);
+            atomic_store_explicit(&cell->bytes_received, 0, memory_order_relaxed);
+            atomic_store_explicit(&cell->bytes_sent, 0, memory_order_relaxed);
+            atomic_store_explicit(&cell->latency_sum_us, 0, memory_order_relaxed);
+            atomic_store_explicit(&cell->parse_us, 0, memory_order_relaxed);
+            atomic_store_explicit(&cell->decode_us, 0, memory_order_relaxed);
+        }
+    }
+}
+
+// Per-series totals summed over all shards at dump time
+typedef struct {
+    uint64_t requests[METRICS_CODE_CLASSES];
+    uint64_t count;
+    uint64_t json_errors;
+    uint64_t bytes_received;
+    uint64_t bytes_sent;
+    uint64_t latency_buckets[DO_METRICS_BUCKETS + 1];
+    uint64_t latency_sum_us;
+    uint64_t parse_us;
+    uint64_t decode_us;
+} metrics_totals_t;
+
+static uint64_t metrics_load(_Atomic uint64_t *counter) {
+    return atomic_load_explicit(counter, memory_order_relaxed);
+}
+
+static void metrics_collect(int series, metrics_totals_t *totals) {
+    memset(totals, 0, sizeof(*totals));
+    
+    for (int shard = 0; shard < DO_METRICS_SHARDS; shard++) {
+        metrics_cell_t *cell = &cells[shard][series];
+        for (int i = 0; i < METRICS_CODE_CLASSES; i++) {
+            uint64_t value = metrics_load(&cell->requests[i]);
+            totals->requests[i] += value;
+            totals->count += value;
+        }
+        for (int i = 0; i <= DO_METRICS_BUCKETS; i++) {
+            totals->latency_buckets[i] += metrics_load(&cell->latency_buckets[i]);
+        }
+        totals->json_errors += metrics_load(&cell->json_errors);
+        totals->bytes_received += metrics_load(&cell->bytes_received);
+        totals->bytes_sent += metrics_load(&cell->bytes_sent);
+        totals->latency_sum_us += metrics_load(&cell->latency_sum_us);
+        totals->parse_us += metrics_load(&cell->parse_us);
+        totals->decode_us += metrics_load(&cell->decode_us);
+    }
+}
+
+// Label values are escaped per the exposition format
+static void print_labels(FILE *out, const metrics_series_t *series) {
+    fprintf(out, "method=\"%s\",endpoint=\"", series->method);
+    for (const char *p = series->endpoint; *p; p++) {
+        if (*p == '"' || *p == '\\') {
+            fputc('\\', out);
+        }
+        fputc(*p, out);
+    }
+    fputc('"', out);
+}
+
+static void print_header(FILE *out, const char *name, const char *type, const char *help) {
+    fprintf(out, "# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+do_result_t do_metrics_dump_prometheus(FILE *out) {
+    if (!out) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    metrics_totals_t totals[DO_METRICS_MAX_SERIES];
+    const metrics_series_t *active[DO_METRICS_MAX_SERIES];
+    const metrics_totals_t *active_totals[DO_METRICS_MAX_SERIES];
+    int count = 0;
+    
+    for (int i = 0; i < DO_METRICS_MAX_SERIES; i++) {
+        if (atomic_load_explicit(&series_table[i].state, memory_order_acquire) != SERIES_READY) {
+            continue;
+        }
+        metrics_collect(i, &totals[i]);
+        if (totals[i].count == 0 && totals[i].parse_us == 0 && totals[i].json_errors == 0) {
+            continue;
+        }
+        active[count] = &series_table[i];
+        active_totals[count] = &totals[i];
+        count++;
+    }
+    
+    print_header(out, "do_requests_total", "counter",
+                 "API requests by method, endpoint and response status class.");
+    for (int i = 0; i < count; i++) {
+        for (int code = 0; code < METRICS_CODE_CLASSES; code++) {
+            if (active_totals[i]->requests[code] == 0) continue;
+            fputs("do_requests_total{", out);
+            print_labels(out, active[i]);
+            fprintf(out, ",code=\"%s\"} %llu\n", code_class_names[code],
+                    (unsigned long long)active_totals[i]->requests[code]);
+        }
+    }
+    
+    print_header(out, "do_json_errors_total", "counter",
+                 "Responses that could not be parsed or decoded.");
+    for (int i = 0; i < count; i++) {
+        fputs("do_json_errors_total{", out);
+        print_labels(out, active[i]);
+        fprintf(out, "} %llu\n", (unsigned long long)active_totals[i]->json_errors);
+    }
+    
+    print_header(out, "do_response_bytes_total", "counter", "Response body bytes received.");
+    for (int i = 0; i < count; i++) {
+        fputs("do_response_bytes_total{", out);
+        print_labels(out, active[i]);
+        fprintf(out, "} %llu\n", (unsigned long long)active_totals[i]->bytes_received);
+    }
+    
+    print_header(out, "do_request_bytes_total", "counter", "Request body bytes sent.");
+    for (int i = 0; i < count; i++) {
+        fputs("do_request_bytes_total{", out);
+        print_labels(out, active[i]);
+        fprintf(out, "} %llu\n", (unsigned long long)active_totals[i]->bytes_sent);
+    }
+    
+    print_header(out, "do_request_duration_seconds", "histogram",
+                 "Wall time of API requests, from start to last byte.");
+    for (int i = 0; i < count; i++) {
+        uint64_t cumulative = 0;
+        for (int bucket = 0; bucket <= DO_METRICS_BUCKETS; bucket++) {
+            cumulative += active_totals[i]->latency_buckets[bucket];
+            fputs("do_request_duration_seconds_bucket{", out);
+            print_labels(out, active[i]);
+            if (bucket < DO_METRICS_BUCKETS) {
+                fprintf(out, ",le=\"%g\"} %llu\n", (double)latency_bounds_us[bucket] / 1e6,
+                        (unsigned long long)cumulative);
+            } else {
+                fprintf(out, ",le=\"+Inf\"} %llu\n", (unsigned long long)cumulative);
+            }
+        }
+        fputs("do_request_duration_seconds_sum{", out);
+        print_labels(out, active[i]);
+        fprintf(out, "} %.6f\n", (double)active_totals[i]->latency_sum_us / 1e6);
+        fputs("do_request_duration_seconds_count{", out);
+        print_labels(out, active[i]);
+        fprintf(out, "} %llu\n", (unsigned long long)cumulative);
+    }
+    
+    print_header(out, "do_parse_seconds_total", "counter", "Time spent parsing response JSON.");
+    for (int i = 0; i < count; i++) {
+        fputs("do_parse_seconds_total{", out);
+        print_labels(out, active[i]);
+        fprintf(out, "} %.6f\n", (double)active_totals[i]->parse_us / 1e6);
+    }
+    
+    print_header(out, "do_decode_seconds_total", "counter",
+                 "Time spent decoding parsed JSON into library types.");
+    for (int i = 0; i < count; i++) {
+        fputs("do_decode_seconds_total{", out);
+        print_labels(out, active[i]);
+        fprintf(out, "} %.6f\n", (double)active_totals[i]->decode_us / 1e6);
+    }
+    
+    // Rate-limit gauges reflect the most recent response that carried them
+    int64_t limit = atomic_load_explicit(&rate_limit, memory_order_relaxed);
+    if (limit >= 0) {
+        print_header(out, "do_ratelimit_limit", "gauge", "Requests allowed per rate-limit window.");
+        fprintf(out, "do_ratelimit_limit %lld\n", (long long)limit);
+        print_header(out, "do_ratelimit_remaining", "gauge", "Requests left in the current window.");
+        fprintf(out, "do_ratelimit_remaining %lld\n",
+                (long long)atomic_load_explicit(&rate_limit_remaining, memory_order_relaxed));
+        print_header(out, "do_ratelimit_reset_timestamp_seconds", "gauge",
+                     "Unix time at which the window resets.");
+        fprintf(out, "do_ratelimit_reset_timestamp_seconds %lld\n",
+                (long long)atomic_load_explicit(&rate_limit_reset, memory_order_relaxed));
+    }
+    
+    return DO_SUCCESS;
+}
\ No newline at end of file
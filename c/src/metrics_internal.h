@@ -0,0 +1,21 @@
+#ifndef DO_METRICS_INTERNAL_H
+#define DO_METRICS_INTERNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Feeds for the metrics registry (metrics.c). Writers never lock, so these
+// are safe from any thread.
+
+void do_metrics_record_request(const char *method, const char *url, long status_code,
+                               bool completed, int64_t total_us,
+                               int64_t bytes_received, int64_t bytes_sent);
+
+// Parse and decode time spent on a response, and whether it failed to decode
+void do_metrics_record_decode(const char *method, const char *url, int64_t parse_us,
+                              int64_t decode_us, bool json_error);
+
+// The last RateLimit-* headers seen
+void do_metrics_record_rate_limit(int64_t limit, int64_t remaining, int64_t reset);
+
+#endif // DO_METRICS_INTERNAL_H
\ No newline at end of file
@@ -0,0 +1,696 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <cjson/cjson.h>
+#include "digitalocean/monitoring.h"
+#include "digitalocean/alloc.h"
+#include "http_transfer.h"
+#include "json_internal.h"
+#include "metrics_internal.h"
+
+#define DO_METRIC_DEFAULT_LOOKBACK 3600
+#define DO_METRIC_DEFAULT_CONCURRENCY 16
+#define DO_METRIC_NONE ((size_t)-1)
+
+static const struct {
+    const char *name;
+    const char *path;   // under /v2/monitoring/metrics/droplet/
+    const char *query;  // extra parameters
+} metric_kinds[DO_METRIC_KIND_COUNT] = {
+    [DO_METRIC_CPU] = {"cpu", "cpu", ""},
+    [DO_METRIC_LOAD_1] = {"load_1", "load_1", ""},
+    [DO_METRIC_LOAD_5] = {"load_5", "load_5", ""},
+    [DO_METRIC_LOAD_15] = {"load_15", "load_15", ""},
+    [DO_METRIC_MEMORY_TOTAL] = {"memory_total", "memory_total", ""},
+    [DO_METRIC_MEMORY_AVAILABLE] = {"memory_available", "memory_available", ""},
+    [DO_METRIC_MEMORY_FREE] = {"memory_free", "memory_free", ""},
+    [DO_METRIC_MEMORY_CACHED] = {"memory_cached", "memory_cached", ""},
+    [DO_METRIC_FILESYSTEM_FREE] = {"filesystem_free", "filesystem_free", ""},
+    [DO_METRIC_FILESYSTEM_SIZE] = {"filesystem_size", "filesystem_size", ""},
+    [DO_METRIC_BANDWIDTH_PUBLIC_IN] = {"bandwidth_public_in", "bandwidth",
+                                       "&interface=public&direction=inbound"},
+    [DO_METRIC_BANDWIDTH_PUBLIC_OUT] = {"bandwidth_public_out", "bandwidth",
+                                        "&interface=public&direction=outbound"},
+    [DO_METRIC_BANDWIDTH_PRIVATE_IN] = {"bandwidth_private_in", "bandwidth",
+                                        "&interface=private&direction=inbound"},
+    [DO_METRIC_BANDWIDTH_PRIVATE_OUT] = {"bandwidth_private_out", "bandwidth",
+                                         "&interface=private&direction=outbound"},
+};
+
+const char *do_metric_kind_name(do_metric_kind_t kind) {
+    return (unsigned)kind < DO_METRIC_KIND_COUNT ? metric_kinds[kind].name : NULL;
+}
+
+bool do_metric_kind_parse(const char *name, do_metric_kind_t *kind) {
+    if (!name || !kind) {
+        return false;
+    }
+    
+    for (int i = 0; i < DO_METRIC_KIND_COUNT; i++) {
+        if (strcmp(metric_kinds[i].name, name) == 0) {
+            *kind = (do_metric_kind_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+// A droplet and metric pair: how far it has been fetched and its series
+typedef struct {
+    uint32_t droplet_id;
+    do_metric_kind_t kind;
+    int64_t fetched_until;  // end of the last complete window; 0 before the first
+    size_t first_series;    // chained through next_series
+} metric_window_t;
+
+struct do_metric_store {
+    do_metric_series_t *series;
+    size_t *next_series;
+    size_t count;
+    size_t capacity;
+    metric_window_t *windows;
+    size_t window_count;
+    size_t window_capacity;
+    size_t *slots;          // open addressing over windows; DO_METRIC_NONE is empty
+    size_t slot_count;      // power of two, at most half full
+};
+
+do_metric_store_t *do_metric_store_new(void) {
+    return do_calloc(1, sizeof(do_metric_store_t));
+}
+
+void do_metric_store_free(do_metric_store_t *store) {
+    if (!store) {
+        return;
+    }
+    
+    for (size_t i = 0; i < store->count; i++) {
+        do_free(store->series[i].labels);
+        do_free(store->series[i].timestamps);
+        do_free(store->series[i].values);
+    }
+    do_free(store->series);
+    do_free(store->next_series);
+    do_free(store->windows);
+    do_free(store->slots);
+    do_free(store);
+}
+
+size_t do_metric_store_count(const do_metric_store_t *store) {
+    return store ? store->count : 0;
+}
+
+const do_metric_series_t *do_metric_store_series(const do_metric_store_t *store, size_t index) {
+    return store && index < store->count ? &store->series[index] : NULL;
+}
+
+static size_t metric_window_slot(const do_metric_store_t *store, uint32_t droplet_id,
+                                 do_metric_kind_t kind) {
+    uint64_t key = ((uint64_t)droplet_id << 8) | (uint64_t)kind;
+    return (size_t)((key * 0x9e3779b97f4a7c15ULL) >> 17) & (store->slot_count - 1);
+}
+
+static size_t metric_window_find(const do_metric_store_t *store, uint32_t droplet_id,
+                                 do_metric_kind_t kind) {
+    if (store->slot_count == 0) {
+        return DO_METRIC_NONE;
+    }
+    
+    for (size_t slot = metric_window_slot(store, droplet_id, kind); ;
+         slot = (slot + 1) & (store->slot_count - 1)) {
+        size_t index = store->slots[slot];
+        if (index == DO_METRIC_NONE) {
+            return DO_METRIC_NONE;
+        }
+        if (store->windows[index].droplet_id == droplet_id && store->windows[index].kind == kind) {
+            return index;
+        }
+    }
+}
+
+static void metric_window_insert_slot(do_metric_store_t *store, size_t index) {
+    const metric_window_t *window = &store->windows[index];
+    size_t slot = metric_window_slot(store, window->droplet_id, window->kind);
+    while (store->slots[slot] != DO_METRIC_NONE) {
+        slot = (slot + 1) & (store->slot_count - 1);
+    }
+    store->slots[slot] = index;
+}
+
+// Finds or creates the window for a pair
+static size_t metric_window_get(do_metric_store_t *store, uint32_t droplet_id,
+                                do_metric_kind_t kind) {
+    size_t index = metric_window_find(store, droplet_id, kind);
+    if (index != DO_METRIC_NONE) {
+        return index;
+    }
+    
+    if (store->window_count == store->window_capacity) {
+        size_t new_capacity = store->window_capacity ? store->window_capacity * 2 : 64;
+        metric_window_t *new_windows = do_realloc(store->windows,
+                                                  new_capacity * sizeof(metric_window_t));
+        if (!new_windows) {
+            return DO_METRIC_NONE;
+        }
+        store->windows = new_windows;
+        store->window_capacity = new_capacity;
+    }
+    
+    if ((store->window_count + 1) * 2 > store->slot_count) {
+        size_t new_slot_count = store->slot_count ? store->slot_count * 2 : 128;
+        size_t *new_slots = do_malloc(new_slot_count * sizeof(size_t));
+        if (!new_slots) {
+            return DO_METRIC_NONE;
+        }
+        
+        do_free(store->slots);
+        store->slots = new_slots;
+        store->slot_count = new_slot_count;
+        memset(store->slots, 0xff, new_slot_count * sizeof(size_t));
+        for (size_t i = 0; i < store->window_count; i++) {
+            metric_window_insert_slot(store, i);
+        }
+    }
+    
+    index = store->window_count++;
+    metric_window_t *window = &store->windows[index];
+    window->droplet_id = droplet_id;
+    window->kind = kind;
+    window->fetched_until = 0;
+    window->first_series = DO_METRIC_NONE;
+    metric_window_insert_slot(store, index);
+    return index;
+}
+
+const do_metric_series_t *do_metric_store_find(const do_metric_store_t *store, uint32_t droplet_id,
+                                               do_metric_kind_t kind, const char *labels) {
+    if (!store) {
+        return NULL;
+    }
+    
+    size_t window = metric_window_find(store, droplet_id, kind);
+    if (window == DO_METRIC_NONE) {
+        return NULL;
+    }
+    
+    for (size_t i = store->windows[window].first_series; i != DO_METRIC_NONE;
+         i = store->next_series[i]) {
+        if (!labels || strcmp(store->series[i].labels, labels) == 0) {
+            return &store->series[i];
+        }
+    }
+    return NULL;
+}
+
+// Finds or creates the series of a window with the given labels
+static size_t metric_series_get(do_metric_store_t *store, size_t window, const char *labels) {
+    size_t *link = &store->windows[window].first_series;
+    while (*link != DO_METRIC_NONE) {
+        if (strcmp(store->series[*link].labels, labels) == 0) {
+            return *link;
+        }
+        link = &store->next_series[*link];
+    }
+    
+    if (store->count == store->capacity) {
+        size_t new_capacity = store->capacity ? store->capacity * 2 : 64;
+        do_metric_series_t *new_series = do_realloc(store->series,
+                                                    new_capacity * sizeof(do_metric_series_t));
+        if (!new_series) {
+            return DO_METRIC_NONE;
+        }
+        store->series = new_series;
+        
+        // link may point into the old chain array
+        size_t link_offset = link == &store->windows[window].first_series
+            ? DO_METRIC_NONE : (size_t)(link - store->next_series);
+        size_t *new_next = do_realloc(store->next_series, new_capacity * sizeof(size_t));
+        if (!new_next) {
+            return DO_METRIC_NONE;
+        }
+        store->next_series = new_next;
+        store->capacity = new_capacity;
+        if (link_offset != DO_METRIC_NONE) {
+            link = &store->next_series[link_offset];
+        }
+    }
+    
+    size_t index = store->count;
+    do_metric_series_t *series = &store->series[index];
+    memset(series, 0, sizeof(*series));
+    series->labels = do_strdup(labels);
+    if (!series->labels) {
+        return DO_METRIC_NONE;
+    }
+    series->droplet_id = store->windows[window].droplet_id;
+    series->kind = store->windows[window].kind;
+    
+    store->next_series[index] = DO_METRIC_NONE;
+    *link = index;
+    store->count++;
+    return index;
+}
+
+void do_metric_store_trim(do_metric_store_t *store, int64_t before) {
+    if (!store) {
+        return;
+    }
+    
+    for (size_t i = 0; i < store->count; i++) {
+        do_metric_series_t *series = &store->series[i];
+        size_t drop = 0;
+        while (drop < series->count && series->timestamps[drop] < before) {
+            drop++;
+        }
+        if (drop == 0) {
+            continue;
+        }
+        
+        series->count -= drop;
+        memmove(series->timestamps, series->timestamps + drop, series->count * sizeof(int64_t));
+        memmove(series->values, series->values + drop, series->count * sizeof(double));
+    }
+}
+
+// One request in flight
+typedef struct {
+    CURL *curl;
+    do_http_response_t *response;
+    do_metric_store_t *store;
+    size_t window;
+    int64_t end;
+    size_t series;   // series being decoded
+    bool busy;
+} metric_transfer_t;
+
+// Labels other than host_id, in the order the API sent them
+static do_result_t metric_open_series(const cJSON *labels, void **series, void *userdata) {
+    metric_transfer_t *transfer = userdata;
+    char text[512];
+    size_t length = 0;
+    text[0] = '\0';
+    
+    const cJSON *label;
+    cJSON_ArrayForEach(label, labels) {
+        if (!label->string || !cJSON_IsString(label) || strcmp(label->string, "host_id") == 0) {
+            continue;
+        }
+        int written = snprintf(text + length, sizeof(text) - length, "%s%s=%s",
+                               length ? "," : "", label->string, label->valuestring);
+        if (written < 0 || (size_t)written >= sizeof(text) - length) {
+            return DO_ERROR_JSON;
+        }
+        length += (size_t)written;
+    }
+    
+    transfer->series = metric_series_get(transfer->store, transfer->window, text);
+    *series = transfer;
+    return transfer->series == DO_METRIC_NONE ? DO_ERROR_MEMORY : DO_SUCCESS;
+}
+
+// Appends a batch to the columns. Windows overlap at their edges, so
+// samples at or before the last one stored are dropped.
+static do_result_t metric_append_points(void *target, const int64_t *timestamps,
+                                        const double *values, size_t count, void *userdata) {
+    (void)userdata;
+    metric_transfer_t *transfer = target;
+    do_metric_series_t *series = &transfer->store->series[transfer->series];
+    
+    size_t skip = 0;
+    if (series->count > 0) {
+        int64_t last = series->timestamps[series->count - 1];
+        while (skip < count && timestamps[skip] <= last) {
+            skip++;
+        }
+    }
+    count -= skip;
+    if (count == 0) {
+        return DO_SUCCESS;
+    }
+    
+    if (series->count + count > series->capacity) {
+        size_t new_capacity = series->capacity ? series->capacity : 64;
+        while (new_capacity < series->count + count) {
+            new_capacity *= 2;
+        }
+        
+        int64_t *new_timestamps = do_realloc(series->timestamps, new_capacity * sizeof(int64_t));
+        if (!new_timestamps) {
+            return DO_ERROR_MEMORY;
+        }
+        series->timestamps = new_timestamps;
+        
+        double *new_values = do_realloc(series->values, new_capacity * sizeof(double));
+        if (!new_values) {
+            return DO_ERROR_MEMORY;
+        }
+        series->values = new_values;
+        series->capacity = new_capacity;
+    }
+    
+    memcpy(series->timestamps + series->count, timestamps + skip, count * sizeof(int64_t));
+    memcpy(series->values + series->count, values + skip, count * sizeof(double));
+    series->count += count;
+    return DO_SUCCESS;
+}
+
+static int64_t metric_clock_us(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+// Walks droplet x metric pairs in order, skipping those with nothing new
+typedef struct {
+    do_client_t *client;
+    do_metric_store_t *store;
+    const do_metric_scrape_t *scrape;
+    struct curl_slist *headers;
+    CURLM *multi;
+    int64_t end;
+    int64_t lookback;
+    size_t next_job;
+    size_t running;
+    do_result_t failure;
+} metric_scrape_state_t;
+
+static do_result_t metric_start_next(metric_scrape_state_t *state, metric_transfer_t *transfer) {
+    const do_metric_scrape_t *scrape = state->scrape;
+    size_t jobs = scrape->droplet_count * scrape->kind_count;
+    
+    while (state->next_job < jobs) {
+        size_t job = state->next_job++;
+        uint32_t droplet_id = scrape->droplet_ids[job / scrape->kind_count];
+        do_metric_kind_t kind = scrape->kinds[job % scrape->kind_count];
+        if ((unsigned)kind >= DO_METRIC_KIND_COUNT) {
+            return DO_ERROR_INVALID_PARAM;
+        }
+        
+        size_t window = metric_window_get(state->store, droplet_id, kind);
+        if (window == DO_METRIC_NONE) {
+            return DO_ERROR_MEMORY;
+        }
+        
+        int64_t fetched_until = state->store->windows[window].fetched_until;
+        int64_t start = fetched_until ? fetched_until : state->end - state->lookback;
+        if (start >= state->end) {
+            continue;
+        }
+        
+        char path[256];
+        snprintf(path, sizeof(path), "/v2/monitoring/metrics/droplet/%s?host_id=%u&start=%lld&end=%lld%s",
+                 metric_kinds[kind].path, droplet_id, (long long)start, (long long)state->end,
+                 metric_kinds[kind].query);
+        char *url = do_http_build_url(state->client->config->base_url, path);
+        if (!url) {
+            return DO_ERROR_MEMORY;
+        }
+        
+        do_http_response_clear(transfer->response);
+        transfer->window = window;
+        transfer->end = state->end;
+        curl_easy_setopt(transfer->curl, CURLOPT_URL, url);
+        do_free(url);
+        
+        do_result_t result = do_http_transfer_start(state->client->http_client, state->multi,
+                                                    transfer->curl);
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+        
+        transfer->busy = true;
+        state->running++;
+        return DO_SUCCESS;
+    }
+    
+    return DO_SUCCESS;
+}
+
+static do_result_t metric_transfer_done(void *owner, CURLcode res, void *userdata) {
+    metric_transfer_t *transfer = owner;
+    metric_scrape_state_t *state = userdata;
+    do_client_t *client = state->client;
+    transfer->busy = false;
+    state->running--;
+    
+    do_request_timing_t timing;
+    do_result_t result = do_http_transfer_finish(client->http_client, transfer->curl, "GET", res,
+                                                 &timing);
+    if (result == DO_SUCCESS) {
+        int64_t decode_start = metric_clock_us();
+        const do_http_response_t *response = transfer->response;
+        result = response->data
+            ? json_scan_metric_matrix(response->data, response->size, metric_open_series,
+                                      metric_append_points, transfer)
+            : DO_ERROR_JSON;
+        timing.decode_us = metric_clock_us() - decode_start;
+        do_metrics_record_decode(timing.method, timing.url, 0, timing.decode_us,
+                                 result == DO_ERROR_JSON);
+    }
+    
+    if (client->timing_callback) {
+        client->timing_callback(&timing, client->timing_userdata);
+    }
+    
+    // A failed window is fetched again in full next time; samples it did
+    // store are skipped then as overlap
+    if (result == DO_SUCCESS) {
+        state->store->windows[transfer->window].fetched_until = transfer->end;
+    } else if (state->failure == DO_SUCCESS) {
+        state->failure = result;
+    }
+    
+    return metric_start_next(state, transfer);
+}
+
+static do_result_t metric_transfer_init(metric_scrape_state_t *state, metric_transfer_t *transfer) {
+    do_http_client_t *http_client = state->client->http_client;
+    
+    transfer->store = state->store;
+    transfer->response = do_http_client_acquire_response(http_client);
+    if (!transfer->response) {
+        return DO_ERROR_MEMORY;
+    }
+    transfer->curl = do_http_transfer_new(http_client, state->headers, transfer->response, transfer);
+    return transfer->curl ? DO_SUCCESS : DO_ERROR_MEMORY;
+}
+
+static do_result_t metric_scrape_run(metric_scrape_state_t *state, metric_transfer_t *transfers,
+                                     size_t transfer_count) {
+    for (size_t i = 0; i < transfer_count; i++) {
+        do_result_t result = metric_transfer_init(state, &transfers[i]);
+        if (result == DO_SUCCESS) {
+            result = metric_start_next(state, &transfers[i]);
+        }
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+    }
+    
+    return do_http_multi_run(state->multi, &state->running, metric_transfer_done, state);
+}
+
+do_result_t do_client_scrape_metrics(do_client_t *client, do_metric_store_t *store,
+                                     const do_metric_scrape_t *scrape) {
+    if (!client || !client->config || !client->http_client || !store || !scrape ||
+        (scrape->droplet_count && !scrape->droplet_ids) || (scrape->kind_count && !scrape->kinds)) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    size_t jobs = scrape->droplet_count * scrape->kind_count;
+    if (jobs == 0) {
+        return DO_SUCCESS;
+    }
+    
+    metric_scrape_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.client = client;
+    state.store = store;
+    state.scrape = scrape;
+    state.end = scrape->end ? scrape->end : (int64_t)time(NULL);
+    state.lookback = scrape->lookback > 0 ? scrape->lookback : DO_METRIC_DEFAULT_LOOKBACK;
+    
+    size_t transfer_count = scrape->max_concurrency ? scrape->max_concurrency
+                                                    : DO_METRIC_DEFAULT_CONCURRENCY;
+    if (transfer_count > jobs) {
+        transfer_count = jobs;
+    }
+    
+    state.multi = curl_multi_init();
+    state.headers = curl_slist_append(NULL, "Content-Type: application/json");
+    if (state.headers) {
+        struct curl_slist *auth = curl_slist_append(state.headers, client->auth_header);
+        if (!auth) {
+            curl_slist_free_all(state.headers);
+            state.headers = NULL;
+        }
+    }
+    metric_transfer_t *transfers = do_calloc(transfer_count, sizeof(metric_transfer_t));
+    
+    do_result_t result = state.multi && state.headers && transfers
+        ? metric_scrape_run(&state, transfers, transfer_count) : DO_ERROR_MEMORY;
+    
+    for (size_t i = 0; transfers && i < transfer_count; i++) {
+        if (transfers[i].busy) {
+            curl_multi_remove_handle(state.multi, transfers[i].curl);
+        }
+        if (transfers[i].curl) {
+            curl_easy_cleanup(transfers[i].curl);
+        }
+        do_http_client_release_response(client->http_client, transfers[i].response);
+    }
+    do_free(transfers);
+    curl_slist_free_all(state.headers);
+    if (state.multi) {
+        curl_multi_cleanup(state.multi);
+    }
+    
+    return result != DO_SUCCESS ? result : state.failure;
+}
+
+// Index of the first sample at or after t
+static size_t metric_lower_bound(const do_metric_series_t *series, int64_t t) {
+    size_t low = 0;
+    size_t high = series->count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (series->timestamps[mid] < t) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+// k-th smallest of values[0..count), reordering them
+static double metric_select(double *values, size_t count, size_t k) {
+    size_t low = 0;
+    size_t high = count - 1;
+    while (low < high) {
+        double pivot = values[low + (high - low) / 2];
+        size_t i = low;
+        size_t j = high;
+        while (i <= j) {
+            while (values[i] < pivot) i++;
+            while (values[j] > pivot) j--;
+            if (i <= j) {
+                double swap = values[i];
+                values[i] = values[j];
+                values[j] = swap;
+                i++;
+                if (j == 0) break;
+                j--;
+            }
+        }
+        if (k <= j) {
+            high = j;
+        } else if (k >= i) {
+            low = i;
+        } else {
+            break;
+        }
+    }
+    return values[k];
+}
+
+// Aggregates a contiguous run of samples. NaN samples are left out; the
+// survivors are packed into scratch for the percentile. Plain loops over
+// the column so the compiler can vectorize them.
+static size_t metric_aggregate(const double *values, size_t count, double *scratch,
+                               do_metric_rollup_t *out, bool want_p95) {
+    double min = INFINITY;
+    double max = -INFINITY;
+    double sum = 0.0;
+    size_t kept = 0;
+    
+    for (size_t i = 0; i < count; i++) {
+        double v = values[i];
+        if (v != v) {
+            continue;
+        }
+        min = v < min ? v : min;
+        max = v > max ? v : max;
+        sum += v;
+        if (want_p95) {
+            scratch[kept] = v;
+        }
+        kept++;
+    }
+    
+    out->count = kept;
+    if (kept == 0) {
+        out->min = out->max = out->avg = out->p95 = NAN;
+        return 0;
+    }
+    
+    out->min = min;
+    out->max = max;
+    out->avg = sum / (double)kept;
+    // Nearest-rank percentile
+    out->p95 = want_p95 ? metric_select(scratch, kept, (kept * 95 + 99) / 100 - 1) : NAN;
+    return kept;
+}
+
+do_result_t do_metric_rollup(const do_metric_series_t *series, int64_t start, int64_t end,
+                             do_metric_rollup_t *rollup) {
+    if (!series || !rollup) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    size_t first = metric_lower_bound(series, start);
+    size_t last = metric_lower_bound(series, end);
+    size_t count = last > first ? last - first : 0;
+    
+    double *scratch = count ? do_malloc(count * sizeof(double)) : NULL;
+    if (count && !scratch) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    metric_aggregate(series->values + first, count, scratch, rollup, true);
+    do_free(scratch);
+    return DO_SUCCESS;
+}
+
+size_t do_metric_downsample(const do_metric_series_t *series, int64_t start, int64_t step,
+                            do_metric_agg_t agg, int64_t *timestamps, double *values,
+                            size_t max_points) {
+    if (!series || step <= 0 || !timestamps || !values || max_points == 0) {
+        return 0;
+    }
+    
+    size_t i = metric_lower_bound(series, start);
+    bool want_p95 = agg == DO_METRIC_AGG_P95;
+    double *scratch = NULL;
+    if (want_p95 && i < series->count) {
+        scratch = do_malloc((series->count - i) * sizeof(double));
+        if (!scratch) {
+            return 0;
+        }
+    }
+    
+    size_t written = 0;
+    while (i < series->count && written < max_points) {
+        int64_t bucket = start + (series->timestamps[i] - start) / step * step;
+        size_t j = metric_lower_bound(series, bucket + step);
+        
+        do_metric_rollup_t rollup;
+        if (metric_aggregate(series->values + i, j - i, scratch, &rollup, want_p95) > 0) {
+            timestamps[written] = bucket;
+            switch (agg) {
+                case DO_METRIC_AGG_MIN: values[written] = rollup.min; break;
+                case DO_METRIC_AGG_MAX: values[written] = rollup.max; break;
+                case DO_METRIC_AGG_AVG: values[written] = rollup.avg; break;
+                case DO_METRIC_AGG_P95: values[written] = rollup.p95; break;
+            }
+            written++;
+        }
+        i = j;
+    }
+    
+    do_free(scratch);
+    return written;
+}
\ No newline at end of file
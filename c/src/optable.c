@@ -0,0 +1,3168 @@
+// Generated by scripts/gen_optable.py from DigitalOcean-public.v2.yaml.
+// Do not edit; rerun the script when the spec changes.
+#include <stddef.h>
+#include "optable.h"
+
+// Every string once, as members of one struct so that offsets into it
+// are compile-time constants
+static const struct do_optable_pool {
+    char s0[sizeof("databases_install_update")];
+    char s1[sizeof("PUT")];
+    char s2[sizeof("/v2/databases/{database_cluster_uuid}/install_update")];
+    char s3[sizeof("database_cluster_uuid")];
+    char s4[sizeof("vpcs_delete")];
+    char s5[sizeof("DELETE")];
+    char s6[sizeof("/v2/vpcs/{vpc_id}")];
+    char s7[sizeof("vpc_id")];
+    char s8[sizeof("imageActions_post")];
+    char s9[sizeof("POST")];
+    char s10[sizeof("/v2/images/{image_id}/actions")];
+    char s11[sizeof("image_id")];
+    char s12[sizeof("type")];
+    char s13[sizeof("monitoring_get_dropletMemoryFreeMetrics")];
+    char s14[sizeof("GET")];
+    char s15[sizeof("/v2/monitoring/metrics/droplet/memory_free")];
+    char s16[sizeof("host_id")];
+    char s17[sizeof("start")];
+    char s18[sizeof("end")];
+    char s19[sizeof("loadBalancers_create")];
+    char s20[sizeof("/v2/load_balancers")];
+    char s21[sizeof("forwarding_rules")];
+    char s22[sizeof("region")];
+    char s23[sizeof("droplets_list_backup_policies")];
+    char s24[sizeof("/v2/droplets/backups/policies")];
+    char s25[sizeof("per_page")];
+    char s26[sizeof("page")];
+    char s27[sizeof("kubernetes_create_cluster")];
+    char s28[sizeof("/v2/kubernetes/clusters")];
+    char s29[sizeof("name")];
+    char s30[sizeof("node_pools")];
+    char s31[sizeof("version")];
+    char s32[sizeof("kubernetes_get_clusterLintResults")];
+    char s33[sizeof("/v2/kubernetes/clusters/{cluster_id}/clusterlint")];
+    char s34[sizeof("cluster_id")];
+    char s35[sizeof("run_id")];
+    char s36[sizeof("kubernetes_get_status_messages")];
+    char s37[sizeof("/v2/kubernetes/clusters/{cluster_id}/status_messages")];
+    char s38[sizeof("since")];
+    char s39[sizeof("monitoring_delete_destination")];
+    char s40[sizeof("/v2/monitoring/sinks/destinations/{destination_uuid}")];
+    char s41[sizeof("destination_uuid")];
+    char s42[sizeof("genai_detach_agent")];
+    char s43[sizeof("/v2/gen-ai/agents/{parent_agent_uuid}/child_agents/{child_agent_uuid}")];
+    char s44[sizeof("parent_agent_uuid")];
+    char s45[sizeof("child_agent_uuid")];
+    char s46[sizeof("autoscalepools_list_members")];
+    char s47[sizeof("/v2/droplets/autoscale/{autoscale_pool_id}/members")];
+    char s48[sizeof("autoscale_pool_id")];
+    char s49[sizeof("vpcPeerings_get")];
+    char s50[sizeof("/v2/vpc_peerings/{vpc_peering_id}")];
+    char s51[sizeof("vpc_peering_id")];
+    char s52[sizeof("vpcPeerings_delete")];
+    char s53[sizeof("monitoring_get_DropletCpuMetrics")];
+    char s54[sizeof("/v2/monitoring/metrics/droplet/cpu")];
+    char s55[sizeof("firewalls_delete_droplets")];
+    char s56[sizeof("/v2/firewalls/{firewall_id}/droplets")];
+    char s57[sizeof("firewall_id")];
+    char s58[sizeof("droplet_ids")];
+    char s59[sizeof("volumeActions_post")];
+    char s60[sizeof("/v2/volumes/actions")];
+    char s61[sizeof("droplet_id")];
+    char s62[sizeof("monitoring_create_sink")];
+    char s63[sizeof("/v2/monitoring/sinks")];
+    char s64[sizeof("monitoring_get_droplet_autoscale_current_cpu_utilization.yml")];
+    char s65[sizeof("/v2/monitoring/metrics/droplet_autoscale/current_cpu_utilization")];
+    char s66[sizeof("apps_list_deployments")];
+    char s67[sizeof("/v2/apps/{app_id}/deployments")];
+    char s68[sizeof("app_id")];
+    char s69[sizeof("genai_update_attached_agent")];
+    char s70[sizeof("droplets_destroy")];
+    char s71[sizeof("/v2/droplets/{droplet_id}")];
+    char s72[sizeof("vpcPeerings_list")];
+    char s73[sizeof("/v2/vpc_peerings")];
+    char s74[sizeof("domains_get")];
+    char s75[sizeof("/v2/domains/{domain_name}")];
+    char s76[sizeof("domain_name")];
+    char s77[sizeof("volumes_delete")];
+    char s78[sizeof("/v2/volumes/{volume_id}")];
+    char s79[sizeof("volume_id")];
+    char s80[sizeof("sshKeys_list")];
+    char s81[sizeof("/v2/account/keys")];
+    char s82[sizeof("regions_list")];
+    char s83[sizeof("/v2/regions")];
+    char s84[sizeof("monitoring_get_appMemoryPercentageMetrics")];
+    char s85[sizeof("/v2/monitoring/metrics/apps/memory_percentage")];
+    char s86[sizeof("app_component")];
+    char s87[sizeof("droplets_list_snapshots")];
+    char s88[sizeof("/v2/droplets/{droplet_id}/snapshots")];
+    char s89[sizeof("volumeSnapshots_delete_byId")];
+    char s90[sizeof("/v2/volumes/snapshots/{snapshot_id}")];
+    char s91[sizeof("snapshot_id")];
+    char s92[sizeof("domains_update_record")];
+    char s93[sizeof("/v2/domains/{domain_name}/records/{domain_record_id}")];
+    char s94[sizeof("domain_record_id")];
+    char s95[sizeof("kubernetes_list_options")];
+    char s96[sizeof("/v2/kubernetes/options")];
+    char s97[sizeof("databases_get_connectionPool")];
+    char s98[sizeof("/v2/databases/{database_cluster_uuid}/pools/{pool_name}")];
+    char s99[sizeof("pool_name")];
+    char s100[sizeof("databases_get_migrationStatus")];
+    char s101[sizeof("/v2/databases/{database_cluster_uuid}/online-migration")];
+    char s102[sizeof("projects_assign_resources_default")];
+    char s103[sizeof("/v2/projects/default/resources")];
+    char s104[sizeof("monitoring_get_lb_frontend_network_throughput_http")];
+    char s105[sizeof("/v2/monitoring/metrics/load_balancer/frontend_network_throughput_http")];
+    char s106[sizeof("lb_id")];
+    char s107[sizeof("kubernetes_destroy_associatedResourcesSelective")];
+    char s108[sizeof("/v2/kubernetes/clusters/{cluster_id}/destroy_with_associated_resources/selective")];
+    char s109[sizeof("cdn_update_endpoints")];
+    char s110[sizeof("/v2/cdn/endpoints/{cdn_id}")];
+    char s111[sizeof("cdn_id")];
+    char s112[sizeof("reservedIPv6_delete")];
+    char s113[sizeof("/v2/reserved_ipv6/{reserved_ipv6}")];
+    char s114[sizeof("reserved_ipv6")];
+    char s115[sizeof("firewalls_get")];
+    char s116[sizeof("/v2/firewalls/{firewall_id}")];
+    char s117[sizeof("databases_create_replica")];
+    char s118[sizeof("/v2/databases/{database_cluster_uuid}/replicas")];
+    char s119[sizeof("size")];
+    char s120[sizeof("partnerAttachments_get")];
+    char s121[sizeof("/v2/partner_network_connect/attachments/{pa_id}")];
+    char s122[sizeof("pa_id")];
+    char s123[sizeof("spacesKey_patch")];
+    char s124[sizeof("PATCH")];
+    char s125[sizeof("/v2/spaces/keys/{access_key}")];
+    char s126[sizeof("access_key")];
+    char s127[sizeof("apps_list_alerts")];
+    char s128[sizeof("/v2/apps/{app_id}/alerts")];
+    char s129[sizeof("snapshots_list")];
+    char s130[sizeof("/v2/snapshots")];
+    char s131[sizeof("resource_type")];
+    char s132[sizeof("tags_get")];
+    char s133[sizeof("/v2/tags/{tag_id}")];
+    char s134[sizeof("tag_id")];
+    char s135[sizeof("sizes_list")];
+    char s136[sizeof("/v2/sizes")];
+    char s137[sizeof("uptime_update_alert")];
+    char s138[sizeof("/v2/uptime/checks/{check_id}/alerts/{alert_id}")];
+    char s139[sizeof("check_id")];
+    char s140[sizeof("alert_id")];
+    char s141[sizeof("notifications")];
+    char s142[sizeof("period")];
+    char s143[sizeof("monitoring_get_sink")];
+    char s144[sizeof("/v2/monitoring/sinks/{sink_uuid}")];
+    char s145[sizeof("sink_uuid")];
+    char s146[sizeof("kubernetes_list_clusters")];
+    char s147[sizeof("functions_delete_trigger")];
+    char s148[sizeof("/v2/functions/namespaces/{namespace_id}/triggers/{trigger_name}")];
+    char s149[sizeof("namespace_id")];
+    char s150[sizeof("trigger_name")];
+    char s151[sizeof("databases_update_maintenanceWindow")];
+    char s152[sizeof("/v2/databases/{database_cluster_uuid}/maintenance")];
+    char s153[sizeof("day")];
+    char s154[sizeof("hour")];
+    char s155[sizeof("images_delete")];
+    char s156[sizeof("/v2/images/{image_id}")];
+    char s157[sizeof("floatingIPsAction_get")];
+    char s158[sizeof("/v2/floating_ips/{floating_ip}/actions/{action_id}")];
+    char s159[sizeof("floating_ip")];
+    char s160[sizeof("action_id")];
+    char s161[sizeof("databases_add_connectionPool")];
+    char s162[sizeof("/v2/databases/{database_cluster_uuid}/pools")];
+    char s163[sizeof("db")];
+    char s164[sizeof("mode")];
+    char s165[sizeof("firewalls_delete")];
+    char s166[sizeof("cdn_get_endpoint")];
+    char s167[sizeof("images_update")];
+    char s168[sizeof("projects_get_default")];
+    char s169[sizeof("/v2/projects/default")];
+    char s170[sizeof("apps_cancel_deployment")];
+    char s171[sizeof("/v2/apps/{app_id}/deployments/{deployment_id}/cancel")];
+    char s172[sizeof("deployment_id")];
+    char s173[sizeof("databases_reset_auth")];
+    char s174[sizeof("/v2/databases/{database_cluster_uuid}/users/{username}/reset_auth")];
+    char s175[sizeof("username")];
+    char s176[sizeof("databases_delete_opensearch_index")];
+    char s177[sizeof("/v2/databases/{database_cluster_uuid}/indexes/{index_name}")];
+    char s178[sizeof("index_name")];
+    char s179[sizeof("kubernetes_delete_cluster")];
+    char s180[sizeof("/v2/kubernetes/clusters/{cluster_id}")];
+    char s181[sizeof("databases_update_evictionPolicy")];
+    char s182[sizeof("/v2/databases/{database_cluster_uuid}/eviction_policy")];
+    char s183[sizeof("eviction_policy")];
+    char s184[sizeof("registry_get_subscription")];
+    char s185[sizeof("/v2/registry/subscription")];
+    char s186[sizeof("projects_assign_resources")];
+    char s187[sizeof("/v2/projects/{project_id}/resources")];
+    char s188[sizeof("project_id")];
+    char s189[sizeof("volumeActions_list")];
+    char s190[sizeof("/v2/volumes/{volume_id}/actions")];
+    char s191[sizeof("droplets_list_supported_backup_policies")];
+    char s192[sizeof("/v2/droplets/backups/supported_policies")];
+    char s193[sizeof("balance_get")];
+    char s194[sizeof("/v2/customers/my/balance")];
+    char s195[sizeof("databases_destroy_cluster")];
+    char s196[sizeof("/v2/databases/{database_cluster_uuid}")];
+    char s197[sizeof("vpcPeerings_create")];
+    char s198[sizeof("vpc_ids")];
+    char s199[sizeof("genai_get_agent_children")];
+    char s200[sizeof("/v2/gen-ai/agents/{uuid}/child_agents")];
+    char s201[sizeof("uuid")];
+    char s202[sizeof("droplets_destroy_withAssociatedResourcesDangerous")];
+    char s203[sizeof("/v2/droplets/{droplet_id}/destroy_with_associated_resources/dangerous")];
+    char s204[sizeof("X-Dangerous")];
+    char s205[sizeof("partnerAttachments_patch")];
+    char s206[sizeof("loadBalancers_add_droplets")];
+    char s207[sizeof("/v2/load_balancers/{lb_id}/droplets")];
+    char s208[sizeof("databases_update_kafka_topic")];
+    char s209[sizeof("/v2/databases/{database_cluster_uuid}/topics/{topic_name}")];
+    char s210[sizeof("topic_name")];
+    char s211[sizeof("dropletActions_post_byTag")];
+    char s212[sizeof("/v2/droplets/actions")];
+    char s213[sizeof("tag_name")];
+    char s214[sizeof("genai_update_agent_api_key")];
+    char s215[sizeof("/v2/gen-ai/agents/{agent_uuid}/api_keys/{api_key_uuid}")];
+    char s216[sizeof("agent_uuid")];
+    char s217[sizeof("api_key_uuid")];
+    char s218[sizeof("monitoring_get_lb_droplets_downtime")];
+    char s219[sizeof("/v2/monitoring/metrics/load_balancer/droplets_downtime")];
+    char s220[sizeof("projects_get")];
+    char s221[sizeof("/v2/projects/{project_id}")];
+    char s222[sizeof("cdn_purge_cache")];
+    char s223[sizeof("/v2/cdn/endpoints/{cdn_id}/cache")];
+    char s224[sizeof("files")];
+    char s225[sizeof("genai_list_model_api_keys")];
+    char s226[sizeof("/v2/gen-ai/models/api_keys")];
+    char s227[sizeof("partnerAttachments_update_remote_routes")];
+    char s228[sizeof("/v2/partner_network_connect/attachments/{pa_id}/remote_routes")];
+    char s229[sizeof("databases_delete_connectionPool")];
+    char s230[sizeof("projects_list")];
+    char s231[sizeof("/v2/projects")];
+    char s232[sizeof("uptime_list_alerts")];
+    char s233[sizeof("/v2/uptime/checks/{check_id}/alerts")];
+    char s234[sizeof("registry_delete")];
+    char s235[sizeof("/v2/registry")];
+    char s236[sizeof("spacesKey_get")];
+    char s237[sizeof("monitoring_get_dropletFilesystemSizeMetrics")];
+    char s238[sizeof("/v2/monitoring/metrics/droplet/filesystem_size")];
+    char s239[sizeof("databases_get_user")];
+    char s240[sizeof("/v2/databases/{database_cluster_uuid}/users/{username}")];
+    char s241[sizeof("monitoring_get_lb_frontend_network_throughput_tcp")];
+    char s242[sizeof("/v2/monitoring/metrics/load_balancer/frontend_network_throughput_tcp")];
+    char s243[sizeof("domains_list")];
+    char s244[sizeof("/v2/domains")];
+    char s245[sizeof("droplets_list_associatedResources")];
+    char s246[sizeof("/v2/droplets/{droplet_id}/destroy_with_associated_resources")];
+    char s247[sizeof("databases_list_opeasearch_indexes")];
+    char s248[sizeof("/v2/databases/{database_cluster_uuid}/indexes")];
+    char s249[sizeof("monitoring_get_appRestartCountMetrics.yml")];
+    char s250[sizeof("/v2/monitoring/metrics/apps/restart_count")];
+    char s251[sizeof("monitoring_get_lb_droplets_health_checks")];
+    char s252[sizeof("/v2/monitoring/metrics/load_balancer/droplets_health_checks")];
+    char s253[sizeof("genai_list_knowledge_bases")];
+    char s254[sizeof("/v2/gen-ai/knowledge_bases")];
+    char s255[sizeof("databases_list_clusters")];
+    char s256[sizeof("/v2/databases")];
+    char s257[sizeof("loadBalancers_add_forwardingRules")];
+    char s258[sizeof("/v2/load_balancers/{lb_id}/forwarding_rules")];
+    char s259[sizeof("functions_create_trigger")];
+    char s260[sizeof("/v2/functions/namespaces/{namespace_id}/triggers")];
+    char s261[sizeof("function")];
+    char s262[sizeof("is_enabled")];
+    char s263[sizeof("scheduled_details")];
+    char s264[sizeof("invoices_get_pdfByUUID")];
+    char s265[sizeof("/v2/customers/my/invoices/{invoice_uuid}/pdf")];
+    char s266[sizeof("invoice_uuid")];
+    char s267[sizeof("uptime_get_checkState")];
+    char s268[sizeof("/v2/uptime/checks/{check_id}/state")];
+    char s269[sizeof("databases_add_user")];
+    char s270[sizeof("/v2/databases/{database_cluster_uuid}/users")];
+    char s271[sizeof("genai_list_agents_by_anthropic_key")];
+    char s272[sizeof("/v2/gen-ai/anthropic/keys/{uuid}/agents")];
+    char s273[sizeof("tags_list")];
+    char s274[sizeof("/v2/tags")];
+    char s275[sizeof("apps_get_deployment")];
+    char s276[sizeof("/v2/apps/{app_id}/deployments/{deployment_id}")];
+    char s277[sizeof("databases_update_clusterSize")];
+    char s278[sizeof("/v2/databases/{database_cluster_uuid}/resize")];
+    char s279[sizeof("num_nodes")];
+    char s280[sizeof("monitoring_get_destination")];
+    char s281[sizeof("autoscalepools_list")];
+    char s282[sizeof("/v2/droplets/autoscale")];
+    char s283[sizeof("autoscalepools_list_history")];
+    char s284[sizeof("/v2/droplets/autoscale/{autoscale_pool_id}/history")];
+    char s285[sizeof("databases_patch_config")];
+    char s286[sizeof("/v2/databases/{database_cluster_uuid}/config")];
+    char s287[sizeof("domains_delete_record")];
+    char s288[sizeof("uptime_update_check")];
+    char s289[sizeof("/v2/uptime/checks/{check_id}")];
+    char s290[sizeof("autoscalepools_get")];
+    char s291[sizeof("/v2/droplets/autoscale/{autoscale_pool_id}")];
+    char s292[sizeof("monitoring_get_dropletMemoryCachedMetrics")];
+    char s293[sizeof("/v2/monitoring/metrics/droplet/memory_cached")];
+    char s294[sizeof("kubernetes_get_credentials")];
+    char s295[sizeof("/v2/kubernetes/clusters/{cluster_id}/credentials")];
+    char s296[sizeof("expiry_seconds")];
+    char s297[sizeof("genai_list_agent_api_keys")];
+    char s298[sizeof("/v2/gen-ai/agents/{agent_uuid}/api_keys")];
+    char s299[sizeof("invoices_get_byUUID")];
+    char s300[sizeof("/v2/customers/my/invoices/{invoice_uuid}")];
+    char s301[sizeof("loadBalancers_remove_droplets")];
+    char s302[sizeof("uptime_list_checks")];
+    char s303[sizeof("/v2/uptime/checks")];
+    char s304[sizeof("genai_detach_agent_function")];
+    char s305[sizeof("/v2/gen-ai/agents/{agent_uuid}/functions/{function_uuid}")];
+    char s306[sizeof("function_uuid")];
+    char s307[sizeof("firewalls_add_rules")];
+    char s308[sizeof("/v2/firewalls/{firewall_id}/rules")];
+    char s309[sizeof("floatingIPs_delete")];
+    char s310[sizeof("/v2/floating_ips/{floating_ip}")];
+    char s311[sizeof("databases_get_ca")];
+    char s312[sizeof("/v2/databases/{database_cluster_uuid}/ca")];
+    char s313[sizeof("dropletActions_post")];
+    char s314[sizeof("/v2/droplets/{droplet_id}/actions")];
+    char s315[sizeof("databases_list_connectionPools")];
+    char s316[sizeof("genai_create_anthropic_api_key")];
+    char s317[sizeof("/v2/gen-ai/anthropic/keys")];
+    char s318[sizeof("sshKeys_update")];
+    char s319[sizeof("/v2/account/keys/{ssh_key_identifier}")];
+    char s320[sizeof("ssh_key_identifier")];
+    char s321[sizeof("images_get")];
+    char s322[sizeof("floatingIPsAction_list")];
+    char s323[sizeof("/v2/floating_ips/{floating_ip}/actions")];
+    char s324[sizeof("databases_list_options")];
+    char s325[sizeof("/v2/databases/options")];
+    char s326[sizeof("monitoring_get_droplet_autoscale_target_memory_utilization")];
+    char s327[sizeof("/v2/monitoring/metrics/droplet_autoscale/target_memory_utilization")];
+    char s328[sizeof("partnerAttachments_delete")];
+    char s329[sizeof("genai_create_knowledge_base_data_source")];
+    char s330[sizeof("/v2/gen-ai/knowledge_bases/{knowledge_base_uuid}/data_sources")];
+    char s331[sizeof("knowledge_base_uuid")];
+    char s332[sizeof("firewalls_add_tags")];
+    char s333[sizeof("/v2/firewalls/{firewall_id}/tags")];
+    char s334[sizeof("tags")];
+    char s335[sizeof("apps_get_metrics_bandwidth_daily")];
+    char s336[sizeof("/v2/apps/{app_id}/metrics/bandwidth_daily")];
+    char s337[sizeof("date")];
+    char s338[sizeof("databases_list_backups")];
+    char s339[sizeof("/v2/databases/{database_cluster_uuid}/backups")];
+    char s340[sizeof("registry_delete_repositoryManifest")];
+    char s341[sizeof("/v2/registry/{registry_name}/repositories/{repository_name}/digests/{manifest_digest}")];
+    char s342[sizeof("registry_name")];
+    char s343[sizeof("repository_name")];
+    char s344[sizeof("manifest_digest")];
+    char s345[sizeof("uptime_create_check")];
+    char s346[sizeof("enabled")];
+    char s347[sizeof("method")];
+    char s348[sizeof("regions")];
+    char s349[sizeof("target")];
+    char s350[sizeof("registry_get")];
+    char s351[sizeof("monitoring_get_lb_droplets_http_responses")];
+    char s352[sizeof("/v2/monitoring/metrics/load_balancer/droplets_http_responses")];
+    char s353[sizeof("account_get")];
+    char s354[sizeof("/v2/account")];
+    char s355[sizeof("genai_regenerate_agent_api_key")];
+    char s356[sizeof("/v2/gen-ai/agents/{agent_uuid}/api_keys/{api_key_uuid}/regenerate")];
+    char s357[sizeof("domains_list_records")];
+    char s358[sizeof("/v2/domains/{domain_name}/records")];
+    char s359[sizeof("actions_list")];
+    char s360[sizeof("/v2/actions")];
+    char s361[sizeof("registry_create")];
+    char s362[sizeof("subscription_tier_slug")];
+    char s363[sizeof("imageActions_list")];
+    char s364[sizeof("genai_update_anthropic_api_key")];
+    char s365[sizeof("/v2/gen-ai/anthropic/keys/{api_key_uuid}")];
+    char s366[sizeof("databases_get_kafka_topic")];
+    char s367[sizeof("projects_delete")];
+    char s368[sizeof("monitoring_create_destination")];
+    char s369[sizeof("/v2/monitoring/sinks/destinations")];
+    char s370[sizeof("config")];
+    char s371[sizeof("monitoring_create_alertPolicy")];
+    char s372[sizeof("/v2/monitoring/alerts")];
+    char s373[sizeof("alerts")];
+    char s374[sizeof("compare")];
+    char s375[sizeof("description")];
+    char s376[sizeof("entities")];
+    char s377[sizeof("value")];
+    char s378[sizeof("window")];
+    char s379[sizeof("firewalls_list")];
+    char s380[sizeof("/v2/firewalls")];
+    char s381[sizeof("cdn_create_endpoint")];
+    char s382[sizeof("/v2/cdn/endpoints")];
+    char s383[sizeof("origin")];
+    char s384[sizeof("domains_get_record")];
+    char s385[sizeof("monitoring_get_lb_frontend_connections_current")];
+    char s386[sizeof("/v2/monitoring/metrics/load_balancer/frontend_connections_current")];
+    char s387[sizeof("databases_update_firewall_rules")];
+    char s388[sizeof("/v2/databases/{database_cluster_uuid}/firewall")];
+    char s389[sizeof("registry_get_garbageCollection")];
+    char s390[sizeof("/v2/registry/{registry_name}/garbage-collection")];
+    char s391[sizeof("genai_attach_agent_function")];
+    char s392[sizeof("/v2/gen-ai/agents/{agent_uuid}/functions")];
+    char s393[sizeof("apps_validate_appSpec")];
+    char s394[sizeof("/v2/apps/propose")];
+    char s395[sizeof("spec")];
+    char s396[sizeof("monitoring_get_dropletMemoryAvailableMetrics")];
+    char s397[sizeof("/v2/monitoring/metrics/droplet/memory_available")];
+    char s398[sizeof("actions_get")];
+    char s399[sizeof("/v2/actions/{action_id}")];
+    char s400[sizeof("droplets_destroy_withAssociatedResourcesSelective")];
+    char s401[sizeof("/v2/droplets/{droplet_id}/destroy_with_associated_resources/selective")];
+    char s402[sizeof("uptime_create_alert")];
+    char s403[sizeof("databases_update_onlineMigration")];
+    char s404[sizeof("source")];
+    char s405[sizeof("monitoring_get_lb_frontend_firewall_dropped_packets")];
+    char s406[sizeof("/v2/monitoring/metrics/load_balancer/frontend_firewall_dropped_packets")];
+    char s407[sizeof("droplets_list_neighborsIds")];
+    char s408[sizeof("/v2/reports/droplet_neighbors_ids")];
+    char s409[sizeof("floatingIPs_create")];
+    char s410[sizeof("/v2/floating_ips")];
+    char s411[sizeof("volumes_get")];
+    char s412[sizeof("dropletActions_get")];
+    char s413[sizeof("/v2/droplets/{droplet_id}/actions/{action_id}")];
+    char s414[sizeof("monitoring_update_alertPolicy")];
+    char s415[sizeof("/v2/monitoring/alerts/{alert_uuid}")];
+    char s416[sizeof("alert_uuid")];
+    char s417[sizeof("monitoring_get_lb_frontend_tls_connections_exceeding_rate_limit")];
+    char s418[sizeof("/v2/monitoring/metrics/load_balancer/frontend_tls_connections_exceeding_rate_limit")];
+    char s419[sizeof("reservedIPsActions_list")];
+    char s420[sizeof("/v2/reserved_ips/{reserved_ip}/actions")];
+    char s421[sizeof("reserved_ip")];
+    char s422[sizeof("volumeSnapshots_get_byId")];
+    char s423[sizeof("projects_patch")];
+    char s424[sizeof("loadBalancers_delete_cache")];
+    char s425[sizeof("/v2/load_balancers/{lb_id}/cache")];
+    char s426[sizeof("monitoring_get_dropletLoad15Metrics")];
+    char s427[sizeof("/v2/monitoring/metrics/droplet/load_15")];
+    char s428[sizeof("domains_patch_record")];
+    char s429[sizeof("databases_list_logsink")];
+    char s430[sizeof("/v2/databases/{database_cluster_uuid}/logsink")];
+    char s431[sizeof("kubernetes_add_registry")];
+    char s432[sizeof("/v2/kubernetes/registry")];
+    char s433[sizeof("projects_update")];
+    char s434[sizeof("environment")];
+    char s435[sizeof("is_default")];
+    char s436[sizeof("purpose")];
+    char s437[sizeof("volumeSnapshots_list")];
+    char s438[sizeof("/v2/volumes/{volume_id}/snapshots")];
+    char s439[sizeof("monitoring_get_lb_droplets_http_response_time_avg")];
+    char s440[sizeof("/v2/monitoring/metrics/load_balancer/droplets_http_response_time_avg")];
+    char s441[sizeof("domains_delete")];
+    char s442[sizeof("spacesKey_list")];
+    char s443[sizeof("/v2/spaces/keys")];
+    char s444[sizeof("sort")];
+    char s445[sizeof("sort_direction")];
+    char s446[sizeof("bucket")];
+    char s447[sizeof("permission")];
+    char s448[sizeof("spacesKey_create")];
+    char s449[sizeof("monitoring_delete_sink")];
+    char s450[sizeof("spacesKey_delete")];
+    char s451[sizeof("apps_get_exec_active_deployment")];
+    char s452[sizeof("/v2/apps/{app_id}/components/{component_name}/exec")];
+    char s453[sizeof("component_name")];
+    char s454[sizeof("genai_create_openai_api_key")];
+    char s455[sizeof("/v2/gen-ai/openai/keys")];
+    char s456[sizeof("databases_list_events_logs")];
+    char s457[sizeof("/v2/databases/{database_cluster_uuid}/events")];
+    char s458[sizeof("kubernetes_run_clusterLint")];
+    char s459[sizeof("monitoring_get_lb_droplets_queue_size")];
+    char s460[sizeof("/v2/monitoring/metrics/load_balancer/droplets_queue_size")];
+    char s461[sizeof("registry_get_dockerCredentials")];
+    char s462[sizeof("/v2/registry/docker-credentials")];
+    char s463[sizeof("read_write")];
+    char s464[sizeof("apps_get_instanceSize")];
+    char s465[sizeof("/v2/apps/tiers/instance_sizes/{slug}")];
+    char s466[sizeof("slug")];
+    char s467[sizeof("vpcs_create_peerings")];
+    char s468[sizeof("/v2/vpcs/{vpc_id}/peerings")];
+    char s469[sizeof("genai_create_indexing_job")];
+    char s470[sizeof("/v2/gen-ai/indexing_jobs")];
+    char s471[sizeof("monitoring_get_lb_droplets_http_response_time_95p")];
+    char s472[sizeof("/v2/monitoring/metrics/load_balancer/droplets_http_response_time_95p")];
+    char s473[sizeof("databases_destroy_replica")];
+    char s474[sizeof("/v2/databases/{database_cluster_uuid}/replicas/{replica_name}")];
+    char s475[sizeof("replica_name")];
+    char s476[sizeof("databases_update_cluster_metrics_credentials")];
+    char s477[sizeof("/v2/databases/metrics/credentials")];
+    char s478[sizeof("reservedIPv6Actions_post")];
+    char s479[sizeof("/v2/reserved_ipv6/{reserved_ipv6}/actions")];
+    char s480[sizeof("reservedIPv6_create")];
+    char s481[sizeof("/v2/reserved_ipv6")];
+    char s482[sizeof("region_slug")];
+    char s483[sizeof("monitoring_delete_alertPolicy")];
+    char s484[sizeof("genai_update_knowledge_base")];
+    char s485[sizeof("/v2/gen-ai/knowledge_bases/{uuid}")];
+    char s486[sizeof("genai_delete_anthropic_api_key")];
+    char s487[sizeof("monitoring_get_droplet_autoscale_current_memory_utilization")];
+    char s488[sizeof("/v2/monitoring/metrics/droplet_autoscale/current_memory_utilization")];
+    char s489[sizeof("genai_get_indexing_job")];
+    char s490[sizeof("/v2/gen-ai/indexing_jobs/{uuid}")];
+    char s491[sizeof("autoscalepools_create")];
+    char s492[sizeof("droplet_template")];
+    char s493[sizeof("registry_list_repositoryTags")];
+    char s494[sizeof("/v2/registry/{registry_name}/repositories/{repository_name}/tags")];
+    char s495[sizeof("apps_get_logs_active_deployment_aggregate")];
+    char s496[sizeof("/v2/apps/{app_id}/logs")];
+    char s497[sizeof("follow")];
+    char s498[sizeof("pod_connection_timeout")];
+    char s499[sizeof("vpcs_create")];
+    char s500[sizeof("/v2/vpcs")];
+    char s501[sizeof("kubernetes_remove_registry")];
+    char s502[sizeof("monitoring_get_droplet_autoscale_current_instances")];
+    char s503[sizeof("/v2/monitoring/metrics/droplet_autoscale/current_instances")];
+    char s504[sizeof("databases_get_replica")];
+    char s505[sizeof("databases_delete_onlineMigration")];
+    char s506[sizeof("/v2/databases/{database_cluster_uuid}/online-migration/{migration_id}")];
+    char s507[sizeof("migration_id")];
+    char s508[sizeof("registry_update_subscription")];
+    char s509[sizeof("domains_create")];
+    char s510[sizeof("apps_get_health")];
+    char s511[sizeof("/v2/apps/{app_id}/health")];
+    char s512[sizeof("certificates_delete")];
+    char s513[sizeof("/v2/certificates/{certificate_id}")];
+    char s514[sizeof("certificate_id")];
+    char s515[sizeof("certificates_create")];
+    char s516[sizeof("/v2/certificates")];
+    char s517[sizeof("apps_get_logs_active_deployment")];
+    char s518[sizeof("/v2/apps/{app_id}/components/{component_name}/logs")];
+    char s519[sizeof("tags_assign_resources")];
+    char s520[sizeof("/v2/tags/{tag_id}/resources")];
+    char s521[sizeof("resources")];
+    char s522[sizeof("databases_promote_replica")];
+    char s523[sizeof("/v2/databases/{database_cluster_uuid}/replicas/{replica_name}/promote")];
+    char s524[sizeof("monitoring_get_lb_frontend_tls_connections_limit")];
+    char s525[sizeof("/v2/monitoring/metrics/load_balancer/frontend_tls_connections_limit")];
+    char s526[sizeof("monitoring_get_dropletFilesystemFreeMetrics")];
+    char s527[sizeof("/v2/monitoring/metrics/droplet/filesystem_free")];
+    char s528[sizeof("functions_delete_namespace")];
+    char s529[sizeof("/v2/functions/namespaces/{namespace_id}")];
+    char s530[sizeof("droplets_list_firewalls")];
+    char s531[sizeof("/v2/droplets/{droplet_id}/firewalls")];
+    char s532[sizeof("apps_get")];
+    char s533[sizeof("/v2/apps/{id}")];
+    char s534[sizeof("id")];
+    char s535[sizeof("loadBalancers_list")];
+    char s536[sizeof("apps_get_logs")];
+    char s537[sizeof("/v2/apps/{app_id}/deployments/{deployment_id}/components/{component_name}/logs")];
+    char s538[sizeof("projects_list_resources_default")];
+    char s539[sizeof("registry_list_garbageCollections")];
+    char s540[sizeof("/v2/registry/{registry_name}/garbage-collections")];
+    char s541[sizeof("registry_update_garbageCollection")];
+    char s542[sizeof("/v2/registry/{registry_name}/garbage-collection/{garbage_collection_uuid}")];
+    char s543[sizeof("garbage_collection_uuid")];
+    char s544[sizeof("loadBalancers_update")];
+    char s545[sizeof("/v2/load_balancers/{lb_id}")];
+    char s546[sizeof("monitoring_get_lb_frontend_connections_limit")];
+    char s547[sizeof("/v2/monitoring/metrics/load_balancer/frontend_connections_limit")];
+    char s548[sizeof("databases_get_sql_mode")];
+    char s549[sizeof("/v2/databases/{database_cluster_uuid}/sql_mode")];
+    char s550[sizeof("invoices_list")];
+    char s551[sizeof("/v2/customers/my/invoices")];
+    char s552[sizeof("reservedIPv6_get")];
+    char s553[sizeof("functions_get_trigger")];
+    char s554[sizeof("functions_create_namespace")];
+    char s555[sizeof("/v2/functions/namespaces")];
+    char s556[sizeof("label")];
+    char s557[sizeof("monitoring_get_alertPolicy")];
+    char s558[sizeof("monitoring_get_dropletLoad1Metrics")];
+    char s559[sizeof("/v2/monitoring/metrics/droplet/load_1")];
+    char s560[sizeof("autoscalepools_delete_dangerous")];
+    char s561[sizeof("/v2/droplets/autoscale/{autoscale_pool_id}/dangerous")];
+    char s562[sizeof("genai_regenerate_model_api_key")];
+    char s563[sizeof("/v2/gen-ai/models/api_keys/{api_key_uuid}/regenerate")];
+    char s564[sizeof("apps_restart")];
+    char s565[sizeof("/v2/apps/{app_id}/restart")];
+    char s566[sizeof("partnerAttachments_create_service_key")];
+    char s567[sizeof("/v2/partner_network_connect/attachments/{pa_id}/service_key")];
+    char s568[sizeof("spacesKey_update")];
+    char s569[sizeof("droplets_get")];
+    char s570[sizeof("apps_validate_rollback")];
+    char s571[sizeof("/v2/apps/{app_id}/rollback/validate")];
+    char s572[sizeof("genai_attach_knowledge_base")];
+    char s573[sizeof("/v2/gen-ai/agents/{agent_uuid}/knowledge_bases/{knowledge_base_uuid}")];
+    char s574[sizeof("databases_get_cluster")];
+    char s575[sizeof("reservedIPs_create")];
+    char s576[sizeof("/v2/reserved_ips")];
+    char s577[sizeof("droplets_get_DestroyAssociatedResourcesStatus")];
+    char s578[sizeof("/v2/droplets/{droplet_id}/destroy_with_associated_resources/status")];
+    char s579[sizeof("kubernetes_list_nodePools")];
+    char s580[sizeof("/v2/kubernetes/clusters/{cluster_id}/node_pools")];
+    char s581[sizeof("uptime_delete_check")];
+    char s582[sizeof("uptime_delete_alert")];
+    char s583[sizeof("droplets_create")];
+    char s584[sizeof("/v2/droplets")];
+    char s585[sizeof("image")];
+    char s586[sizeof("monitoring_get_lb_droplets_http_session_duration_95p")];
+    char s587[sizeof("/v2/monitoring/metrics/load_balancer/droplets_http_session_duration_95p")];
+    char s588[sizeof("genai_detach_knowledge_base")];
+    char s589[sizeof("genai_delete_model_api_key")];
+    char s590[sizeof("/v2/gen-ai/models/api_keys/{api_key_uuid}")];
+    char s591[sizeof("genai_cancel_indexing_job")];
+    char s592[sizeof("/v2/gen-ai/indexing_jobs/{uuid}/cancel")];
+    char s593[sizeof("genai_get_knowledge_base")];
+    char s594[sizeof("autoscalepools_delete")];
+    char s595[sizeof("droplets_list_backups")];
+    char s596[sizeof("/v2/droplets/{droplet_id}/backups")];
+    char s597[sizeof("firewalls_update")];
+    char s598[sizeof("floatingIPs_get")];
+    char s599[sizeof("monitoring_list_destinations")];
+    char s600[sizeof("volumes_list")];
+    char s601[sizeof("/v2/volumes")];
+    char s602[sizeof("kubernetes_upgrade_cluster")];
+    char s603[sizeof("/v2/kubernetes/clusters/{cluster_id}/upgrade")];
+    char s604[sizeof("partnerAttachments_get_service_key")];
+    char s605[sizeof("snapshots_delete")];
+    char s606[sizeof("/v2/snapshots/{snapshot_id}")];
+    char s607[sizeof("domains_create_record")];
+    char s608[sizeof("genai_list_anthropic_api_keys")];
+    char s609[sizeof("sshKeys_delete")];
+    char s610[sizeof("firewalls_assign_droplets")];
+    char s611[sizeof("uptime_get_alert")];
+    char s612[sizeof("images_create_custom")];
+    char s613[sizeof("/v2/images")];
+    char s614[sizeof("url")];
+    char s615[sizeof("functions_list_triggers")];
+    char s616[sizeof("databases_get_cluster_metrics_credentials")];
+    char s617[sizeof("monitoring_get_lb_droplets_connections")];
+    char s618[sizeof("/v2/monitoring/metrics/load_balancer/droplets_connections")];
+    char s619[sizeof("monitoring_get_lb_droplets_http_session_duration_50p")];
+    char s620[sizeof("/v2/monitoring/metrics/load_balancer/droplets_http_session_duration_50p")];
+    char s621[sizeof("apps_get_exec")];
+    char s622[sizeof("/v2/apps/{app_id}/deployments/{deployment_id}/components/{component_name}/exec")];
+    char s623[sizeof("instance_name")];
+    char s624[sizeof("cdn_delete_endpoint")];
+    char s625[sizeof("kubernetes_get_nodePool")];
+    char s626[sizeof("/v2/kubernetes/clusters/{cluster_id}/node_pools/{node_pool_id}")];
+    char s627[sizeof("node_pool_id")];
+    char s628[sizeof("kubernetes_get_clusterUser")];
+    char s629[sizeof("/v2/kubernetes/clusters/{cluster_id}/user")];
+    char s630[sizeof("tags_delete")];
+    char s631[sizeof("uptime_get_check")];
+    char s632[sizeof("monitoring_get_lb_frontend_nlb_udp_network_throughput")];
+    char s633[sizeof("/v2/monitoring/metrics/load_balancer/frontend_nlb_udp_network_throughput")];
+    char s634[sizeof("databases_get_config")];
+    char s635[sizeof("registry_delete_repositoryTag")];
+    char s636[sizeof("/v2/registry/{registry_name}/repositories/{repository_name}/tags/{repository_tag}")];
+    char s637[sizeof("repository_tag")];
+    char s638[sizeof("volumes_delete_byName")];
+    char s639[sizeof("genai_delete_knowledge_base_data_source")];
+    char s640[sizeof("/v2/gen-ai/knowledge_bases/{knowledge_base_uuid}/data_sources/{data_source_uuid}")];
+    char s641[sizeof("data_source_uuid")];
+    char s642[sizeof("monitoring_get_dropletMemoryTotalMetrics")];
+    char s643[sizeof("/v2/monitoring/metrics/droplet/memory_total")];
+    char s644[sizeof("kubernetes_delete_nodePool")];
+    char s645[sizeof("snapshots_get")];
+    char s646[sizeof("registry_validate_name")];
+    char s647[sizeof("/v2/registry/validate-name")];
+    char s648[sizeof("tags_create")];
+    char s649[sizeof("genai_update_agent_deployment_visibility")];
+    char s650[sizeof("/v2/gen-ai/agents/{uuid}/deployment_visibility")];
+    char s651[sizeof("vpcs_patch_peerings")];
+    char s652[sizeof("/v2/vpcs/{vpc_id}/peerings/{vpc_peering_id}")];
+    char s653[sizeof("droplets_list_neighbors")];
+    char s654[sizeof("/v2/droplets/{droplet_id}/neighbors")];
+    char s655[sizeof("genai_get_openai_api_key")];
+    char s656[sizeof("/v2/gen-ai/openai/keys/{api_key_uuid}")];
+    char s657[sizeof("apps_create")];
+    char s658[sizeof("/v2/apps")];
+    char s659[sizeof("Accept")];
+    char s660[sizeof("Content-Type")];
+    char s661[sizeof("monitoring_get_lb_frontend_tls_connections_current")];
+    char s662[sizeof("/v2/monitoring/metrics/load_balancer/frontend_tls_connections_current")];
+    char s663[sizeof("databases_update_sql_mode")];
+    char s664[sizeof("sql_mode")];
+    char s665[sizeof("databases_create_kafka_topic")];
+    char s666[sizeof("/v2/databases/{database_cluster_uuid}/topics")];
+    char s667[sizeof("loadBalancers_delete")];
+    char s668[sizeof("genai_delete_agent_api_key")];
+    char s669[sizeof("kubernetes_destroy_associatedResourcesDangerous")];
+    char s670[sizeof("/v2/kubernetes/clusters/{cluster_id}/destroy_with_associated_resources/dangerous")];
+    char s671[sizeof("genai_update_agent_function")];
+    char s672[sizeof("monitoring_list_sinks")];
+    char s673[sizeof("resource_id")];
+    char s674[sizeof("genai_update_model_api_key")];
+    char s675[sizeof("apps_revert_rollback")];
+    char s676[sizeof("/v2/apps/{app_id}/rollback/revert")];
+    char s677[sizeof("reservedIPs_delete")];
+    char s678[sizeof("/v2/reserved_ips/{reserved_ip}")];
+    char s679[sizeof("oneClicks_install_kubernetes")];
+    char s680[sizeof("/v2/1-clicks/kubernetes")];
+    char s681[sizeof("addon_slugs")];
+    char s682[sizeof("cluster_uuid")];
+    char s683[sizeof("databases_create_cluster")];
+    char s684[sizeof("engine")];
+    char s685[sizeof("dropletActions_list")];
+    char s686[sizeof("reservedIPsActions_get")];
+    char s687[sizeof("/v2/reserved_ips/{reserved_ip}/actions/{action_id}")];
+    char s688[sizeof("firewalls_create")];
+    char s689[sizeof("sshKeys_create")];
+    char s690[sizeof("public_key")];
+    char s691[sizeof("imageActions_get")];
+    char s692[sizeof("/v2/images/{image_id}/actions/{action_id}")];
+    char s693[sizeof("genai_list_indexing_job_data_sources")];
+    char s694[sizeof("/v2/gen-ai/indexing_jobs/{indexing_job_uuid}/data_sources")];
+    char s695[sizeof("indexing_job_uuid")];
+    char s696[sizeof("volumeSnapshots_create")];
+    char s697[sizeof("functions_update_trigger")];
+    char s698[sizeof("genai_rollback_to_agent_version")];
+    char s699[sizeof("/v2/gen-ai/agents/{uuid}/versions")];
+    char s700[sizeof("monitoring_update_destination")];
+    char s701[sizeof("reservedIPs_list")];
+    char s702[sizeof("genai_get_anthropic_api_key")];
+    char s703[sizeof("kubernetes_list_associatedResources")];
+    char s704[sizeof("/v2/kubernetes/clusters/{cluster_id}/destroy_with_associated_resources")];
+    char s705[sizeof("registry_list_repositoryManifests")];
+    char s706[sizeof("/v2/registry/{registry_name}/repositories/{repository_name}/digests")];
+    char s707[sizeof("genai_list_datacenter_regions")];
+    char s708[sizeof("/v2/gen-ai/regions")];
+    char s709[sizeof("serves_inference")];
+    char s710[sizeof("serves_batch")];
+    char s711[sizeof("projects_create")];
+    char s712[sizeof("apps_list_instanceSizes")];
+    char s713[sizeof("/v2/apps/tiers/instance_sizes")];
+    char s714[sizeof("projects_list_resources")];
+    char s715[sizeof("apps_create_deployment")];
+    char s716[sizeof("databases_update_region")];
+    char s717[sizeof("/v2/databases/{database_cluster_uuid}/migrate")];
+    char s718[sizeof("monitoring_get_droplet_autoscale_target_cpu_utilization")];
+    char s719[sizeof("/v2/monitoring/metrics/droplet_autoscale/target_cpu_utilization")];
+    char s720[sizeof("volumeActions_post_byId")];
+    char s721[sizeof("invoices_get_csvByUUID")];
+    char s722[sizeof("/v2/customers/my/invoices/{invoice_uuid}/csv")];
+    char s723[sizeof("genai_delete_agent")];
+    char s724[sizeof("/v2/gen-ai/agents/{uuid}")];
+    char s725[sizeof("certificates_list")];
+    char s726[sizeof("genai_list_agents")];
+    char s727[sizeof("/v2/gen-ai/agents")];
+    char s728[sizeof("only_deployed")];
+    char s729[sizeof("kubernetes_recycle_node_pool")];
+    char s730[sizeof("/v2/kubernetes/clusters/{cluster_id}/node_pools/{node_pool_id}/recycle")];
+    char s731[sizeof("databases_update_logsink")];
+    char s732[sizeof("/v2/databases/{database_cluster_uuid}/logsink/{logsink_id}")];
+    char s733[sizeof("logsink_id")];
+    char s734[sizeof("firewalls_delete_tags")];
+    char s735[sizeof("oneClicks_list")];
+    char s736[sizeof("/v2/1-clicks")];
+    char s737[sizeof("vpcs_list_members")];
+    char s738[sizeof("/v2/vpcs/{vpc_id}/members")];
+    char s739[sizeof("genai_attach_knowledge_bases")];
+    char s740[sizeof("/v2/gen-ai/agents/{agent_uuid}/knowledge_bases")];
+    char s741[sizeof("vpcPeerings_patch")];
+    char s742[sizeof("partnerAttachments_list")];
+    char s743[sizeof("/v2/partner_network_connect/attachments")];
+    char s744[sizeof("kubernetes_delete_node")];
+    char s745[sizeof("/v2/kubernetes/clusters/{cluster_id}/node_pools/{node_pool_id}/nodes/{node_id}")];
+    char s746[sizeof("node_id")];
+    char s747[sizeof("skip_drain")];
+    char s748[sizeof("replace")];
+    char s749[sizeof("vpcs_patch")];
+    char s750[sizeof("monitoring_get_lb_frontend_http_responses")];
+    char s751[sizeof("/v2/monitoring/metrics/load_balancer/frontend_http_responses")];
+    char s752[sizeof("genai_create_model_api_key")];
+    char s753[sizeof("genai_delete_openai_api_key")];
+    char s754[sizeof("apps_list_regions")];
+    char s755[sizeof("/v2/apps/regions")];
+    char s756[sizeof("vpcs_list_peerings")];
+    char s757[sizeof("functions_get_namespace")];
+    char s758[sizeof("genai_list_models")];
+    char s759[sizeof("/v2/gen-ai/models")];
+    char s760[sizeof("usecases")];
+    char s761[sizeof("public_only")];
+    char s762[sizeof("functions_list_namespaces")];
+    char s763[sizeof("tags_unassign_resources")];
+    char s764[sizeof("genai_list_openai_api_keys")];
+    char s765[sizeof("monitoring_get_appCPUPercentageMetrics")];
+    char s766[sizeof("/v2/monitoring/metrics/apps/cpu_percentage")];
+    char s767[sizeof("databases_list_replicas")];
+    char s768[sizeof("databases_get")];
+    char s769[sizeof("/v2/databases/{database_cluster_uuid}/dbs/{database_name}")];
+    char s770[sizeof("database_name")];
+    char s771[sizeof("monitoring_get_dropletLoad5Metrics")];
+    char s772[sizeof("/v2/monitoring/metrics/droplet/load_5")];
+    char s773[sizeof("droplets_destroy_retryWithAssociatedResources")];
+    char s774[sizeof("/v2/droplets/{droplet_id}/destroy_with_associated_resources/retry")];
+    char s775[sizeof("autoscalepools_update")];
+    char s776[sizeof("apps_get_instances")];
+    char s777[sizeof("/v2/apps/{app_id}/instances")];
+    char s778[sizeof("databases_list_firewall_rules")];
+    char s779[sizeof("monitoring_get_lb_droplets_http_response_time_50p")];
+    char s780[sizeof("/v2/monitoring/metrics/load_balancer/droplets_http_response_time_50p")];
+    char s781[sizeof("images_list")];
+    char s782[sizeof("private")];
+    char s783[sizeof("monitoring_get_droplet_autoscale_target_instances")];
+    char s784[sizeof("/v2/monitoring/metrics/droplet_autoscale/target_instances")];
+    char s785[sizeof("genai_create_agent_api_key")];
+    char s786[sizeof("genai_update_openai_api_key")];
+    char s787[sizeof("vpcs_get")];
+    char s788[sizeof("apps_delete")];
+    char s789[sizeof("databases_list_kafka_topics")];
+    char s790[sizeof("databases_delete_logsink")];
+    char s791[sizeof("vpcs_update")];
+    char s792[sizeof("genai_create_knowledge_base")];
+    char s793[sizeof("registry_list_repositoriesV2")];
+    char s794[sizeof("/v2/registry/{registry_name}/repositoriesV2")];
+    char s795[sizeof("page_token")];
+    char s796[sizeof("projects_patch_default")];
+    char s797[sizeof("monitoring_get_lb_frontend_http_requests_per_second")];
+    char s798[sizeof("/v2/monitoring/metrics/load_balancer/frontend_http_requests_per_second")];
+    char s799[sizeof("vpcs_list")];
+    char s800[sizeof("monitoring_get_lb_droplets_http_response_time_99p")];
+    char s801[sizeof("/v2/monitoring/metrics/load_balancer/droplets_http_response_time_99p")];
+    char s802[sizeof("droplets_list")];
+    char s803[sizeof("monitoring_get_dropletBandwidthMetrics")];
+    char s804[sizeof("/v2/monitoring/metrics/droplet/bandwidth")];
+    char s805[sizeof("interface")];
+    char s806[sizeof("direction")];
+    char s807[sizeof("certificates_get")];
+    char s808[sizeof("apps_get_logs_aggregate")];
+    char s809[sizeof("/v2/apps/{app_id}/deployments/{deployment_id}/logs")];
+    char s810[sizeof("loadBalancers_remove_forwardingRules")];
+    char s811[sizeof("monitoring_list_alertPolicy")];
+    char s812[sizeof("genai_list_agent_versions")];
+    char s813[sizeof("databases_list_users")];
+    char s814[sizeof("databases_get_logsink")];
+    char s815[sizeof("genai_list_indexing_jobs")];
+    char s816[sizeof("sshKeys_get")];
+    char s817[sizeof("apps_list_metrics_bandwidth_daily")];
+    char s818[sizeof("/v2/apps/metrics/bandwidth_daily")];
+    char s819[sizeof("app_ids")];
+    char s820[sizeof("databases_update_connectionPool")];
+    char s821[sizeof("volumeActions_get")];
+    char s822[sizeof("/v2/volumes/{volume_id}/actions/{action_id}")];
+    char s823[sizeof("droplets_list_kernels")];
+    char s824[sizeof("/v2/droplets/{droplet_id}/kernels")];
+    char s825[sizeof("databases_delete_user")];
+    char s826[sizeof("genai_delete_knowledge_base")];
+    char s827[sizeof("monitoring_get_lb_frontend_network_throughput_udp")];
+    char s828[sizeof("/v2/monitoring/metrics/load_balancer/frontend_network_throughput_udp")];
+    char s829[sizeof("kubernetes_get_cluster")];
+    char s830[sizeof("partnerAttachments_get_bgp_auth_key")];
+    char s831[sizeof("/v2/partner_network_connect/attachments/{pa_id}/bgp_auth_key")];
+    char s832[sizeof("genai_list_agents_by_openai_key")];
+    char s833[sizeof("/v2/gen-ai/openai/keys/{uuid}/agents")];
+    char s834[sizeof("registry_get_options")];
+    char s835[sizeof("/v2/registry/options")];
+    char s836[sizeof("databases_delete_kafka_topic")];
+    char s837[sizeof("billingHistory_list")];
+    char s838[sizeof("/v2/customers/my/billing_history")];
+    char s839[sizeof("partnerAttachments_create")];
+    char s840[sizeof("connection_bandwidth_in_mbps")];
+    char s841[sizeof("naas_provider")];
+    char s842[sizeof("monitoring_get_lb_frontend_firewall_dropped_bytes")];
+    char s843[sizeof("/v2/monitoring/metrics/load_balancer/frontend_firewall_dropped_bytes")];
+    char s844[sizeof("volumes_create")];
+    char s845[sizeof("size_gigabytes")];
+    char s846[sizeof("reservedIPv6_list")];
+    char s847[sizeof("registry_run_garbageCollection")];
+    char s848[sizeof("kubernetes_update_cluster")];
+    char s849[sizeof("apps_list")];
+    char s850[sizeof("with_projects")];
+    char s851[sizeof("databases_create_logsink")];
+    char s852[sizeof("sink_name")];
+    char s853[sizeof("sink_type")];
+    char s854[sizeof("genai_create_agent")];
+    char s855[sizeof("kubernetes_get_kubeconfig")];
+    char s856[sizeof("/v2/kubernetes/clusters/{cluster_id}/kubeconfig")];
+    char s857[sizeof("loadBalancers_get")];
+    char s858[sizeof("genai_attach_agent")];
+    char s859[sizeof("projects_update_default")];
+    char s860[sizeof("firewalls_delete_rules")];
+    char s861[sizeof("cdn_list_endpoints")];
+    char s862[sizeof("genai_get_agent")];
+    char s863[sizeof("apps_assign_alertDestinations")];
+    char s864[sizeof("/v2/apps/{app_id}/alerts/{alert_id}/destinations")];
+    char s865[sizeof("kubernetes_add_nodePool")];
+    char s866[sizeof("count")];
+    char s867[sizeof("registry_list_repositories")];
+    char s868[sizeof("/v2/registry/{registry_name}/repositories")];
+    char s869[sizeof("databases_add")];
+    char s870[sizeof("/v2/databases/{database_cluster_uuid}/dbs")];
+    char s871[sizeof("reservedIPsActions_post")];
+    char s872[sizeof("apps_create_rollback")];
+    char s873[sizeof("/v2/apps/{app_id}/rollback")];
+    char s874[sizeof("databases_list")];
+    char s875[sizeof("databases_update_user")];
+    char s876[sizeof("settings")];
+    char s877[sizeof("kubernetes_get_availableUpgrades")];
+    char s878[sizeof("/v2/kubernetes/clusters/{cluster_id}/upgrades")];
+    char s879[sizeof("droplets_destroy_byTag")];
+    char s880[sizeof("apps_commit_rollback")];
+    char s881[sizeof("/v2/apps/{app_id}/rollback/commit")];
+    char s882[sizeof("databases_update_major_version")];
+    char s883[sizeof("/v2/databases/{database_cluster_uuid}/upgrade")];
+    char s884[sizeof("apps_update")];
+    char s885[sizeof("monitoring_get_lb_droplets_http_session_duration_avg")];
+    char s886[sizeof("/v2/monitoring/metrics/load_balancer/droplets_http_session_duration_avg")];
+    char s887[sizeof("databases_delete")];
+    char s888[sizeof("genai_update_agent")];
+    char s889[sizeof("monitoring_get_lb_frontend_cpu_utilization")];
+    char s890[sizeof("/v2/monitoring/metrics/load_balancer/frontend_cpu_utilization")];
+    char s891[sizeof("databases_get_evictionPolicy")];
+    char s892[sizeof("monitoring_get_lb_frontend_nlb_tcp_network_throughput")];
+    char s893[sizeof("/v2/monitoring/metrics/load_balancer/frontend_nlb_tcp_network_throughput")];
+    char s894[sizeof("genai_list_knowledge_base_data_sources")];
+    char s895[sizeof("partnerAttachments_list_remote_routes")];
+    char s896[sizeof("floatingIPs_list")];
+    char s897[sizeof("droplets_get_backup_policy")];
+    char s898[sizeof("/v2/droplets/{droplet_id}/backups/policy")];
+    char s899[sizeof("kubernetes_update_nodePool")];
+    char s900[sizeof("reservedIPs_get")];
+    char s901[sizeof("floatingIPsAction_post")];
+    char s902[sizeof("invoices_get_summaryByUUID")];
+    char s903[sizeof("/v2/customers/my/invoices/{invoice_uuid}/summary")];
+} do_optable_pool = {
+    "databases_install_update",
+    "PUT",
+    "/v2/databases/{database_cluster_uuid}/install_update",
+    "database_cluster_uuid",
+    "vpcs_delete",
+    "DELETE",
+    "/v2/vpcs/{vpc_id}",
+    "vpc_id",
+    "imageActions_post",
+    "POST",
+    "/v2/images/{image_id}/actions",
+    "image_id",
+    "type",
+    "monitoring_get_dropletMemoryFreeMetrics",
+    "GET",
+    "/v2/monitoring/metrics/droplet/memory_free",
+    "host_id",
+    "start",
+    "end",
+    "loadBalancers_create",
+    "/v2/load_balancers",
+    "forwarding_rules",
+    "region",
+    "droplets_list_backup_policies",
+    "/v2/droplets/backups/policies",
+    "per_page",
+    "page",
+    "kubernetes_create_cluster",
+    "/v2/kubernetes/clusters",
+    "name",
+    "node_pools",
+    "version",
+    "kubernetes_get_clusterLintResults",
+    "/v2/kubernetes/clusters/{cluster_id}/clusterlint",
+    "cluster_id",
+    "run_id",
+    "kubernetes_get_status_messages",
+    "/v2/kubernetes/clusters/{cluster_id}/status_messages",
+    "since",
+    "monitoring_delete_destination",
+    "/v2/monitoring/sinks/destinations/{destination_uuid}",
+    "destination_uuid",
+    "genai_detach_agent",
+    "/v2/gen-ai/agents/{parent_agent_uuid}/child_agents/{child_agent_uuid}",
+    "parent_agent_uuid",
+    "child_agent_uuid",
+    "autoscalepools_list_members",
+    "/v2/droplets/autoscale/{autoscale_pool_id}/members",
+    "autoscale_pool_id",
+    "vpcPeerings_get",
+    "/v2/vpc_peerings/{vpc_peering_id}",
+    "vpc_peering_id",
+    "vpcPeerings_delete",
+    "monitoring_get_DropletCpuMetrics",
+    "/v2/monitoring/metrics/droplet/cpu",
+    "firewalls_delete_droplets",
+    "/v2/firewalls/{firewall_id}/droplets",
+    "firewall_id",
+    "droplet_ids",
+    "volumeActions_post",
+    "/v2/volumes/actions",
+    "droplet_id",
+    "monitoring_create_sink",
+    "/v2/monitoring/sinks",
+    "monitoring_get_droplet_autoscale_current_cpu_utilization.yml",
+    "/v2/monitoring/metrics/droplet_autoscale/current_cpu_utilization",
+    "apps_list_deployments",
+    "/v2/apps/{app_id}/deployments",
+    "app_id",
+    "genai_update_attached_agent",
+    "droplets_destroy",
+    "/v2/droplets/{droplet_id}",
+    "vpcPeerings_list",
+    "/v2/vpc_peerings",
+    "domains_get",
+    "/v2/domains/{domain_name}",
+    "domain_name",
+    "volumes_delete",
+    "/v2/volumes/{volume_id}",
+    "volume_id",
+    "sshKeys_list",
+    "/v2/account/keys",
+    "regions_list",
+    "/v2/regions",
+    "monitoring_get_appMemoryPercentageMetrics",
+    "/v2/monitoring/metrics/apps/memory_percentage",
+    "app_component",
+    "droplets_list_snapshots",
+    "/v2/droplets/{droplet_id}/snapshots",
+    "volumeSnapshots_delete_byId",
+    "/v2/volumes/snapshots/{snapshot_id}",
+    "snapshot_id",
+    "domains_update_record",
+    "/v2/domains/{domain_name}/records/{domain_record_id}",
+    "domain_record_id",
+    "kubernetes_list_options",
+    "/v2/kubernetes/options",
+    "databases_get_connectionPool",
+    "/v2/databases/{database_cluster_uuid}/pools/{pool_name}",
+    "pool_name",
+    "databases_get_migrationStatus",
+    "/v2/databases/{database_cluster_uuid}/online-migration",
+    "projects_assign_resources_default",
+    "/v2/projects/default/resources",
+    "monitoring_get_lb_frontend_network_throughput_http",
+    "/v2/monitoring/metrics/load_balancer/frontend_network_throughput_http",
+    "lb_id",
+    "kubernetes_destroy_associatedResourcesSelective",
+    "/v2/kubernetes/clusters/{cluster_id}/destroy_with_associated_resources/selective",
+    "cdn_update_endpoints",
+    "/v2/cdn/endpoints/{cdn_id}",
+    "cdn_id",
+    "reservedIPv6_delete",
+    "/v2/reserved_ipv6/{reserved_ipv6}",
+    "reserved_ipv6",
+    "firewalls_get",
+    "/v2/firewalls/{firewall_id}",
+    "databases_create_replica",
+    "/v2/databases/{database_cluster_uuid}/replicas",
+    "size",
+    "partnerAttachments_get",
+    "/v2/partner_network_connect/attachments/{pa_id}",
+    "pa_id",
+    "spacesKey_patch",
+    "PATCH",
+    "/v2/spaces/keys/{access_key}",
+    "access_key",
+    "apps_list_alerts",
+    "/v2/apps/{app_id}/alerts",
+    "snapshots_list",
+    "/v2/snapshots",
+    "resource_type",
+    "tags_get",
+    "/v2/tags/{tag_id}",
+    "tag_id",
+    "sizes_list",
+    "/v2/sizes",
+    "uptime_update_alert",
+    "/v2/uptime/checks/{check_id}/alerts/{alert_id}",
+    "check_id",
+    "alert_id",
+    "notifications",
+    "period",
+    "monitoring_get_sink",
+    "/v2/monitoring/sinks/{sink_uuid}",
+    "sink_uuid",
+    "kubernetes_list_clusters",
+    "functions_delete_trigger",
+    "/v2/functions/namespaces/{namespace_id}/triggers/{trigger_name}",
+    "namespace_id",
+    "trigger_name",
+    "databases_update_maintenanceWindow",
+    "/v2/databases/{database_cluster_uuid}/maintenance",
+    "day",
+    "hour",
+    "images_delete",
+    "/v2/images/{image_id}",
+    "floatingIPsAction_get",
+    "/v2/floating_ips/{floating_ip}/actions/{action_id}",
+    "floating_ip",
+    "action_id",
+    "databases_add_connectionPool",
+    "/v2/databases/{database_cluster_uuid}/pools",
+    "db",
+    "mode",
+    "firewalls_delete",
+    "cdn_get_endpoint",
+    "images_update",
+    "projects_get_default",
+    "/v2/projects/default",
+    "apps_cancel_deployment",
+    "/v2/apps/{app_id}/deployments/{deployment_id}/cancel",
+    "deployment_id",
+    "databases_reset_auth",
+    "/v2/databases/{database_cluster_uuid}/users/{username}/reset_auth",
+    "username",
+    "databases_delete_opensearch_index",
+    "/v2/databases/{database_cluster_uuid}/indexes/{index_name}",
+    "index_name",
+    "kubernetes_delete_cluster",
+    "/v2/kubernetes/clusters/{cluster_id}",
+    "databases_update_evictionPolicy",
+    "/v2/databases/{database_cluster_uuid}/eviction_policy",
+    "eviction_policy",
+    "registry_get_subscription",
+    "/v2/registry/subscription",
+    "projects_assign_resources",
+    "/v2/projects/{project_id}/resources",
+    "project_id",
+    "volumeActions_list",
+    "/v2/volumes/{volume_id}/actions",
+    "droplets_list_supported_backup_policies",
+    "/v2/droplets/backups/supported_policies",
+    "balance_get",
+    "/v2/customers/my/balance",
+    "databases_destroy_cluster",
+    "/v2/databases/{database_cluster_uuid}",
+    "vpcPeerings_create",
+    "vpc_ids",
+    "genai_get_agent_children",
+    "/v2/gen-ai/agents/{uuid}/child_agents",
+    "uuid",
+    "droplets_destroy_withAssociatedResourcesDangerous",
+    "/v2/droplets/{droplet_id}/destroy_with_associated_resources/dangerous",
+    "X-Dangerous",
+    "partnerAttachments_patch",
+    "loadBalancers_add_droplets",
+    "/v2/load_balancers/{lb_id}/droplets",
+    "databases_update_kafka_topic",
+    "/v2/databases/{database_cluster_uuid}/topics/{topic_name}",
+    "topic_name",
+    "dropletActions_post_byTag",
+    "/v2/droplets/actions",
+    "tag_name",
+    "genai_update_agent_api_key",
+    "/v2/gen-ai/agents/{agent_uuid}/api_keys/{api_key_uuid}",
+    "agent_uuid",
+    "api_key_uuid",
+    "monitoring_get_lb_droplets_downtime",
+    "/v2/monitoring/metrics/load_balancer/droplets_downtime",
+    "projects_get",
+    "/v2/projects/{project_id}",
+    "cdn_purge_cache",
+    "/v2/cdn/endpoints/{cdn_id}/cache",
+    "files",
+    "genai_list_model_api_keys",
+    "/v2/gen-ai/models/api_keys",
+    "partnerAttachments_update_remote_routes",
+    "/v2/partner_network_connect/attachments/{pa_id}/remote_routes",
+    "databases_delete_connectionPool",
+    "projects_list",
+    "/v2/projects",
+    "uptime_list_alerts",
+    "/v2/uptime/checks/{check_id}/alerts",
+    "registry_delete",
+    "/v2/registry",
+    "spacesKey_get",
+    "monitoring_get_dropletFilesystemSizeMetrics",
+    "/v2/monitoring/metrics/droplet/filesystem_size",
+    "databases_get_user",
+    "/v2/databases/{database_cluster_uuid}/users/{username}",
+    "monitoring_get_lb_frontend_network_throughput_tcp",
+    "/v2/monitoring/metrics/load_balancer/frontend_network_throughput_tcp",
+    "domains_list",
+    "/v2/domains",
+    "droplets_list_associatedResources",
+    "/v2/droplets/{droplet_id}/destroy_with_associated_resources",
+    "databases_list_opeasearch_indexes",
+    "/v2/databases/{database_cluster_uuid}/indexes",
+    "monitoring_get_appRestartCountMetrics.yml",
+    "/v2/monitoring/metrics/apps/restart_count",
+    "monitoring_get_lb_droplets_health_checks",
+    "/v2/monitoring/metrics/load_balancer/droplets_health_checks",
+    "genai_list_knowledge_bases",
+    "/v2/gen-ai/knowledge_bases",
+    "databases_list_clusters",
+    "/v2/databases",
+    "loadBalancers_add_forwardingRules",
+    "/v2/load_balancers/{lb_id}/forwarding_rules",
+    "functions_create_trigger",
+    "/v2/functions/namespaces/{namespace_id}/triggers",
+    "function",
+    "is_enabled",
+    "scheduled_details",
+    "invoices_get_pdfByUUID",
+    "/v2/customers/my/invoices/{invoice_uuid}/pdf",
+    "invoice_uuid",
+    "uptime_get_checkState",
+    "/v2/uptime/checks/{check_id}/state",
+    "databases_add_user",
+    "/v2/databases/{database_cluster_uuid}/users",
+    "genai_list_agents_by_anthropic_key",
+    "/v2/gen-ai/anthropic/keys/{uuid}/agents",
+    "tags_list",
+    "/v2/tags",
+    "apps_get_deployment",
+    "/v2/apps/{app_id}/deployments/{deployment_id}",
+    "databases_update_clusterSize",
+    "/v2/databases/{database_cluster_uuid}/resize",
+    "num_nodes",
+    "monitoring_get_destination",
+    "autoscalepools_list",
+    "/v2/droplets/autoscale",
+    "autoscalepools_list_history",
+    "/v2/droplets/autoscale/{autoscale_pool_id}/history",
+    "databases_patch_config",
+    "/v2/databases/{database_cluster_uuid}/config",
+    "domains_delete_record",
+    "uptime_update_check",
+    "/v2/uptime/checks/{check_id}",
+    "autoscalepools_get",
+    "/v2/droplets/autoscale/{autoscale_pool_id}",
+    "monitoring_get_dropletMemoryCachedMetrics",
+    "/v2/monitoring/metrics/droplet/memory_cached",
+    "kubernetes_get_credentials",
+    "/v2/kubernetes/clusters/{cluster_id}/credentials",
+    "expiry_seconds",
+    "genai_list_agent_api_keys",
+    "/v2/gen-ai/agents/{agent_uuid}/api_keys",
+    "invoices_get_byUUID",
+    "/v2/customers/my/invoices/{invoice_uuid}",
+    "loadBalancers_remove_droplets",
+    "uptime_list_checks",
+    "/v2/uptime/checks",
+    "genai_detach_agent_function",
+    "/v2/gen-ai/agents/{agent_uuid}/functions/{function_uuid}",
+    "function_uuid",
+    "firewalls_add_rules",
+    "/v2/firewalls/{firewall_id}/rules",
+    "floatingIPs_delete",
+    "/v2/floating_ips/{floating_ip}",
+    "databases_get_ca",
+    "/v2/databases/{database_cluster_uuid}/ca",
+    "dropletActions_post",
+    "/v2/droplets/{droplet_id}/actions",
+    "databases_list_connectionPools",
+    "genai_create_anthropic_api_key",
+    "/v2/gen-ai/anthropic/keys",
+    "sshKeys_update",
+    "/v2/account/keys/{ssh_key_identifier}",
+    "ssh_key_identifier",
+    "images_get",
+    "floatingIPsAction_list",
+    "/v2/floating_ips/{floating_ip}/actions",
+    "databases_list_options",
+    "/v2/databases/options",
+    "monitoring_get_droplet_autoscale_target_memory_utilization",
+    "/v2/monitoring/metrics/droplet_autoscale/target_memory_utilization",
+    "partnerAttachments_delete",
+    "genai_create_knowledge_base_data_source",
+    "/v2/gen-ai/knowledge_bases/{knowledge_base_uuid}/data_sources",
+    "knowledge_base_uuid",
+    "firewalls_add_tags",
+    "/v2/firewalls/{firewall_id}/tags",
+    "tags",
+    "apps_get_metrics_bandwidth_daily",
+    "/v2/apps/{app_id}/metrics/bandwidth_daily",
+    "date",
+    "databases_list_backups",
+    "/v2/databases/{database_cluster_uuid}/backups",
+    "registry_delete_repositoryManifest",
+    "/v2/registry/{registry_name}/repositories/{repository_name}/digests/{manifest_digest}",
+    "registry_name",
+    "repository_name",
+    "manifest_digest",
+    "uptime_create_check",
+    "enabled",
+    "method",
+    "regions",
+    "target",
+    "registry_get",
+    "monitoring_get_lb_droplets_http_responses",
+    "/v2/monitoring/metrics/load_balancer/droplets_http_responses",
+    "account_get",
+    "/v2/account",
+    "genai_regenerate_agent_api_key",
+    "/v2/gen-ai/agents/{agent_uuid}/api_keys/{api_key_uuid}/regenerate",
+    "domains_list_records",
+    "/v2/domains/{domain_name}/records",
+    "actions_list",
+    "/v2/actions",
+    "registry_create",
+    "subscription_tier_slug",
+    "imageActions_list",
+    "genai_update_anthropic_api_key",
+    "/v2/gen-ai/anthropic/keys/{api_key_uuid}",
+    "databases_get_kafka_topic",
+    "projects_delete",
+    "monitoring_create_destination",
+    "/v2/monitoring/sinks/destinations",
+    "config",
+    "monitoring_create_alertPolicy",
+    "/v2/monitoring/alerts",
+    "alerts",
+    "compare",
+    "description",
+    "entities",
+    "value",
+    "window",
+    "firewalls_list",
+    "/v2/firewalls",
+    "cdn_create_endpoint",
+    "/v2/cdn/endpoints",
+    "origin",
+    "domains_get_record",
+    "monitoring_get_lb_frontend_connections_current",
+    "/v2/monitoring/metrics/load_balancer/frontend_connections_current",
+    "databases_update_firewall_rules",
+    "/v2/databases/{database_cluster_uuid}/firewall",
+    "registry_get_garbageCollection",
+    "/v2/registry/{registry_name}/garbage-collection",
+    "genai_attach_agent_function",
+    "/v2/gen-ai/agents/{agent_uuid}/functions",
+    "apps_validate_appSpec",
+    "/v2/apps/propose",
+    "spec",
+    "monitoring_get_dropletMemoryAvailableMetrics",
+    "/v2/monitoring/metrics/droplet/memory_available",
+    "actions_get",
+    "/v2/actions/{action_id}",
+    "droplets_destroy_withAssociatedResourcesSelective",
+    "/v2/droplets/{droplet_id}/destroy_with_associated_resources/selective",
+    "uptime_create_alert",
+    "databases_update_onlineMigration",
+    "source",
+    "monitoring_get_lb_frontend_firewall_dropped_packets",
+    "/v2/monitoring/metrics/load_balancer/frontend_firewall_dropped_packets",
+    "droplets_list_neighborsIds",
+    "/v2/reports/droplet_neighbors_ids",
+    "floatingIPs_create",
+    "/v2/floating_ips",
+    "volumes_get",
+    "dropletActions_get",
+    "/v2/droplets/{droplet_id}/actions/{action_id}",
+    "monitoring_update_alertPolicy",
+    "/v2/monitoring/alerts/{alert_uuid}",
+    "alert_uuid",
+    "monitoring_get_lb_frontend_tls_connections_exceeding_rate_limit",
+    "/v2/monitoring/metrics/load_balancer/frontend_tls_connections_exceeding_rate_limit",
+    "reservedIPsActions_list",
+    "/v2/reserved_ips/{reserved_ip}/actions",
+    "reserved_ip",
+    "volumeSnapshots_get_byId",
+    "projects_patch",
+    "loadBalancers_delete_cache",
+    "/v2/load_balancers/{lb_id}/cache",
+    "monitoring_get_dropletLoad15Metrics",
+    "/v2/monitoring/metrics/droplet/load_15",
+    "domains_patch_record",
+    "databases_list_logsink",
+    "/v2/databases/{database_cluster_uuid}/logsink",
+    "kubernetes_add_registry",
+    "/v2/kubernetes/registry",
+    "projects_update",
+    "environment",
+    "is_default",
+    "purpose",
+    "volumeSnapshots_list",
+    "/v2/volumes/{volume_id}/snapshots",
+    "monitoring_get_lb_droplets_http_response_time_avg",
+    "/v2/monitoring/metrics/load_balancer/droplets_http_response_time_avg",
+    "domains_delete",
+    "spacesKey_list",
+    "/v2/spaces/keys",
+    "sort",
+    "sort_direction",
+    "bucket",
+    "permission",
+    "spacesKey_create",
+    "monitoring_delete_sink",
+    "spacesKey_delete",
+    "apps_get_exec_active_deployment",
+    "/v2/apps/{app_id}/components/{component_name}/exec",
+    "component_name",
+    "genai_create_openai_api_key",
+    "/v2/gen-ai/openai/keys",
+    "databases_list_events_logs",
+    "/v2/databases/{database_cluster_uuid}/events",
+    "kubernetes_run_clusterLint",
+    "monitoring_get_lb_droplets_queue_size",
+    "/v2/monitoring/metrics/load_balancer/droplets_queue_size",
+    "registry_get_dockerCredentials",
+    "/v2/registry/docker-credentials",
+    "read_write",
+    "apps_get_instanceSize",
+    "/v2/apps/tiers/instance_sizes/{slug}",
+    "slug",
+    "vpcs_create_peerings",
+    "/v2/vpcs/{vpc_id}/peerings",
+    "genai_create_indexing_job",
+    "/v2/gen-ai/indexing_jobs",
+    "monitoring_get_lb_droplets_http_response_time_95p",
+    "/v2/monitoring/metrics/load_balancer/droplets_http_response_time_95p",
+    "databases_destroy_replica",
+    "/v2/databases/{database_cluster_uuid}/replicas/{replica_name}",
+    "replica_name",
+    "databases_update_cluster_metrics_credentials",
+    "/v2/databases/metrics/credentials",
+    "reservedIPv6Actions_post",
+    "/v2/reserved_ipv6/{reserved_ipv6}/actions",
+    "reservedIPv6_create",
+    "/v2/reserved_ipv6",
+    "region_slug",
+    "monitoring_delete_alertPolicy",
+    "genai_update_knowledge_base",
+    "/v2/gen-ai/knowledge_bases/{uuid}",
+    "genai_delete_anthropic_api_key",
+    "monitoring_get_droplet_autoscale_current_memory_utilization",
+    "/v2/monitoring/metrics/droplet_autoscale/current_memory_utilization",
+    "genai_get_indexing_job",
+    "/v2/gen-ai/indexing_jobs/{uuid}",
+    "autoscalepools_create",
+    "droplet_template",
+    "registry_list_repositoryTags",
+    "/v2/registry/{registry_name}/repositories/{repository_name}/tags",
+    "apps_get_logs_active_deployment_aggregate",
+    "/v2/apps/{app_id}/logs",
+    "follow",
+    "pod_connection_timeout",
+    "vpcs_create",
+    "/v2/vpcs",
+    "kubernetes_remove_registry",
+    "monitoring_get_droplet_autoscale_current_instances",
+    "/v2/monitoring/metrics/droplet_autoscale/current_instances",
+    "databases_get_replica",
+    "databases_delete_onlineMigration",
+    "/v2/databases/{database_cluster_uuid}/online-migration/{migration_id}",
+    "migration_id",
+    "registry_update_subscription",
+    "domains_create",
+    "apps_get_health",
+    "/v2/apps/{app_id}/health",
+    "certificates_delete",
+    "/v2/certificates/{certificate_id}",
+    "certificate_id",
+    "certificates_create",
+    "/v2/certificates",
+    "apps_get_logs_active_deployment",
+    "/v2/apps/{app_id}/components/{component_name}/logs",
+    "tags_assign_resources",
+    "/v2/tags/{tag_id}/resources",
+    "resources",
+    "databases_promote_replica",
+    "/v2/databases/{database_cluster_uuid}/replicas/{replica_name}/promote",
+    "monitoring_get_lb_frontend_tls_connections_limit",
+    "/v2/monitoring/metrics/load_balancer/frontend_tls_connections_limit",
+    "monitoring_get_dropletFilesystemFreeMetrics",
+    "/v2/monitoring/metrics/droplet/filesystem_free",
+    "functions_delete_namespace",
+    "/v2/functions/namespaces/{namespace_id}",
+    "droplets_list_firewalls",
+    "/v2/droplets/{droplet_id}/firewalls",
+    "apps_get",
+    "/v2/apps/{id}",
+    "id",
+    "loadBalancers_list",
+    "apps_get_logs",
+    "/v2/apps/{app_id}/deployments/{deployment_id}/components/{component_name}/logs",
+    "projects_list_resources_default",
+    "registry_list_garbageCollections",
+    "/v2/registry/{registry_name}/garbage-collections",
+    "registry_update_garbageCollection",
+    "/v2/registry/{registry_name}/garbage-collection/{garbage_collection_uuid}",
+    "garbage_collection_uuid",
+    "loadBalancers_update",
+    "/v2/load_balancers/{lb_id}",
+    "monitoring_get_lb_frontend_connections_limit",
+    "/v2/monitoring/metrics/load_balancer/frontend_connections_limit",
+    "databases_get_sql_mode",
+    "/v2/databases/{database_cluster_uuid}/sql_mode",
+    "invoices_list",
+    "/v2/customers/my/invoices",
+    "reservedIPv6_get",
+    "functions_get_trigger",
+    "functions_create_namespace",
+    "/v2/functions/namespaces",
+    "label",
+    "monitoring_get_alertPolicy",
+    "monitoring_get_dropletLoad1Metrics",
+    "/v2/monitoring/metrics/droplet/load_1",
+    "autoscalepools_delete_dangerous",
+    "/v2/droplets/autoscale/{autoscale_pool_id}/dangerous",
+    "genai_regenerate_model_api_key",
+    "/v2/gen-ai/models/api_keys/{api_key_uuid}/regenerate",
+    "apps_restart",
+    "/v2/apps/{app_id}/restart",
+    "partnerAttachments_create_service_key",
+    "/v2/partner_network_connect/attachments/{pa_id}/service_key",
+    "spacesKey_update",
+    "droplets_get",
+    "apps_validate_rollback",
+    "/v2/apps/{app_id}/rollback/validate",
+    "genai_attach_knowledge_base",
+    "/v2/gen-ai/agents/{agent_uuid}/knowledge_bases/{knowledge_base_uuid}",
+    "databases_get_cluster",
+    "reservedIPs_create",
+    "/v2/reserved_ips",
+    "droplets_get_DestroyAssociatedResourcesStatus",
+    "/v2/droplets/{droplet_id}/destroy_with_associated_resources/status",
+    "kubernetes_list_nodePools",
+    "/v2/kubernetes/clusters/{cluster_id}/node_pools",
+    "uptime_delete_check",
+    "uptime_delete_alert",
+    "droplets_create",
+    "/v2/droplets",
+    "image",
+    "monitoring_get_lb_droplets_http_session_duration_95p",
+    "/v2/monitoring/metrics/load_balancer/droplets_http_session_duration_95p",
+    "genai_detach_knowledge_base",
+    "genai_delete_model_api_key",
+    "/v2/gen-ai/models/api_keys/{api_key_uuid}",
+    "genai_cancel_indexing_job",
+    "/v2/gen-ai/indexing_jobs/{uuid}/cancel",
+    "genai_get_knowledge_base",
+    "autoscalepools_delete",
+    "droplets_list_backups",
+    "/v2/droplets/{droplet_id}/backups",
+    "firewalls_update",
+    "floatingIPs_get",
+    "monitoring_list_destinations",
+    "volumes_list",
+    "/v2/volumes",
+    "kubernetes_upgrade_cluster",
+    "/v2/kubernetes/clusters/{cluster_id}/upgrade",
+    "partnerAttachments_get_service_key",
+    "snapshots_delete",
+    "/v2/snapshots/{snapshot_id}",
+    "domains_create_record",
+    "genai_list_anthropic_api_keys",
+    "sshKeys_delete",
+    "firewalls_assign_droplets",
+    "uptime_get_alert",
+    "images_create_custom",
+    "/v2/images",
+    "url",
+    "functions_list_triggers",
+    "databases_get_cluster_metrics_credentials",
+    "monitoring_get_lb_droplets_connections",
+    "/v2/monitoring/metrics/load_balancer/droplets_connections",
+    "monitoring_get_lb_droplets_http_session_duration_50p",
+    "/v2/monitoring/metrics/load_balancer/droplets_http_session_duration_50p",
+    "apps_get_exec",
+    "/v2/apps/{app_id}/deployments/{deployment_id}/components/{component_name}/exec",
+    "instance_name",
+    "cdn_delete_endpoint",
+    "kubernetes_get_nodePool",
+    "/v2/kubernetes/clusters/{cluster_id}/node_pools/{node_pool_id}",
+    "node_pool_id",
+    "kubernetes_get_clusterUser",
+    "/v2/kubernetes/clusters/{cluster_id}/user",
+    "tags_delete",
+    "uptime_get_check",
+    "monitoring_get_lb_frontend_nlb_udp_network_throughput",
+    "/v2/monitoring/metrics/load_balancer/frontend_nlb_udp_network_throughput",
+    "databases_get_config",
+    "registry_delete_repositoryTag",
+    "/v2/registry/{registry_name}/repositories/{repository_name}/tags/{repository_tag}",
+    "repository_tag",
+    "volumes_delete_byName",
+    "genai_delete_knowledge_base_data_source",
+    "/v2/gen-ai/knowledge_bases/{knowledge_base_uuid}/data_sources/{data_source_uuid}",
+    "data_source_uuid",
+    "monitoring_get_dropletMemoryTotalMetrics",
+    "/v2/monitoring/metrics/droplet/memory_total",
+    "kubernetes_delete_nodePool",
+    "snapshots_get",
+    "registry_validate_name",
+    "/v2/registry/validate-name",
+    "tags_create",
+    "genai_update_agent_deployment_visibility",
+    "/v2/gen-ai/agents/{uuid}/deployment_visibility",
+    "vpcs_patch_peerings",
+    "/v2/vpcs/{vpc_id}/peerings/{vpc_peering_id}",
+    "droplets_list_neighbors",
+    "/v2/droplets/{droplet_id}/neighbors",
+    "genai_get_openai_api_key",
+    "/v2/gen-ai/openai/keys/{api_key_uuid}",
+    "apps_create",
+    "/v2/apps",
+    "Accept",
+    "Content-Type",
+    "monitoring_get_lb_frontend_tls_connections_current",
+    "/v2/monitoring/metrics/load_balancer/frontend_tls_connections_current",
+    "databases_update_sql_mode",
+    "sql_mode",
+    "databases_create_kafka_topic",
+    "/v2/databases/{database_cluster_uuid}/topics",
+    "loadBalancers_delete",
+    "genai_delete_agent_api_key",
+    "kubernetes_destroy_associatedResourcesDangerous",
+    "/v2/kubernetes/clusters/{cluster_id}/destroy_with_associated_resources/dangerous",
+    "genai_update_agent_function",
+    "monitoring_list_sinks",
+    "resource_id",
+    "genai_update_model_api_key",
+    "apps_revert_rollback",
+    "/v2/apps/{app_id}/rollback/revert",
+    "reservedIPs_delete",
+    "/v2/reserved_ips/{reserved_ip}",
+    "oneClicks_install_kubernetes",
+    "/v2/1-clicks/kubernetes",
+    "addon_slugs",
+    "cluster_uuid",
+    "databases_create_cluster",
+    "engine",
+    "dropletActions_list",
+    "reservedIPsActions_get",
+    "/v2/reserved_ips/{reserved_ip}/actions/{action_id}",
+    "firewalls_create",
+    "sshKeys_create",
+    "public_key",
+    "imageActions_get",
+    "/v2/images/{image_id}/actions/{action_id}",
+    "genai_list_indexing_job_data_sources",
+    "/v2/gen-ai/indexing_jobs/{indexing_job_uuid}/data_sources",
+    "indexing_job_uuid",
+    "volumeSnapshots_create",
+    "functions_update_trigger",
+    "genai_rollback_to_agent_version",
+    "/v2/gen-ai/agents/{uuid}/versions",
+    "monitoring_update_destination",
+    "reservedIPs_list",
+    "genai_get_anthropic_api_key",
+    "kubernetes_list_associatedResources",
+    "/v2/kubernetes/clusters/{cluster_id}/destroy_with_associated_resources",
+    "registry_list_repositoryManifests",
+    "/v2/registry/{registry_name}/repositories/{repository_name}/digests",
+    "genai_list_datacenter_regions",
+    "/v2/gen-ai/regions",
+    "serves_inference",
+    "serves_batch",
+    "projects_create",
+    "apps_list_instanceSizes",
+    "/v2/apps/tiers/instance_sizes",
+    "projects_list_resources",
+    "apps_create_deployment",
+    "databases_update_region",
+    "/v2/databases/{database_cluster_uuid}/migrate",
+    "monitoring_get_droplet_autoscale_target_cpu_utilization",
+    "/v2/monitoring/metrics/droplet_autoscale/target_cpu_utilization",
+    "volumeActions_post_byId",
+    "invoices_get_csvByUUID",
+    "/v2/customers/my/invoices/{invoice_uuid}/csv",
+    "genai_delete_agent",
+    "/v2/gen-ai/agents/{uuid}",
+    "certificates_list",
+    "genai_list_agents",
+    "/v2/gen-ai/agents",
+    "only_deployed",
+    "kubernetes_recycle_node_pool",
+    "/v2/kubernetes/clusters/{cluster_id}/node_pools/{node_pool_id}/recycle",
+    "databases_update_logsink",
+    "/v2/databases/{database_cluster_uuid}/logsink/{logsink_id}",
+    "logsink_id",
+    "firewalls_delete_tags",
+    "oneClicks_list",
+    "/v2/1-clicks",
+    "vpcs_list_members",
+    "/v2/vpcs/{vpc_id}/members",
+    "genai_attach_knowledge_bases",
+    "/v2/gen-ai/agents/{agent_uuid}/knowledge_bases",
+    "vpcPeerings_patch",
+    "partnerAttachments_list",
+    "/v2/partner_network_connect/attachments",
+    "kubernetes_delete_node",
+    "/v2/kubernetes/clusters/{cluster_id}/node_pools/{node_pool_id}/nodes/{node_id}",
+    "node_id",
+    "skip_drain",
+    "replace",
+    "vpcs_patch",
+    "monitoring_get_lb_frontend_http_responses",
+    "/v2/monitoring/metrics/load_balancer/frontend_http_responses",
+    "genai_create_model_api_key",
+    "genai_delete_openai_api_key",
+    "apps_list_regions",
+    "/v2/apps/regions",
+    "vpcs_list_peerings",
+    "functions_get_namespace",
+    "genai_list_models",
+    "/v2/gen-ai/models",
+    "usecases",
+    "public_only",
+    "functions_list_namespaces",
+    "tags_unassign_resources",
+    "genai_list_openai_api_keys",
+    "monitoring_get_appCPUPercentageMetrics",
+    "/v2/monitoring/metrics/apps/cpu_percentage",
+    "databases_list_replicas",
+    "databases_get",
+    "/v2/databases/{database_cluster_uuid}/dbs/{database_name}",
+    "database_name",
+    "monitoring_get_dropletLoad5Metrics",
+    "/v2/monitoring/metrics/droplet/load_5",
+    "droplets_destroy_retryWithAssociatedResources",
+    "/v2/droplets/{droplet_id}/destroy_with_associated_resources/retry",
+    "autoscalepools_update",
+    "apps_get_instances",
+    "/v2/apps/{app_id}/instances",
+    "databases_list_firewall_rules",
+    "monitoring_get_lb_droplets_http_response_time_50p",
+    "/v2/monitoring/metrics/load_balancer/droplets_http_response_time_50p",
+    "images_list",
+    "private",
+    "monitoring_get_droplet_autoscale_target_instances",
+    "/v2/monitoring/metrics/droplet_autoscale/target_instances",
+    "genai_create_agent_api_key",
+    "genai_update_openai_api_key",
+    "vpcs_get",
+    "apps_delete",
+    "databases_list_kafka_topics",
+    "databases_delete_logsink",
+    "vpcs_update",
+    "genai_create_knowledge_base",
+    "registry_list_repositoriesV2",
+    "/v2/registry/{registry_name}/repositoriesV2",
+    "page_token",
+    "projects_patch_default",
+    "monitoring_get_lb_frontend_http_requests_per_second",
+    "/v2/monitoring/metrics/load_balancer/frontend_http_requests_per_second",
+    "vpcs_list",
+    "monitoring_get_lb_droplets_http_response_time_99p",
+    "/v2/monitoring/metrics/load_balancer/droplets_http_response_time_99p",
+    "droplets_list",
+    "monitoring_get_dropletBandwidthMetrics",
+    "/v2/monitoring/metrics/droplet/bandwidth",
+    "interface",
+    "direction",
+    "certificates_get",
+    "apps_get_logs_aggregate",
+    "/v2/apps/{app_id}/deployments/{deployment_id}/logs",
+    "loadBalancers_remove_forwardingRules",
+    "monitoring_list_alertPolicy",
+    "genai_list_agent_versions",
+    "databases_list_users",
+    "databases_get_logsink",
+    "genai_list_indexing_jobs",
+    "sshKeys_get",
+    "apps_list_metrics_bandwidth_daily",
+    "/v2/apps/metrics/bandwidth_daily",
+    "app_ids",
+    "databases_update_connectionPool",
+    "volumeActions_get",
+    "/v2/volumes/{volume_id}/actions/{action_id}",
+    "droplets_list_kernels",
+    "/v2/droplets/{droplet_id}/kernels",
+    "databases_delete_user",
+    "genai_delete_knowledge_base",
+    "monitoring_get_lb_frontend_network_throughput_udp",
+    "/v2/monitoring/metrics/load_balancer/frontend_network_throughput_udp",
+    "kubernetes_get_cluster",
+    "partnerAttachments_get_bgp_auth_key",
+    "/v2/partner_network_connect/attachments/{pa_id}/bgp_auth_key",
+    "genai_list_agents_by_openai_key",
+    "/v2/gen-ai/openai/keys/{uuid}/agents",
+    "registry_get_options",
+    "/v2/registry/options",
+    "databases_delete_kafka_topic",
+    "billingHistory_list",
+    "/v2/customers/my/billing_history",
+    "partnerAttachments_create",
+    "connection_bandwidth_in_mbps",
+    "naas_provider",
+    "monitoring_get_lb_frontend_firewall_dropped_bytes",
+    "/v2/monitoring/metrics/load_balancer/frontend_firewall_dropped_bytes",
+    "volumes_create",
+    "size_gigabytes",
+    "reservedIPv6_list",
+    "registry_run_garbageCollection",
+    "kubernetes_update_cluster",
+    "apps_list",
+    "with_projects",
+    "databases_create_logsink",
+    "sink_name",
+    "sink_type",
+    "genai_create_agent",
+    "kubernetes_get_kubeconfig",
+    "/v2/kubernetes/clusters/{cluster_id}/kubeconfig",
+    "loadBalancers_get",
+    "genai_attach_agent",
+    "projects_update_default",
+    "firewalls_delete_rules",
+    "cdn_list_endpoints",
+    "genai_get_agent",
+    "apps_assign_alertDestinations",
+    "/v2/apps/{app_id}/alerts/{alert_id}/destinations",
+    "kubernetes_add_nodePool",
+    "count",
+    "registry_list_repositories",
+    "/v2/registry/{registry_name}/repositories",
+    "databases_add",
+    "/v2/databases/{database_cluster_uuid}/dbs",
+    "reservedIPsActions_post",
+    "apps_create_rollback",
+    "/v2/apps/{app_id}/rollback",
+    "databases_list",
+    "databases_update_user",
+    "settings",
+    "kubernetes_get_availableUpgrades",
+    "/v2/kubernetes/clusters/{cluster_id}/upgrades",
+    "droplets_destroy_byTag",
+    "apps_commit_rollback",
+    "/v2/apps/{app_id}/rollback/commit",
+    "databases_update_major_version",
+    "/v2/databases/{database_cluster_uuid}/upgrade",
+    "apps_update",
+    "monitoring_get_lb_droplets_http_session_duration_avg",
+    "/v2/monitoring/metrics/load_balancer/droplets_http_session_duration_avg",
+    "databases_delete",
+    "genai_update_agent",
+    "monitoring_get_lb_frontend_cpu_utilization",
+    "/v2/monitoring/metrics/load_balancer/frontend_cpu_utilization",
+    "databases_get_evictionPolicy",
+    "monitoring_get_lb_frontend_nlb_tcp_network_throughput",
+    "/v2/monitoring/metrics/load_balancer/frontend_nlb_tcp_network_throughput",
+    "genai_list_knowledge_base_data_sources",
+    "partnerAttachments_list_remote_routes",
+    "floatingIPs_list",
+    "droplets_get_backup_policy",
+    "/v2/droplets/{droplet_id}/backups/policy",
+    "kubernetes_update_nodePool",
+    "reservedIPs_get",
+    "floatingIPsAction_post",
+    "invoices_get_summaryByUUID",
+    "/v2/customers/my/invoices/{invoice_uuid}/summary",
+};
+
+#define DO_OPTABLE_STR(n) offsetof(struct do_optable_pool, s##n)
+
+const char *const do_optable_strings = (const char *)&do_optable_pool;
+
+const size_t do_optable_op_count = 452;
+const size_t do_optable_seed_count = 113;
+
+// Indexed by perfect-hash slot
+const struct do_operation do_optable_ops[] = {
+    {DO_OPTABLE_STR(0), DO_OPTABLE_STR(1), DO_OPTABLE_STR(2), 0, 1, 0, 0, 0},
+    {DO_OPTABLE_STR(4), DO_OPTABLE_STR(5), DO_OPTABLE_STR(6), 1, 1, 0, 0, 0},
+    {DO_OPTABLE_STR(8), DO_OPTABLE_STR(9), DO_OPTABLE_STR(10), 2, 1, 0, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(13), DO_OPTABLE_STR(14), DO_OPTABLE_STR(15), 3, 3, 1, 0, 0},
+    {DO_OPTABLE_STR(19), DO_OPTABLE_STR(9), DO_OPTABLE_STR(20), 6, 0, 1, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(23), DO_OPTABLE_STR(14), DO_OPTABLE_STR(24), 6, 2, 3, 0, 0},
+    {DO_OPTABLE_STR(27), DO_OPTABLE_STR(9), DO_OPTABLE_STR(28), 8, 0, 3, 4, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(32), DO_OPTABLE_STR(14), DO_OPTABLE_STR(33), 8, 2, 7, 0, 0},
+    {DO_OPTABLE_STR(36), DO_OPTABLE_STR(14), DO_OPTABLE_STR(37), 10, 2, 7, 0, 0},
+    {DO_OPTABLE_STR(39), DO_OPTABLE_STR(5), DO_OPTABLE_STR(40), 12, 1, 7, 0, 0},
+    {DO_OPTABLE_STR(42), DO_OPTABLE_STR(5), DO_OPTABLE_STR(43), 13, 2, 7, 0, 0},
+    {DO_OPTABLE_STR(46), DO_OPTABLE_STR(14), DO_OPTABLE_STR(47), 15, 3, 7, 0, 0},
+    {DO_OPTABLE_STR(49), DO_OPTABLE_STR(14), DO_OPTABLE_STR(50), 18, 1, 7, 0, 0},
+    {DO_OPTABLE_STR(52), DO_OPTABLE_STR(5), DO_OPTABLE_STR(50), 19, 1, 7, 0, 0},
+    {DO_OPTABLE_STR(53), DO_OPTABLE_STR(14), DO_OPTABLE_STR(54), 20, 3, 7, 0, 0},
+    {DO_OPTABLE_STR(55), DO_OPTABLE_STR(5), DO_OPTABLE_STR(56), 23, 1, 7, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(59), DO_OPTABLE_STR(9), DO_OPTABLE_STR(60), 24, 2, 8, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(62), DO_OPTABLE_STR(9), DO_OPTABLE_STR(63), 26, 0, 10, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(64), DO_OPTABLE_STR(14), DO_OPTABLE_STR(65), 26, 3, 10, 0, 0},
+    {DO_OPTABLE_STR(66), DO_OPTABLE_STR(14), DO_OPTABLE_STR(67), 29, 3, 10, 0, 0},
+    {DO_OPTABLE_STR(69), DO_OPTABLE_STR(1), DO_OPTABLE_STR(43), 32, 2, 10, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(70), DO_OPTABLE_STR(5), DO_OPTABLE_STR(71), 34, 1, 10, 0, 0},
+    {DO_OPTABLE_STR(72), DO_OPTABLE_STR(14), DO_OPTABLE_STR(73), 35, 3, 10, 0, 0},
+    {DO_OPTABLE_STR(74), DO_OPTABLE_STR(14), DO_OPTABLE_STR(75), 38, 1, 10, 0, 0},
+    {DO_OPTABLE_STR(77), DO_OPTABLE_STR(5), DO_OPTABLE_STR(78), 39, 1, 10, 0, 0},
+    {DO_OPTABLE_STR(80), DO_OPTABLE_STR(14), DO_OPTABLE_STR(81), 40, 2, 10, 0, 0},
+    {DO_OPTABLE_STR(82), DO_OPTABLE_STR(14), DO_OPTABLE_STR(83), 42, 2, 10, 0, 0},
+    {DO_OPTABLE_STR(84), DO_OPTABLE_STR(14), DO_OPTABLE_STR(85), 44, 4, 10, 0, 0},
+    {DO_OPTABLE_STR(87), DO_OPTABLE_STR(14), DO_OPTABLE_STR(88), 48, 3, 10, 0, 0},
+    {DO_OPTABLE_STR(89), DO_OPTABLE_STR(5), DO_OPTABLE_STR(90), 51, 1, 10, 0, 0},
+    {DO_OPTABLE_STR(92), DO_OPTABLE_STR(1), DO_OPTABLE_STR(93), 52, 2, 10, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(95), DO_OPTABLE_STR(14), DO_OPTABLE_STR(96), 54, 0, 11, 0, 0},
+    {DO_OPTABLE_STR(97), DO_OPTABLE_STR(14), DO_OPTABLE_STR(98), 54, 2, 11, 0, 0},
+    {DO_OPTABLE_STR(100), DO_OPTABLE_STR(14), DO_OPTABLE_STR(101), 56, 1, 11, 0, 0},
+    {DO_OPTABLE_STR(102), DO_OPTABLE_STR(9), DO_OPTABLE_STR(103), 57, 0, 11, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(104), DO_OPTABLE_STR(14), DO_OPTABLE_STR(105), 57, 3, 11, 0, 0},
+    {DO_OPTABLE_STR(107), DO_OPTABLE_STR(5), DO_OPTABLE_STR(108), 60, 1, 11, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(109), DO_OPTABLE_STR(1), DO_OPTABLE_STR(110), 61, 1, 11, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(112), DO_OPTABLE_STR(5), DO_OPTABLE_STR(113), 62, 1, 11, 0, 0},
+    {DO_OPTABLE_STR(115), DO_OPTABLE_STR(14), DO_OPTABLE_STR(116), 63, 1, 11, 0, 0},
+    {DO_OPTABLE_STR(117), DO_OPTABLE_STR(9), DO_OPTABLE_STR(118), 64, 1, 11, 2, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(120), DO_OPTABLE_STR(14), DO_OPTABLE_STR(121), 65, 1, 13, 0, 0},
+    {DO_OPTABLE_STR(123), DO_OPTABLE_STR(124), DO_OPTABLE_STR(125), 66, 1, 13, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(127), DO_OPTABLE_STR(14), DO_OPTABLE_STR(128), 67, 1, 13, 0, 0},
+    {DO_OPTABLE_STR(129), DO_OPTABLE_STR(14), DO_OPTABLE_STR(130), 68, 3, 13, 0, 0},
+    {DO_OPTABLE_STR(132), DO_OPTABLE_STR(14), DO_OPTABLE_STR(133), 71, 1, 13, 0, 0},
+    {DO_OPTABLE_STR(135), DO_OPTABLE_STR(14), DO_OPTABLE_STR(136), 72, 2, 13, 0, 0},
+    {DO_OPTABLE_STR(137), DO_OPTABLE_STR(1), DO_OPTABLE_STR(138), 74, 2, 13, 4, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(143), DO_OPTABLE_STR(14), DO_OPTABLE_STR(144), 76, 1, 17, 0, 0},
+    {DO_OPTABLE_STR(146), DO_OPTABLE_STR(14), DO_OPTABLE_STR(28), 77, 2, 17, 0, 0},
+    {DO_OPTABLE_STR(147), DO_OPTABLE_STR(5), DO_OPTABLE_STR(148), 79, 2, 17, 0, 0},
+    {DO_OPTABLE_STR(151), DO_OPTABLE_STR(1), DO_OPTABLE_STR(152), 81, 1, 17, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(155), DO_OPTABLE_STR(5), DO_OPTABLE_STR(156), 82, 1, 19, 0, 0},
+    {DO_OPTABLE_STR(157), DO_OPTABLE_STR(14), DO_OPTABLE_STR(158), 83, 2, 19, 0, 0},
+    {DO_OPTABLE_STR(161), DO_OPTABLE_STR(9), DO_OPTABLE_STR(162), 85, 1, 19, 4, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(165), DO_OPTABLE_STR(5), DO_OPTABLE_STR(116), 86, 1, 23, 0, 0},
+    {DO_OPTABLE_STR(166), DO_OPTABLE_STR(14), DO_OPTABLE_STR(110), 87, 1, 23, 0, 0},
+    {DO_OPTABLE_STR(167), DO_OPTABLE_STR(1), DO_OPTABLE_STR(156), 88, 1, 23, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(168), DO_OPTABLE_STR(14), DO_OPTABLE_STR(169), 89, 0, 23, 0, 0},
+    {DO_OPTABLE_STR(170), DO_OPTABLE_STR(9), DO_OPTABLE_STR(171), 89, 2, 23, 0, 0},
+    {DO_OPTABLE_STR(173), DO_OPTABLE_STR(9), DO_OPTABLE_STR(174), 91, 2, 23, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(176), DO_OPTABLE_STR(5), DO_OPTABLE_STR(177), 93, 2, 23, 0, 0},
+    {DO_OPTABLE_STR(179), DO_OPTABLE_STR(5), DO_OPTABLE_STR(180), 95, 1, 23, 0, 0},
+    {DO_OPTABLE_STR(181), DO_OPTABLE_STR(1), DO_OPTABLE_STR(182), 96, 1, 23, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(184), DO_OPTABLE_STR(14), DO_OPTABLE_STR(185), 97, 0, 24, 0, 0},
+    {DO_OPTABLE_STR(186), DO_OPTABLE_STR(9), DO_OPTABLE_STR(187), 97, 1, 24, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(189), DO_OPTABLE_STR(14), DO_OPTABLE_STR(190), 98, 3, 24, 0, 0},
+    {DO_OPTABLE_STR(191), DO_OPTABLE_STR(14), DO_OPTABLE_STR(192), 101, 0, 24, 0, 0},
+    {DO_OPTABLE_STR(193), DO_OPTABLE_STR(14), DO_OPTABLE_STR(194), 101, 0, 24, 0, 0},
+    {DO_OPTABLE_STR(195), DO_OPTABLE_STR(5), DO_OPTABLE_STR(196), 101, 1, 24, 0, 0},
+    {DO_OPTABLE_STR(197), DO_OPTABLE_STR(9), DO_OPTABLE_STR(73), 102, 0, 24, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(199), DO_OPTABLE_STR(14), DO_OPTABLE_STR(200), 102, 1, 26, 0, 0},
+    {DO_OPTABLE_STR(202), DO_OPTABLE_STR(5), DO_OPTABLE_STR(203), 103, 2, 26, 0, 0},
+    {DO_OPTABLE_STR(205), DO_OPTABLE_STR(124), DO_OPTABLE_STR(121), 105, 1, 26, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(206), DO_OPTABLE_STR(9), DO_OPTABLE_STR(207), 106, 1, 26, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(208), DO_OPTABLE_STR(1), DO_OPTABLE_STR(209), 107, 2, 27, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(211), DO_OPTABLE_STR(9), DO_OPTABLE_STR(212), 109, 1, 27, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(214), DO_OPTABLE_STR(1), DO_OPTABLE_STR(215), 110, 2, 28, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(218), DO_OPTABLE_STR(14), DO_OPTABLE_STR(219), 112, 3, 28, 0, 0},
+    {DO_OPTABLE_STR(220), DO_OPTABLE_STR(14), DO_OPTABLE_STR(221), 115, 1, 28, 0, 0},
+    {DO_OPTABLE_STR(222), DO_OPTABLE_STR(5), DO_OPTABLE_STR(223), 116, 1, 28, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(225), DO_OPTABLE_STR(14), DO_OPTABLE_STR(226), 117, 2, 29, 0, 0},
+    {DO_OPTABLE_STR(227), DO_OPTABLE_STR(1), DO_OPTABLE_STR(228), 119, 1, 29, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(229), DO_OPTABLE_STR(5), DO_OPTABLE_STR(98), 120, 2, 29, 0, 0},
+    {DO_OPTABLE_STR(230), DO_OPTABLE_STR(14), DO_OPTABLE_STR(231), 122, 2, 29, 0, 0},
+    {DO_OPTABLE_STR(232), DO_OPTABLE_STR(14), DO_OPTABLE_STR(233), 124, 3, 29, 0, 0},
+    {DO_OPTABLE_STR(234), DO_OPTABLE_STR(5), DO_OPTABLE_STR(235), 127, 0, 29, 0, 0},
+    {DO_OPTABLE_STR(236), DO_OPTABLE_STR(14), DO_OPTABLE_STR(125), 127, 1, 29, 0, 0},
+    {DO_OPTABLE_STR(237), DO_OPTABLE_STR(14), DO_OPTABLE_STR(238), 128, 3, 29, 0, 0},
+    {DO_OPTABLE_STR(239), DO_OPTABLE_STR(14), DO_OPTABLE_STR(240), 131, 2, 29, 0, 0},
+    {DO_OPTABLE_STR(241), DO_OPTABLE_STR(14), DO_OPTABLE_STR(242), 133, 3, 29, 0, 0},
+    {DO_OPTABLE_STR(243), DO_OPTABLE_STR(14), DO_OPTABLE_STR(244), 136, 2, 29, 0, 0},
+    {DO_OPTABLE_STR(245), DO_OPTABLE_STR(14), DO_OPTABLE_STR(246), 138, 1, 29, 0, 0},
+    {DO_OPTABLE_STR(247), DO_OPTABLE_STR(14), DO_OPTABLE_STR(248), 139, 1, 29, 0, 0},
+    {DO_OPTABLE_STR(249), DO_OPTABLE_STR(14), DO_OPTABLE_STR(250), 140, 4, 29, 0, 0},
+    {DO_OPTABLE_STR(251), DO_OPTABLE_STR(14), DO_OPTABLE_STR(252), 144, 3, 29, 0, 0},
+    {DO_OPTABLE_STR(253), DO_OPTABLE_STR(14), DO_OPTABLE_STR(254), 147, 2, 29, 0, 0},
+    {DO_OPTABLE_STR(255), DO_OPTABLE_STR(14), DO_OPTABLE_STR(256), 149, 1, 29, 0, 0},
+    {DO_OPTABLE_STR(257), DO_OPTABLE_STR(9), DO_OPTABLE_STR(258), 150, 1, 29, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(259), DO_OPTABLE_STR(9), DO_OPTABLE_STR(260), 151, 1, 30, 5, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(264), DO_OPTABLE_STR(14), DO_OPTABLE_STR(265), 152, 1, 35, 0, 0},
+    {DO_OPTABLE_STR(267), DO_OPTABLE_STR(14), DO_OPTABLE_STR(268), 153, 1, 35, 0, 0},
+    {DO_OPTABLE_STR(269), DO_OPTABLE_STR(9), DO_OPTABLE_STR(270), 154, 1, 35, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(271), DO_OPTABLE_STR(14), DO_OPTABLE_STR(272), 155, 3, 36, 0, 0},
+    {DO_OPTABLE_STR(273), DO_OPTABLE_STR(14), DO_OPTABLE_STR(274), 158, 2, 36, 0, 0},
+    {DO_OPTABLE_STR(275), DO_OPTABLE_STR(14), DO_OPTABLE_STR(276), 160, 2, 36, 0, 0},
+    {DO_OPTABLE_STR(277), DO_OPTABLE_STR(1), DO_OPTABLE_STR(278), 162, 1, 36, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(280), DO_OPTABLE_STR(14), DO_OPTABLE_STR(40), 163, 1, 38, 0, 0},
+    {DO_OPTABLE_STR(281), DO_OPTABLE_STR(14), DO_OPTABLE_STR(282), 164, 3, 38, 0, 0},
+    {DO_OPTABLE_STR(283), DO_OPTABLE_STR(14), DO_OPTABLE_STR(284), 167, 3, 38, 0, 0},
+    {DO_OPTABLE_STR(285), DO_OPTABLE_STR(124), DO_OPTABLE_STR(286), 170, 1, 38, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(287), DO_OPTABLE_STR(5), DO_OPTABLE_STR(93), 171, 2, 38, 0, 0},
+    {DO_OPTABLE_STR(288), DO_OPTABLE_STR(1), DO_OPTABLE_STR(289), 173, 1, 38, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(290), DO_OPTABLE_STR(14), DO_OPTABLE_STR(291), 174, 1, 38, 0, 0},
+    {DO_OPTABLE_STR(292), DO_OPTABLE_STR(14), DO_OPTABLE_STR(293), 175, 3, 38, 0, 0},
+    {DO_OPTABLE_STR(294), DO_OPTABLE_STR(14), DO_OPTABLE_STR(295), 178, 2, 38, 0, 0},
+    {DO_OPTABLE_STR(297), DO_OPTABLE_STR(14), DO_OPTABLE_STR(298), 180, 3, 38, 0, 0},
+    {DO_OPTABLE_STR(299), DO_OPTABLE_STR(14), DO_OPTABLE_STR(300), 183, 3, 38, 0, 0},
+    {DO_OPTABLE_STR(301), DO_OPTABLE_STR(5), DO_OPTABLE_STR(207), 186, 1, 38, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(302), DO_OPTABLE_STR(14), DO_OPTABLE_STR(303), 187, 2, 39, 0, 0},
+    {DO_OPTABLE_STR(304), DO_OPTABLE_STR(5), DO_OPTABLE_STR(305), 189, 2, 39, 0, 0},
+    {DO_OPTABLE_STR(307), DO_OPTABLE_STR(9), DO_OPTABLE_STR(308), 191, 1, 39, 0, DO_OP_HAS_BODY},
+    {DO_OPTABLE_STR(309), DO_OPTABLE_STR(5), DO_OPTABLE_STR(310), 192, 1, 39, 0, 0},
+    {DO_OPTABLE_STR(311), DO_OPTABLE_STR(14), DO_OPTABLE_STR(312), 193, 1, 39, 0, 0},
+    {DO_OPTABLE_STR(313), DO_OPTABLE_STR(9), DO_OPTABLE_STR(314), 194, 1, 39, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(315), DO_OPTABLE_STR(14), DO_OPTABLE_STR(162), 195, 1, 40, 0, 0},
+    {DO_OPTABLE_STR(316), DO_OPTABLE_STR(9), DO_OPTABLE_STR(317), 196, 0, 40, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(318), DO_OPTABLE_STR(1), DO_OPTABLE_STR(319), 196, 1, 40, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(321), DO_OPTABLE_STR(14), DO_OPTABLE_STR(156), 197, 1, 40, 0, 0},
+    {DO_OPTABLE_STR(322), DO_OPTABLE_STR(14), DO_OPTABLE_STR(323), 198, 1, 40, 0, 0},
+    {DO_OPTABLE_STR(324), DO_OPTABLE_STR(14), DO_OPTABLE_STR(325), 199, 0, 40, 0, 0},
+    {DO_OPTABLE_STR(326), DO_OPTABLE_STR(14), DO_OPTABLE_STR(327), 199, 3, 40, 0, 0},
+    {DO_OPTABLE_STR(328), DO_OPTABLE_STR(5), DO_OPTABLE_STR(121), 202, 1, 40, 0, 0},
+    {DO_OPTABLE_STR(329), DO_OPTABLE_STR(9), DO_OPTABLE_STR(330), 203, 1, 40, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(332), DO_OPTABLE_STR(9), DO_OPTABLE_STR(333), 204, 1, 40, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(335), DO_OPTABLE_STR(14), DO_OPTABLE_STR(336), 205, 2, 41, 0, 0},
+    {DO_OPTABLE_STR(338), DO_OPTABLE_STR(14), DO_OPTABLE_STR(339), 207, 1, 41, 0, 0},
+    {DO_OPTABLE_STR(340), DO_OPTABLE_STR(5), DO_OPTABLE_STR(341), 208, 3, 41, 0, 0},
+    {DO_OPTABLE_STR(345), DO_OPTABLE_STR(9), DO_OPTABLE_STR(303), 211, 0, 41, 6, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(350), DO_OPTABLE_STR(14), DO_OPTABLE_STR(235), 211, 0, 47, 0, 0},
+    {DO_OPTABLE_STR(351), DO_OPTABLE_STR(14), DO_OPTABLE_STR(352), 211, 3, 47, 0, 0},
+    {DO_OPTABLE_STR(353), DO_OPTABLE_STR(14), DO_OPTABLE_STR(354), 214, 0, 47, 0, 0},
+    {DO_OPTABLE_STR(355), DO_OPTABLE_STR(1), DO_OPTABLE_STR(356), 214, 2, 47, 0, 0},
+    {DO_OPTABLE_STR(357), DO_OPTABLE_STR(14), DO_OPTABLE_STR(358), 216, 5, 47, 0, 0},
+    {DO_OPTABLE_STR(359), DO_OPTABLE_STR(14), DO_OPTABLE_STR(360), 221, 2, 47, 0, 0},
+    {DO_OPTABLE_STR(361), DO_OPTABLE_STR(9), DO_OPTABLE_STR(235), 223, 0, 47, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(363), DO_OPTABLE_STR(14), DO_OPTABLE_STR(10), 223, 1, 49, 0, 0},
+    {DO_OPTABLE_STR(364), DO_OPTABLE_STR(1), DO_OPTABLE_STR(365), 224, 1, 49, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(366), DO_OPTABLE_STR(14), DO_OPTABLE_STR(209), 225, 2, 49, 0, 0},
+    {DO_OPTABLE_STR(367), DO_OPTABLE_STR(5), DO_OPTABLE_STR(221), 227, 1, 49, 0, 0},
+    {DO_OPTABLE_STR(368), DO_OPTABLE_STR(9), DO_OPTABLE_STR(369), 228, 0, 49, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(371), DO_OPTABLE_STR(9), DO_OPTABLE_STR(372), 228, 0, 51, 9, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(379), DO_OPTABLE_STR(14), DO_OPTABLE_STR(380), 228, 2, 60, 0, 0},
+    {DO_OPTABLE_STR(381), DO_OPTABLE_STR(9), DO_OPTABLE_STR(382), 230, 0, 60, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(384), DO_OPTABLE_STR(14), DO_OPTABLE_STR(93), 230, 2, 61, 0, 0},
+    {DO_OPTABLE_STR(385), DO_OPTABLE_STR(14), DO_OPTABLE_STR(386), 232, 3, 61, 0, 0},
+    {DO_OPTABLE_STR(387), DO_OPTABLE_STR(1), DO_OPTABLE_STR(388), 235, 1, 61, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(389), DO_OPTABLE_STR(14), DO_OPTABLE_STR(390), 236, 1, 61, 0, 0},
+    {DO_OPTABLE_STR(391), DO_OPTABLE_STR(9), DO_OPTABLE_STR(392), 237, 1, 61, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(393), DO_OPTABLE_STR(9), DO_OPTABLE_STR(394), 238, 0, 61, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(396), DO_OPTABLE_STR(14), DO_OPTABLE_STR(397), 238, 3, 62, 0, 0},
+    {DO_OPTABLE_STR(398), DO_OPTABLE_STR(14), DO_OPTABLE_STR(399), 241, 1, 62, 0, 0},
+    {DO_OPTABLE_STR(400), DO_OPTABLE_STR(5), DO_OPTABLE_STR(401), 242, 1, 62, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(402), DO_OPTABLE_STR(9), DO_OPTABLE_STR(233), 243, 1, 62, 4, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(403), DO_OPTABLE_STR(1), DO_OPTABLE_STR(101), 244, 1, 66, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(405), DO_OPTABLE_STR(14), DO_OPTABLE_STR(406), 245, 3, 67, 0, 0},
+    {DO_OPTABLE_STR(407), DO_OPTABLE_STR(14), DO_OPTABLE_STR(408), 248, 0, 67, 0, 0},
+    {DO_OPTABLE_STR(409), DO_OPTABLE_STR(9), DO_OPTABLE_STR(410), 248, 0, 67, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(411), DO_OPTABLE_STR(14), DO_OPTABLE_STR(78), 248, 1, 67, 0, 0},
+    {DO_OPTABLE_STR(412), DO_OPTABLE_STR(14), DO_OPTABLE_STR(413), 249, 2, 67, 0, 0},
+    {DO_OPTABLE_STR(414), DO_OPTABLE_STR(1), DO_OPTABLE_STR(415), 251, 1, 67, 9, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(417), DO_OPTABLE_STR(14), DO_OPTABLE_STR(418), 252, 3, 76, 0, 0},
+    {DO_OPTABLE_STR(419), DO_OPTABLE_STR(14), DO_OPTABLE_STR(420), 255, 1, 76, 0, 0},
+    {DO_OPTABLE_STR(422), DO_OPTABLE_STR(14), DO_OPTABLE_STR(90), 256, 1, 76, 0, 0},
+    {DO_OPTABLE_STR(423), DO_OPTABLE_STR(124), DO_OPTABLE_STR(221), 257, 1, 76, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(424), DO_OPTABLE_STR(5), DO_OPTABLE_STR(425), 258, 1, 76, 0, 0},
+    {DO_OPTABLE_STR(426), DO_OPTABLE_STR(14), DO_OPTABLE_STR(427), 259, 3, 76, 0, 0},
+    {DO_OPTABLE_STR(428), DO_OPTABLE_STR(124), DO_OPTABLE_STR(93), 262, 2, 76, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(429), DO_OPTABLE_STR(14), DO_OPTABLE_STR(430), 264, 1, 77, 0, 0},
+    {DO_OPTABLE_STR(431), DO_OPTABLE_STR(9), DO_OPTABLE_STR(432), 265, 0, 77, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(433), DO_OPTABLE_STR(1), DO_OPTABLE_STR(221), 265, 1, 77, 5, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(437), DO_OPTABLE_STR(14), DO_OPTABLE_STR(438), 266, 3, 82, 0, 0},
+    {DO_OPTABLE_STR(439), DO_OPTABLE_STR(14), DO_OPTABLE_STR(440), 269, 3, 82, 0, 0},
+    {DO_OPTABLE_STR(441), DO_OPTABLE_STR(5), DO_OPTABLE_STR(75), 272, 1, 82, 0, 0},
+    {DO_OPTABLE_STR(442), DO_OPTABLE_STR(14), DO_OPTABLE_STR(443), 273, 7, 82, 0, 0},
+    {DO_OPTABLE_STR(448), DO_OPTABLE_STR(9), DO_OPTABLE_STR(443), 280, 0, 82, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(449), DO_OPTABLE_STR(5), DO_OPTABLE_STR(144), 280, 1, 82, 0, 0},
+    {DO_OPTABLE_STR(450), DO_OPTABLE_STR(5), DO_OPTABLE_STR(125), 281, 1, 82, 0, 0},
+    {DO_OPTABLE_STR(451), DO_OPTABLE_STR(14), DO_OPTABLE_STR(452), 282, 2, 82, 0, 0},
+    {DO_OPTABLE_STR(454), DO_OPTABLE_STR(9), DO_OPTABLE_STR(455), 284, 0, 82, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(456), DO_OPTABLE_STR(14), DO_OPTABLE_STR(457), 284, 1, 82, 0, 0},
+    {DO_OPTABLE_STR(458), DO_OPTABLE_STR(9), DO_OPTABLE_STR(33), 285, 1, 82, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(459), DO_OPTABLE_STR(14), DO_OPTABLE_STR(460), 286, 3, 82, 0, 0},
+    {DO_OPTABLE_STR(461), DO_OPTABLE_STR(14), DO_OPTABLE_STR(462), 289, 2, 82, 0, 0},
+    {DO_OPTABLE_STR(464), DO_OPTABLE_STR(14), DO_OPTABLE_STR(465), 291, 1, 82, 0, 0},
+    {DO_OPTABLE_STR(467), DO_OPTABLE_STR(9), DO_OPTABLE_STR(468), 292, 1, 82, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(469), DO_OPTABLE_STR(9), DO_OPTABLE_STR(470), 293, 0, 84, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(471), DO_OPTABLE_STR(14), DO_OPTABLE_STR(472), 293, 3, 84, 0, 0},
+    {DO_OPTABLE_STR(473), DO_OPTABLE_STR(5), DO_OPTABLE_STR(474), 296, 2, 84, 0, 0},
+    {DO_OPTABLE_STR(476), DO_OPTABLE_STR(1), DO_OPTABLE_STR(477), 298, 0, 84, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(478), DO_OPTABLE_STR(9), DO_OPTABLE_STR(479), 298, 1, 84, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(480), DO_OPTABLE_STR(9), DO_OPTABLE_STR(481), 299, 0, 85, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(483), DO_OPTABLE_STR(5), DO_OPTABLE_STR(415), 299, 1, 86, 0, 0},
+    {DO_OPTABLE_STR(484), DO_OPTABLE_STR(1), DO_OPTABLE_STR(485), 300, 1, 86, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(486), DO_OPTABLE_STR(5), DO_OPTABLE_STR(365), 301, 1, 86, 0, 0},
+    {DO_OPTABLE_STR(487), DO_OPTABLE_STR(14), DO_OPTABLE_STR(488), 302, 3, 86, 0, 0},
+    {DO_OPTABLE_STR(489), DO_OPTABLE_STR(14), DO_OPTABLE_STR(490), 305, 1, 86, 0, 0},
+    {DO_OPTABLE_STR(491), DO_OPTABLE_STR(9), DO_OPTABLE_STR(282), 306, 0, 86, 3, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(493), DO_OPTABLE_STR(14), DO_OPTABLE_STR(494), 306, 4, 89, 0, 0},
+    {DO_OPTABLE_STR(495), DO_OPTABLE_STR(14), DO_OPTABLE_STR(496), 310, 4, 89, 0, 0},
+    {DO_OPTABLE_STR(499), DO_OPTABLE_STR(9), DO_OPTABLE_STR(500), 314, 0, 89, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(501), DO_OPTABLE_STR(5), DO_OPTABLE_STR(432), 314, 0, 91, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(502), DO_OPTABLE_STR(14), DO_OPTABLE_STR(503), 314, 3, 91, 0, 0},
+    {DO_OPTABLE_STR(504), DO_OPTABLE_STR(14), DO_OPTABLE_STR(474), 317, 2, 91, 0, 0},
+    {DO_OPTABLE_STR(505), DO_OPTABLE_STR(5), DO_OPTABLE_STR(506), 319, 2, 91, 0, 0},
+    {DO_OPTABLE_STR(508), DO_OPTABLE_STR(9), DO_OPTABLE_STR(185), 321, 0, 91, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(509), DO_OPTABLE_STR(9), DO_OPTABLE_STR(244), 321, 0, 91, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(510), DO_OPTABLE_STR(14), DO_OPTABLE_STR(511), 321, 1, 91, 0, 0},
+    {DO_OPTABLE_STR(512), DO_OPTABLE_STR(5), DO_OPTABLE_STR(513), 322, 1, 91, 0, 0},
+    {DO_OPTABLE_STR(515), DO_OPTABLE_STR(9), DO_OPTABLE_STR(516), 323, 0, 91, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(517), DO_OPTABLE_STR(14), DO_OPTABLE_STR(518), 323, 5, 92, 0, 0},
+    {DO_OPTABLE_STR(519), DO_OPTABLE_STR(9), DO_OPTABLE_STR(520), 328, 1, 92, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(522), DO_OPTABLE_STR(1), DO_OPTABLE_STR(523), 329, 2, 93, 0, 0},
+    {DO_OPTABLE_STR(524), DO_OPTABLE_STR(14), DO_OPTABLE_STR(525), 331, 3, 93, 0, 0},
+    {DO_OPTABLE_STR(526), DO_OPTABLE_STR(14), DO_OPTABLE_STR(527), 334, 3, 93, 0, 0},
+    {DO_OPTABLE_STR(528), DO_OPTABLE_STR(5), DO_OPTABLE_STR(529), 337, 1, 93, 0, 0},
+    {DO_OPTABLE_STR(530), DO_OPTABLE_STR(14), DO_OPTABLE_STR(531), 338, 3, 93, 0, 0},
+    {DO_OPTABLE_STR(532), DO_OPTABLE_STR(14), DO_OPTABLE_STR(533), 341, 2, 93, 0, 0},
+    {DO_OPTABLE_STR(535), DO_OPTABLE_STR(14), DO_OPTABLE_STR(20), 343, 2, 93, 0, 0},
+    {DO_OPTABLE_STR(536), DO_OPTABLE_STR(14), DO_OPTABLE_STR(537), 345, 6, 93, 0, 0},
+    {DO_OPTABLE_STR(538), DO_OPTABLE_STR(14), DO_OPTABLE_STR(103), 351, 0, 93, 0, 0},
+    {DO_OPTABLE_STR(539), DO_OPTABLE_STR(14), DO_OPTABLE_STR(540), 351, 3, 93, 0, 0},
+    {DO_OPTABLE_STR(541), DO_OPTABLE_STR(1), DO_OPTABLE_STR(542), 354, 2, 93, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(544), DO_OPTABLE_STR(1), DO_OPTABLE_STR(545), 356, 1, 93, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(546), DO_OPTABLE_STR(14), DO_OPTABLE_STR(547), 357, 3, 95, 0, 0},
+    {DO_OPTABLE_STR(548), DO_OPTABLE_STR(14), DO_OPTABLE_STR(549), 360, 1, 95, 0, 0},
+    {DO_OPTABLE_STR(550), DO_OPTABLE_STR(14), DO_OPTABLE_STR(551), 361, 2, 95, 0, 0},
+    {DO_OPTABLE_STR(552), DO_OPTABLE_STR(14), DO_OPTABLE_STR(113), 363, 1, 95, 0, 0},
+    {DO_OPTABLE_STR(553), DO_OPTABLE_STR(14), DO_OPTABLE_STR(148), 364, 2, 95, 0, 0},
+    {DO_OPTABLE_STR(554), DO_OPTABLE_STR(9), DO_OPTABLE_STR(555), 366, 0, 95, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(557), DO_OPTABLE_STR(14), DO_OPTABLE_STR(415), 366, 1, 97, 0, 0},
+    {DO_OPTABLE_STR(558), DO_OPTABLE_STR(14), DO_OPTABLE_STR(559), 367, 3, 97, 0, 0},
+    {DO_OPTABLE_STR(560), DO_OPTABLE_STR(5), DO_OPTABLE_STR(561), 370, 2, 97, 0, 0},
+    {DO_OPTABLE_STR(562), DO_OPTABLE_STR(1), DO_OPTABLE_STR(563), 372, 1, 97, 0, 0},
+    {DO_OPTABLE_STR(564), DO_OPTABLE_STR(9), DO_OPTABLE_STR(565), 373, 1, 97, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(566), DO_OPTABLE_STR(9), DO_OPTABLE_STR(567), 374, 1, 97, 0, 0},
+    {DO_OPTABLE_STR(568), DO_OPTABLE_STR(1), DO_OPTABLE_STR(125), 375, 1, 97, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(569), DO_OPTABLE_STR(14), DO_OPTABLE_STR(71), 376, 1, 97, 0, 0},
+    {DO_OPTABLE_STR(570), DO_OPTABLE_STR(9), DO_OPTABLE_STR(571), 377, 1, 97, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(572), DO_OPTABLE_STR(9), DO_OPTABLE_STR(573), 378, 2, 97, 0, 0},
+    {DO_OPTABLE_STR(574), DO_OPTABLE_STR(14), DO_OPTABLE_STR(196), 380, 1, 97, 0, 0},
+    {DO_OPTABLE_STR(575), DO_OPTABLE_STR(9), DO_OPTABLE_STR(576), 381, 0, 97, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(577), DO_OPTABLE_STR(14), DO_OPTABLE_STR(578), 381, 1, 97, 0, 0},
+    {DO_OPTABLE_STR(579), DO_OPTABLE_STR(14), DO_OPTABLE_STR(580), 382, 1, 97, 0, 0},
+    {DO_OPTABLE_STR(581), DO_OPTABLE_STR(5), DO_OPTABLE_STR(289), 383, 1, 97, 0, 0},
+    {DO_OPTABLE_STR(582), DO_OPTABLE_STR(5), DO_OPTABLE_STR(138), 384, 2, 97, 0, 0},
+    {DO_OPTABLE_STR(583), DO_OPTABLE_STR(9), DO_OPTABLE_STR(584), 386, 0, 97, 2, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(586), DO_OPTABLE_STR(14), DO_OPTABLE_STR(587), 386, 3, 99, 0, 0},
+    {DO_OPTABLE_STR(588), DO_OPTABLE_STR(5), DO_OPTABLE_STR(573), 389, 2, 99, 0, 0},
+    {DO_OPTABLE_STR(589), DO_OPTABLE_STR(5), DO_OPTABLE_STR(590), 391, 1, 99, 0, 0},
+    {DO_OPTABLE_STR(591), DO_OPTABLE_STR(1), DO_OPTABLE_STR(592), 392, 1, 99, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(593), DO_OPTABLE_STR(14), DO_OPTABLE_STR(485), 393, 1, 99, 0, 0},
+    {DO_OPTABLE_STR(594), DO_OPTABLE_STR(5), DO_OPTABLE_STR(291), 394, 1, 99, 0, 0},
+    {DO_OPTABLE_STR(595), DO_OPTABLE_STR(14), DO_OPTABLE_STR(596), 395, 3, 99, 0, 0},
+    {DO_OPTABLE_STR(597), DO_OPTABLE_STR(1), DO_OPTABLE_STR(116), 398, 1, 99, 0, DO_OP_HAS_BODY},
+    {DO_OPTABLE_STR(598), DO_OPTABLE_STR(14), DO_OPTABLE_STR(310), 399, 1, 99, 0, 0},
+    {DO_OPTABLE_STR(599), DO_OPTABLE_STR(14), DO_OPTABLE_STR(369), 400, 0, 99, 0, 0},
+    {DO_OPTABLE_STR(600), DO_OPTABLE_STR(14), DO_OPTABLE_STR(601), 400, 4, 99, 0, 0},
+    {DO_OPTABLE_STR(602), DO_OPTABLE_STR(9), DO_OPTABLE_STR(603), 404, 1, 99, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(604), DO_OPTABLE_STR(14), DO_OPTABLE_STR(567), 405, 1, 99, 0, 0},
+    {DO_OPTABLE_STR(605), DO_OPTABLE_STR(5), DO_OPTABLE_STR(606), 406, 1, 99, 0, 0},
+    {DO_OPTABLE_STR(607), DO_OPTABLE_STR(9), DO_OPTABLE_STR(358), 407, 1, 99, 0, DO_OP_HAS_BODY},
+    {DO_OPTABLE_STR(608), DO_OPTABLE_STR(14), DO_OPTABLE_STR(317), 408, 2, 99, 0, 0},
+    {DO_OPTABLE_STR(609), DO_OPTABLE_STR(5), DO_OPTABLE_STR(319), 410, 1, 99, 0, 0},
+    {DO_OPTABLE_STR(610), DO_OPTABLE_STR(9), DO_OPTABLE_STR(56), 411, 1, 99, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(611), DO_OPTABLE_STR(14), DO_OPTABLE_STR(138), 412, 2, 100, 0, 0},
+    {DO_OPTABLE_STR(612), DO_OPTABLE_STR(9), DO_OPTABLE_STR(613), 414, 0, 100, 3, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(615), DO_OPTABLE_STR(14), DO_OPTABLE_STR(260), 414, 1, 103, 0, 0},
+    {DO_OPTABLE_STR(616), DO_OPTABLE_STR(14), DO_OPTABLE_STR(477), 415, 0, 103, 0, 0},
+    {DO_OPTABLE_STR(617), DO_OPTABLE_STR(14), DO_OPTABLE_STR(618), 415, 3, 103, 0, 0},
+    {DO_OPTABLE_STR(619), DO_OPTABLE_STR(14), DO_OPTABLE_STR(620), 418, 3, 103, 0, 0},
+    {DO_OPTABLE_STR(621), DO_OPTABLE_STR(14), DO_OPTABLE_STR(622), 421, 4, 103, 0, 0},
+    {DO_OPTABLE_STR(624), DO_OPTABLE_STR(5), DO_OPTABLE_STR(110), 425, 1, 103, 0, 0},
+    {DO_OPTABLE_STR(625), DO_OPTABLE_STR(14), DO_OPTABLE_STR(626), 426, 2, 103, 0, 0},
+    {DO_OPTABLE_STR(628), DO_OPTABLE_STR(14), DO_OPTABLE_STR(629), 428, 1, 103, 0, 0},
+    {DO_OPTABLE_STR(630), DO_OPTABLE_STR(5), DO_OPTABLE_STR(133), 429, 1, 103, 0, 0},
+    {DO_OPTABLE_STR(631), DO_OPTABLE_STR(14), DO_OPTABLE_STR(289), 430, 1, 103, 0, 0},
+    {DO_OPTABLE_STR(632), DO_OPTABLE_STR(14), DO_OPTABLE_STR(633), 431, 3, 103, 0, 0},
+    {DO_OPTABLE_STR(634), DO_OPTABLE_STR(14), DO_OPTABLE_STR(286), 434, 1, 103, 0, 0},
+    {DO_OPTABLE_STR(635), DO_OPTABLE_STR(5), DO_OPTABLE_STR(636), 435, 3, 103, 0, 0},
+    {DO_OPTABLE_STR(638), DO_OPTABLE_STR(5), DO_OPTABLE_STR(601), 438, 2, 103, 0, 0},
+    {DO_OPTABLE_STR(639), DO_OPTABLE_STR(5), DO_OPTABLE_STR(640), 440, 2, 103, 0, 0},
+    {DO_OPTABLE_STR(642), DO_OPTABLE_STR(14), DO_OPTABLE_STR(643), 442, 3, 103, 0, 0},
+    {DO_OPTABLE_STR(644), DO_OPTABLE_STR(5), DO_OPTABLE_STR(626), 445, 2, 103, 0, 0},
+    {DO_OPTABLE_STR(645), DO_OPTABLE_STR(14), DO_OPTABLE_STR(606), 447, 1, 103, 0, 0},
+    {DO_OPTABLE_STR(646), DO_OPTABLE_STR(9), DO_OPTABLE_STR(647), 448, 0, 103, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(648), DO_OPTABLE_STR(9), DO_OPTABLE_STR(274), 448, 0, 104, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(649), DO_OPTABLE_STR(1), DO_OPTABLE_STR(650), 448, 1, 104, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(651), DO_OPTABLE_STR(124), DO_OPTABLE_STR(652), 449, 2, 104, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(653), DO_OPTABLE_STR(14), DO_OPTABLE_STR(654), 451, 1, 105, 0, 0},
+    {DO_OPTABLE_STR(655), DO_OPTABLE_STR(14), DO_OPTABLE_STR(656), 452, 1, 105, 0, 0},
+    {DO_OPTABLE_STR(657), DO_OPTABLE_STR(9), DO_OPTABLE_STR(658), 453, 2, 105, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(661), DO_OPTABLE_STR(14), DO_OPTABLE_STR(662), 455, 3, 106, 0, 0},
+    {DO_OPTABLE_STR(663), DO_OPTABLE_STR(1), DO_OPTABLE_STR(549), 458, 1, 106, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(665), DO_OPTABLE_STR(9), DO_OPTABLE_STR(666), 459, 1, 107, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(667), DO_OPTABLE_STR(5), DO_OPTABLE_STR(545), 460, 1, 108, 0, 0},
+    {DO_OPTABLE_STR(668), DO_OPTABLE_STR(5), DO_OPTABLE_STR(215), 461, 2, 108, 0, 0},
+    {DO_OPTABLE_STR(669), DO_OPTABLE_STR(5), DO_OPTABLE_STR(670), 463, 1, 108, 0, 0},
+    {DO_OPTABLE_STR(671), DO_OPTABLE_STR(1), DO_OPTABLE_STR(305), 464, 2, 108, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(672), DO_OPTABLE_STR(14), DO_OPTABLE_STR(63), 466, 1, 108, 0, 0},
+    {DO_OPTABLE_STR(674), DO_OPTABLE_STR(1), DO_OPTABLE_STR(590), 467, 1, 108, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(675), DO_OPTABLE_STR(9), DO_OPTABLE_STR(676), 468, 1, 108, 0, 0},
+    {DO_OPTABLE_STR(677), DO_OPTABLE_STR(5), DO_OPTABLE_STR(678), 469, 1, 108, 0, 0},
+    {DO_OPTABLE_STR(679), DO_OPTABLE_STR(9), DO_OPTABLE_STR(680), 470, 0, 108, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(683), DO_OPTABLE_STR(9), DO_OPTABLE_STR(256), 470, 0, 110, 5, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(685), DO_OPTABLE_STR(14), DO_OPTABLE_STR(314), 470, 3, 115, 0, 0},
+    {DO_OPTABLE_STR(686), DO_OPTABLE_STR(14), DO_OPTABLE_STR(687), 473, 2, 115, 0, 0},
+    {DO_OPTABLE_STR(688), DO_OPTABLE_STR(9), DO_OPTABLE_STR(380), 475, 0, 115, 0, DO_OP_HAS_BODY},
+    {DO_OPTABLE_STR(689), DO_OPTABLE_STR(9), DO_OPTABLE_STR(81), 475, 0, 115, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(691), DO_OPTABLE_STR(14), DO_OPTABLE_STR(692), 475, 2, 117, 0, 0},
+    {DO_OPTABLE_STR(693), DO_OPTABLE_STR(14), DO_OPTABLE_STR(694), 477, 1, 117, 0, 0},
+    {DO_OPTABLE_STR(696), DO_OPTABLE_STR(9), DO_OPTABLE_STR(438), 478, 1, 117, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(697), DO_OPTABLE_STR(1), DO_OPTABLE_STR(148), 479, 2, 118, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(698), DO_OPTABLE_STR(1), DO_OPTABLE_STR(699), 481, 1, 118, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(700), DO_OPTABLE_STR(9), DO_OPTABLE_STR(40), 482, 1, 118, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(701), DO_OPTABLE_STR(14), DO_OPTABLE_STR(576), 483, 2, 120, 0, 0},
+    {DO_OPTABLE_STR(702), DO_OPTABLE_STR(14), DO_OPTABLE_STR(365), 485, 1, 120, 0, 0},
+    {DO_OPTABLE_STR(703), DO_OPTABLE_STR(14), DO_OPTABLE_STR(704), 486, 1, 120, 0, 0},
+    {DO_OPTABLE_STR(705), DO_OPTABLE_STR(14), DO_OPTABLE_STR(706), 487, 4, 120, 0, 0},
+    {DO_OPTABLE_STR(707), DO_OPTABLE_STR(14), DO_OPTABLE_STR(708), 491, 2, 120, 0, 0},
+    {DO_OPTABLE_STR(711), DO_OPTABLE_STR(9), DO_OPTABLE_STR(231), 493, 0, 120, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(712), DO_OPTABLE_STR(14), DO_OPTABLE_STR(713), 493, 0, 122, 0, 0},
+    {DO_OPTABLE_STR(714), DO_OPTABLE_STR(14), DO_OPTABLE_STR(187), 493, 3, 122, 0, 0},
+    {DO_OPTABLE_STR(715), DO_OPTABLE_STR(9), DO_OPTABLE_STR(67), 496, 1, 122, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(716), DO_OPTABLE_STR(1), DO_OPTABLE_STR(717), 497, 1, 122, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(718), DO_OPTABLE_STR(14), DO_OPTABLE_STR(719), 498, 3, 123, 0, 0},
+    {DO_OPTABLE_STR(720), DO_OPTABLE_STR(9), DO_OPTABLE_STR(190), 501, 3, 123, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(721), DO_OPTABLE_STR(14), DO_OPTABLE_STR(722), 504, 1, 124, 0, 0},
+    {DO_OPTABLE_STR(723), DO_OPTABLE_STR(5), DO_OPTABLE_STR(724), 505, 1, 124, 0, 0},
+    {DO_OPTABLE_STR(725), DO_OPTABLE_STR(14), DO_OPTABLE_STR(516), 506, 3, 124, 0, 0},
+    {DO_OPTABLE_STR(726), DO_OPTABLE_STR(14), DO_OPTABLE_STR(727), 509, 3, 124, 0, 0},
+    {DO_OPTABLE_STR(729), DO_OPTABLE_STR(9), DO_OPTABLE_STR(730), 512, 2, 124, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(731), DO_OPTABLE_STR(1), DO_OPTABLE_STR(732), 514, 2, 124, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(734), DO_OPTABLE_STR(5), DO_OPTABLE_STR(333), 516, 1, 125, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(735), DO_OPTABLE_STR(14), DO_OPTABLE_STR(736), 517, 1, 126, 0, 0},
+    {DO_OPTABLE_STR(737), DO_OPTABLE_STR(14), DO_OPTABLE_STR(738), 518, 4, 126, 0, 0},
+    {DO_OPTABLE_STR(739), DO_OPTABLE_STR(9), DO_OPTABLE_STR(740), 522, 1, 126, 0, 0},
+    {DO_OPTABLE_STR(741), DO_OPTABLE_STR(124), DO_OPTABLE_STR(50), 523, 1, 126, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(742), DO_OPTABLE_STR(14), DO_OPTABLE_STR(743), 524, 2, 127, 0, 0},
+    {DO_OPTABLE_STR(744), DO_OPTABLE_STR(5), DO_OPTABLE_STR(745), 526, 5, 127, 0, 0},
+    {DO_OPTABLE_STR(749), DO_OPTABLE_STR(124), DO_OPTABLE_STR(6), 531, 1, 127, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(750), DO_OPTABLE_STR(14), DO_OPTABLE_STR(751), 532, 3, 127, 0, 0},
+    {DO_OPTABLE_STR(752), DO_OPTABLE_STR(9), DO_OPTABLE_STR(226), 535, 0, 127, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(753), DO_OPTABLE_STR(5), DO_OPTABLE_STR(656), 535, 1, 127, 0, 0},
+    {DO_OPTABLE_STR(754), DO_OPTABLE_STR(14), DO_OPTABLE_STR(755), 536, 0, 127, 0, 0},
+    {DO_OPTABLE_STR(756), DO_OPTABLE_STR(14), DO_OPTABLE_STR(468), 536, 3, 127, 0, 0},
+    {DO_OPTABLE_STR(757), DO_OPTABLE_STR(14), DO_OPTABLE_STR(529), 539, 1, 127, 0, 0},
+    {DO_OPTABLE_STR(758), DO_OPTABLE_STR(14), DO_OPTABLE_STR(759), 540, 4, 127, 0, 0},
+    {DO_OPTABLE_STR(762), DO_OPTABLE_STR(14), DO_OPTABLE_STR(555), 544, 0, 127, 0, 0},
+    {DO_OPTABLE_STR(763), DO_OPTABLE_STR(5), DO_OPTABLE_STR(520), 544, 1, 127, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(764), DO_OPTABLE_STR(14), DO_OPTABLE_STR(455), 545, 2, 128, 0, 0},
+    {DO_OPTABLE_STR(765), DO_OPTABLE_STR(14), DO_OPTABLE_STR(766), 547, 4, 128, 0, 0},
+    {DO_OPTABLE_STR(767), DO_OPTABLE_STR(14), DO_OPTABLE_STR(118), 551, 1, 128, 0, 0},
+    {DO_OPTABLE_STR(768), DO_OPTABLE_STR(14), DO_OPTABLE_STR(769), 552, 2, 128, 0, 0},
+    {DO_OPTABLE_STR(771), DO_OPTABLE_STR(14), DO_OPTABLE_STR(772), 554, 3, 128, 0, 0},
+    {DO_OPTABLE_STR(773), DO_OPTABLE_STR(9), DO_OPTABLE_STR(774), 557, 1, 128, 0, 0},
+    {DO_OPTABLE_STR(775), DO_OPTABLE_STR(1), DO_OPTABLE_STR(291), 558, 1, 128, 3, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(776), DO_OPTABLE_STR(14), DO_OPTABLE_STR(777), 559, 1, 131, 0, 0},
+    {DO_OPTABLE_STR(778), DO_OPTABLE_STR(14), DO_OPTABLE_STR(388), 560, 1, 131, 0, 0},
+    {DO_OPTABLE_STR(779), DO_OPTABLE_STR(14), DO_OPTABLE_STR(780), 561, 3, 131, 0, 0},
+    {DO_OPTABLE_STR(781), DO_OPTABLE_STR(14), DO_OPTABLE_STR(613), 564, 5, 131, 0, 0},
+    {DO_OPTABLE_STR(783), DO_OPTABLE_STR(14), DO_OPTABLE_STR(784), 569, 3, 131, 0, 0},
+    {DO_OPTABLE_STR(785), DO_OPTABLE_STR(9), DO_OPTABLE_STR(298), 572, 1, 131, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(786), DO_OPTABLE_STR(1), DO_OPTABLE_STR(656), 573, 1, 131, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(787), DO_OPTABLE_STR(14), DO_OPTABLE_STR(6), 574, 1, 131, 0, 0},
+    {DO_OPTABLE_STR(788), DO_OPTABLE_STR(5), DO_OPTABLE_STR(533), 575, 1, 131, 0, 0},
+    {DO_OPTABLE_STR(789), DO_OPTABLE_STR(14), DO_OPTABLE_STR(666), 576, 1, 131, 0, 0},
+    {DO_OPTABLE_STR(790), DO_OPTABLE_STR(5), DO_OPTABLE_STR(732), 577, 2, 131, 0, 0},
+    {DO_OPTABLE_STR(791), DO_OPTABLE_STR(1), DO_OPTABLE_STR(6), 579, 1, 131, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(792), DO_OPTABLE_STR(9), DO_OPTABLE_STR(254), 580, 0, 132, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(793), DO_OPTABLE_STR(14), DO_OPTABLE_STR(794), 580, 4, 132, 0, 0},
+    {DO_OPTABLE_STR(796), DO_OPTABLE_STR(124), DO_OPTABLE_STR(169), 584, 0, 132, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(797), DO_OPTABLE_STR(14), DO_OPTABLE_STR(798), 584, 3, 132, 0, 0},
+    {DO_OPTABLE_STR(799), DO_OPTABLE_STR(14), DO_OPTABLE_STR(500), 587, 2, 132, 0, 0},
+    {DO_OPTABLE_STR(800), DO_OPTABLE_STR(14), DO_OPTABLE_STR(801), 589, 3, 132, 0, 0},
+    {DO_OPTABLE_STR(802), DO_OPTABLE_STR(14), DO_OPTABLE_STR(584), 592, 5, 132, 0, 0},
+    {DO_OPTABLE_STR(803), DO_OPTABLE_STR(14), DO_OPTABLE_STR(804), 597, 5, 132, 0, 0},
+    {DO_OPTABLE_STR(807), DO_OPTABLE_STR(14), DO_OPTABLE_STR(513), 602, 1, 132, 0, 0},
+    {DO_OPTABLE_STR(808), DO_OPTABLE_STR(14), DO_OPTABLE_STR(809), 603, 5, 132, 0, 0},
+    {DO_OPTABLE_STR(810), DO_OPTABLE_STR(5), DO_OPTABLE_STR(258), 608, 1, 132, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(811), DO_OPTABLE_STR(14), DO_OPTABLE_STR(372), 609, 2, 133, 0, 0},
+    {DO_OPTABLE_STR(812), DO_OPTABLE_STR(14), DO_OPTABLE_STR(699), 611, 3, 133, 0, 0},
+    {DO_OPTABLE_STR(813), DO_OPTABLE_STR(14), DO_OPTABLE_STR(270), 614, 1, 133, 0, 0},
+    {DO_OPTABLE_STR(814), DO_OPTABLE_STR(14), DO_OPTABLE_STR(732), 615, 2, 133, 0, 0},
+    {DO_OPTABLE_STR(815), DO_OPTABLE_STR(14), DO_OPTABLE_STR(470), 617, 2, 133, 0, 0},
+    {DO_OPTABLE_STR(816), DO_OPTABLE_STR(14), DO_OPTABLE_STR(319), 619, 1, 133, 0, 0},
+    {DO_OPTABLE_STR(817), DO_OPTABLE_STR(9), DO_OPTABLE_STR(818), 620, 0, 133, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(820), DO_OPTABLE_STR(1), DO_OPTABLE_STR(98), 620, 2, 134, 3, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(821), DO_OPTABLE_STR(14), DO_OPTABLE_STR(822), 622, 4, 137, 0, 0},
+    {DO_OPTABLE_STR(823), DO_OPTABLE_STR(14), DO_OPTABLE_STR(824), 626, 3, 137, 0, 0},
+    {DO_OPTABLE_STR(825), DO_OPTABLE_STR(5), DO_OPTABLE_STR(240), 629, 2, 137, 0, 0},
+    {DO_OPTABLE_STR(826), DO_OPTABLE_STR(5), DO_OPTABLE_STR(485), 631, 1, 137, 0, 0},
+    {DO_OPTABLE_STR(827), DO_OPTABLE_STR(14), DO_OPTABLE_STR(828), 632, 3, 137, 0, 0},
+    {DO_OPTABLE_STR(829), DO_OPTABLE_STR(14), DO_OPTABLE_STR(180), 635, 1, 137, 0, 0},
+    {DO_OPTABLE_STR(830), DO_OPTABLE_STR(14), DO_OPTABLE_STR(831), 636, 1, 137, 0, 0},
+    {DO_OPTABLE_STR(832), DO_OPTABLE_STR(14), DO_OPTABLE_STR(833), 637, 3, 137, 0, 0},
+    {DO_OPTABLE_STR(834), DO_OPTABLE_STR(14), DO_OPTABLE_STR(835), 640, 0, 137, 0, 0},
+    {DO_OPTABLE_STR(836), DO_OPTABLE_STR(5), DO_OPTABLE_STR(209), 640, 2, 137, 0, 0},
+    {DO_OPTABLE_STR(837), DO_OPTABLE_STR(14), DO_OPTABLE_STR(838), 642, 0, 137, 0, 0},
+    {DO_OPTABLE_STR(839), DO_OPTABLE_STR(9), DO_OPTABLE_STR(743), 642, 0, 137, 5, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(842), DO_OPTABLE_STR(14), DO_OPTABLE_STR(843), 642, 3, 142, 0, 0},
+    {DO_OPTABLE_STR(844), DO_OPTABLE_STR(9), DO_OPTABLE_STR(601), 645, 0, 142, 3, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(846), DO_OPTABLE_STR(14), DO_OPTABLE_STR(481), 645, 2, 145, 0, 0},
+    {DO_OPTABLE_STR(847), DO_OPTABLE_STR(9), DO_OPTABLE_STR(390), 647, 1, 145, 0, 0},
+    {DO_OPTABLE_STR(848), DO_OPTABLE_STR(1), DO_OPTABLE_STR(180), 648, 1, 145, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(849), DO_OPTABLE_STR(14), DO_OPTABLE_STR(658), 649, 3, 146, 0, 0},
+    {DO_OPTABLE_STR(851), DO_OPTABLE_STR(9), DO_OPTABLE_STR(430), 652, 1, 146, 3, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(854), DO_OPTABLE_STR(9), DO_OPTABLE_STR(727), 653, 0, 149, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(855), DO_OPTABLE_STR(14), DO_OPTABLE_STR(856), 653, 2, 149, 0, 0},
+    {DO_OPTABLE_STR(857), DO_OPTABLE_STR(14), DO_OPTABLE_STR(545), 655, 1, 149, 0, 0},
+    {DO_OPTABLE_STR(858), DO_OPTABLE_STR(9), DO_OPTABLE_STR(43), 656, 2, 149, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(859), DO_OPTABLE_STR(1), DO_OPTABLE_STR(169), 658, 0, 149, 5, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(860), DO_OPTABLE_STR(5), DO_OPTABLE_STR(308), 658, 1, 154, 0, DO_OP_HAS_BODY},
+    {DO_OPTABLE_STR(861), DO_OPTABLE_STR(14), DO_OPTABLE_STR(382), 659, 2, 154, 0, 0},
+    {DO_OPTABLE_STR(862), DO_OPTABLE_STR(14), DO_OPTABLE_STR(724), 661, 1, 154, 0, 0},
+    {DO_OPTABLE_STR(863), DO_OPTABLE_STR(9), DO_OPTABLE_STR(864), 662, 2, 154, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(865), DO_OPTABLE_STR(9), DO_OPTABLE_STR(580), 664, 1, 154, 3, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(867), DO_OPTABLE_STR(14), DO_OPTABLE_STR(868), 665, 3, 157, 0, 0},
+    {DO_OPTABLE_STR(869), DO_OPTABLE_STR(9), DO_OPTABLE_STR(870), 668, 1, 157, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(871), DO_OPTABLE_STR(9), DO_OPTABLE_STR(420), 669, 1, 158, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(872), DO_OPTABLE_STR(9), DO_OPTABLE_STR(873), 670, 1, 159, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(874), DO_OPTABLE_STR(14), DO_OPTABLE_STR(870), 671, 1, 159, 0, 0},
+    {DO_OPTABLE_STR(875), DO_OPTABLE_STR(1), DO_OPTABLE_STR(240), 672, 2, 159, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(877), DO_OPTABLE_STR(14), DO_OPTABLE_STR(878), 674, 1, 160, 0, 0},
+    {DO_OPTABLE_STR(879), DO_OPTABLE_STR(5), DO_OPTABLE_STR(584), 675, 1, 160, 0, 0},
+    {DO_OPTABLE_STR(880), DO_OPTABLE_STR(9), DO_OPTABLE_STR(881), 676, 1, 160, 0, 0},
+    {DO_OPTABLE_STR(882), DO_OPTABLE_STR(1), DO_OPTABLE_STR(883), 677, 1, 160, 0, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(884), DO_OPTABLE_STR(1), DO_OPTABLE_STR(533), 678, 1, 160, 1, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(885), DO_OPTABLE_STR(14), DO_OPTABLE_STR(886), 679, 3, 161, 0, 0},
+    {DO_OPTABLE_STR(887), DO_OPTABLE_STR(5), DO_OPTABLE_STR(769), 682, 2, 161, 0, 0},
+    {DO_OPTABLE_STR(888), DO_OPTABLE_STR(1), DO_OPTABLE_STR(724), 684, 1, 161, 0, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(889), DO_OPTABLE_STR(14), DO_OPTABLE_STR(890), 685, 3, 161, 0, 0},
+    {DO_OPTABLE_STR(891), DO_OPTABLE_STR(14), DO_OPTABLE_STR(182), 688, 1, 161, 0, 0},
+    {DO_OPTABLE_STR(892), DO_OPTABLE_STR(14), DO_OPTABLE_STR(893), 689, 3, 161, 0, 0},
+    {DO_OPTABLE_STR(894), DO_OPTABLE_STR(14), DO_OPTABLE_STR(330), 692, 3, 161, 0, 0},
+    {DO_OPTABLE_STR(895), DO_OPTABLE_STR(14), DO_OPTABLE_STR(228), 695, 3, 161, 0, 0},
+    {DO_OPTABLE_STR(896), DO_OPTABLE_STR(14), DO_OPTABLE_STR(410), 698, 2, 161, 0, 0},
+    {DO_OPTABLE_STR(897), DO_OPTABLE_STR(14), DO_OPTABLE_STR(898), 700, 1, 161, 0, 0},
+    {DO_OPTABLE_STR(899), DO_OPTABLE_STR(1), DO_OPTABLE_STR(626), 701, 2, 161, 2, DO_OP_HAS_BODY | DO_OP_BODY_REQUIRED | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(900), DO_OPTABLE_STR(14), DO_OPTABLE_STR(678), 703, 1, 163, 0, 0},
+    {DO_OPTABLE_STR(901), DO_OPTABLE_STR(9), DO_OPTABLE_STR(323), 704, 1, 163, 1, DO_OP_HAS_BODY | DO_OP_BODY_OBJECT},
+    {DO_OPTABLE_STR(902), DO_OPTABLE_STR(14), DO_OPTABLE_STR(903), 705, 1, 164, 0, 0},
+};
+
+const do_optable_param_t do_optable_params[] = {
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(7), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(11), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(16), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(35), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(38), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(41), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(44), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(45), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(48), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(51), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(51), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(16), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(57), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(48), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(44), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(45), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(22), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(76), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(79), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(68), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(86), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(91), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(76), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(94), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(99), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(111), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(114), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(57), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(122), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(126), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(131), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(134), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(139), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(140), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(145), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(149), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(150), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(11), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(159), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(160), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(57), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(111), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(11), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(172), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(175), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(178), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(188), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(79), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(204), DO_PARAM_HEADER, DO_PARAM_BOOLEAN, true},
+    {DO_OPTABLE_STR(122), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(210), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(213), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(216), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(188), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(111), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(122), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(99), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(139), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(126), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(16), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(175), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(86), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(213), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(106), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(149), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(266), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(139), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(172), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(41), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(29), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(48), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(76), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(94), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(139), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(48), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(16), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(296), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(216), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(266), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(106), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(216), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(306), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(57), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(159), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(320), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(11), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(159), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(48), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(122), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(331), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(57), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(337), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(342), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(343), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(344), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(216), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(76), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(29), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(12), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(11), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(210), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(188), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(76), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(94), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(342), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(216), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(16), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(160), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(139), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(79), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(160), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(416), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(421), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(91), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(188), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(16), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(76), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(94), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(188), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(79), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(76), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(444), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(445), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(29), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(446), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(447), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(145), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(126), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(453), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(296), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(463), DO_PARAM_QUERY, DO_PARAM_BOOLEAN, false},
+    {DO_OPTABLE_STR(466), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(7), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(475), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(114), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(416), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(48), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(342), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(343), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(497), DO_PARAM_QUERY, DO_PARAM_BOOLEAN, false},
+    {DO_OPTABLE_STR(12), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(498), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(48), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(475), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(507), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(514), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(453), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(497), DO_PARAM_QUERY, DO_PARAM_BOOLEAN, false},
+    {DO_OPTABLE_STR(12), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(498), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(134), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(475), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(16), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(149), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(534), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(29), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(172), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(453), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(497), DO_PARAM_QUERY, DO_PARAM_BOOLEAN, false},
+    {DO_OPTABLE_STR(12), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(498), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(342), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(342), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(543), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(114), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(149), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(150), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(416), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(16), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(48), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(204), DO_PARAM_HEADER, DO_PARAM_BOOLEAN, true},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(122), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(126), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(216), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(331), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(139), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(139), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(140), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(216), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(331), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(48), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(57), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(159), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(29), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(22), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(122), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(91), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(76), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(320), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(57), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(139), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(140), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(149), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(172), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(453), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(623), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(111), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(627), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(134), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(139), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(342), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(343), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(637), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(29), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(22), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(331), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(641), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(16), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(627), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(91), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(7), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(51), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(659), DO_PARAM_HEADER, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(660), DO_PARAM_HEADER, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(216), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(216), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(306), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(673), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(421), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(421), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(160), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(11), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(160), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(695), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(79), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(149), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(150), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(41), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(342), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(343), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(709), DO_PARAM_QUERY, DO_PARAM_BOOLEAN, false},
+    {DO_OPTABLE_STR(710), DO_PARAM_QUERY, DO_PARAM_BOOLEAN, false},
+    {DO_OPTABLE_STR(188), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(48), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(79), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(266), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(29), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(728), DO_PARAM_QUERY, DO_PARAM_BOOLEAN, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(627), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(733), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(57), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(12), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(7), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(131), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(216), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(51), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(627), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(746), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(747), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(748), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(7), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(7), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(149), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(760), DO_PARAM_QUERY, DO_PARAM_ARRAY, false},
+    {DO_OPTABLE_STR(761), DO_PARAM_QUERY, DO_PARAM_BOOLEAN, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(134), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(68), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(86), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(770), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(16), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(48), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(12), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(782), DO_PARAM_QUERY, DO_PARAM_BOOLEAN, false},
+    {DO_OPTABLE_STR(213), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(48), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(216), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(217), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(7), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(534), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(733), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(7), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(342), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(795), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(213), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(29), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(12), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(16), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(805), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(806), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(514), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(172), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(497), DO_PARAM_QUERY, DO_PARAM_BOOLEAN, false},
+    {DO_OPTABLE_STR(12), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(498), DO_PARAM_QUERY, DO_PARAM_STRING, false},
+    {DO_OPTABLE_STR(106), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(733), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(320), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(99), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(79), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(160), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(175), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(122), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(210), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(342), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(850), DO_PARAM_QUERY, DO_PARAM_BOOLEAN, false},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(296), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(106), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(44), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(45), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(57), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(140), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(342), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(421), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(175), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(213), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(68), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(534), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(770), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(201), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(3), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(106), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(17), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(18), DO_PARAM_QUERY, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(331), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(122), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(25), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(26), DO_PARAM_QUERY, DO_PARAM_INTEGER, false},
+    {DO_OPTABLE_STR(61), DO_PARAM_PATH, DO_PARAM_INTEGER, true},
+    {DO_OPTABLE_STR(34), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(627), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(421), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(159), DO_PARAM_PATH, DO_PARAM_STRING, true},
+    {DO_OPTABLE_STR(266), DO_PARAM_PATH, DO_PARAM_STRING, true},
+};
+
+const uint32_t do_optable_fields[] = {
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(21),
+    DO_OPTABLE_STR(22),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(30),
+    DO_OPTABLE_STR(22),
+    DO_OPTABLE_STR(31),
+    DO_OPTABLE_STR(58),
+    DO_OPTABLE_STR(61),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(119),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(141),
+    DO_OPTABLE_STR(142),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(153),
+    DO_OPTABLE_STR(154),
+    DO_OPTABLE_STR(163),
+    DO_OPTABLE_STR(164),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(119),
+    DO_OPTABLE_STR(183),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(198),
+    DO_OPTABLE_STR(58),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(224),
+    DO_OPTABLE_STR(21),
+    DO_OPTABLE_STR(261),
+    DO_OPTABLE_STR(262),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(263),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(279),
+    DO_OPTABLE_STR(119),
+    DO_OPTABLE_STR(58),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(334),
+    DO_OPTABLE_STR(346),
+    DO_OPTABLE_STR(347),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(348),
+    DO_OPTABLE_STR(349),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(362),
+    DO_OPTABLE_STR(370),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(373),
+    DO_OPTABLE_STR(374),
+    DO_OPTABLE_STR(375),
+    DO_OPTABLE_STR(346),
+    DO_OPTABLE_STR(376),
+    DO_OPTABLE_STR(334),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(377),
+    DO_OPTABLE_STR(378),
+    DO_OPTABLE_STR(383),
+    DO_OPTABLE_STR(395),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(141),
+    DO_OPTABLE_STR(142),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(404),
+    DO_OPTABLE_STR(373),
+    DO_OPTABLE_STR(374),
+    DO_OPTABLE_STR(375),
+    DO_OPTABLE_STR(346),
+    DO_OPTABLE_STR(376),
+    DO_OPTABLE_STR(334),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(377),
+    DO_OPTABLE_STR(378),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(375),
+    DO_OPTABLE_STR(434),
+    DO_OPTABLE_STR(435),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(436),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(7),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(482),
+    DO_OPTABLE_STR(370),
+    DO_OPTABLE_STR(492),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(22),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(521),
+    DO_OPTABLE_STR(21),
+    DO_OPTABLE_STR(22),
+    DO_OPTABLE_STR(556),
+    DO_OPTABLE_STR(22),
+    DO_OPTABLE_STR(585),
+    DO_OPTABLE_STR(119),
+    DO_OPTABLE_STR(58),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(22),
+    DO_OPTABLE_STR(614),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(395),
+    DO_OPTABLE_STR(664),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(681),
+    DO_OPTABLE_STR(682),
+    DO_OPTABLE_STR(684),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(279),
+    DO_OPTABLE_STR(22),
+    DO_OPTABLE_STR(119),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(690),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(370),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(436),
+    DO_OPTABLE_STR(22),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(370),
+    DO_OPTABLE_STR(334),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(521),
+    DO_OPTABLE_STR(370),
+    DO_OPTABLE_STR(492),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(21),
+    DO_OPTABLE_STR(819),
+    DO_OPTABLE_STR(163),
+    DO_OPTABLE_STR(164),
+    DO_OPTABLE_STR(119),
+    DO_OPTABLE_STR(840),
+    DO_OPTABLE_STR(841),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(22),
+    DO_OPTABLE_STR(198),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(22),
+    DO_OPTABLE_STR(845),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(370),
+    DO_OPTABLE_STR(852),
+    DO_OPTABLE_STR(853),
+    DO_OPTABLE_STR(375),
+    DO_OPTABLE_STR(434),
+    DO_OPTABLE_STR(435),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(436),
+    DO_OPTABLE_STR(866),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(119),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(12),
+    DO_OPTABLE_STR(876),
+    DO_OPTABLE_STR(395),
+    DO_OPTABLE_STR(866),
+    DO_OPTABLE_STR(29),
+    DO_OPTABLE_STR(12),
+};
+
+const uint16_t do_optable_seeds[] = {
+    5, 9, 1, 121, 4, 1, 8, 11, 30, 54, 5, 8, 197, 207, 56, 25,
+    1, 64, 33, 1, 18, 361, 6, 231, 94, 57, 44, 1, 22, 2, 246, 75,
+    19, 279, 56, 168, 26, 501, 176, 404, 0, 3, 1, 148, 42, 34, 453, 0,
+    4, 7, 48, 0, 6, 88, 387, 0, 2, 3, 1, 89, 2, 2, 504, 15,
+    59, 30, 24, 81, 282, 2, 290, 104, 1, 12, 3, 898, 60, 11, 29, 1,
+    22, 326, 9, 254, 7, 9, 1498, 12, 95, 48, 477, 215, 1702, 7, 307, 1,
+    64, 387, 21, 8012, 0, 3723, 68, 6693, 60, 2566, 431, 183, 3, 2363, 271, 779,
+    2,
+};
\ No newline at end of file
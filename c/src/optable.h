@@ -0,0 +1,41 @@
+#ifndef DO_OPTABLE_H
+#define DO_OPTABLE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "digitalocean/invoke.h"
+
+// Layout of the generated operation table (optable.c). Strings are byte
+// offsets into do_optable_strings.
+#define DO_OP_HAS_BODY 0x1
+#define DO_OP_BODY_REQUIRED 0x2
+#define DO_OP_BODY_OBJECT 0x4
+
+struct do_operation {
+    uint32_t id;
+    uint32_t method;
+    uint32_t path;
+    uint16_t param_first;  // into do_optable_params
+    uint8_t param_count;
+    uint16_t field_first;  // into do_optable_fields
+    uint8_t field_count;
+    uint8_t flags;
+};
+
+typedef struct {
+    uint32_t name;
+    uint8_t location;      // do_param_location_t
+    uint8_t kind;          // do_param_kind_t
+    bool required;
+} do_optable_param_t;
+
+extern const char *const do_optable_strings;
+extern const size_t do_optable_op_count;
+extern const size_t do_optable_seed_count;
+extern const struct do_operation do_optable_ops[];
+extern const do_optable_param_t do_optable_params[];
+extern const uint32_t do_optable_fields[];
+extern const uint16_t do_optable_seeds[];
+
+#endif // DO_OPTABLE_H
\ No newline at end of file
@@ -0,0 +1,229 @@
+#define _GNU_SOURCE
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "digitalocean/http.h"
+#include "digitalocean/config.h"
+#include "digitalocean/alloc.h"
+#include "ratelimit.h"
+
+#define DO_RATE_BUDGET_MAGIC 0x444f2d524c000001ULL // "DO-RL", layout version 1
+#define DO_RATE_MINUTE_US 60000000LL
+#define DO_RATE_INTERVAL_US (DO_RATE_MINUTE_US / DO_RATE_LIMIT_PER_MINUTE)
+#define DO_RATE_MAX_WAIT_US DO_RATE_MINUTE_US // longer waits fail with DO_ERROR_RATE_LIMIT
+
+_Static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "the shared budget needs lock-free 64-bit atomics");
+
+// The mapped file, shared by every process using the token. All zeroes is
+// a valid fresh state, so a new file needs no initialisation beyond its
+// magic. Each field is one atomic word, updated only by compare-and-swap.
+struct do_rate_budget {
+    _Atomic uint64_t magic;
+    // RateLimit-Reset (epoch seconds) in the high half and the requests
+    // left before it in the low half, so both change together. 0 until the
+    // API has reported them.
+    _Atomic uint64_t hour;
+    // Per-minute pacing as a GCRA: the time, in epoch microseconds, at
+    // which the bucket would be empty again
+    _Atomic int64_t minute_tat;
+};
+
+static int64_t do_rate_budget_now_us(void) {
+    // Wall clock rather than monotonic: the file outlives reboots
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// One file per token under the config directory, named by a hash so the
+// token itself never appears on disk
+static char *do_rate_budget_path(const char *token) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (const unsigned char *p = (const unsigned char *)token; *p; p++) {
+        hash ^= *p;
+        hash *= 1099511628211ULL;
+    }
+    
+    char *config_dir = do_config_get_config_dir();
+    if (!config_dir) {
+        return NULL;
+    }
+    
+    size_t len = strlen(config_dir) + strlen("/ratelimit-") + 16 + 1;
+    char *path = do_malloc(len);
+    if (path) {
+        snprintf(path, len, "%s/ratelimit-%016llx", config_dir, (unsigned long long)hash);
+    }
+    do_free(config_dir);
+    return path;
+}
+
+do_result_t do_rate_budget_open(const char *token, do_rate_budget_t **budget_out) {
+    if (!token || !budget_out) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    *budget_out = NULL;
+    
+    do_result_t result = do_config_ensure_config_dir();
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    
+    char *path = do_rate_budget_path(token);
+    if (!path) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+    do_free(path);
+    if (fd < 0) {
+        return DO_ERROR_CONFIG;
+    }
+    
+    // Growing is idempotent, so racing creators are harmless
+    struct stat st;
+    if (fstat(fd, &st) != 0 ||
+        (st.st_size < (off_t)sizeof(do_rate_budget_t) &&
+         ftruncate(fd, sizeof(do_rate_budget_t)) != 0)) {
+        close(fd);
+        return DO_ERROR_CONFIG;
+    }
+    
+    do_rate_budget_t *budget = mmap(NULL, sizeof(do_rate_budget_t), PROT_READ | PROT_WRITE,
+                                    MAP_SHARED, fd, 0);
+    close(fd);
+    if (budget == MAP_FAILED) {
+        return DO_ERROR_CONFIG;
+    }
+    
+    uint64_t magic = 0;
+    if (!atomic_compare_exchange_strong(&budget->magic, &magic, DO_RATE_BUDGET_MAGIC) &&
+        magic != DO_RATE_BUDGET_MAGIC) {
+        munmap(budget, sizeof(do_rate_budget_t));
+        return DO_ERROR_CONFIG;
+    }
+    
+    *budget_out = budget;
+    return DO_SUCCESS;
+}
+
+void do_rate_budget_close(do_rate_budget_t *budget) {
+    if (budget) {
+        munmap(budget, sizeof(do_rate_budget_t));
+    }
+}
+
+// The wait until the hourly budget has a request left, or 0 when it has
+// one. Once the reset time has passed the count is stale and the API
+// decides.
+static int64_t do_rate_budget_hour_wait(uint64_t hour, int64_t now) {
+    int64_t reset_us = (int64_t)(hour >> 32) * 1000000;
+    if (hour == 0 || reset_us <= now || (hour & 0xffffffffu) != 0) {
+        return 0;
+    }
+    return reset_us - now;
+}
+
+// Takes one request from the budget without waiting. On DO_ERROR_RATE_LIMIT
+// wait_us says how long until one is likely to be free, and nothing has
+// been taken.
+do_result_t do_rate_budget_reserve(do_rate_budget_t *budget, int64_t *wait_us) {
+    int64_t now = do_rate_budget_now_us();
+    *wait_us = 0;
+    
+    // A spent hour fails before the minute is touched, so callers waiting
+    // for the reset do not use up the pacing of everyone else
+    uint64_t hour = atomic_load_explicit(&budget->hour, memory_order_relaxed);
+    *wait_us = do_rate_budget_hour_wait(hour, now);
+    if (*wait_us > 0) {
+        return DO_ERROR_RATE_LIMIT;
+    }
+    
+    // A slot in the minute; a theoretical arrival time more than a minute
+    // out can only come from the clock having been set back
+    int64_t tat = atomic_load_explicit(&budget->minute_tat, memory_order_relaxed);
+    for (;;) {
+        int64_t base = tat > now && tat - now <= DO_RATE_MINUTE_US ? tat : now;
+        if (base - now > DO_RATE_MINUTE_US - DO_RATE_INTERVAL_US) {
+            *wait_us = base - now - (DO_RATE_MINUTE_US - DO_RATE_INTERVAL_US);
+            return DO_ERROR_RATE_LIMIT;
+        }
+        if (atomic_compare_exchange_weak_explicit(&budget->minute_tat, &tat,
+                                                  base + DO_RATE_INTERVAL_US,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+            break;
+        }
+    }
+    
+    // Then one of the requests the API says are left this hour. Another
+    // process may have taken the last one since the check above; the
+    // minute slot goes back in that case.
+    hour = atomic_load_explicit(&budget->hour, memory_order_relaxed);
+    for (;;) {
+        int64_t reset_us = (int64_t)(hour >> 32) * 1000000;
+        if (hour == 0 || reset_us <= now) {
+            break;
+        }
+        *wait_us = do_rate_budget_hour_wait(hour, now);
+        if (*wait_us > 0) {
+            atomic_fetch_sub_explicit(&budget->minute_tat, DO_RATE_INTERVAL_US,
+                                      memory_order_relaxed);
+            return DO_ERROR_RATE_LIMIT;
+        }
+        if (atomic_compare_exchange_weak_explicit(&budget->hour, &hour, hour - 1,
+                                                  memory_order_relaxed, memory_order_relaxed)) {
+            break;
+        }
+    }
+    
+    return DO_SUCCESS;
+}
+
+// Blocks until a request may be sent, or fails at once when that is more
+// than a minute away, i.e. the hourly budget is spent
+do_result_t do_rate_budget_acquire(do_rate_budget_t *budget) {
+    for (;;) {
+        int64_t wait_us;
+        if (do_rate_budget_reserve(budget, &wait_us) == DO_SUCCESS) {
+            return DO_SUCCESS;
+        }
+        if (wait_us > DO_RATE_MAX_WAIT_US) {
+            return DO_ERROR_RATE_LIMIT;
+        }
+        
+        struct timespec ts = {wait_us / 1000000, (wait_us % 1000000) * 1000};
+        while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+        }
+    }
+}
+
+// Publishes a response's RateLimit-Remaining and RateLimit-Reset. Reports
+// for an older reset are ignored, and within the same one the count only
+// goes down, so responses arriving out of order cannot give back requests
+// other processes have already reserved.
+void do_rate_budget_update(do_rate_budget_t *budget, int64_t remaining, int64_t reset) {
+    if (remaining < 0 || reset <= 0 || reset > (int64_t)UINT32_MAX) {
+        return;
+    }
+    if (remaining > (int64_t)UINT32_MAX) {
+        remaining = UINT32_MAX;
+    }
+    
+    uint64_t next = (uint64_t)reset << 32 | (uint64_t)remaining;
+    uint64_t hour = atomic_load_explicit(&budget->hour, memory_order_relaxed);
+    do {
+        uint64_t current_reset = hour >> 32;
+        if ((uint64_t)reset < current_reset ||
+            ((uint64_t)reset == current_reset && (uint64_t)remaining >= (hour & 0xffffffffu))) {
+            return;
+        }
+    } while (!atomic_compare_exchange_weak_explicit(&budget->hour, &hour, next,
+                                                    memory_order_relaxed, memory_order_relaxed));
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#ifndef DO_RATELIMIT_H
+#define DO_RATELIMIT_H
+
+#include <stdint.h>
+#include "digitalocean/http.h"
+
+// Host-wide rate-limit budget, shared through a mapped file by every
+// process using the same token (ratelimit.c)
+
+do_result_t do_rate_budget_open(const char *token, do_rate_budget_t **budget);
+void do_rate_budget_close(do_rate_budget_t *budget);
+
+// Takes one request from the budget without waiting. On DO_ERROR_RATE_LIMIT
+// wait_us says how long until one is likely to be free, and nothing has
+// been taken.
+do_result_t do_rate_budget_reserve(do_rate_budget_t *budget, int64_t *wait_us);
+
+// Blocks until a request may be sent, or fails at once when that is more
+// than a minute away, i.e. the hourly budget is spent
+do_result_t do_rate_budget_acquire(do_rate_budget_t *budget);
+
+// Publishes a response's RateLimit-Remaining and RateLimit-Reset
+void do_rate_budget_update(do_rate_budget_t *budget, int64_t remaining, int64_t reset);
+
+#endif // DO_RATELIMIT_H
\ No newline at end of file
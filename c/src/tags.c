@@ -0,0 +1,255 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "digitalocean/client.h"
+#include "digitalocean/alloc.h"
+#include "client_internal.h"
+#include "http_transfer.h"
+#include "json_writer.h"
+
+do_result_t do_client_create_tag(do_client_t *client, const char *name) {
+    if (!client || !name || name[0] == '\0') {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    
+    json_writer_t writer;
+    json_writer_init(&writer, &client->request_body);
+    json_writer_begin_object(&writer);
+    json_writer_member_string(&writer, "name", name);
+    json_writer_end_object(&writer);
+    
+    do_result_t result = json_writer_finish(&writer);
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    
+    char *url = do_http_build_url(client->config->base_url, "/v2/tags");
+    if (!url) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    do_http_response_t *response = do_http_client_acquire_response(client->http_client);
+    if (!response) {
+        do_free(url);
+        return DO_ERROR_MEMORY;
+    }
+    
+    result = do_http_post(client->http_client, url, client->auth_header,
+                          client->request_body.data, response);
+    do_free(url);
+    do_http_client_release_response(client->http_client, response);
+    if (result == DO_SUCCESS) {
+        result = do_http_status_to_result(client->http_client->timing.status_code);
+    }
+    do_client_request_done(client, result, 0, 0);
+    
+    return result;
+}
+
+// One chunk in flight
+typedef struct {
+    CURL *curl;
+    do_http_response_t *response;
+    do_string_t body;
+    bool busy;
+} tag_transfer_t;
+
+typedef struct {
+    do_client_t *client;
+    const char *method;
+    const char *resource_type;
+    const char *const *resource_ids;
+    size_t count;
+    size_t next;             // first id not yet sent
+    char *url;
+    struct curl_slist *headers;
+    CURLM *multi;
+    size_t running;
+    do_result_t failure;
+} tag_state_t;
+
+static do_result_t tag_start_next(tag_state_t *state, tag_transfer_t *transfer) {
+    if (state->next >= state->count) {
+        return DO_SUCCESS;
+    }
+    
+    size_t end = state->next + DO_TAG_CHUNK_SIZE;
+    if (end > state->count) {
+        end = state->count;
+    }
+    
+    json_writer_t writer;
+    json_writer_init(&writer, &transfer->body);
+    json_writer_begin_object(&writer);
+    json_writer_key(&writer, "resources");
+    json_writer_begin_array(&writer);
+    for (size_t i = state->next; i < end; i++) {
+        json_writer_begin_object(&writer);
+        json_writer_member_string(&writer, "resource_id", state->resource_ids[i]);
+        json_writer_member_string(&writer, "resource_type", state->resource_type);
+        json_writer_end_object(&writer);
+    }
+    json_writer_end_array(&writer);
+    json_writer_end_object(&writer);
+    
+    do_result_t result = json_writer_finish(&writer);
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    state->next = end;
+    
+    // libcurl does not copy POSTFIELDS; the body stays put until the
+    // transfer is done
+    do_http_response_clear(transfer->response);
+    curl_easy_setopt(transfer->curl, CURLOPT_POSTFIELDS, transfer->body.data);
+    curl_easy_setopt(transfer->curl, CURLOPT_POSTFIELDSIZE, (long)transfer->body.length);
+    
+    result = do_http_transfer_start(state->client->http_client, state->multi, transfer->curl);
+    if (result != DO_SUCCESS) {
+        return result;
+    }
+    
+    transfer->busy = true;
+    state->running++;
+    return DO_SUCCESS;
+}
+
+static do_result_t tag_transfer_done(void *owner, CURLcode res, void *userdata) {
+    tag_transfer_t *transfer = owner;
+    tag_state_t *state = userdata;
+    do_client_t *client = state->client;
+    transfer->busy = false;
+    state->running--;
+    
+    do_request_timing_t timing;
+    do_result_t result = do_http_transfer_finish(client->http_client, transfer->curl,
+                                                 state->method, res, &timing);
+    if (client->timing_callback) {
+        client->timing_callback(&timing, client->timing_userdata);
+    }
+    if (result != DO_SUCCESS && state->failure == DO_SUCCESS) {
+        state->failure = result;
+    }
+    
+    return tag_start_next(state, transfer);
+}
+
+static do_result_t tag_transfer_init(tag_state_t *state, tag_transfer_t *transfer) {
+    do_http_client_t *http_client = state->client->http_client;
+    
+    do_string_init(&transfer->body);
+    transfer->response = do_http_client_acquire_response(http_client);
+    if (!transfer->response) {
+        return DO_ERROR_MEMORY;
+    }
+    transfer->curl = do_http_transfer_new(http_client, state->headers, transfer->response, transfer);
+    if (!transfer->curl) {
+        return DO_ERROR_MEMORY;
+    }
+    
+    CURL *curl = transfer->curl;
+    curl_easy_setopt(curl, CURLOPT_URL, state->url);
+    curl_easy_setopt(curl, CURLOPT_POST, 1L);
+    curl_easy_setopt(curl, CURLOPT_CUSTOMREQUEST,
+                     strcmp(state->method, "POST") == 0 ? NULL : state->method);
+    return DO_SUCCESS;
+}
+
+static do_result_t tag_run(tag_state_t *state, tag_transfer_t *transfers, size_t transfer_count) {
+    for (size_t i = 0; i < transfer_count; i++) {
+        do_result_t result = tag_transfer_init(state, &transfers[i]);
+        if (result == DO_SUCCESS) {
+            result = tag_start_next(state, &transfers[i]);
+        }
+        if (result != DO_SUCCESS) {
+            return result;
+        }
+    }
+    
+    return do_http_multi_run(state->multi, &state->running, tag_transfer_done, state);
+}
+
+static do_result_t tag_resources(do_client_t *client, const char *method, const char *tag,
+                                 const char *resource_type, const char *const *resource_ids,
+                                 size_t count) {
+    if (!client || !client->config || !client->http_client || !tag || tag[0] == '\0' ||
+        !resource_type || (count && !resource_ids)) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!resource_ids[i]) {
+            return DO_ERROR_INVALID_PARAM;
+        }
+    }
+    if (count == 0) {
+        return DO_SUCCESS;
+    }
+    
+    tag_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.client = client;
+    state.method = method;
+    state.resource_type = resource_type;
+    state.resource_ids = resource_ids;
+    state.count = count;
+    
+    size_t chunks = (count + DO_TAG_CHUNK_SIZE - 1) / DO_TAG_CHUNK_SIZE;
+    size_t transfer_count = chunks < DO_TAG_MAX_CONCURRENCY ? chunks : DO_TAG_MAX_CONCURRENCY;
+    
+    // Tag names may hold characters that need escaping in a path
+    char *escaped = curl_easy_escape(NULL, tag, 0);
+    if (escaped) {
+        char endpoint[512];
+        int written = snprintf(endpoint, sizeof(endpoint), "/v2/tags/%s/resources", escaped);
+        curl_free(escaped);
+        if (written < 0 || (size_t)written >= sizeof(endpoint)) {
+            return DO_ERROR_INVALID_PARAM;
+        }
+        state.url = do_http_build_url(client->config->base_url, endpoint);
+    }
+    
+    state.multi = curl_multi_init();
+    state.headers = curl_slist_append(NULL, "Content-Type: application/json");
+    if (state.headers) {
+        struct curl_slist *auth = curl_slist_append(state.headers, client->auth_header);
+        if (!auth) {
+            curl_slist_free_all(state.headers);
+            state.headers = NULL;
+        }
+    }
+    tag_transfer_t *transfers = do_calloc(transfer_count, sizeof(tag_transfer_t));
+    
+    do_result_t result = state.url && state.multi && state.headers && transfers
+        ? tag_run(&state, transfers, transfer_count) : DO_ERROR_MEMORY;
+    
+    for (size_t i = 0; transfers && i < transfer_count; i++) {
+        if (transfers[i].busy) {
+            curl_multi_remove_handle(state.multi, transfers[i].curl);
+        }
+        if (transfers[i].curl) {
+            curl_easy_cleanup(transfers[i].curl);
+        }
+        do_http_client_release_response(client->http_client, transfers[i].response);
+        do_string_free(&transfers[i].body);
+    }
+    do_free(transfers);
+    curl_slist_free_all(state.headers);
+    if (state.multi) {
+        curl_multi_cleanup(state.multi);
+    }
+    do_free(state.url);
+    
+    return result != DO_SUCCESS ? result : state.failure;
+}
+
+do_result_t do_client_tag_resources(do_client_t *client, const char *tag,
+                                    const char *resource_type, const char *const *resource_ids,
+                                    size_t count) {
+    return tag_resources(client, "POST", tag, resource_type, resource_ids, count);
+}
+
+do_result_t do_client_untag_resources(do_client_t *client, const char *tag,
+                                      const char *resource_type, const char *const *resource_ids,
+                                      size_t count) {
+    return tag_resources(client, "DELETE", tag, resource_type, resource_ids, count);
+}
\ No newline at end of file
@@ -0,0 +1,285 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "digitalocean/http.h"
+#include "digitalocean/config.h"
+#include "digitalocean/alloc.h"
+#include "http_internal.h"
+#include "tls_sessions.h"
+
+// TLS session tickets kept on disk so a new process resumes the handshake
+// with the API instead of starting over. libcurl hands sessions out and
+// takes them back from 8.12 on, and only when it was built with
+// --enable-ssls-export, which it reports as the "SSLS-EXPORT" feature;
+// otherwise these are no-ops reporting DO_ERROR_CONFIG.
+//
+// The file is a magic line followed by one record per session:
+//
+//   u16 key length, u16 hmac length, u32 data length, i64 valid until,
+//   key, hmac, data
+//
+// in host byte order; it never leaves the machine. Sessions are
+// credentials for the connection, so the file is 0600 like the config.
+
+#define DO_TLS_SESSIONS_MAGIC "do-cli tls sessions 1\n"
+#define DO_TLS_SESSIONS_MAX_FILE (1024 * 1024) // ignore anything bigger
+
+#if LIBCURL_VERSION_NUM >= 0x080c00
+#define DO_TLS_SESSIONS_AVAILABLE 1
+#else
+#define DO_TLS_SESSIONS_AVAILABLE 0
+#endif
+
+char *do_tls_sessions_default_path(void) {
+    char *config_dir = do_config_get_config_dir();
+    if (!config_dir) {
+        return NULL;
+    }
+    
+    size_t len = strlen(config_dir) + strlen("/tls-sessions") + 1;
+    char *path = do_malloc(len);
+    if (path) {
+        snprintf(path, len, "%s/tls-sessions", config_dir);
+    }
+    do_free(config_dir);
+    return path;
+}
+
+bool do_tls_sessions_supported(void) {
+#if DO_TLS_SESSIONS_AVAILABLE
+    // The library loaded may be another build than the headers we saw
+    const curl_version_info_data *info = curl_version_info(CURLVERSION_NOW);
+    if (info->age < CURLVERSION_ELEVENTH || !info->feature_names) {
+        return false;
+    }
+    for (const char *const *name = info->feature_names; *name; name++) {
+        if (strcmp(*name, "SSLS-EXPORT") == 0) {
+            return true;
+        }
+    }
+#endif
+    return false;
+}
+
+#if DO_TLS_SESSIONS_AVAILABLE
+
+typedef struct {
+    char *data;
+    size_t length;
+    size_t capacity;
+    bool failed;
+} tls_buffer_t;
+
+static void tls_append(tls_buffer_t *buffer, const void *data, size_t len) {
+    if (buffer->failed) {
+        return;
+    }
+    
+    if (buffer->length + len > buffer->capacity) {
+        size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+        while (capacity < buffer->length + len) {
+            capacity *= 2;
+        }
+        char *data_new = do_realloc(buffer->data, capacity);
+        if (!data_new) {
+            buffer->failed = true;
+            return;
+        }
+        buffer->data = data_new;
+        buffer->capacity = capacity;
+    }
+    
+    memcpy(buffer->data + buffer->length, data, len);
+    buffer->length += len;
+}
+
+static CURLcode tls_export_one(CURL *curl, void *userptr, const char *session_key,
+                               const unsigned char *shmac, size_t shmac_len,
+                               const unsigned char *sdata, size_t sdata_len,
+                               curl_off_t valid_until, int ietf_tls_id, const char *alpn,
+                               size_t earlydata_max) {
+    (void)curl;
+    (void)ietf_tls_id;
+    (void)alpn;
+    (void)earlydata_max;
+    tls_buffer_t *buffer = userptr;
+    
+    size_t key_len = strlen(session_key);
+    if (key_len > UINT16_MAX || shmac_len > UINT16_MAX || sdata_len > UINT32_MAX ||
+        valid_until <= (curl_off_t)time(NULL)) {
+        return CURLE_OK;
+    }
+    
+    uint16_t key_len16 = (uint16_t)key_len;
+    uint16_t shmac_len16 = (uint16_t)shmac_len;
+    uint32_t sdata_len32 = (uint32_t)sdata_len;
+    int64_t expires = valid_until;
+    tls_append(buffer, &key_len16, sizeof(key_len16));
+    tls_append(buffer, &shmac_len16, sizeof(shmac_len16));
+    tls_append(buffer, &sdata_len32, sizeof(sdata_len32));
+    tls_append(buffer, &expires, sizeof(expires));
+    tls_append(buffer, session_key, key_len);
+    tls_append(buffer, shmac, shmac_len);
+    tls_append(buffer, sdata, sdata_len);
+    return buffer->failed ? CURLE_OUT_OF_MEMORY : CURLE_OK;
+}
+
+static char *tls_read_file(const char *path, size_t *length) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return NULL;
+    }
+    
+    struct stat st;
+    char *data = NULL;
+    if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 &&
+        st.st_size <= DO_TLS_SESSIONS_MAX_FILE) {
+        data = do_malloc((size_t)st.st_size);
+    }
+    
+    size_t filled = 0;
+    while (data && filled < (size_t)st.st_size) {
+        ssize_t n = read(fd, data + filled, (size_t)st.st_size - filled);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            break;
+        }
+        filled += (size_t)n;
+    }
+    close(fd);
+    
+    *length = filled;
+    return data;
+}
+
+#endif // DO_TLS_SESSIONS_AVAILABLE
+
+// Hands the unexpired sessions in path to the client's handle. A missing
+// or damaged file just means full handshakes.
+do_result_t do_tls_sessions_load(do_http_client_t *client, const char *path) {
+    if (!client || !client->curl || !path) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    if (!do_tls_sessions_supported()) {
+        return DO_ERROR_CONFIG;
+    }
+
+#if DO_TLS_SESSIONS_AVAILABLE
+    do_http_client_settle(client);
+    
+    size_t length = 0;
+    char *data = tls_read_file(path, &length);
+    if (!data) {
+        return DO_SUCCESS;
+    }
+    
+    size_t magic_len = strlen(DO_TLS_SESSIONS_MAGIC);
+    if (length < magic_len || memcmp(data, DO_TLS_SESSIONS_MAGIC, magic_len) != 0) {
+        do_free(data);
+        return DO_SUCCESS;
+    }
+    
+    time_t now = time(NULL);
+    size_t offset = magic_len;
+    const size_t header_len = 2 * sizeof(uint16_t) + sizeof(uint32_t) + sizeof(int64_t);
+    while (length - offset >= header_len) {
+        uint16_t key_len, shmac_len;
+        uint32_t sdata_len;
+        int64_t expires;
+        memcpy(&key_len, data + offset, sizeof(key_len));
+        memcpy(&shmac_len, data + offset + 2, sizeof(shmac_len));
+        memcpy(&sdata_len, data + offset + 4, sizeof(sdata_len));
+        memcpy(&expires, data + offset + 8, sizeof(expires));
+        offset += header_len;
+        
+        size_t record_len = (size_t)key_len + shmac_len + sdata_len;
+        if (key_len == 0 || record_len > length - offset) {
+            break;
+        }
+        
+        if (expires > (int64_t)now) {
+            char *key = do_malloc((size_t)key_len + 1);
+            if (key) {
+                memcpy(key, data + offset, key_len);
+                key[key_len] = '\0';
+                const unsigned char *shmac = (const unsigned char *)data + offset + key_len;
+                CURLcode code = curl_easy_ssls_import(client->curl, key, shmac, shmac_len,
+                                                      shmac + shmac_len, sdata_len);
+                do_free(key);
+                if (code == CURLE_NOT_BUILT_IN) {
+                    do_free(data);
+                    return DO_ERROR_CONFIG;
+                }
+            }
+        }
+        offset += record_len;
+    }
+    
+    do_free(data);
+#endif
+    return DO_SUCCESS;
+}
+
+// Writes the unexpired sessions of every client to path, replacing it
+// atomically so concurrent processes never read half a file
+do_result_t do_tls_sessions_save(do_http_client_t *const *clients, size_t count, const char *path) {
+    if (!clients || !path) {
+        return DO_ERROR_INVALID_PARAM;
+    }
+    if (!do_tls_sessions_supported()) {
+        return DO_ERROR_CONFIG;
+    }
+
+#if DO_TLS_SESSIONS_AVAILABLE
+    tls_buffer_t buffer = {0};
+    tls_append(&buffer, DO_TLS_SESSIONS_MAGIC, strlen(DO_TLS_SESSIONS_MAGIC));
+    for (size_t i = 0; i < count; i++) {
+        if (clients[i] && clients[i]->curl) {
+            do_http_client_settle(clients[i]);
+            if (curl_easy_ssls_export(clients[i]->curl, tls_export_one, &buffer) ==
+                CURLE_NOT_BUILT_IN) {
+                do_free(buffer.data);
+                return DO_ERROR_CONFIG;
+            }
+        }
+    }
+    if (buffer.failed || buffer.length > DO_TLS_SESSIONS_MAX_FILE) {
+        do_free(buffer.data);
+        return buffer.failed ? DO_ERROR_MEMORY : DO_SUCCESS;
+    }
+    
+    size_t tmp_len = strlen(path) + 32;
+    char *tmp_path = do_malloc(tmp_len);
+    if (!tmp_path) {
+        do_free(buffer.data);
+        return DO_ERROR_MEMORY;
+    }
+    snprintf(tmp_path, tmp_len, "%s.%ld", path, (long)getpid());
+    
+    do_result_t result = DO_ERROR_CONFIG;
+    int fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    if (fd >= 0) {
+        ssize_t written = write(fd, buffer.data, buffer.length);
+        if (close(fd) == 0 && written == (ssize_t)buffer.length && rename(tmp_path, path) == 0) {
+            result = DO_SUCCESS;
+        } else {
+            unlink(tmp_path);
+        }
+    }
+    
+    do_free(tmp_path);
+    do_free(buffer.data);
+    return result;
+#else
+    (void)count;
+    return DO_ERROR_CONFIG;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+#ifndef DO_TLS_SESSIONS_H
+#define DO_TLS_SESSIONS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "digitalocean/http.h"
+
+// TLS session tickets kept on disk across processes (tls_sessions.c). All
+// of these report DO_ERROR_CONFIG when libcurl cannot export sessions.
+
+// The sessions file in the config directory; the caller frees it
+char *do_tls_sessions_default_path(void);
+bool do_tls_sessions_supported(void);
+
+// Hands the unexpired sessions in path to the client's handle. A missing
+// or damaged file just means full handshakes.
+do_result_t do_tls_sessions_load(do_http_client_t *client, const char *path);
+
+// Writes the unexpired sessions of every client to path, replacing it
+// atomically so concurrent processes never read half a file
+do_result_t do_tls_sessions_save(do_http_client_t *const *clients, size_t count, const char *path);
+
+#endif // DO_TLS_SESSIONS_H
\ No newline at end of file
@@ -0,0 +1,20 @@
+#ifndef DO_TEST_H
+#define DO_TEST_H
+
+#include <stdio.h>
+
+// Each test program counts its failed checks and exits with 1 if any did;
+// a check that fails prints where and carries on with the rest
+static int test_failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { \
+        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        test_failures++; \
+    } \
+} while (0)
+
+#define TEST_DONE() (test_failures ? (fprintf(stderr, "%d check(s) failed\n", \
+                                              test_failures), 1) : 0)
+
+#endif // DO_TEST_H
\ No newline at end of file
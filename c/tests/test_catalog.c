@@ -0,0 +1,120 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "digitalocean/catalog.h"
+#include "test.h"
+
+// More regions than one word of bits holds, so the availability rows
+// span two words. r05 is not taking new droplets.
+#define REGION_COUNT 70
+
+static bool write_catalog(const char *path) {
+    FILE *file = fopen(path, "w");
+    if (!file) {
+        return false;
+    }
+    fprintf(file, "{\"fetched_at\":1700000000,\"regions\":[");
+    for (int i = 0; i < REGION_COUNT; i++) {
+        fprintf(file, "%s{\"slug\":\"r%02d\",\"name\":\"Region %d\",\"available\":%s}",
+                i ? "," : "", i, i, i == 5 ? "false" : "true");
+    }
+    fprintf(file, "],\"sizes\":["
+                  "{\"slug\":\"s-small\",\"memory\":1024,\"vcpus\":1,\"disk\":25,"
+                  "\"available\":true,\"regions\":[\"r01\",\"r05\",\"r65\",\"gone\"]},"
+                  "{\"slug\":\"s-retired\",\"memory\":2048,\"vcpus\":2,\"disk\":50,"
+                  "\"available\":false,\"regions\":[\"r01\",\"r65\"]}"
+                  "],\"images\":["
+                  "{\"id\":7,\"slug\":\"ubuntu\",\"name\":\"Ubuntu\",\"distribution\":\"Ubuntu\","
+                  "\"min_disk_size\":30,\"regions\":[\"r02\",\"r64\"]}"
+                  "]}\n");
+    return fclose(file) == 0;
+}
+
+static void check_lookups(const do_catalog_t *catalog) {
+    CHECK(do_catalog_fetched_at(catalog) == 1700000000);
+    CHECK(do_catalog_region_count(catalog) == REGION_COUNT);
+    CHECK(do_catalog_size_count(catalog) == 2 && do_catalog_image_count(catalog) == 1);
+    
+    const do_catalog_region_t *region = do_catalog_find_region(catalog, "r69");
+    CHECK(region && strcmp(region->name, "Region 69") == 0 && region->available);
+    region = do_catalog_find_region(catalog, "r05");
+    CHECK(region && !region->available);
+    const do_catalog_size_t *size = do_catalog_find_size(catalog, "s-small");
+    CHECK(size && size->memory == 1024 && size->disk == 25);
+    const do_catalog_image_t *image = do_catalog_find_image(catalog, "ubuntu");
+    CHECK(image && image->id == 7 && image->min_disk_size == 30);
+    CHECK(!do_catalog_find_region(catalog, "r70") && !do_catalog_find_size(catalog, "s-big"));
+    
+    // Bits in the first and the second word
+    CHECK(do_catalog_size_available(catalog, "s-small", "r01"));
+    CHECK(do_catalog_size_available(catalog, "s-small", "r65"));
+    CHECK(!do_catalog_size_available(catalog, "s-small", "r00"));
+    CHECK(!do_catalog_size_available(catalog, "s-small", "r64"));
+    CHECK(do_catalog_image_available(catalog, "ubuntu", "r02"));
+    CHECK(do_catalog_image_available(catalog, "ubuntu", "r64"));
+    CHECK(!do_catalog_image_available(catalog, "ubuntu", "r01"));
+    CHECK(!do_catalog_image_available(catalog, "ubuntu", "r65"));
+    
+    // A listed region that is closed, or a size that is off, sets no bit
+    CHECK(!do_catalog_size_available(catalog, "s-small", "r05"));
+    CHECK(!do_catalog_size_available(catalog, "s-retired", "r01"));
+    CHECK(!do_catalog_size_available(catalog, "s-retired", "r65"));
+    
+    // Unknown slugs on either side
+    CHECK(!do_catalog_size_available(catalog, "s-big", "r01"));
+    CHECK(!do_catalog_size_available(catalog, "s-small", "gone"));
+    CHECK(!do_catalog_image_available(catalog, "debian", "r02"));
+    CHECK(!do_catalog_image_available(catalog, "ubuntu", NULL));
+}
+
+static void test_availability(const char *dir) {
+    char path[256];
+    char copy[256];
+    snprintf(path, sizeof(path), "%s/catalog.json", dir);
+    snprintf(copy, sizeof(copy), "%s/copy.json", dir);
+    CHECK(write_catalog(path));
+    
+    do_catalog_t *catalog = NULL;
+    CHECK(do_catalog_load(path, &catalog) == DO_SUCCESS);
+    if (!catalog) {
+        return;
+    }
+    check_lookups(catalog);
+    
+    // A saved catalog loads back with the same rows
+    do_catalog_t *reloaded = NULL;
+    CHECK(do_catalog_save(catalog, copy) == DO_SUCCESS);
+    CHECK(do_catalog_load(copy, &reloaded) == DO_SUCCESS);
+    if (reloaded) {
+        check_lookups(reloaded);
+    }
+    
+    do_catalog_free(reloaded);
+    do_catalog_free(catalog);
+    unlink(copy);
+    unlink(path);
+}
+
+static void test_missing(const char *dir) {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/absent.json", dir);
+    do_catalog_t *catalog = NULL;
+    CHECK(do_catalog_load(path, &catalog) == DO_ERROR_NOT_FOUND && !catalog);
+    CHECK(!do_catalog_size_available(NULL, "s-small", "r01"));
+}
+
+int main(void) {
+    char dir[] = "/tmp/do-catalog-XXXXXX";
+    if (!mkdtemp(dir)) {
+        perror("mkdtemp");
+        return 1;
+    }
+    
+    test_availability(dir);
+    test_missing(dir);
+    
+    rmdir(dir);
+    return TEST_DONE();
+}
\ No newline at end of file
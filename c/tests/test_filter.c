@@ -0,0 +1,122 @@
+#include <string.h>
+#include <cjson/cjson.h>
+#include "digitalocean/filter.h"
+#include "client_internal.h"
+#include "json_ondemand.h"
+#include "test.h"
+
+static const char droplet_text[] =
+    "{\"id\":42,\"name\":\"web-1\",\"memory\":4096,\"vcpus\":2,\"disk\":80,\"locked\":false,"
+    "\"status\":\"active\",\"created_at\":\"2024-03-01T10:00:00Z\",\"size_slug\":\"s-2vcpu-4gb\","
+    "\"region\":{\"slug\":\"nyc3\"},\"image\":{\"slug\":\"ubuntu-22-04-x64\"},"
+    "\"tags\":[\"web\",\"env:prod\"],\"vpc_uuid\":\"vpc-1\"}";
+
+// Matches against the tree and against the index of the same text, which
+// must agree
+static bool matches(const char *expression, const char *text) {
+    do_droplet_filter_t *filter = NULL;
+    char error[128];
+    if (do_droplet_filter_compile(expression, &filter, error, sizeof(error)) != DO_SUCCESS) {
+        fprintf(stderr, "%s: %s\n", expression, error);
+        test_failures++;
+        return false;
+    }
+    cJSON *droplet = cJSON_Parse(text);
+    bool result = do_droplet_filter_matches(filter, droplet);
+    
+    json_od_doc_t doc = {0};
+    json_od_value_t root;
+    CHECK(json_od_index(&doc, text, strlen(text)) == DO_SUCCESS && json_od_root(&doc, &root));
+    CHECK(do_droplet_filter_matches_indexed(filter, &root) == result);
+    
+    json_od_doc_free(&doc);
+    cJSON_Delete(droplet);
+    do_droplet_filter_free(filter);
+    return result;
+}
+
+static void test_push_down(void) {
+    static const struct {
+        const char *expression;
+        const char *query;
+    } cases[] = {
+        {"status=active", ""},
+        {"tag=web", "tag_name=web"},
+        {"name=web-1 and tag=web", "tag_name=web"},
+        {"name=\"web 1\"", "name=web%201"},
+        {"tag!=web", ""},
+        {"name~web", ""},
+    };
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        do_droplet_filter_t *filter = NULL;
+        CHECK(do_droplet_filter_compile(cases[i].expression, &filter, NULL, 0) == DO_SUCCESS);
+        CHECK(strcmp(do_droplet_filter_query(filter), cases[i].query) == 0);
+        do_droplet_filter_free(filter);
+    }
+}
+
+static void test_errors(void) {
+    static const char *bad[] = {
+        "colour=red",
+        "status",
+        "status=",
+        "memory>lots",
+        "locked=maybe",
+        "locked>true",
+        "tag<web",
+        "memory~4",
+        "name='web",
+        "status=active or tag=web",
+        "status=active and",
+    };
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        do_droplet_filter_t *filter = (do_droplet_filter_t *)&filter;
+        char error[128] = "";
+        CHECK(do_droplet_filter_compile(bad[i], &filter, error, sizeof(error)) ==
+              DO_ERROR_INVALID_PARAM);
+        CHECK(filter == NULL);
+        CHECK(error[0] != '\0');
+    }
+}
+
+static void test_matches(void) {
+    // An empty expression has no clauses, so everything matches
+    CHECK(matches("", droplet_text));
+    CHECK(matches("status=active", droplet_text));
+    CHECK(!matches("status!=active", droplet_text));
+    CHECK(matches("memory>=4096 and vcpus<4 and disk>40", droplet_text));
+    CHECK(!matches("memory>4096", droplet_text));
+    CHECK(matches("id=42 and locked=false", droplet_text));
+    CHECK(!matches("locked=true", droplet_text));
+    CHECK(matches("region=nyc3 and image~ubuntu and size=s-2vcpu-4gb", droplet_text));
+    CHECK(matches("tag!=db and vpc=vpc-1", droplet_text));
+    CHECK(matches("created>=2024-03 and created<2024-04", droplet_text));
+    CHECK(!matches("created<2024", droplet_text));
+    CHECK(matches("name~web AND status='active'", droplet_text));
+    CHECK(!matches("name>web-10", droplet_text));
+    CHECK(matches("name>web-", droplet_text));
+    
+    // A pushed-down clause is the API's to check, not the filter's
+    CHECK(matches("tag=db", droplet_text));
+    
+    // Escaped text is compared decoded
+    static const char escaped[] =
+        "{\"name\":\"web \\\"blue\\\"\",\"status\":\"\\u0061ctive\",\"tags\":[\"a\\/b\"]}";
+    CHECK(matches("name~\"blue\" and status=active", escaped));
+    CHECK(matches("name<webz and tag!=c", escaped));
+    CHECK(!matches("tag!=a/b", escaped));
+    
+    // Absent or mistyped fields only satisfy !=
+    static const char bare[] = "{\"id\":\"42\",\"region\":\"nyc3\",\"tags\":[1]}";
+    CHECK(!matches("id=42", bare));
+    CHECK(matches("id!=42 and status!=active and locked!=true", bare));
+    CHECK(!matches("region=nyc3", bare));
+    CHECK(matches("region!=nyc3", bare));
+}
+
+int main(void) {
+    test_push_down();
+    test_errors();
+    test_matches();
+    return TEST_DONE();
+}
\ No newline at end of file
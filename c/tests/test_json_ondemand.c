@@ -0,0 +1,210 @@
+#include <stdlib.h>
+#include <string.h>
+#include <cjson/cjson.h>
+#include "digitalocean/alloc.h"
+#include "json_internal.h"
+#include "test.h"
+
+static const char *backends[] = {"scalar", "sse4.2", "avx2"};
+
+#define BACKEND_COUNT (sizeof(backends) / sizeof(backends[0]))
+
+// The unescaped value of key in the object text, or NULL
+static char *string_member(const char *text, const char *key) {
+    json_od_doc_t doc = {0};
+    json_od_value_t root, value;
+    char *result = NULL;
+    if (json_od_index(&doc, text, strlen(text)) == DO_SUCCESS && json_od_root(&doc, &root) &&
+        json_od_find(&root, key, &value)) {
+        result = json_od_strdup(&value);
+    }
+    json_od_doc_free(&doc);
+    return result;
+}
+
+// Every indexer must record the same structurals as the scalar one
+static void check_same_index(const char *text) {
+    json_od_use_backend("scalar");
+    json_od_doc_t expected = {0};
+    CHECK(json_od_index(&expected, text, strlen(text)) == DO_SUCCESS);
+    
+    for (size_t i = 1; i < BACKEND_COUNT; i++) {
+        if (!json_od_use_backend(backends[i])) {
+            continue;
+        }
+        json_od_doc_t doc = {0};
+        CHECK(json_od_index(&doc, text, strlen(text)) == DO_SUCCESS);
+        CHECK(doc.count == expected.count);
+        if (doc.count == expected.count) {
+            CHECK(memcmp(doc.pos, expected.pos, doc.count * sizeof(uint32_t)) == 0);
+            // match is only kept for opening brackets
+            for (size_t j = 0; j < doc.count; j++) {
+                char c = text[doc.pos[j]];
+                CHECK((c != '{' && c != '[') || doc.match[j] == expected.match[j]);
+            }
+        }
+        json_od_doc_free(&doc);
+    }
+    json_od_doc_free(&expected);
+}
+
+// Escaped quotes and backslash runs placed at every offset around the
+// 64-byte block edges, where an indexer carries state to the next block
+static void test_escapes_across_blocks(void) {
+    static const struct {
+        const char *raw;
+        const char *decoded;
+    } escapes[] = {
+        {"\\\"", "\""},
+        {"\\\\", "\\"},
+        {"\\\\\\\"", "\\\""},
+        {"\\\\\\\\", "\\\\"},
+        {"\\u0041\\n", "A\n"},
+    };
+    
+    for (size_t e = 0; e < sizeof(escapes) / sizeof(escapes[0]); e++) {
+        for (size_t pad = 0; pad < 140; pad++) {
+            char text[512];
+            char expected[256];
+            memset(expected, 'x', pad);
+            strcpy(expected + pad, escapes[e].decoded);
+            strcat(expected, "]{");
+            snprintf(text, sizeof(text), "{\"k\":\"%.*s%s]{\",\"n\":[1,{\"m\":true}]}",
+                     (int)pad, expected, escapes[e].raw);
+            
+            check_same_index(text);
+            for (size_t i = 0; i < BACKEND_COUNT; i++) {
+                if (!json_od_use_backend(backends[i])) {
+                    continue;
+                }
+                char *value = string_member(text, "k");
+                CHECK(value && strcmp(value, expected) == 0);
+                do_free(value);
+                
+                json_od_doc_t doc = {0};
+                json_od_value_t root, n, first;
+                CHECK(json_od_index(&doc, text, strlen(text)) == DO_SUCCESS);
+                CHECK(json_od_root(&doc, &root) && json_od_find(&root, "n", &n));
+                CHECK(json_od_count(&n) == 2);
+                double number = 0;
+                CHECK(json_od_first(&n, &first) && json_od_number(&first, &number) &&
+                      number == 1);
+                json_od_doc_free(&doc);
+            }
+        }
+    }
+}
+
+static void test_unicode_escapes(void) {
+    char *value = string_member("{\"k\":\"\\u00e9\\ud83d\\ude00\"}", "k");
+    CHECK(value && strcmp(value, "\xc3\xa9\xf0\x9f\x98\x80") == 0);
+    do_free(value);
+    
+    // Half a pair, a pair in the wrong order and unknown escapes are refused
+    static const char *bad[] = {
+        "{\"k\":\"\\ud83d\"}",
+        "{\"k\":\"\\ud83dx\"}",
+        "{\"k\":\"\\ude00\"}",
+        "{\"k\":\"\\ude00\\ud83d\"}",
+        "{\"k\":\"\\ud83d\\u0041\"}",
+        "{\"k\":\"\\u12\"}",
+        "{\"k\":\"\\x41\"}",
+    };
+    for (size_t i = 0; i < sizeof(bad) / sizeof(bad[0]); i++) {
+        value = string_member(bad[i], "k");
+        CHECK(value == NULL);
+        do_free(value);
+    }
+}
+
+static void test_malformed(void) {
+    static const char *bad[] = {
+        "{",
+        "}",
+        "[1,2}",
+        "{\"a\":[1,2}",
+        "{\"a\":\"unterminated}",
+        "[[[]]",
+    };
+    for (size_t i = 0; i < BACKEND_COUNT; i++) {
+        if (!json_od_use_backend(backends[i])) {
+            continue;
+        }
+        for (size_t j = 0; j < sizeof(bad) / sizeof(bad[0]); j++) {
+            json_od_doc_t doc = {0};
+            CHECK(json_od_index(&doc, bad[j], strlen(bad[j])) == DO_ERROR_JSON);
+            json_od_doc_free(&doc);
+        }
+    }
+}
+
+static const char droplet_text[] =
+    "{\"id\":3164444,\"name\":\"web \\\"one\\\"\",\"memory\":1024,\"vcpus\":1,\"disk\":25,"
+    "\"locked\":false,\"status\":\"active\",\"kernel\":null,"
+    "\"created_at\":\"2020-07-21T18:37:44Z\",\"features\":[\"backups\",\"ipv6\"],"
+    "\"backup_ids\":[53893572],\"snapshot_ids\":[],"
+    "\"image\":{\"id\":63663980,\"name\":\"20.04 (LTS) x64\",\"slug\":\"ubuntu-20-04-x64\"},"
+    "\"size_slug\":\"s-1vcpu-1gb\","
+    "\"networks\":{\"v4\":[{\"ip_address\":\"10.128.192.124\",\"netmask\":\"255.255.0.0\","
+    "\"gateway\":\"nil\",\"type\":\"private\"}],\"v6\":[]},"
+    "\"region\":{\"name\":\"New York 3\",\"slug\":\"nyc3\",\"available\":true},"
+    "\"tags\":[\"web\",\"env:prod\"],\"volume_ids\":[],"
+    "\"vpc_uuid\":\"760e09ef-dc84-11e8-981e-3cfdfeaae000\"}";
+
+static bool same_string(const char *a, const char *b) {
+    return (!a && !b) || (a && b && strcmp(a, b) == 0);
+}
+
+// Both decoders must fill a droplet the same way
+static void test_droplet_equivalence(void) {
+    cJSON *json = cJSON_Parse(droplet_text);
+    do_droplet_t expected = {0};
+    CHECK(json && json_parse_droplet(json, &expected) == DO_SUCCESS);
+    cJSON_Delete(json);
+    
+    for (size_t i = 0; i < BACKEND_COUNT; i++) {
+        if (!json_od_use_backend(backends[i])) {
+            continue;
+        }
+        json_od_doc_t doc = {0};
+        json_od_value_t root;
+        do_droplet_t droplet = {0};
+        CHECK(json_od_index(&doc, droplet_text, strlen(droplet_text)) == DO_SUCCESS);
+        CHECK(json_od_root(&doc, &root) &&
+              json_od_parse_droplet(&root, &droplet) == DO_SUCCESS);
+        
+        CHECK(droplet.id == expected.id);
+        CHECK(same_string(droplet.name, expected.name));
+        CHECK(same_string(droplet.name, "web \"one\""));
+        CHECK(droplet.memory == expected.memory && droplet.vcpus == expected.vcpus &&
+              droplet.disk == expected.disk && droplet.locked == expected.locked);
+        CHECK(same_string(droplet.status, expected.status));
+        CHECK(droplet.created_at == expected.created_at);
+        CHECK(same_string(droplet.size_slug, expected.size_slug));
+        CHECK(same_string(droplet.vpc_uuid, expected.vpc_uuid));
+        CHECK(droplet.region && expected.region &&
+              same_string(droplet.region->slug, expected.region->slug));
+        CHECK(!droplet.image == !expected.image);
+        CHECK(!droplet.size == !expected.size);
+        CHECK(droplet.tags.count == expected.tags.count);
+        for (size_t t = 0; t < droplet.tags.count && t < expected.tags.count; t++) {
+            CHECK(same_string(droplet.tags.items[t], expected.tags.items[t]));
+        }
+        CHECK(droplet.features.count == expected.features.count);
+        CHECK(droplet.backup_ids_count == expected.backup_ids_count);
+        CHECK(droplet.networks && expected.networks &&
+              droplet.networks->v4_count == expected.networks->v4_count);
+        
+        do_droplet_free(&droplet);
+        json_od_doc_free(&doc);
+    }
+    do_droplet_free(&expected);
+}
+
+int main(void) {
+    test_escapes_across_blocks();
+    test_unicode_escapes();
+    test_malformed();
+    test_droplet_equivalence();
+    return TEST_DONE();
+}
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include <string.h>
+#include "digitalocean/alloc.h"
+#include "json_writer.h"
+#include "test.h"
+
+static bool written(const do_string_t *out, const char *expected) {
+    return out->data && strcmp(out->data, expected) == 0;
+}
+
+static void test_escaping(void) {
+    do_string_t out;
+    do_string_init(&out);
+    json_writer_t writer;
+    
+    json_writer_init(&writer, &out);
+    json_writer_string(&writer, "quote \" backslash \\ slash /");
+    CHECK(written(&out, "\"quote \\\" backslash \\\\ slash /\""));
+    
+    json_writer_init(&writer, &out);
+    json_writer_string(&writer, "a\nb\rc\td");
+    CHECK(written(&out, "\"a\\nb\\rc\\td\""));
+    
+    // Other control characters as \u escapes; UTF-8 passes through
+    json_writer_init(&writer, &out);
+    json_writer_string(&writer, "\x01\x1f\x7f caf\xc3\xa9");
+    CHECK(written(&out, "\"\\u0001\\u001f\x7f caf\xc3\xa9\""));
+    
+    // Keys are escaped the same way
+    json_writer_init(&writer, &out);
+    json_writer_begin_object(&writer);
+    json_writer_key(&writer, "a\"b");
+    json_writer_string(&writer, NULL);
+    json_writer_end_object(&writer);
+    CHECK(written(&out, "{\"a\\\"b\":null}"));
+    CHECK(json_writer_finish(&writer) == DO_SUCCESS);
+    
+    do_string_free(&out);
+}
+
+static void test_commas(void) {
+    do_string_t out;
+    do_string_init(&out);
+    json_writer_t writer;
+    
+    json_writer_init(&writer, &out);
+    json_writer_begin_object(&writer);
+    json_writer_member_string(&writer, "name", "web");
+    json_writer_member_string(&writer, "skipped", NULL);
+    json_writer_key(&writer, "ids");
+    json_writer_begin_array(&writer);
+    json_writer_int(&writer, 1);
+    json_writer_int(&writer, -2);
+    json_writer_begin_object(&writer);
+    json_writer_end_object(&writer);
+    json_writer_begin_array(&writer);
+    json_writer_end_array(&writer);
+    json_writer_end_array(&writer);
+    json_writer_member_bool(&writer, "backups", false);
+    json_writer_key(&writer, "raw");
+    json_writer_raw(&writer, "[1,2]", 5);
+    json_writer_key(&writer, "ratio");
+    json_writer_number(&writer, 0.5);
+    json_writer_end_object(&writer);
+    CHECK(written(&out, "{\"name\":\"web\",\"ids\":[1,-2,{},[]],\"backups\":false,"
+                        "\"raw\":[1,2],\"ratio\":0.5}"));
+    
+    // A buffer reused for a new document starts empty
+    json_writer_init(&writer, &out);
+    json_writer_begin_array(&writer);
+    json_writer_end_array(&writer);
+    CHECK(written(&out, "[]"));
+    
+    do_string_free(&out);
+}
+
+static void test_string_array(void) {
+    do_string_t out;
+    do_string_init(&out);
+    do_string_array_t tags;
+    do_string_array_init(&tags);
+    json_writer_t writer;
+    
+    json_writer_init(&writer, &out);
+    json_writer_begin_object(&writer);
+    json_writer_member_string_array(&writer, "tags", &tags);
+    json_writer_end_object(&writer);
+    CHECK(written(&out, "{}")); // an empty list is left out like a NULL string
+    
+    CHECK(do_string_array_add(&tags, "web") == DO_SUCCESS);
+    CHECK(do_string_array_add(&tags, "env:prod") == DO_SUCCESS);
+    json_writer_init(&writer, &out);
+    json_writer_begin_object(&writer);
+    json_writer_member_string_array(&writer, "tags", &tags);
+    json_writer_member_bool(&writer, "ipv6", true);
+    json_writer_end_object(&writer);
+    CHECK(written(&out, "{\"tags\":[\"web\",\"env:prod\"],\"ipv6\":true}"));
+    
+    do_string_array_free(&tags);
+    do_string_free(&out);
+}
+
+// IDs go out as numbers, slugs and anything too long for one as strings
+static void test_id_or_string(void) {
+    static const struct {
+        const char *value;
+        const char *expected;
+    } cases[] = {
+        {"12345", "[12345]"},
+        {"ubuntu-22-04-x64", "[\"ubuntu-22-04-x64\"]"},
+        {"123abc", "[\"123abc\"]"},
+        {"-1", "[\"-1\"]"},
+        {"", "[\"\"]"},
+        {"123456789012345678", "[123456789012345678]"},
+        {"1234567890123456789", "[\"1234567890123456789\"]"},
+        {NULL, "[null]"},
+    };
+    
+    do_string_t out;
+    do_string_init(&out);
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        json_writer_t writer;
+        json_writer_init(&writer, &out);
+        json_writer_begin_array(&writer);
+        json_writer_id_or_string(&writer, cases[i].value);
+        json_writer_end_array(&writer);
+        CHECK(written(&out, cases[i].expected));
+    }
+    do_string_free(&out);
+}
+
+// Documents appended after one another, as for NDJSON
+static void test_continue(void) {
+    do_string_t out;
+    do_string_init(&out);
+    json_writer_t writer;
+    
+    json_writer_init(&writer, &out);
+    for (int i = 1; i <= 2; i++) {
+        json_writer_continue(&writer, &out);
+        json_writer_begin_object(&writer);
+        json_writer_key(&writer, "id");
+        json_writer_int(&writer, i);
+        json_writer_end_object(&writer);
+        json_writer_newline(&writer);
+    }
+    CHECK(written(&out, "{\"id\":1}\n{\"id\":2}\n"));
+    
+    do_string_free(&out);
+}
+
+static void *failing_malloc(size_t size, void *ctx) {
+    (void)size;
+    (void)ctx;
+    return NULL;
+}
+
+static void *failing_realloc(void *ptr, size_t size, void *ctx) {
+    (void)ptr;
+    (void)size;
+    (void)ctx;
+    return NULL;
+}
+
+static void failing_free(void *ptr, void *ctx) {
+    (void)ptr;
+    (void)ctx;
+}
+
+// A failed allocation sticks until the next document
+static void test_out_of_memory(void) {
+    do_allocator_t failing = {failing_malloc, failing_realloc, failing_free, NULL};
+    do_string_t out;
+    do_string_init(&out);
+    json_writer_t writer;
+    
+    CHECK(do_set_allocator(&failing) == DO_SUCCESS);
+    json_writer_init(&writer, &out);
+    json_writer_string(&writer, "never written");
+    json_writer_int(&writer, 1);
+    CHECK(json_writer_finish(&writer) == DO_ERROR_MEMORY);
+    CHECK(out.length == 0);
+    CHECK(do_set_allocator(NULL) == DO_SUCCESS);
+    
+    json_writer_init(&writer, &out);
+    json_writer_int(&writer, 1);
+    CHECK(json_writer_finish(&writer) == DO_SUCCESS && written(&out, "1"));
+    
+    do_string_free(&out);
+}
+
+int main(void) {
+    test_escaping();
+    test_commas();
+    test_string_array();
+    test_id_or_string();
+    test_continue();
+    test_out_of_memory();
+    return TEST_DONE();
+}
\ No newline at end of file
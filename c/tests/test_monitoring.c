@@ -0,0 +1,157 @@
+#include <math.h>
+#include <stdlib.h>
+#include "digitalocean/monitoring.h"
+#include "test.h"
+
+#define MAX_SAMPLES 256
+
+// A series over caller-owned columns
+static do_metric_series_t series_of(int64_t *timestamps, double *values, size_t count) {
+    do_metric_series_t series = {0};
+    series.labels = "";
+    series.timestamps = timestamps;
+    series.values = values;
+    series.count = count;
+    series.capacity = count;
+    return series;
+}
+
+static int compare_doubles(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// p95 of count values by sorting: the value at rank ceil(0.95 * count)
+static double sorted_p95(const double *values, size_t count) {
+    double sorted[MAX_SAMPLES];
+    for (size_t i = 0; i < count; i++) {
+        sorted[i] = values[i];
+    }
+    qsort(sorted, count, sizeof(double), compare_doubles);
+    return sorted[(count * 95 + 99) / 100 - 1];
+}
+
+static void test_nearest_rank(void) {
+    int64_t timestamps[MAX_SAMPLES];
+    double values[MAX_SAMPLES];
+    for (size_t i = 0; i < MAX_SAMPLES; i++) {
+        timestamps[i] = (int64_t)i;
+    }
+    
+    // 1..n in reverse: rank ceil(0.95 n)
+    static const struct {
+        size_t count;
+        double p95;
+    } ranks[] = {{1, 1}, {2, 2}, {19, 19}, {20, 19}, {21, 20}, {100, 95}, {101, 96}};
+    for (size_t r = 0; r < sizeof(ranks) / sizeof(ranks[0]); r++) {
+        for (size_t i = 0; i < ranks[r].count; i++) {
+            values[i] = (double)(ranks[r].count - i);
+        }
+        do_metric_series_t series = series_of(timestamps, values, ranks[r].count);
+        do_metric_rollup_t rollup;
+        CHECK(do_metric_rollup(&series, 0, MAX_SAMPLES, &rollup) == DO_SUCCESS);
+        CHECK(rollup.count == ranks[r].count && rollup.p95 == ranks[r].p95);
+        CHECK(rollup.min == 1 && rollup.max == (double)ranks[r].count);
+        CHECK(rollup.avg == ((double)ranks[r].count + 1) / 2);
+    }
+    
+    // Selection agrees with sorting on shuffled input, runs of equal values
+    // and negative numbers
+    srand(40);
+    for (size_t count = 1; count <= 200; count += 7) {
+        for (int round = 0; round < 20; round++) {
+            int spread = round % 4 == 0 ? 3 : 1000;
+            for (size_t i = 0; i < count; i++) {
+                values[i] = (double)(rand() % spread - spread / 2);
+            }
+            double expected = sorted_p95(values, count);
+            do_metric_series_t series = series_of(timestamps, values, count);
+            do_metric_rollup_t rollup;
+            CHECK(do_metric_rollup(&series, 0, MAX_SAMPLES, &rollup) == DO_SUCCESS);
+            CHECK(rollup.p95 == expected);
+        }
+    }
+}
+
+static void test_nan_and_window(void) {
+    int64_t timestamps[] = {10, 20, 30, 40, 50};
+    double values[] = {4, NAN, 2, NAN, 8};
+    do_metric_series_t series = series_of(timestamps, values, 5);
+    do_metric_rollup_t rollup;
+    
+    // NaN samples are skipped, not counted as zero
+    CHECK(do_metric_rollup(&series, 0, 100, &rollup) == DO_SUCCESS);
+    CHECK(rollup.count == 3 && rollup.min == 2 && rollup.max == 8);
+    CHECK(rollup.avg == 14.0 / 3 && rollup.p95 == 8);
+    
+    // start is inclusive and end exclusive
+    CHECK(do_metric_rollup(&series, 30, 50, &rollup) == DO_SUCCESS);
+    CHECK(rollup.count == 1 && rollup.min == 2 && rollup.p95 == 2);
+    
+    // Only NaN, or nothing at all, in the window
+    CHECK(do_metric_rollup(&series, 20, 21, &rollup) == DO_SUCCESS);
+    CHECK(rollup.count == 0 && isnan(rollup.min) && isnan(rollup.max) && isnan(rollup.avg) &&
+          isnan(rollup.p95));
+    CHECK(do_metric_rollup(&series, 60, 100, &rollup) == DO_SUCCESS);
+    CHECK(rollup.count == 0 && isnan(rollup.p95));
+    CHECK(do_metric_rollup(&series, 50, 10, &rollup) == DO_SUCCESS && rollup.count == 0);
+    
+    CHECK(do_metric_rollup(NULL, 0, 100, &rollup) == DO_ERROR_INVALID_PARAM);
+}
+
+static void test_downsample(void) {
+    // Buckets of 60 s from 0: [0,60) [60,120) [120,180) [180,240) [240,300)
+    int64_t timestamps[] = {0, 30, 59, 60, 119, 125, 130, 245};
+    double values[] = {1, 5, 3, 7, NAN, NAN, NAN, 9};
+    do_metric_series_t series = series_of(timestamps, values, 8);
+    int64_t out_timestamps[8];
+    double out_values[8];
+    
+    // A sample on the edge opens the next bucket; buckets with no samples,
+    // or only NaN ones, are left out
+    size_t points = do_metric_downsample(&series, 0, 60, DO_METRIC_AGG_AVG, out_timestamps,
+                                         out_values, 8);
+    CHECK(points == 3);
+    CHECK(out_timestamps[0] == 0 && out_values[0] == 3);
+    CHECK(out_timestamps[1] == 60 && out_values[1] == 7);
+    CHECK(out_timestamps[2] == 240 && out_values[2] == 9);
+    
+    static const struct {
+        do_metric_agg_t agg;
+        double first;
+    } aggs[] = {
+        {DO_METRIC_AGG_MIN, 1},
+        {DO_METRIC_AGG_MAX, 5},
+        {DO_METRIC_AGG_AVG, 3},
+        {DO_METRIC_AGG_P95, 5},
+    };
+    for (size_t i = 0; i < sizeof(aggs) / sizeof(aggs[0]); i++) {
+        points = do_metric_downsample(&series, 0, 60, aggs[i].agg, out_timestamps, out_values, 8);
+        CHECK(points == 3 && out_values[0] == aggs[i].first && out_values[2] == 9);
+    }
+    
+    // Buckets are aligned to start, and samples before it are ignored
+    points = do_metric_downsample(&series, 30, 60, DO_METRIC_AGG_MAX, out_timestamps, out_values,
+                                  8);
+    CHECK(points == 2);
+    CHECK(out_timestamps[0] == 30 && out_values[0] == 7);
+    CHECK(out_timestamps[1] == 210 && out_values[1] == 9);
+    
+    // Never more than max_points
+    points = do_metric_downsample(&series, 0, 60, DO_METRIC_AGG_MAX, out_timestamps, out_values,
+                                  2);
+    CHECK(points == 2 && out_timestamps[1] == 60);
+    
+    CHECK(do_metric_downsample(&series, 0, 0, DO_METRIC_AGG_MAX, out_timestamps, out_values,
+                               8) == 0);
+    CHECK(do_metric_downsample(&series, 300, 60, DO_METRIC_AGG_MAX, out_timestamps, out_values,
+                               8) == 0);
+}
+
+int main(void) {
+    test_nearest_rank();
+    test_nan_and_window();
+    test_downsample();
+    return TEST_DONE();
+}
\ No newline at end of file
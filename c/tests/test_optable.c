@@ -0,0 +1,73 @@
+#include <string.h>
+#include "digitalocean/invoke.h"
+#include "test.h"
+
+// Every operation is found again by its own id
+static void test_lookup(void) {
+    size_t count = do_operation_count();
+    CHECK(count > 0);
+    for (size_t i = 0; i < count; i++) {
+        const do_operation_t *op = do_operation_at(i);
+        CHECK(op && do_operation_find(do_operation_id(op)) == op);
+    }
+    CHECK(do_operation_at(count) == NULL);
+    
+    CHECK(do_operation_find("droplets_gets") == NULL);
+    CHECK(do_operation_find("") == NULL);
+    CHECK(do_operation_find(NULL) == NULL);
+    
+    const do_operation_t *op = do_operation_find("droplets_get");
+    CHECK(op && strcmp(do_operation_method(op), "GET") == 0);
+    CHECK(op && strcmp(do_operation_path(op), "/v2/droplets/{droplet_id}") == 0);
+    CHECK(op && do_operation_param_count(op) == 1);
+    if (op && do_operation_param_count(op) == 1) {
+        do_param_info_t param = do_operation_param(op, 0);
+        CHECK(strcmp(param.name, "droplet_id") == 0);
+        CHECK(param.location == DO_PARAM_PATH && param.kind == DO_PARAM_INTEGER);
+        CHECK(param.required);
+    }
+}
+
+static bool valid(const char *op_id, const do_param_t *params, size_t count, const char *body) {
+    char error[256] = "";
+    do_result_t result = do_operation_validate(do_operation_find(op_id), params, count, body,
+                                               error, sizeof(error));
+    CHECK(result == DO_SUCCESS || error[0] != '\0');
+    return result == DO_SUCCESS;
+}
+
+static void test_validate(void) {
+    do_param_t id = {"droplet_id", "3164444"};
+    CHECK(valid("droplets_get", &id, 1, NULL));
+    CHECK(!valid("droplets_get", NULL, 0, NULL));
+    
+    do_param_t not_integer = {"droplet_id", "31x"};
+    CHECK(!valid("droplets_get", &not_integer, 1, NULL));
+    
+    do_param_t unknown[] = {{"droplet_id", "1"}, {"colour", "red"}};
+    CHECK(!valid("droplets_get", unknown, 2, NULL));
+    
+    do_param_t no_value = {"droplet_id", NULL};
+    CHECK(!valid("droplets_get", &no_value, 1, NULL));
+    
+    do_param_t list[] = {{"per_page", "200"}, {"tag_name", "web"}};
+    CHECK(valid("droplets_list", list, 2, NULL));
+    CHECK(!valid("droplets_list", NULL, 0, "{}"));
+    
+    // The body must be a JSON object with the required fields
+    CHECK(valid("droplets_create", NULL, 0, NULL));
+    CHECK(valid("droplets_create", NULL, 0,
+                "{\"name\":\"a\",\"size\":\"s-1vcpu-1gb\",\"image\":\"ubuntu-22-04-x64\"}"));
+    CHECK(!valid("droplets_create", NULL, 0, "{\"name\":\"a\",\"size\":\"s-1vcpu-1gb\"}"));
+    CHECK(!valid("droplets_create", NULL, 0, "[1]"));
+    CHECK(!valid("droplets_create", NULL, 0, "{\"size\":"));
+    CHECK(!valid("tags_create", NULL, 0, NULL));
+    
+    CHECK(do_operation_validate(NULL, NULL, 0, NULL, NULL, 0) == DO_ERROR_INVALID_PARAM);
+}
+
+int main(void) {
+    test_lookup();
+    test_validate();
+    return TEST_DONE();
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <time.h>
+#include <unistd.h>
+#include "digitalocean/http.h"
+#include "digitalocean/config.h"
+#include "digitalocean/alloc.h"
+#include "ratelimit.h"
+#include "test.h"
+
+#define INTERVAL_US (60000000LL / DO_RATE_LIMIT_PER_MINUTE)
+
+// A burst gets the whole minute's allowance at once and no more; the
+// next request is one interval away. Both handles map the same file.
+static void test_minute_burst(void) {
+    do_rate_budget_t *first = NULL;
+    do_rate_budget_t *second = NULL;
+    CHECK(do_rate_budget_open("burst-token", &first) == DO_SUCCESS);
+    CHECK(do_rate_budget_open("burst-token", &second) == DO_SUCCESS);
+    if (!first || !second) {
+        return;
+    }
+    
+    int granted = 0;
+    int64_t wait_us = 0;
+    for (int i = 0; i < DO_RATE_LIMIT_PER_MINUTE + 10; i++) {
+        if (do_rate_budget_reserve(i % 2 ? first : second, &wait_us) == DO_SUCCESS) {
+            granted++;
+        }
+    }
+    // The clock moves during the loop, which may free one more slot
+    CHECK(granted >= DO_RATE_LIMIT_PER_MINUTE && granted <= DO_RATE_LIMIT_PER_MINUTE + 1);
+    CHECK(do_rate_budget_reserve(first, &wait_us) == DO_ERROR_RATE_LIMIT);
+    CHECK(wait_us > 0 && wait_us <= INTERVAL_US);
+    
+    // Another token has its own budget
+    do_rate_budget_t *other = NULL;
+    CHECK(do_rate_budget_open("other-token", &other) == DO_SUCCESS);
+    CHECK(other && do_rate_budget_reserve(other, &wait_us) == DO_SUCCESS && wait_us == 0);
+    
+    do_rate_budget_close(other);
+    do_rate_budget_close(second);
+    do_rate_budget_close(first);
+}
+
+static void test_hourly_budget(void) {
+    do_rate_budget_t *budget = NULL;
+    CHECK(do_rate_budget_open("hour-token", &budget) == DO_SUCCESS);
+    if (!budget) {
+        return;
+    }
+    
+    int64_t now = (int64_t)time(NULL);
+    int64_t reset = now + 3600;
+    int64_t wait_us = 0;
+    do_rate_budget_update(budget, 3, reset);
+    for (int i = 0; i < 3; i++) {
+        CHECK(do_rate_budget_reserve(budget, &wait_us) == DO_SUCCESS);
+    }
+    CHECK(do_rate_budget_reserve(budget, &wait_us) == DO_ERROR_RATE_LIMIT);
+    CHECK(wait_us > 3500 * 1000000LL && wait_us <= 3600 * 1000000LL);
+    
+    // Waiting until the reset is not worth blocking for
+    CHECK(do_rate_budget_acquire(budget) == DO_ERROR_RATE_LIMIT);
+    
+    // A late response for the same window or an older one gives nothing back
+    do_rate_budget_update(budget, 100, reset);
+    do_rate_budget_update(budget, 100, reset - 60);
+    CHECK(do_rate_budget_reserve(budget, &wait_us) == DO_ERROR_RATE_LIMIT);
+    
+    // Out-of-range reports are dropped
+    do_rate_budget_update(budget, -1, reset + 60);
+    do_rate_budget_update(budget, 100, 0);
+    do_rate_budget_update(budget, 100, (int64_t)UINT32_MAX + 1);
+    CHECK(do_rate_budget_reserve(budget, &wait_us) == DO_ERROR_RATE_LIMIT);
+    
+    // A new window starts a new count
+    do_rate_budget_update(budget, 1, reset + 60);
+    CHECK(do_rate_budget_reserve(budget, &wait_us) == DO_SUCCESS);
+    CHECK(do_rate_budget_reserve(budget, &wait_us) == DO_ERROR_RATE_LIMIT);
+    
+    do_rate_budget_close(budget);
+    
+    // Once the reset has passed the count is stale and no longer enforced
+    CHECK(do_rate_budget_open("stale-token", &budget) == DO_SUCCESS);
+    if (budget) {
+        do_rate_budget_update(budget, 0, now - 10);
+        CHECK(do_rate_budget_reserve(budget, &wait_us) == DO_SUCCESS);
+        do_rate_budget_close(budget);
+    }
+}
+
+// Requests refused for a spent hour must not use up the minute's slots
+static void test_spent_hour_keeps_minute(void) {
+    do_rate_budget_t *budget = NULL;
+    CHECK(do_rate_budget_open("spent-token", &budget) == DO_SUCCESS);
+    if (!budget) {
+        return;
+    }
+    
+    int64_t reset = (int64_t)time(NULL) + 3600;
+    int64_t wait_us = 0;
+    do_rate_budget_update(budget, 0, reset);
+    for (int i = 0; i < DO_RATE_LIMIT_PER_MINUTE; i++) {
+        CHECK(do_rate_budget_reserve(budget, &wait_us) == DO_ERROR_RATE_LIMIT);
+    }
+    
+    // The next window finds the whole minute's allowance still there
+    do_rate_budget_update(budget, 1000, reset + 60);
+    int granted = 0;
+    for (int i = 0; i < DO_RATE_LIMIT_PER_MINUTE; i++) {
+        if (do_rate_budget_reserve(budget, &wait_us) == DO_SUCCESS) {
+            granted++;
+        }
+    }
+    CHECK(granted == DO_RATE_LIMIT_PER_MINUTE);
+    
+    do_rate_budget_close(budget);
+}
+
+// The budgets live under $HOME/.config/do-cli; point HOME at a scratch
+// directory so the test neither sees nor touches the user's
+static void remove_tree(const char *home) {
+    char *config_dir = do_config_get_config_dir();
+    DIR *dir = config_dir ? opendir(config_dir) : NULL;
+    struct dirent *entry;
+    while (dir && (entry = readdir(dir))) {
+        char path[4096];
+        if (strncmp(entry->d_name, "ratelimit-", 10) == 0 &&
+            snprintf(path, sizeof(path), "%s/%s", config_dir, entry->d_name) <
+                (int)sizeof(path)) {
+            unlink(path);
+        }
+    }
+    if (dir) {
+        closedir(dir);
+        rmdir(config_dir);
+    }
+    do_free(config_dir);
+    
+    char path[4096];
+    snprintf(path, sizeof(path), "%s/.config", home);
+    rmdir(path);
+    rmdir(home);
+}
+
+int main(void) {
+    char home[] = "/tmp/do-test-XXXXXX";
+    if (!mkdtemp(home) || setenv("HOME", home, 1) != 0) {
+        perror("mkdtemp");
+        return 1;
+    }
+    
+    test_minute_burst();
+    test_hourly_budget();
+    test_spent_hour_keeps_minute();
+    
+    remove_tree(home);
+    return TEST_DONE();
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+#define _GNU_SOURCE
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include "digitalocean/client.h"
+#include "digitalocean/config.h"
+#include "test.h"
+#include "test_server.h"
+
+// A local API serving two pages of /v2/droplets. Each fleet below is the
+// listing as the refresh should see it; which one is served is switched
+// between refreshes.
+#define DROPLET(id, name) "{\"id\":" #id ",\"name\":\"" name "\",\"status\":\"active\"}"
+
+typedef struct {
+    const char *first;
+    const char *second; // NULL for a one-page listing
+    int status;
+} fleet_t;
+
+static const fleet_t fleets[] = {
+    // Starting point
+    {DROPLET(1, "web-1") "," DROPLET(2, "web-2"), DROPLET(3, "db-1"), 200},
+    // web-2 renamed, db-1 gone, cache-1 new; web-1 is listed again on the
+    // second page, as when the fleet shifts while paging
+    {DROPLET(1, "web-1") "," DROPLET(2, "web-2b"),
+     DROPLET(1, "web-1") "," DROPLET(4, "cache-1"), 200},
+    // An error body must not read as an empty fleet
+    {"", NULL, 401},
+};
+
+static _Atomic int serving;
+static test_server_t server;
+
+static void respond(int fd, const char *method, const char *target, const char *body_in,
+                    void *userdata) {
+    (void)method;
+    (void)body_in;
+    (void)userdata;
+    const fleet_t *fleet = &fleets[atomic_load(&serving)];
+    bool second = strstr(target, "?page=2&") != NULL;
+    
+    char body[1024];
+    if (fleet->status != 200) {
+        snprintf(body, sizeof(body), "{\"id\":\"unauthorized\",\"message\":\"no\"}");
+    } else if (!second && fleet->second) {
+        snprintf(body, sizeof(body),
+                 "{\"droplets\":[%s],\"links\":{\"pages\":{\"next\":"
+                 "\"http://127.0.0.1:%d/v2/droplets?page=2&per_page=200\"}},\"meta\":{}}",
+                 fleet->first, server.port);
+    } else {
+        snprintf(body, sizeof(body), "{\"droplets\":[%s],\"links\":{},\"meta\":{}}",
+                 second ? fleet->second : fleet->first);
+    }
+    test_server_respond(fd, fleet->status, body);
+}
+
+static const do_droplet_t *find(const do_droplet_list_t *list, uint32_t id) {
+    for (size_t i = 0; i < list->count; i++) {
+        if (list->items[i].id == id) {
+            return &list->items[i];
+        }
+    }
+    return NULL;
+}
+
+static void test_refresh(do_client_t *client) {
+    do_droplet_list_t *list = NULL;
+    do_droplet_changes_t changes;
+    
+    // From scratch every droplet is new
+    atomic_store(&serving, 0);
+    CHECK(do_droplet_list_refresh(client, &list, &changes) == DO_SUCCESS);
+    if (!list) {
+        return;
+    }
+    CHECK(list->count == 3 && list->hashes);
+    CHECK(changes.added_count == 3 && changes.modified_count == 0 && changes.removed_count == 0);
+    CHECK(changes.added_count == 3 && changes.added[0] == 1 && changes.added[2] == 3);
+    do_droplet_changes_free(&changes);
+    
+    // Nothing changed: no changes, and the structs are carried over as they are
+    const char *name = find(list, 1) ? find(list, 1)->name : NULL;
+    CHECK(do_droplet_list_refresh(client, &list, &changes) == DO_SUCCESS);
+    CHECK(list->count == 3);
+    CHECK(changes.added_count == 0 && changes.modified_count == 0 && changes.removed_count == 0);
+    CHECK(find(list, 1) && find(list, 1)->name == name);
+    do_droplet_changes_free(&changes);
+    
+    atomic_store(&serving, 1);
+    CHECK(do_droplet_list_refresh(client, &list, &changes) == DO_SUCCESS);
+    CHECK(list->count == 3 && find(list, 1) && find(list, 2) && find(list, 4) && !find(list, 3));
+    CHECK(find(list, 2) && strcmp(find(list, 2)->name, "web-2b") == 0);
+    CHECK(find(list, 1) && find(list, 1)->name == name);
+    CHECK(changes.added_count == 1 && changes.added[0] == 4);
+    CHECK(changes.modified_count == 1 && changes.modified[0] == 2);
+    CHECK(changes.removed_count == 1 && changes.removed[0].id == 3 &&
+          strcmp(changes.removed[0].name, "db-1") == 0);
+    do_droplet_changes_free(&changes);
+    
+    // A failed refresh leaves the list alone
+    atomic_store(&serving, 2);
+    CHECK(do_droplet_list_refresh(client, &list, NULL) == DO_ERROR_AUTH);
+    CHECK(list->count == 3 && find(list, 2) && strcmp(find(list, 2)->name, "web-2b") == 0);
+    
+    do_droplet_list_free(list);
+}
+
+int main(void) {
+    if (!test_server_start(&server, respond, NULL)) {
+        return 1;
+    }
+    
+    char base_url[64];
+    snprintf(base_url, sizeof(base_url), "http://127.0.0.1:%d", server.port);
+    do_config_t *config = do_config_new();
+    do_client_t *client = do_client_new();
+    if (!config || !client || do_config_set_token(config, "token") != DO_SUCCESS ||
+        do_config_set_base_url(config, base_url) != DO_SUCCESS ||
+        do_client_init(client, config) != DO_SUCCESS) {
+        fprintf(stderr, "client setup failed\n");
+        return 1;
+    }
+    
+    test_refresh(client);
+    
+    do_client_free(client); // frees the config too
+    test_server_stop(&server);
+    return TEST_DONE();
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#ifndef DO_TEST_SERVER_H
+#define DO_TEST_SERVER_H
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+// A loopback HTTP server for tests that go through the client. Requests
+// are served one connection at a time on a thread of their own; the
+// handler answers each with test_server_respond(). Every response closes
+// its connection.
+typedef void (*test_server_handler_t)(int fd, const char *method, const char *target,
+                                      const char *body, void *userdata);
+
+typedef struct {
+    int listen_fd;
+    int port;
+    pthread_t thread;
+    test_server_handler_t handler;
+    void *userdata;
+} test_server_t;
+
+static void test_server_respond(int fd, int status, const char *body) {
+    char head[256];
+    int len = snprintf(head, sizeof(head),
+                       "HTTP/1.1 %d X\r\nContent-Type: application/json\r\n"
+                       "Content-Length: %zu\r\nConnection: close\r\n\r\n",
+                       status, strlen(body));
+    if (write(fd, head, (size_t)len) != len ||
+        write(fd, body, strlen(body)) != (ssize_t)strlen(body)) {
+        perror("write");
+    }
+}
+
+// Reads one request: the head, then Content-Length bytes of body
+static void test_server_handle(test_server_t *server, int fd) {
+    static char request[1 << 16];
+    size_t length = 0;
+    const char *body = NULL;
+    size_t body_length = 0;
+    
+    ssize_t n;
+    while (length < sizeof(request) - 1 &&
+           (n = read(fd, request + length, sizeof(request) - 1 - length)) > 0) {
+        length += (size_t)n;
+        request[length] = '\0';
+        
+        char *end = strstr(request, "\r\n\r\n");
+        if (!body && end) {
+            body = end + 4;
+            const char *header = strstr(request, "Content-Length:");
+            body_length = header && header < end ? strtoul(header + 15, NULL, 10) : 0;
+            
+            // libcurl holds back bigger bodies until it is told to go on
+            const char *expect = strstr(request, "Expect: 100-continue");
+            if (expect && expect < end &&
+                write(fd, "HTTP/1.1 100 Continue\r\n\r\n", 25) != 25) {
+                return;
+            }
+        }
+        if (body && (size_t)(request + length - body) >= body_length) {
+            break;
+        }
+    }
+    if (!body) {
+        return;
+    }
+    
+    // "METHOD target HTTP/1.1"
+    char method[16] = "";
+    char target[1024] = "";
+    if (sscanf(request, "%15s %1023s", method, target) == 2) {
+        server->handler(fd, method, target, body, server->userdata);
+    }
+}
+
+static void *test_server_run(void *arg) {
+    test_server_t *server = arg;
+    int fd;
+    while ((fd = accept(server->listen_fd, NULL, NULL)) >= 0) {
+        test_server_handle(server, fd);
+        close(fd);
+    }
+    return NULL;
+}
+
+static bool test_server_start(test_server_t *server, test_server_handler_t handler,
+                              void *userdata) {
+    struct sockaddr_in address = {0};
+    socklen_t address_len = sizeof(address);
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    
+    server->handler = handler;
+    server->userdata = userdata;
+    server->listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (server->listen_fd < 0 ||
+        bind(server->listen_fd, (struct sockaddr *)&address, sizeof(address)) != 0 ||
+        listen(server->listen_fd, 64) != 0 ||
+        getsockname(server->listen_fd, (struct sockaddr *)&address, &address_len) != 0) {
+        perror("test server");
+        return false;
+    }
+    server->port = ntohs(address.sin_port);
+    return pthread_create(&server->thread, NULL, test_server_run, server) == 0;
+}
+
+static void test_server_stop(test_server_t *server) {
+    shutdown(server->listen_fd, SHUT_RDWR);
+    pthread_join(server->thread, NULL);
+    close(server->listen_fd);
+}
+
+#endif // DO_TEST_SERVER_H
\ No newline at end of file
@@ -0,0 +1,139 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "digitalocean/client.h"
+#include "digitalocean/config.h"
+#include "test.h"
+#include "test_server.h"
+
+#define ID_COUNT 450
+#define MAX_REQUESTS 16
+
+// What the server saw. Requests are handled one at a time on the server
+// thread and read once the client call has returned.
+typedef struct {
+    size_t requests;
+    char methods[MAX_REQUESTS][8];
+    char targets[MAX_REQUESTS][128];
+    size_t largest_chunk;
+    unsigned seen[ID_COUNT + 1];  // times each id was sent
+    const char *failing_id;       // a chunk holding this id gets a 500
+} tag_log_t;
+
+static void handle(int fd, const char *method, const char *target, const char *body,
+                   void *userdata) {
+    tag_log_t *log = userdata;
+    if (log->requests < MAX_REQUESTS) {
+        snprintf(log->methods[log->requests], sizeof(log->methods[0]), "%s", method);
+        snprintf(log->targets[log->requests], sizeof(log->targets[0]), "%s", target);
+    }
+    log->requests++;
+    
+    size_t chunk = 0;
+    bool failing = false;
+    for (const char *p = body; (p = strstr(p, "\"resource_id\":\"")); chunk++) {
+        p += strlen("\"resource_id\":\"");
+        unsigned long id = strtoul(p, NULL, 10);
+        if (id <= ID_COUNT) {
+            log->seen[id]++;
+        }
+        size_t len = strcspn(p, "\"");
+        failing |= log->failing_id && strlen(log->failing_id) == len &&
+                   strncmp(p, log->failing_id, len) == 0;
+        if (strncmp(p + len, "\",\"resource_type\":\"droplet\"}", 28) != 0) {
+            chunk = 0; // malformed; fails the size check
+            break;
+        }
+    }
+    if (chunk > log->largest_chunk) {
+        log->largest_chunk = chunk;
+    }
+    
+    if (strcmp(target, "/v2/tags") == 0) {
+        test_server_respond(fd, 201, "{\"tag\":{\"name\":\"x\"}}");
+    } else {
+        test_server_respond(fd, failing ? 500 : 204, "");
+    }
+}
+
+static bool each_id_once(const tag_log_t *log) {
+    for (size_t id = 1; id <= ID_COUNT; id++) {
+        if (log->seen[id] != 1) {
+            return false;
+        }
+    }
+    return log->seen[0] == 0;
+}
+
+static void test_chunks(do_client_t *client, tag_log_t *log, const char *const *ids) {
+    // 450 ids go out as 200 + 200 + 50, each exactly once
+    memset(log, 0, sizeof(*log));
+    CHECK(do_client_tag_resources(client, "web", "droplet", ids, ID_COUNT) == DO_SUCCESS);
+    CHECK(log->requests == 3 && log->largest_chunk == DO_TAG_CHUNK_SIZE);
+    CHECK(each_id_once(log));
+    for (size_t i = 0; i < 3 && i < log->requests; i++) {
+        CHECK(strcmp(log->methods[i], "POST") == 0);
+        CHECK(strcmp(log->targets[i], "/v2/tags/web/resources") == 0);
+    }
+    
+    // An exact multiple leaves no empty chunk behind
+    memset(log, 0, sizeof(*log));
+    CHECK(do_client_untag_resources(client, "web", "droplet", ids, 2 * DO_TAG_CHUNK_SIZE) ==
+          DO_SUCCESS);
+    CHECK(log->requests == 2 && log->largest_chunk == DO_TAG_CHUNK_SIZE);
+    CHECK(strcmp(log->methods[0], "DELETE") == 0 && strcmp(log->methods[1], "DELETE") == 0);
+    
+    // One id is one request, none is none
+    memset(log, 0, sizeof(*log));
+    CHECK(do_client_tag_resources(client, "a b/c", "droplet", ids, 1) == DO_SUCCESS);
+    CHECK(log->requests == 1 && log->largest_chunk == 1 && log->seen[1] == 1);
+    CHECK(strcmp(log->targets[0], "/v2/tags/a%20b%2Fc/resources") == 0);
+    
+    memset(log, 0, sizeof(*log));
+    CHECK(do_client_tag_resources(client, "web", "droplet", ids, 0) == DO_SUCCESS);
+    CHECK(log->requests == 0);
+    
+    // A failed chunk does not stop the others; its error comes back at the end
+    memset(log, 0, sizeof(*log));
+    log->failing_id = "201";
+    CHECK(do_client_tag_resources(client, "web", "droplet", ids, ID_COUNT) == DO_ERROR_HTTP);
+    CHECK(log->requests == 3 && each_id_once(log));
+    
+    const char *with_null[] = {"1", NULL};
+    CHECK(do_client_tag_resources(client, "web", "droplet", with_null, 2) ==
+          DO_ERROR_INVALID_PARAM);
+    CHECK(do_client_tag_resources(client, "", "droplet", ids, 1) == DO_ERROR_INVALID_PARAM);
+}
+
+int main(void) {
+    static tag_log_t log;
+    test_server_t server;
+    if (!test_server_start(&server, handle, &log)) {
+        return 1;
+    }
+    
+    static char id_text[ID_COUNT][8];
+    static const char *ids[ID_COUNT];
+    for (size_t i = 0; i < ID_COUNT; i++) {
+        snprintf(id_text[i], sizeof(id_text[i]), "%zu", i + 1);
+        ids[i] = id_text[i];
+    }
+    
+    char base_url[64];
+    snprintf(base_url, sizeof(base_url), "http://127.0.0.1:%d", server.port);
+    do_config_t *config = do_config_new();
+    do_client_t *client = do_client_new();
+    if (!config || !client || do_config_set_token(config, "token") != DO_SUCCESS ||
+        do_config_set_base_url(config, base_url) != DO_SUCCESS ||
+        do_client_init(client, config) != DO_SUCCESS) {
+        fprintf(stderr, "client setup failed\n");
+        return 1;
+    }
+    
+    test_chunks(client, &log, ids);
+    
+    do_client_free(client); // frees the config too
+    test_server_stop(&server);
+    return TEST_DONE();
+}
\ No newline at end of file